@@ -0,0 +1,472 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Core_CM4.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Core_CM4.h
+    Cortex-M4 core helpers: interrupt masking, low power, byte reverse, RAM functions and alignment.
+    Moved out of cStartup_file.c so every BSW module can use them.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CORE_CM4_H
+#define CORE_CM4_H
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "S32K144.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief  INT_VECTOR_Reg
+ *
+ *   Register in which the start of vector table needs to be configured
+ */
+#define INT_VECTOR_Reg S32_SCB->VTOR
+
+/** \brief  BKPT_ASM
+ *
+ *   Macro to be used to trigger an debug interrupt
+ */
+#if defined (HOST_BUILD)
+#define BKPT_ASM __builtin_trap()
+#else
+#define BKPT_ASM __asm("BKPT #0\n\t")
+#endif
+
+
+/** \brief  Enable FPU
+ *
+ *   ENABLE_FPU indicates whether SystemInit will enable the Floating point unit (FPU)
+ */
+#if defined (__GNUC__)
+#if defined (__VFP_FP__) && !defined (__SOFTFP__)
+#define ENABLE_FPU
+#endif
+
+#elif defined (__ICCARM__)
+#if defined __ARMVFP__
+#define ENABLE_FPU
+#endif
+
+#elif defined (__ghs__) || defined (__DCC__)
+#if defined (__VFP__)
+#define ENABLE_FPU
+#endif
+
+#elif defined (__CSMC__)
+#if (__CSMC__ & 0x400U) /* bit 10: set if hardware FPU selected (+fpu) */
+#define ENABLE_FPU
+#endif
+#endif /* if defined (__GNUC__) */
+
+
+/** \brief  Host builds: the only interrupt is the SIGALRM tick of the Os host port (Os_Port_Host.c), the
+ *   interrupt macros below block and unblock it and STANDBY() waits for it.
+ */
+#if defined (HOST_BUILD)
+extern u32bit Os_PortDisableInterrupts(void);
+extern void   Os_PortRestoreInterrupts(u32bit state);
+extern void   Os_PortStandby(void);
+#endif
+
+
+/** \brief  Enable interrupts
+ */
+#if defined (HOST_BUILD)
+#define ENABLE_INTERRUPTS() Os_PortRestoreInterrupts(0u)
+#elif defined (__GNUC__)
+#define ENABLE_INTERRUPTS() __asm volatile ("cpsie i" : : : "memory");
+#else
+#define ENABLE_INTERRUPTS() __asm("cpsie i")
+#endif
+
+
+/** \brief  Disable interrupts
+ */
+#if defined (HOST_BUILD)
+#define DISABLE_INTERRUPTS() ((void)Os_PortDisableInterrupts())
+#elif defined (__GNUC__)
+#define DISABLE_INTERRUPTS() __asm volatile ("cpsid i" : : : "memory");
+#else
+#define DISABLE_INTERRUPTS() __asm("cpsid i")
+#endif
+
+
+/** \brief  Save and mask interrupts, nestable
+ *   SUSPEND_INTERRUPTS(state) stores the previous PRIMASK in the u32bit state and masks interrupts,
+ *   RESUME_INTERRUPTS(state) restores it, so interrupts stay masked when they already were.
+ */
+#if defined (HOST_BUILD)
+#define SUSPEND_INTERRUPTS(state) ((state) = Os_PortDisableInterrupts())
+#define RESUME_INTERRUPTS(state)  Os_PortRestoreInterrupts(state)
+#elif defined (__GNUC__)
+#define SUSPEND_INTERRUPTS(state) __asm volatile ("mrs %0, primask \n\t" \
+                                                  "cpsid i" : "=r" (state) : : "memory")
+#define RESUME_INTERRUPTS(state)  __asm volatile ("msr primask, %0" : : "r" (state) : "memory")
+#endif
+
+
+/** \brief  Enter low-power standby state
+ *    WFI (Wait For Interrupt) makes the processor suspend execution (Clock is stopped) until an IRQ interrupts.
+ */
+#if defined (HOST_BUILD)
+#define STANDBY() Os_PortStandby()
+#elif defined (__GNUC__)
+#define STANDBY() __asm volatile ("wfi")
+#else
+#define STANDBY() __asm("wfi")
+#endif
+
+
+/** \brief  Reverse byte order in a word.
+ */
+#if (defined (__GNUC__) || defined (__ICCARM__) || defined (__ghs__)) && !defined (HOST_BUILD)
+#define REV_BYTES_32(a, b) __asm volatile ("rev %0, %1" : "=r" (b) : "r" (a))
+#else
+#define REV_BYTES_32(a, b) (b = ((a & 0xFF000000U) >> 24U) | ((a & 0xFF0000U) >> 8U) \
+                                | ((a & 0xFF00U) << 8U) | ((a & 0xFFU) << 24U))
+#endif
+
+/** \brief  Reverse byte order in each halfword independently.
+ */
+#if (defined (__GNUC__) || defined (__ICCARM__) || defined (__ghs__)) && !defined (HOST_BUILD)
+#define REV_BYTES_16(a, b) __asm volatile ("rev16 %0, %1" : "=r" (b) : "r" (a))
+#else
+#define REV_BYTES_16(a, b) (b = ((a & 0xFF000000U) >> 8U) | ((a & 0xFF0000U) << 8U) \
+                                | ((a & 0xFF00U) >> 8U) | ((a & 0xFFU) << 8U))
+#endif
+
+/** \brief  Reverse bit order of value.
+ */
+#if (defined (__GNUC__) || defined (__ICCARM__) || defined (__ghs__)) && !defined (HOST_BUILD)
+#define REV_BITS_32(a, b) __asm volatile ("rbit %0, %1" : "=r" (b) : "r" (a))
+#else
+#define REV_BITS_32(a, b) do { u32bit rbit_ = (a);                                                      \
+                                rbit_ = ((rbit_ >> 1U) & 0x55555555U) | ((rbit_ & 0x55555555U) << 1U);  \
+                                rbit_ = ((rbit_ >> 2U) & 0x33333333U) | ((rbit_ & 0x33333333U) << 2U);  \
+                                rbit_ = ((rbit_ >> 4U) & 0x0F0F0F0FU) | ((rbit_ & 0x0F0F0F0FU) << 4U);  \
+                                REV_BYTES_32(rbit_, b); } while (0)
+#endif
+
+/** \brief  Places a function in RAM.
+ */
+#if defined ( __GNUC__ )
+    #define START_FUNCTION_DECLARATION_RAMSECTION
+    #define END_FUNCTION_DECLARATION_RAMSECTION        __attribute__((section (".code_ram")));
+#elif defined ( __ghs__ )
+    #define START_FUNCTION_DECLARATION_RAMSECTION      _Pragma("ghs callmode=far")
+    #define END_FUNCTION_DECLARATION_RAMSECTION        __attribute__((section (".code_ram")));\
+                                                       _Pragma("ghs callmode=default")
+#elif defined ( __ICCARM__ )
+    #define START_FUNCTION_DECLARATION_RAMSECTION      __ramfunc
+    #define END_FUNCTION_DECLARATION_RAMSECTION        ;
+#elif defined ( __DCC__ )
+    #define START_FUNCTION_DECLARATION_RAMSECTION      _Pragma("section CODE \".code_ram\"") \
+                                                       _Pragma("use_section CODE")
+    #define END_FUNCTION_DECLARATION_RAMSECTION        ; \
+                                                       _Pragma("section CODE \".text\"")
+#elif defined ( __CSMC__ )
+    #define START_FUNCTION_DECLARATION_RAMSECTION      @ext
+    #define END_FUNCTION_DECLARATION_RAMSECTION        ;
+#else
+    /* Keep compatibility with software analysis tools */
+    #define START_FUNCTION_DECLARATION_RAMSECTION
+    #define END_FUNCTION_DECLARATION_RAMSECTION        ;
+#endif
+
+#if defined ( __CSMC__ )
+    #define START_FUNCTION_DEFINITION_RAMSECTION       _Pragma("section (code_ram)")
+    #define END_FUNCTION_DEFINITION_RAMSECTION         _Pragma("section ()")
+#else
+    /* For GCC, IAR, GHS and Diab there is no need to specify the section when
+    defining a function, it is enough to specify it at the declaration. This
+    also enables compatibility with software analysis tools. */
+    #define START_FUNCTION_DEFINITION_RAMSECTION
+    #define END_FUNCTION_DEFINITION_RAMSECTION
+#endif
+
+#if defined (__ICCARM__)
+    #define DISABLE_CHECK_RAMSECTION_FUNCTION_CALL     _Pragma("diag_suppress=Ta022")
+    #define ENABLE_CHECK_RAMSECTION_FUNCTION_CALL      _Pragma("diag_default=Ta022")
+#else
+    #define DISABLE_CHECK_RAMSECTION_FUNCTION_CALL
+    #define ENABLE_CHECK_RAMSECTION_FUNCTION_CALL
+#endif
+
+
+/** \brief  Weak symbol, default implementation that can be replaced by a driver.
+ */
+#if defined ( __GNUC__ ) || defined ( __ghs__ ) || defined ( __DCC__ )
+    #define WEAK            __attribute__((weak))
+#elif defined ( __ICCARM__ )
+    #define WEAK            __weak
+#else
+    /* Keep compatibility with software analysis tools */
+    #define WEAK
+#endif
+
+/** \brief  Data alignment.
+ */
+#if defined ( __GNUC__ ) || defined ( __ghs__ ) || defined ( __DCC__ )
+    #define ALIGNED(x)      __attribute__((aligned(x)))
+#elif defined ( __ICCARM__ )
+    #define stringify(s) tostring(s)
+    #define tostring(s) #s
+    #define ALIGNED(x)      _Pragma(stringify(data_alignment=x))
+#else
+    /* Keep compatibility with software analysis tools */
+    #define ALIGNED(x)
+#endif
+
+/** \brief  Data placement, see the RAM layout in settings/linker.
+ *   SRAM_L (m_data) is reached by the core through the code bus, SRAM_U (m_data_2) through the system bus
+ *   shared with DMA. FAST_DATA/FAST_BSS keep hot CPU only state in SRAM_L, away from DMA traffic,
+ *   DMA_BUFFER keeps DMA transfers in SRAM_U, away from the data and .code_ram fetches of the core.
+ *   NO_INIT variables are not loaded and keep their value over a warm reset (Startup_Warm.h), init_data_bss
+ *   only clears them on a cold reset.
+ */
+#if defined ( __GNUC__ ) || defined ( __ghs__ ) || defined ( __DCC__ )
+    #define FAST_DATA       __attribute__((section (".data.fast")))  /* Initialized, SRAM_L */
+    #define FAST_BSS        __attribute__((section (".bss.fast")))   /* Zeroed, SRAM_L */
+    #define DMA_BUFFER      __attribute__((section (".bss.dma")))    /* Zeroed, SRAM_U */
+    #define NO_INIT         __attribute__((section (".noinit")))     /* Kept over warm resets, SRAM_U */
+#elif defined ( __ICCARM__ )
+    #define FAST_DATA       _Pragma("location=\".data.fast\"")
+    #define FAST_BSS        _Pragma("location=\".bss.fast\"")
+    #define DMA_BUFFER      _Pragma("location=\".bss.dma\"")
+    #define NO_INIT         __no_init
+#else
+    /* Keep compatibility with software analysis tools */
+    #define FAST_DATA
+    #define FAST_BSS
+    #define DMA_BUFFER
+    #define NO_INIT
+#endif
+
+/** \brief  Function left out of -finstrument-functions profiling (the profiling hooks themselves).
+ */
+#if defined ( __GNUC__ )
+    #define NO_INSTRUMENT   __attribute__((no_instrument_function))
+#else
+    #define NO_INSTRUMENT
+#endif
+
+/** \brief  Endianness.
+ */
+#define CORE_LITTLE_ENDIAN
+
+/** \brief  Atomic compare and swap of a word, TRUE when *addr was expected and is now desired.
+ *   GCC emits an LDREX/STREX loop on Cortex-M4. Any exception clears the exclusive monitor, so the
+ *   operation is safe between tasks and ISRs of any priority without masking interrupts.
+ */
+#if defined (__GNUC__)
+static inline boolean Core_CompareAndSwap(volatile u32bit * addr, u32bit expected, u32bit desired)
+{
+    return (__atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) != 0) ?
+           TRUE : FALSE;
+}
+#endif
+
+/** \brief  Atomic add, returns the new value.
+ */
+#if defined (__GNUC__)
+static inline u32bit Core_AtomicAdd(volatile u32bit * addr, u32bit value)
+{
+    return __atomic_add_fetch(addr, value, __ATOMIC_ACQ_REL);
+}
+#endif
+
+/** \brief  Ordered word access for lock-free producer/consumer hand over.
+ *   Core_StoreRelease makes every previous write visible before the word, Core_LoadAcquire keeps later
+ *   reads after it. A DMB on Cortex-M4, needed for the host build where both sides are threads.
+ */
+#if defined (__GNUC__)
+static inline u32bit Core_LoadAcquire(const volatile u32bit * addr)
+{
+    return __atomic_load_n(addr, __ATOMIC_ACQUIRE);
+}
+
+static inline void Core_StoreRelease(volatile u32bit * addr, u32bit value)
+{
+    __atomic_store_n(addr, value, __ATOMIC_RELEASE);
+}
+
+/** \brief  Keep every previous read before the following ones (reader side of a sequence counter).
+ */
+static inline void Core_ReadFence(void)
+{
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+#endif
+
+/** \brief  DSP extension (SIMD on halfwords, saturating arithmetic).
+ *   Halfword pairs travel packed in a word, low half first. Without the DSP extension (host builds) the
+ *   C versions below give bit exact results.
+ */
+#define CORE_LO16(x)        ((s16bit)(u16bit)((u32bit)(x) & 0xFFFFu))
+#define CORE_HI16(x)        ((s16bit)(u16bit)(((u32bit)(x) >> 16) & 0xFFFFu))
+
+/*Two halfwords packed in a word (PKHBT)*/
+static inline u32bit Core_Pack16(s16bit lo, s16bit hi)
+{
+    return ((u32bit)(u16bit)lo) | (((u32bit)(u16bit)hi) << 16);
+}
+
+/*Saturation to the signed 32 and 16 bit ranges*/
+static inline s32bit Core_Ssat32(s64bit value)
+{
+    return (value > 2147483647LL) ? (s32bit)2147483647LL :
+           ((value < -2147483648LL) ? (s32bit)(-2147483648LL) : (s32bit)value);
+}
+
+static inline s16bit Core_Ssat16(s32bit value)
+{
+    return (value > 32767L) ? (s16bit)32767 : ((value < -32768L) ? (s16bit)(-32768) : (s16bit)value);
+}
+
+#if defined (__GNUC__) && defined (__ARM_FEATURE_DSP)
+/*Saturating 32 bit add*/
+static inline s32bit Core_Qadd(s32bit a, s32bit b)
+{
+    s32bit result;
+
+    __asm ("qadd %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+    return result;
+}
+
+/*Saturating subtract of both halfwords*/
+static inline u32bit Core_Qsub16(u32bit a, u32bit b)
+{
+    u32bit result;
+
+    __asm ("qsub16 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+    return result;
+}
+
+/*lo(a) * lo(b) + hi(a) * hi(b)*/
+static inline s32bit Core_Smuad(u32bit a, u32bit b)
+{
+    s32bit result;
+
+    __asm ("smuad %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+    return result;
+}
+
+/*acc + lo(a) * lo(b) + hi(a) * hi(b), 64 bit accumulator*/
+static inline s64bit Core_Smlald(u32bit a, u32bit b, s64bit acc)
+{
+    __asm ("smlald %Q0, %R0, %1, %2" : "+r" (acc) : "r" (a), "r" (b));
+    return acc;
+}
+
+/*acc + lo(a) * lo(b) + hi(a) * hi(b), 32 bit accumulator*/
+static inline s32bit Core_Smlad(u32bit a, u32bit b, s32bit acc)
+{
+    s32bit result;
+
+    __asm ("smlad %0, %1, %2, %3" : "=r" (result) : "r" (a), "r" (b), "r" (acc));
+    return result;
+}
+
+/*Bytes 0 and 2 sign extended to halfwords*/
+static inline u32bit Core_Sxtb16(u32bit a)
+{
+    u32bit result;
+
+    __asm ("sxtb16 %0, %1" : "=r" (result) : "r" (a));
+    return result;
+}
+
+/*Bytes 1 and 3 sign extended to halfwords*/
+static inline u32bit Core_Sxtb16Ror8(u32bit a)
+{
+    u32bit result;
+
+    __asm ("sxtb16 %0, %1, ror #8" : "=r" (result) : "r" (a));
+    return result;
+}
+#else
+static inline s32bit Core_Qadd(s32bit a, s32bit b)
+{
+    return Core_Ssat32((s64bit)a + (s64bit)b);
+}
+
+static inline u32bit Core_Qsub16(u32bit a, u32bit b)
+{
+    return Core_Pack16(Core_Ssat16((s32bit)CORE_LO16(a) - (s32bit)CORE_LO16(b)),
+                       Core_Ssat16((s32bit)CORE_HI16(a) - (s32bit)CORE_HI16(b)));
+}
+
+/*Only -32768 * -32768 twice overflows (the instruction wraps), callers keep one factor above -32768*/
+static inline s32bit Core_Smuad(u32bit a, u32bit b)
+{
+    return ((s32bit)CORE_LO16(a) * CORE_LO16(b)) + ((s32bit)CORE_HI16(a) * CORE_HI16(b));
+}
+
+static inline s64bit Core_Smlald(u32bit a, u32bit b, s64bit acc)
+{
+    return acc + ((s64bit)CORE_LO16(a) * CORE_LO16(b)) + ((s64bit)CORE_HI16(a) * CORE_HI16(b));
+}
+
+/*The instruction wraps on overflow, callers keep the sum in range*/
+static inline s32bit Core_Smlad(u32bit a, u32bit b, s32bit acc)
+{
+    return acc + ((s32bit)CORE_LO16(a) * CORE_LO16(b)) + ((s32bit)CORE_HI16(a) * CORE_HI16(b));
+}
+
+static inline u32bit Core_Sxtb16(u32bit a)
+{
+    return Core_Pack16((s16bit)(s8bit)(u8bit)(a & 0xFFu), (s16bit)(s8bit)(u8bit)((a >> 16) & 0xFFu));
+}
+
+static inline u32bit Core_Sxtb16Ror8(u32bit a)
+{
+    return Core_Sxtb16((u32bit)(a >> 8));
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* CORE_CM4_H */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | First version of Core_CM4.h, macros moved from cStartup_file.c, add WEAK     |
+ *| CMARTI  |  user-005   | 17-Oct-2026 | Add Core_CompareAndSwap and Core_AtomicAdd                                   |
+ *| CMARTI  |  user-006   | 17-Oct-2026 | Add Core_LoadAcquire and Core_StoreRelease                                   |
+ *| CMARTI  |  user-007   | 17-Oct-2026 | Add Core_ReadFence                                                           |
+ *| CMARTI  |  user-008   | 17-Oct-2026 | Add DSP extension helpers                                                    |
+ *| CMARTI  |  user-010   | 17-Oct-2026 | Add Core_Smlad, Core_Sxtb16 and Core_Sxtb16Ror8                              |
+ *| CMARTI  |  user-011   | 17-Oct-2026 | Add NO_INSTRUMENT                                                            |
+ *| CMARTI  |  user-013   | 17-Oct-2026 | Host build variants of the interrupt, standby, breakpoint and REV macros     |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | Add REV_BITS_32                                                              |
+ *| CMARTI  |  user-023   | 17-Oct-2026 | Add FAST_DATA, FAST_BSS, DMA_BUFFER and NO_INIT placement macros             |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | NO_INIT kept over warm resets only                                           |
+ *| CMARTI  |  user-013   | 17-Oct-2026 | Host interrupt masking and STANDBY() on the Os host port tick                |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | Add SUSPEND_INTERRUPTS and RESUME_INTERRUPTS                                 |
+***********************************************************************************************************************/
@@ -0,0 +1,429 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: S32K144.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \S32K144.h
+    Microcontroller map.
+    Register layout of the core and S32K144 peripherals used by the project. Names follow the NXP
+    device header so drivers stay compatible with it. Only registers in use are described here,
+    add new peripherals when a driver needs them.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef S32K144_H_
+#define S32K144_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Register access qualifiers*/
+#define __I   volatile const
+#define __O   volatile
+#define __IO  volatile
+
+/*Peripheral instance at base. Host builds (HOST_BUILD) access RAM stubs of the same layout instead,
+ *see settings/host/S32K144_Host.c*/
+#if defined (HOST_BUILD)
+#define S32_PERIPHERAL(type, base)       (&type##_Stub)
+#else
+#define S32_PERIPHERAL(type, base)       ((type *)(base))
+#endif
+
+/************************************ S32_SCB, System Control Block ************************************/
+typedef struct
+{
+    u8bit  RESERVED_0[8];
+    __IO u32bit ACTLR;                   /*Auxiliary Control Register,                offset: 0x008*/
+    u8bit  RESERVED_1[3316];
+    __I  u32bit CPUID;                   /*CPUID Base Register,                       offset: 0xD00*/
+    __IO u32bit ICSR;                    /*Interrupt Control and State Register,      offset: 0xD04*/
+    __IO u32bit VTOR;                    /*Vector Table Offset Register,              offset: 0xD08*/
+    __IO u32bit AIRCR;                   /*Application Interrupt and Reset Control,   offset: 0xD0C*/
+    __IO u32bit SCR;                     /*System Control Register,                   offset: 0xD10*/
+    __IO u32bit CCR;                     /*Configuration and Control Register,        offset: 0xD14*/
+    __IO u32bit SHPR1;                   /*System Handler Priority Register 1,        offset: 0xD18*/
+    __IO u32bit SHPR2;                   /*System Handler Priority Register 2,        offset: 0xD1C*/
+    __IO u32bit SHPR3;                   /*System Handler Priority Register 3,        offset: 0xD20*/
+    __IO u32bit SHCSR;                   /*System Handler Control and State Register, offset: 0xD24*/
+    __IO u32bit CFSR;                    /*Configurable Fault Status Registers,       offset: 0xD28*/
+    __IO u32bit HFSR;                    /*HardFault Status register,                 offset: 0xD2C*/
+    __IO u32bit DFSR;                    /*Debug Fault Status Register,               offset: 0xD30*/
+    __IO u32bit MMFAR;                   /*MemManage Address Register,                offset: 0xD34*/
+    __IO u32bit BFAR;                    /*BusFault Address Register,                 offset: 0xD38*/
+    __IO u32bit AFSR;                    /*Auxiliary Fault Status Register,           offset: 0xD3C*/
+    u8bit  RESERVED_2[72];
+    __IO u32bit CPACR;                   /*Coprocessor Access Control Register,       offset: 0xD88*/
+    u8bit  RESERVED_3[424];
+    __IO u32bit FPCCR;                   /*Floating-point Context Control Register,   offset: 0xF34*/
+    __IO u32bit FPCAR;                   /*Floating-point Context Address Register,   offset: 0xF38*/
+    __IO u32bit FPDSCR;                  /*Floating-point Default Status Control,     offset: 0xF3C*/
+} S32_SCB_Type;
+
+#define S32_SCB_BASE                     (0xE000E000u)
+#define S32_SCB                          S32_PERIPHERAL(S32_SCB_Type, S32_SCB_BASE)
+
+#define S32_SCB_ICSR_PENDSTCLR_MASK      (0x02000000u)
+#define S32_SCB_ICSR_PENDSTSET_MASK      (0x04000000u)
+#define S32_SCB_ICSR_PENDSVCLR_MASK      (0x08000000u)
+#define S32_SCB_ICSR_PENDSVSET_MASK      (0x10000000u)
+#define S32_SCB_AIRCR_VECTKEY            (0x05FA0000u)   /*Write key*/
+#define S32_SCB_AIRCR_VECTKEY_MASK       (0xFFFF0000u)
+#define S32_SCB_AIRCR_PRIGROUP_SHIFT     (8u)
+#define S32_SCB_AIRCR_PRIGROUP_MASK      (0x00000700u)
+#define S32_SCB_AIRCR_SYSRESETREQ_MASK   (0x00000004u)
+#define S32_SCB_SHPR3_PRI_14_SHIFT       (16u)           /*PendSV priority*/
+#define S32_SCB_SHPR3_PRI_15_SHIFT       (24u)           /*SysTick priority*/
+#define S32_SCB_CPACR_CP10_MASK          (0x00300000u)
+#define S32_SCB_CPACR_CP11_MASK          (0x00C00000u)
+#define S32_SCB_FPCCR_LSPEN_MASK         (0x40000000u)
+#define S32_SCB_FPCCR_ASPEN_MASK         (0x80000000u)
+
+/************************************ S32_SysTick, System timer ****************************************/
+typedef struct
+{
+    __IO u32bit CSR;                     /*SysTick Control and Status Register,       offset: 0x0*/
+    __IO u32bit RVR;                     /*SysTick Reload Value Register,             offset: 0x4*/
+    __IO u32bit CVR;                     /*SysTick Current Value Register,            offset: 0x8*/
+    __I  u32bit CALIB;                   /*SysTick Calibration Value Register,        offset: 0xC*/
+} S32_SysTick_Type;
+
+#define S32_SysTick_BASE                 (0xE000E010u)
+#define S32_SysTick                      S32_PERIPHERAL(S32_SysTick_Type, S32_SysTick_BASE)
+
+#define S32_SysTick_CSR_ENABLE_MASK      (0x00000001u)
+#define S32_SysTick_CSR_TICKINT_MASK     (0x00000002u)
+#define S32_SysTick_CSR_CLKSOURCE_MASK   (0x00000004u)
+#define S32_SysTick_CSR_COUNTFLAG_MASK   (0x00010000u)
+#define S32_SysTick_RVR_RELOAD_MASK      (0x00FFFFFFu)
+
+/************************************ S32_CoreDebug, Debug exception and monitor control **************/
+typedef struct
+{
+    __IO u32bit DHCSR;                   /*Debug Halting Control and Status Register, offset: 0x0*/
+    __O  u32bit DCRSR;                   /*Debug Core Register Selector Register,     offset: 0x4*/
+    __IO u32bit DCRDR;                   /*Debug Core Register Data Register,         offset: 0x8*/
+    __IO u32bit DEMCR;                   /*Debug Exception and Monitor Control,       offset: 0xC*/
+} S32_CoreDebug_Type;
+
+#define S32_CoreDebug_BASE               (0xE000EDF0u)
+#define S32_CoreDebug                    S32_PERIPHERAL(S32_CoreDebug_Type, S32_CoreDebug_BASE)
+
+#define S32_CoreDebug_DEMCR_TRCENA_MASK  (0x01000000u)   /*Enables DWT and ITM*/
+
+/************************************ S32_DWT, Data Watchpoint and Trace *******************************/
+typedef struct
+{
+    __IO u32bit CTRL;                    /*Control Register,                          offset: 0x0*/
+    __IO u32bit CYCCNT;                  /*Cycle Count Register,                      offset: 0x4*/
+    __IO u32bit CPICNT;                  /*CPI Count Register,                        offset: 0x8*/
+    __IO u32bit EXCCNT;                  /*Exception Overhead Count Register,         offset: 0xC*/
+    __IO u32bit SLEEPCNT;                /*Sleep Count Register,                      offset: 0x10*/
+    __IO u32bit LSUCNT;                  /*LSU Count Register,                        offset: 0x14*/
+    __IO u32bit FOLDCNT;                 /*Folded-instruction Count Register,         offset: 0x18*/
+} S32_DWT_Type;
+
+#define S32_DWT_BASE                     (0xE0001000u)
+#define S32_DWT                          S32_PERIPHERAL(S32_DWT_Type, S32_DWT_BASE)
+
+#define S32_DWT_CTRL_CYCCNTENA_MASK      (0x00000001u)
+#define S32_DWT_CTRL_NOCYCCNT_MASK       (0x02000000u)   /*Cycle counter not implemented*/
+
+/************************************ S32_NVIC, Nested Vectored Interrupt Controller *******************/
+typedef struct
+{
+    __IO u32bit ISER[8];                 /*Interrupt Set Enable Register,             offset: 0x000*/
+    u8bit  RESERVED_0[96];
+    __IO u32bit ICER[8];                 /*Interrupt Clear Enable Register,           offset: 0x080*/
+    u8bit  RESERVED_1[96];
+    __IO u32bit ISPR[8];                 /*Interrupt Set Pending Register,            offset: 0x100*/
+    u8bit  RESERVED_2[96];
+    __IO u32bit ICPR[8];                 /*Interrupt Clear Pending Register,          offset: 0x180*/
+    u8bit  RESERVED_3[96];
+    __I  u32bit IABR[8];                 /*Interrupt Active bit Register,             offset: 0x200*/
+    u8bit  RESERVED_4[224];
+    __IO u8bit  IP[240];                 /*Interrupt Priority Register,               offset: 0x300*/
+    u8bit  RESERVED_5[2576];
+    __O  u32bit STIR;                    /*Software Trigger Interrupt Register,       offset: 0xE00*/
+} S32_NVIC_Type;
+
+#define S32_NVIC_BASE                    (0xE000E100u)
+#define S32_NVIC                         S32_PERIPHERAL(S32_NVIC_Type, S32_NVIC_BASE)
+
+/*Implemented priority bits, priorities are stored in the upper bits of every IP byte*/
+#define FEATURE_NVIC_PRIO_BITS           (4u)
+
+/*Device interrupts (IRQ 0 to 122), the vector table holds 16 core exceptions before them*/
+#define FEATURE_INTERRUPT_IRQ_COUNT      (123u)
+
+/************************************ WDOG, Watchdog timer *********************************************/
+typedef struct
+{
+    __IO u32bit CS;                      /*Watchdog Control and Status Register,      offset: 0x0*/
+    __IO u32bit CNT;                     /*Watchdog Counter Register,                 offset: 0x4*/
+    __IO u32bit TOVAL;                   /*Watchdog Timeout Value Register,           offset: 0x8*/
+    __IO u32bit WIN;                     /*Watchdog Window Register,                  offset: 0xC*/
+} WDOG_Type;
+
+#define WDOG_BASE                        (0x40052000u)
+#define WDOG                             S32_PERIPHERAL(WDOG_Type, WDOG_BASE)
+
+#define WDOG_CS_UPDATE_SHIFT             (5u)
+#define WDOG_CS_EN_SHIFT                 (7u)
+#define WDOG_CS_CLK_SHIFT                (8u)
+#define WDOG_CS_CMD32EN_SHIFT            (13u)
+#define FEATURE_WDOG_UNLOCK_VALUE        (0xD928C520u)
+#define FEATURE_WDOG_CLK_FROM_LPO        (0x1u)
+
+/************************************ SMC, System Mode Controller **************************************/
+typedef struct
+{
+    __I  u32bit VERID;                   /*SMC Version ID Register,                   offset: 0x00*/
+    __I  u32bit PARAM;                   /*SMC Parameter Register,                    offset: 0x04*/
+    __IO u32bit PMPROT;                  /*Power Mode Protection register,            offset: 0x08*/
+    __IO u32bit PMCTRL;                  /*Power Mode Control register,               offset: 0x0C*/
+    __IO u32bit STOPCTRL;                /*Stop Control Register,                     offset: 0x10*/
+    __I  u32bit PMSTAT;                  /*SMC Power Mode Status register,            offset: 0x14*/
+} SMC_Type;
+
+#define SMC_BASE                         (0x4007E000u)
+#define SMC                              S32_PERIPHERAL(SMC_Type, SMC_BASE)
+
+/************************************ FTFC, Flash Memory Module ****************************************/
+typedef struct
+{
+    __IO u8bit  FSTAT;                   /*Flash Status Register,                     offset: 0x00*/
+    __IO u8bit  FCNFG;                   /*Flash Configuration Register,              offset: 0x01*/
+    __I  u8bit  FSEC;                    /*Flash Security Register,                   offset: 0x02*/
+    __I  u8bit  FOPT;                    /*Flash Option Register,                     offset: 0x03*/
+    __IO u8bit  FCCOB[12];               /*Flash Common Command Object Registers,     offset: 0x04*/
+    __IO u8bit  FPROT[4];                /*Program Flash Protection Registers,        offset: 0x10*/
+    u8bit  RESERVED_0[2];
+    __IO u8bit  FEPROT;                  /*EEPROM Protection Register,                offset: 0x16*/
+    __IO u8bit  FDPROT;                  /*Data Flash Protection Register,            offset: 0x17*/
+    u8bit  RESERVED_1[20];
+    __I  u8bit  FCSESTAT;                /*Flash CSEc Status Register,                offset: 0x2C*/
+    u8bit  RESERVED_2[1];
+    __IO u8bit  FERSTAT;                 /*Flash Error Status Register,               offset: 0x2E*/
+    __IO u8bit  FERCNFG;                 /*Flash Error Configuration Register,        offset: 0x2F*/
+} FTFC_Type;
+
+#define FTFC_BASE                        (0x40020000u)
+#define FTFC                             S32_PERIPHERAL(FTFC_Type, FTFC_BASE)
+
+#define FTFC_FSTAT_MGSTAT0_MASK          (0x01u)         /*Command completion status, verify failed*/
+#define FTFC_FSTAT_FPVIOL_MASK           (0x10u)         /*Protection violation*/
+#define FTFC_FSTAT_ACCERR_MASK           (0x20u)         /*Access error*/
+#define FTFC_FSTAT_RDCOLERR_MASK         (0x40u)         /*Read collision error*/
+#define FTFC_FSTAT_CCIF_MASK             (0x80u)         /*Command complete, write 1 to launch*/
+
+/*FCCOB numbers of the reference manual are stored big endian inside every word of FCCOB[]*/
+#define FTFC_FCCOB_INDEX(n)              (((n) & ~3u) + 3u - ((n) & 3u))
+
+#define FTFC_CMD_PROGRAM_PHRASE          (0x07u)
+#define FTFC_CMD_ERASE_SECTOR            (0x09u)
+
+/*P-Flash geometry*/
+#define FEATURE_FLS_PF_SIZE              (0x00080000u)
+#define FEATURE_FLS_PF_SECTOR_SIZE       (0x00001000u)
+#define FEATURE_FLS_PF_WRITE_UNIT_SIZE   (8u)
+
+/************************************ PCC, Peripheral Clock Controller *********************************/
+typedef struct
+{
+    __IO u32bit PCCn[116];               /*PCC registers, one per peripheral slot,    offset: 0x00*/
+} PCC_Type;
+
+#define PCC_BASE                         (0x40065000u)
+#define PCC                              S32_PERIPHERAL(PCC_Type, PCC_BASE)
+
+#define PCC_FlexCAN0_INDEX               (36u)
+#define PCC_CRC_INDEX                    (50u)
+#define PCC_PORTE_INDEX                  (77u)
+#define PCC_PCCn_CGC_MASK                (0x40000000u)   /*Clock gate control, 1 = clock enabled*/
+
+/************************************ CRC, Cyclic Redundancy Check *************************************/
+typedef struct
+{
+    union
+    {
+        __IO u32bit DATA;                /*CRC Data register,                         offset: 0x00*/
+        struct
+        {
+            __IO u8bit LL;               /*CRC DATALL register, byte writes*/
+            __IO u8bit LU;
+            __IO u8bit HL;
+            __IO u8bit HU;
+        } DATA_8;
+    } DATAu;
+    __IO u32bit GPOLY;                   /*CRC Polynomial register,                   offset: 0x04*/
+    __IO u32bit CTRL;                    /*CRC Control register,                      offset: 0x08*/
+} CRC_Type;
+
+#define CRC_BASE                         (0x40032000u)
+#define CRC                              S32_PERIPHERAL(CRC_Type, CRC_BASE)
+
+#define CRC_CTRL_TCRC_MASK               (0x01000000u)   /*Width, 0 = 16 bit, 1 = 32 bit*/
+#define CRC_CTRL_WAS_MASK                (0x02000000u)   /*Writes to DATA are the seed*/
+#define CRC_CTRL_FXOR_MASK               (0x04000000u)   /*Complement the read value*/
+#define CRC_CTRL_TOTR_SHIFT              (28u)           /*Read transpose*/
+#define CRC_CTRL_TOT_SHIFT               (30u)           /*Write transpose*/
+#define CRC_CTRL_TOTR(x)                 (((u32bit)(x) & 3u) << CRC_CTRL_TOTR_SHIFT)
+#define CRC_CTRL_TOT(x)                  (((u32bit)(x) & 3u) << CRC_CTRL_TOT_SHIFT)
+
+/*Transpose types of TOT and TOTR*/
+#define CRC_TRANSPOSE_NONE               (0u)
+#define CRC_TRANSPOSE_BITS               (1u)            /*Bits in bytes*/
+#define CRC_TRANSPOSE_BITS_AND_BYTES     (2u)
+#define CRC_TRANSPOSE_BYTES              (3u)
+
+/************************************ PORT, Pin control ************************************************/
+typedef struct
+{
+    __IO u32bit PCR[32];                 /*Pin Control Register n,                    offset: 0x00*/
+} PORT_Type;
+
+#define PORTE_BASE                       (0x4004D000u)
+#define PORTE                            S32_PERIPHERAL(PORT_Type, PORTE_BASE)
+
+#define PORT_PCR_MUX(x)                  (((u32bit)(x) & 7u) << 8)   /*Pin function, 1 = GPIO, 2-7 = ALT2-ALT7*/
+
+/************************************ CAN, FlexCAN *****************************************************/
+typedef struct
+{
+    __IO u32bit MCR;                     /*Module Configuration Register,             offset: 0x000*/
+    __IO u32bit CTRL1;                   /*Control 1 register,                        offset: 0x004*/
+    __IO u32bit TIMER;                   /*Free Running Timer,                        offset: 0x008*/
+    u8bit  RESERVED_0[4];
+    __IO u32bit RXMGMASK;                /*Rx Mailboxes Global Mask Register,         offset: 0x010*/
+    __IO u32bit RX14MASK;                /*Rx 14 Mask register,                       offset: 0x014*/
+    __IO u32bit RX15MASK;                /*Rx 15 Mask register,                       offset: 0x018*/
+    __IO u32bit ECR;                     /*Error Counter,                             offset: 0x01C*/
+    __IO u32bit ESR1;                    /*Error and Status 1 register,               offset: 0x020*/
+    u8bit  RESERVED_1[4];
+    __IO u32bit IMASK1;                  /*Interrupt Masks 1 register,                offset: 0x028*/
+    u8bit  RESERVED_2[4];
+    __IO u32bit IFLAG1;                  /*Interrupt Flags 1 register,                offset: 0x030*/
+    __IO u32bit CTRL2;                   /*Control 2 register,                        offset: 0x034*/
+    __I  u32bit ESR2;                    /*Error and Status 2 register,               offset: 0x038*/
+    u8bit  RESERVED_3[8];
+    __I  u32bit CRCR;                    /*CRC Register,                              offset: 0x044*/
+    __IO u32bit RXFGMASK;                /*Rx FIFO Global Mask register,              offset: 0x048*/
+    __I  u32bit RXFIR;                   /*Rx FIFO Information Register,              offset: 0x04C*/
+    u8bit  RESERVED_4[48];
+    __IO u32bit RAMn[128];               /*Message buffers, 4 words each,             offset: 0x080*/
+} CAN_Type;
+
+#define CAN0_BASE                        (0x40024000u)
+#define CAN0                             S32_PERIPHERAL(CAN_Type, CAN0_BASE)
+
+#define CAN_MCR_MDIS_MASK                (0x80000000u)   /*Module disable*/
+#define CAN_MCR_FRZ_MASK                 (0x40000000u)   /*Freeze enable*/
+#define CAN_MCR_RFEN_MASK                (0x20000000u)   /*Legacy Rx FIFO enable, MB0-5 FIFO, MB6-7 filters*/
+#define CAN_MCR_HALT_MASK                (0x10000000u)   /*Enter freeze mode*/
+#define CAN_MCR_NOTRDY_MASK              (0x08000000u)   /*Disabled or frozen*/
+#define CAN_MCR_FRZACK_MASK              (0x01000000u)   /*Freeze mode acknowledge*/
+#define CAN_MCR_LPMACK_MASK              (0x00100000u)   /*Low power (disable) mode acknowledge*/
+#define CAN_MCR_SRXDIS_MASK              (0x00020000u)   /*Own frames not received*/
+#define CAN_MCR_MAXMB(x)                 ((u32bit)(x) & 0x7Fu)        /*Last message buffer in use*/
+#define CAN_CTRL1_CLKSRC_MASK            (0x00002000u)   /*Protocol engine clock, 1 = SYS_CLK*/
+#define CAN_CTRL1_LBUF_MASK              (0x00000010u)   /*Lowest numbered Tx buffer sent first*/
+
+/*Message buffer words: CS, ID, data bytes 0-3 and 4-7 (byte 0 in bits 31:24)*/
+#define CAN_MB_WORDS                     (4u)
+#define CAN_CS_CODE(x)                   (((u32bit)(x) & 0xFu) << 24)
+#define CAN_CS_DLC(cs)                   (((cs) >> 16) & 0xFu)
+#define CAN_CS_DLC_SET(x)                (((u32bit)(x) & 0xFu) << 16)
+#define CAN_ID_STD(x)                    (((u32bit)(x) & 0x7FFu) << 18)
+#define CAN_ID_STD_GET(id)               (((id) >> 18) & 0x7FFu)
+#define CAN_CODE_TX_INACTIVE             (0x8u)
+#define CAN_CODE_TX_DATA                 (0xCu)
+
+/*Legacy Rx FIFO: output in MB0, IFLAG1 bits 5 (frame available), 6 (almost full), 7 (overflow).
+  Filter table format A at MB6-7 (CTRL2 RFFN 0, 8 elements), standard identifier in bits 29:19*/
+#define CAN_IFLAG1_BUF5I_MASK            (0x00000020u)
+#define CAN_IFLAG1_BUF6I_MASK            (0x00000040u)
+#define CAN_IFLAG1_BUF7I_MASK            (0x00000080u)
+#define CAN_FIFO_DEPTH                   (6u)
+#define CAN_FIFO_FILTERS                 (8u)
+#define CAN_FIFO_FILTER_WORD             (6u * CAN_MB_WORDS)
+#define CAN_FIFO_FILTER_STD(x)           (((u32bit)(x) & 0x7FFu) << 19)
+#define CAN_FIFO_FILTER_STD_MASK         (0xFFF80000u)   /*RTR, IDE and the standard identifier*/
+
+/************************************ RCM, Reset Control Module ****************************************/
+typedef struct
+{
+    __I  u32bit VERID;                   /*Version ID Register,                       offset: 0x00*/
+    __I  u32bit PARAM;                   /*Parameter Register,                        offset: 0x04*/
+    __I  u32bit SRS;                     /*System Reset Status Register,              offset: 0x08*/
+    __IO u32bit RPC;                     /*Reset Pin Control register,                offset: 0x0C*/
+    u8bit  RESERVED_0[8];
+    __IO u32bit SSRS;                    /*Sticky System Reset Status Register,       offset: 0x18*/
+    __IO u32bit SRIE;                    /*System Reset Interrupt Enable Register,    offset: 0x1C*/
+} RCM_Type;
+
+#define RCM_BASE                         (0x4007F000u)
+#define RCM                              S32_PERIPHERAL(RCM_Type, RCM_BASE)
+
+/*SRS causes of the last reset*/
+#define RCM_SRS_LVD_MASK                 (0x00000002u)   /*Low voltage detect*/
+#define RCM_SRS_LOC_MASK                 (0x00000004u)   /*Loss of external clock*/
+#define RCM_SRS_LOL_MASK                 (0x00000008u)   /*Loss of lock*/
+#define RCM_SRS_WDOG_MASK                (0x00000020u)   /*Watchdog*/
+#define RCM_SRS_PIN_MASK                 (0x00000040u)   /*External reset pin*/
+#define RCM_SRS_POR_MASK                 (0x00000080u)   /*Power on*/
+#define RCM_SRS_JTAG_MASK                (0x00000100u)   /*JTAG generated reset*/
+#define RCM_SRS_LOCKUP_MASK              (0x00000200u)   /*Core lockup*/
+#define RCM_SRS_SW_MASK                  (0x00000400u)   /*Software, AIRCR SYSRESETREQ*/
+#define RCM_SRS_MDM_AP_MASK              (0x00000800u)   /*Debugger system reset request*/
+#define RCM_SRS_SACKERR_MASK             (0x00002000u)   /*Stop acknowledge error*/
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+#if defined (HOST_BUILD)
+extern S32_SCB_Type       S32_SCB_Type_Stub;
+extern S32_SysTick_Type   S32_SysTick_Type_Stub;
+extern S32_CoreDebug_Type S32_CoreDebug_Type_Stub;
+extern S32_DWT_Type       S32_DWT_Type_Stub;
+extern S32_NVIC_Type      S32_NVIC_Type_Stub;
+extern WDOG_Type          WDOG_Type_Stub;
+extern SMC_Type           SMC_Type_Stub;
+extern FTFC_Type          FTFC_Type_Stub;
+extern PCC_Type           PCC_Type_Stub;
+extern CRC_Type           CRC_Type_Stub;
+extern RCM_Type           RCM_Type_Stub;
+extern PORT_Type          PORT_Type_Stub;
+extern CAN_Type           CAN_Type_Stub;
+#endif
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* S32K144_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | First version of S32K144.h: SCB, SysTick, NVIC, WDOG, SMC                    |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | Add S32_CoreDebug and S32_DWT                                                |
+ *| CMARTI  |  user-013   | 17-Oct-2026 | S32_PERIPHERAL, RAM register stubs for host builds                           |
+ *| CMARTI  |  user-014   | 17-Oct-2026 | AIRCR priority grouping fields and device IRQ count                          |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Add FTFC and AIRCR SYSRESETREQ                                               |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | Add PCC and CRC                                                              |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | Add RCM                                                                      |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Add PORTE and FlexCAN CAN0                                                   |
+***********************************************************************************************************************/
@@ -36,9 +36,21 @@ typedef signed   char  s8bit;
 typedef unsigned short u16bit;
 typedef signed   short s16bit;
 
-/*Long types definition*/
+/*Long types definition, long is 64 bit on Linux hosts*/
+#if defined (HOST_BUILD)
+typedef unsigned int   u32bit;
+typedef signed   int   s32bit;
+#else
 typedef unsigned long  u32bit;
 typedef signed   long  s32bit;
+#endif
+
+/*Long long types definition*/
+typedef unsigned long long u64bit;
+typedef signed   long long s64bit;
+
+/*Address type definition, unsigned integer wide enough to hold a pointer*/
+typedef unsigned long  uaddr;
 
 /*Boolean type definition*/
 typedef u8bit boolean;
@@ -65,4 +77,7 @@ typedef u8bit boolean;
 /***************************************************Log Projects********************************************************
  *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
  *| CMARTI  |     NA      | 28-Apr-2021 | First version of Std_Types.h                                                 |
+ *| CMARTI  |  user-001   | 17-Oct-2026 | Add uaddr type for pointer alignment checks                                  |
+ *| CMARTI  |  user-008   | 17-Oct-2026 | Add 64 bit types                                                             |
+ *| CMARTI  |  user-013   | 17-Oct-2026 | 32 bit u32bit/s32bit on host builds                                          |
 ***********************************************************************************************************************/
@@ -0,0 +1,451 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Boot.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Boot.c
+    Bootloader programming pipeline. Transfer blocks arrive in MemPool blocks (CanTp reassembles them in
+    place), the block being programmed is kept while the next one is received into the other, so the CAN
+    transfer hides erase and programming time. Sectors are erased just before their first phrase. The
+    download ends with a CRC-32 check of the flash contents and the trailer phrase {length, CRC-32} at the
+    end of the application region, which Boot_AppValid checks on every start.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Boot.h"
+#include "Boot_Delta.h"
+#include "Fls.h"
+#include "MemPool.h"
+#include "Crc.h"
+#include "Startup_Warm.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Branch to the application reset handler on its stack*/
+#if defined (HOST_BUILD)
+#define BOOT_JUMP(sp, pc)             ((void)(sp), (void)(pc))
+#else
+#define BOOT_JUMP(sp, pc)             __asm volatile ("msr msp, %0\n\tbx %1" : : "r" (sp), "r" (pc) : "memory")
+#endif
+
+/*Download states*/
+#define BOOT_IDLE                     (0u)
+#define BOOT_READY                    (1u)            /*Waiting for the next block*/
+#define BOOT_PROGRAM                  (2u)            /*Block being programmed*/
+#define BOOT_VERIFY                   (3u)
+#define BOOT_TRAILER                  (4u)
+#define BOOT_CLOSE                    (5u)            /*Trailer being programmed*/
+#define BOOT_DONE                     (6u)
+#define BOOT_ERROR                    (7u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static u8bit   Boot_State = BOOT_IDLE;
+static boolean Boot_Launched = FALSE;           /*Command of ours running or its result not checked*/
+static boolean Boot_TrailerErased;
+static boolean Boot_Delta;                      /*Blocks are a delta image*/
+static u32bit  Boot_Begin;                      /*Image start*/
+static u32bit  Boot_End;
+static u32bit  Boot_Address;                    /*Next phrase*/
+static u32bit  Boot_ErasedEnd;                  /*Sectors below are erased*/
+static u32bit  Boot_Expected;                   /*CRC-32 of Boot_Finish*/
+static u32bit  Boot_Crc;                        /*CRC-32 of the image read back so far*/
+
+/*Block being programmed*/
+static u8bit *       Boot_Block = NULL;
+static const u8bit * Boot_Data;
+static u32bit        Boot_Left;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void   Boot_Fail(void);
+static void   Boot_ProgramStep(void);
+static void   Boot_DeltaStep(void);
+static void   Boot_VerifyStep(void);
+static boolean Boot_AppHeader(u32bit * length);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+static inline u32bit Boot_Get32(const u8bit * data)
+{
+    return ((u32bit)data[0]) | ((u32bit)data[1] << 8) | ((u32bit)data[2] << 16) | ((u32bit)data[3] << 24);
+}
+
+static inline void Boot_Put32(u8bit * data, u32bit value)
+{
+    data[0] = (u8bit)value;
+    data[1] = (u8bit)(value >> 8);
+    data[2] = (u8bit)(value >> 16);
+    data[3] = (u8bit)(value >> 24);
+}
+
+static inline void Boot_Launch(boolean launched)
+{
+    Boot_Launched = launched;
+    if (launched == FALSE)
+    {
+        Boot_Fail();
+    }
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+static void Boot_Fail(void)
+{
+    MemPool_Free(Boot_Block);
+    Boot_Block = NULL;
+    Boot_State = BOOT_ERROR;
+}
+
+/*
+ * One FTFC command: the erase of the sector the next phrase enters, or the phrase itself. The last phrase
+ * of the image is padded with erased bytes. The block is released with its last phrase, its data is in
+ * FCCOB by then.
+ */
+static void Boot_ProgramStep(void)
+{
+    u8bit phrase[FLS_PHRASE_SIZE];
+    const u8bit * data = Boot_Data;
+    u32bit count;
+    u32bit i;
+
+    if (Boot_Address >= Boot_ErasedEnd)
+    {
+        Boot_Launch(Fls_Erase(Boot_Address));
+        Boot_ErasedEnd = Boot_Address + FLS_SECTOR_SIZE;
+    }
+    else
+    {
+        count = (Boot_Left < FLS_PHRASE_SIZE) ? Boot_Left : FLS_PHRASE_SIZE;
+        if (count < FLS_PHRASE_SIZE)
+        {
+            for (i = 0u; i < FLS_PHRASE_SIZE; i++)
+            {
+                phrase[i] = (i < count) ? Boot_Data[i] : 0xFFu;
+            }
+            data = phrase;
+        }
+        Boot_Launch(Fls_Write(Boot_Address, data));
+        if (Boot_Launched == TRUE)
+        {
+            Boot_Address += FLS_PHRASE_SIZE;
+            Boot_Data = &Boot_Data[count];
+            Boot_Left -= count;
+            if (Boot_Left == 0u)
+            {
+                MemPool_Free(Boot_Block);
+                Boot_Block = NULL;
+                Boot_State = BOOT_READY;
+            }
+        }
+    }
+}
+
+/*
+ * Delta image: one FTFC command as Boot_ProgramStep, the old contents of a sector are kept before its
+ * erase and the phrases come from the decoder. The block is released once its input is used up.
+ */
+static void Boot_DeltaStep(void)
+{
+    const u8bit * phrase;
+    u8bit result;
+
+    if ((Boot_Address < Boot_End) && (Boot_Address >= Boot_ErasedEnd))
+    {
+        Boot_DeltaSave(Boot_Address);
+        Boot_Launch(Fls_Erase(Boot_Address));
+        Boot_ErasedEnd = Boot_Address + FLS_SECTOR_SIZE;
+    }
+    else
+    {
+        result = Boot_DeltaDecode(&Boot_Data, &Boot_Left, &phrase);
+        if (result == BOOT_DELTA_PHRASE)
+        {
+            Boot_Launch(Fls_Write(Boot_Address, phrase));
+            if (Boot_Launched == TRUE)
+            {
+                Boot_Address += FLS_PHRASE_SIZE;
+            }
+        }
+        else if (result == BOOT_DELTA_MORE)
+        {
+            MemPool_Free(Boot_Block);
+            Boot_Block = NULL;
+            Boot_State = BOOT_READY;
+        }
+        else
+        {
+            Boot_Fail();
+        }
+    }
+}
+
+/*
+ * BOOT_CFG_VERIFY_CHUNK bytes of the image read back, then the result.
+ */
+static void Boot_VerifyStep(void)
+{
+    u32bit count = Boot_End - Boot_Address;
+
+    count = (count > BOOT_CFG_VERIFY_CHUNK) ? BOOT_CFG_VERIFY_CHUNK : count;
+    Boot_Crc = Crc_CalculateCRC32(Fls_Memory(Boot_Address), count, Boot_Crc,
+                                  (Boot_Address == Boot_Begin) ? TRUE : FALSE);
+    Boot_Address += count;
+    if (Boot_Address == Boot_End)
+    {
+        Boot_State = (Boot_Crc == Boot_Expected) ? BOOT_TRAILER : BOOT_ERROR;
+    }
+}
+
+/*
+ * Trailer length inside the region, initial stack pointer in RAM, reset handler a Thumb address inside
+ * the image.
+ */
+static boolean Boot_AppHeader(u32bit * length)
+{
+    const u8bit * trailer = Fls_Memory(BOOT_TRAILER_ADDRESS);
+    const u8bit * vectors = Fls_Memory(BOOT_CFG_APP_START);
+    u32bit sp = Boot_Get32(&vectors[0]);
+    u32bit pc = Boot_Get32(&vectors[4]);
+
+    *length = Boot_Get32(&trailer[0]);
+    return ((*length >= 8u) && (*length <= (BOOT_TRAILER_ADDRESS - BOOT_CFG_APP_START)) &&
+            (sp > BOOT_CFG_RAM_START) && (sp <= BOOT_CFG_RAM_END) && ((sp & 3u) == 0u) &&
+            ((pc & 1u) != 0u) && (pc > BOOT_CFG_APP_START) && (pc < (BOOT_CFG_APP_START + *length))) ? TRUE : FALSE;
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Boot_Init(void)
+{
+    Fls_Init();
+    MemPool_Free(Boot_Block);
+    Boot_Block = NULL;
+    Boot_Launched = FALSE;
+    Boot_State = BOOT_IDLE;
+}
+
+/*
+ * A delta is checked against the trailer of the application in flash, read before the download erases it.
+ * Images start at BOOT_CFG_APP_START: the trailer covers the application from there, a download of part of
+ * it would leave a trailer Boot_AppValid cannot match.
+ */
+boolean Boot_Start(u32bit address, u32bit size, boolean delta)
+{
+    const u8bit * trailer = Fls_Memory(BOOT_TRAILER_ADDRESS);
+    boolean started = FALSE;
+
+    if (((Boot_State == BOOT_IDLE) || (Boot_State == BOOT_READY) || (Boot_State == BOOT_DONE) ||
+         (Boot_State == BOOT_ERROR)) && (Fls_GetStatus() != FLS_BUSY) &&
+        (address == BOOT_CFG_APP_START) && (size != 0u) && (size <= (BOOT_TRAILER_ADDRESS - address)))
+    {
+        if (delta == TRUE)
+        {
+            Boot_DeltaStart(address, address + size, Boot_Get32(&trailer[0]), Boot_Get32(&trailer[4]));
+        }
+        MemPool_Free(Boot_Block);
+        Boot_Block = NULL;
+        Boot_Delta = delta;
+        Boot_Begin = address;
+        Boot_End = address + size;
+        Boot_Address = address;
+        Boot_ErasedEnd = address;
+        Boot_TrailerErased = FALSE;
+        Boot_State = BOOT_READY;
+        started = TRUE;
+    }
+    return started;
+}
+
+/*
+ * Phrase multiples only, apart from the block that ends the image. The last phrase may have taken
+ * Boot_Address past Boot_End, nothing is left then.
+ */
+u8bit Boot_Write(u8bit * block, const u8bit * data, u16bit length)
+{
+    u8bit result = BOOT_FAILED;
+
+    if (Boot_State == BOOT_PROGRAM)
+    {
+        result = BOOT_PENDING;
+    }
+    else if ((Boot_State == BOOT_READY) && (length != 0u) && (length <= BOOT_CFG_BLOCK_SIZE) &&
+             ((Boot_Delta == TRUE) ||
+              ((Boot_Address < Boot_End) && (length <= (Boot_End - Boot_Address)) &&
+               (((length & (FLS_PHRASE_SIZE - 1u)) == 0u) || (length == (Boot_End - Boot_Address))))))
+    {
+        Boot_Block = block;
+        Boot_Data = data;
+        Boot_Left = length;
+        Boot_State = BOOT_PROGRAM;
+        result = BOOT_OK;
+    }
+    else
+    {
+    }
+    return result;
+}
+
+u8bit Boot_Finish(u32bit crc)
+{
+    u8bit result = BOOT_PENDING;
+
+    switch (Boot_State)
+    {
+        case BOOT_READY:
+            if ((Boot_Address < Boot_End) || ((Boot_Delta == TRUE) && (Boot_DeltaDone() == FALSE)))
+            {
+                Boot_State = BOOT_IDLE;
+                result = BOOT_FAILED;
+            }
+            else
+            {
+                Boot_Expected = crc;
+                Boot_Address = Boot_Begin;
+                Boot_State = BOOT_VERIFY;
+            }
+            break;
+        case BOOT_DONE:
+            Boot_State = BOOT_IDLE;
+            result = BOOT_OK;
+            break;
+        case BOOT_IDLE:
+        case BOOT_ERROR:
+            Boot_State = BOOT_IDLE;
+            result = BOOT_FAILED;
+            break;
+        default:
+            break;
+    }
+    return result;
+}
+
+/*
+ * Nothing is done while the FTFC runs, a failed command of ours ends the download.
+ */
+void Boot_MainFunction(void)
+{
+    u8bit status = Fls_GetStatus();
+    u8bit trailer[FLS_PHRASE_SIZE];
+
+    if (status != FLS_BUSY)
+    {
+        if ((Boot_Launched == TRUE) && (status == FLS_FAILED))
+        {
+            Boot_Launched = FALSE;
+            Boot_Fail();
+        }
+        else if ((Boot_TrailerErased == FALSE) && ((Boot_State == BOOT_READY) || (Boot_State == BOOT_PROGRAM)))
+        {
+            Boot_Launch(Fls_Erase(BOOT_TRAILER_ADDRESS & ~(FLS_SECTOR_SIZE - 1u)));
+            Boot_TrailerErased = TRUE;
+        }
+        else
+        {
+            Boot_Launched = FALSE;
+            switch (Boot_State)
+            {
+                case BOOT_PROGRAM:
+                    if (Boot_Delta == TRUE)
+                    {
+                        Boot_DeltaStep();
+                    }
+                    else
+                    {
+                        Boot_ProgramStep();
+                    }
+                    break;
+                case BOOT_VERIFY:
+                    Boot_VerifyStep();
+                    break;
+                case BOOT_TRAILER:
+                    Boot_Put32(&trailer[0], Boot_End - Boot_Begin);
+                    Boot_Put32(&trailer[4], Boot_Expected);
+                    Boot_Launch(Fls_Write(BOOT_TRAILER_ADDRESS, trailer));
+                    if (Boot_Launched == TRUE)
+                    {
+                        Boot_State = BOOT_CLOSE;
+                    }
+                    break;
+                case BOOT_CLOSE:
+                    Boot_State = BOOT_DONE;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+/*
+ * Image CRC of the application against its trailer, recorded in the warm-boot record for Boot_AppChecked.
+ */
+boolean Boot_AppValid(void)
+{
+    const u8bit * trailer = Fls_Memory(BOOT_TRAILER_ADDRESS);
+    u32bit length;
+    boolean valid = FALSE;
+
+    if ((Boot_AppHeader(&length) == TRUE) &&
+        (Crc_CalculateCRC32(Fls_Memory(BOOT_CFG_APP_START), length, 0u, TRUE) == Boot_Get32(&trailer[4])))
+    {
+        valid = TRUE;
+        StartupWarm_Record.appCrc = Boot_Get32(&trailer[4]);
+        StartupWarm_Seal();
+    }
+    return valid;
+}
+
+/*
+ * Warm start fast path: the trailer still holds the CRC Boot_AppValid checked before the reset, the image is
+ * not read again. A download erases or rewrites the trailer first.
+ */
+boolean Boot_AppChecked(void)
+{
+    const u8bit * trailer = Fls_Memory(BOOT_TRAILER_ADDRESS);
+    u32bit length;
+
+    return ((Boot_AppHeader(&length) == TRUE) && (StartupWarm_Record.appCrc != 0u) &&
+            (StartupWarm_Record.appCrc == Boot_Get32(&trailer[4]))) ? TRUE : FALSE;
+}
+
+/*
+ * The bootloader runs without interrupts, only its polled SysTick is stopped.
+ */
+void Boot_JumpToApp(void)
+{
+    const u8bit * vectors = Fls_Memory(BOOT_CFG_APP_START);
+
+    S32_SysTick->CSR = 0u;
+    S32_SCB->VTOR = BOOT_CFG_APP_START;
+    BOOT_JUMP(Boot_Get32(&vectors[0]), Boot_Get32(&vectors[4]));
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Boot.c                                                      |
+ *| CMARTI  |  user-019   | 17-Oct-2026 | Delta images, old sectors kept in the window before their erase              |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | CRC-32 from the Crc service                                                  |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | Boot_AppChecked, checked image CRC kept in the warm-boot record              |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Region check of Boot_Start without an always true compare                    |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Images from the application start only, no block past the end                |
+***********************************************************************************************************************/
@@ -0,0 +1,82 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Boot.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Boot.h
+    Bootloader: programs a downloaded image into the application region, verifies it and starts it.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef BOOT_H_
+#define BOOT_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Boot_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Trailer phrase {image length, CRC-32} at the end of the application region, and its sector*/
+#define BOOT_TRAILER_ADDRESS          (BOOT_CFG_APP_END - FEATURE_FLS_PF_WRITE_UNIT_SIZE)
+#define BOOT_TRAILER_SECTOR           (BOOT_CFG_APP_END - FEATURE_FLS_PF_SECTOR_SIZE)
+
+/*Boot_Write and Boot_Finish results*/
+#define BOOT_OK                       (0u)
+#define BOOT_PENDING                  (1u)            /*Not possible yet, call again*/
+#define BOOT_FAILED                   (2u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+extern void Boot_Init(void);
+
+/*Start a download of an image of size bytes to address, which must be BOOT_CFG_APP_START. Erases the
+  trailer first, the previous application is invalid from now on. FALSE when the range is not allowed.
+  With delta the blocks are a delta image (Boot_Delta.h) against the application in flash*/
+extern boolean Boot_Start(u32bit address, u32bit size, boolean delta);
+
+/*Program the next length bytes of the image (or of the delta) from data, inside the MemPool block. The
+  block is freed once programmed. BOOT_PENDING while the previous block is being programmed*/
+extern u8bit Boot_Write(u8bit * block, const u8bit * data, u16bit length);
+
+/*End of the download: CRC-32 of the image programmed against crc, then the trailer. BOOT_PENDING
+  until done*/
+extern u8bit Boot_Finish(u32bit crc);
+
+/*Erase and programming steps, verification. Call it as often as possible, it never waits for the FTFC*/
+extern void Boot_MainFunction(void);
+
+/*TRUE when the trailer matches the CRC-32 of the programmed image and the vector table is plausible*/
+extern boolean Boot_AppValid(void);
+
+/*TRUE when the application passed Boot_AppValid before the last reset and its trailer did not change since*/
+extern boolean Boot_AppChecked(void);
+
+/*Start the application through its vector table, host builds return*/
+extern void Boot_JumpToApp(void);
+
+#endif /* BOOT_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Boot.h                                                      |
+ *| CMARTI  |  user-019   | 17-Oct-2026 | Delta downloads, trailer address exported                                    |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | Add Boot_AppChecked                                                          |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Images from the application start only                                       |
+***********************************************************************************************************************/
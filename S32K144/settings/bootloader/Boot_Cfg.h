@@ -0,0 +1,101 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Boot_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Boot_Cfg.h
+    Configuration of the bootloader.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef BOOT_CFG_H_
+#define BOOT_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "S32K144.h"
+#include "Os.h"
+#if defined (HOST_BUILD)
+#include "Ftfc_Host.h"
+#include "Can_Host.h"
+#else
+#include "Can.h"
+#endif
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Application region, from its vector table to the end of the P-Flash. Its last phrase is the trailer
+  written after a verified download. Targets keep the bootloader in the first 32 KB, link the application
+  with make APP_OFFSET=0x8000. Host builds have the whole simulated P-Flash for the application*/
+#if defined (HOST_BUILD)
+#define BOOT_CFG_APP_START            (0x00000000uL)
+#else
+#define BOOT_CFG_APP_START            (0x00008000uL)
+#endif
+#define BOOT_CFG_APP_END              (FEATURE_FLS_PF_SIZE)
+
+/*Stack pointer range accepted in the application vector table*/
+#define BOOT_CFG_RAM_START            (0x1FFF8000uL)
+#define BOOT_CFG_RAM_END              (0x20007000uL)
+
+/*Data bytes of a transfer block, multiple of the phrase size. Only the last block may be shorter*/
+#define BOOT_CFG_BLOCK_SIZE           (4088u)
+
+/*Old sectors a delta image can still copy from once erased, kept in RAM (4 KB each)*/
+#define BOOT_CFG_DELTA_WINDOW         (3u)
+
+/*Image bytes checked per Boot_MainFunction call while verifying*/
+#define BOOT_CFG_VERIFY_CHUNK         (1024u)
+
+/*Main ticks after reset during which a programming session request keeps a valid application from
+  being started*/
+#define BOOT_CFG_WAIT_TICKS           (50u)
+
+/*Warm starts of the application (StartupWarm_Record.warmResets) the bootloader starts it at once, without
+  waiting for a tester and without the image CRC. More in a row, e.g. a fault loop, take the normal path*/
+#define BOOT_CFG_FAST_RESETS          (3u)
+
+/*1 ms main tick of the bootloader loop and the CAN driver, polled. Host builds advance the simulated time of the FTFC by
+  BOOT_CFG_HOST_LOOP_US per loop*/
+#define BOOT_CFG_TICK_CYCLES          (OS_CFG_CORE_CLOCK_HZ / 1000u)
+#if defined (HOST_BUILD)
+#define BOOT_CFG_HOST_LOOP_US         (10u)
+#define BOOT_CFG_TICK_INIT()
+#define BOOT_CFG_TICK()               Boot_HostTick()
+#define BOOT_CFG_CAN_INIT()
+#define BOOT_CFG_CAN_MAIN()           ((void)Can_HostProcess())
+#else
+#define BOOT_CFG_TICK_INIT()          (S32_SysTick->RVR = BOOT_CFG_TICK_CYCLES - 1u, S32_SysTick->CVR = 0u, \
+                                       S32_SysTick->CSR = S32_SysTick_CSR_CLKSOURCE_MASK | S32_SysTick_CSR_ENABLE_MASK)
+#define BOOT_CFG_TICK()               ((S32_SysTick->CSR & S32_SysTick_CSR_COUNTFLAG_MASK) != 0u)
+#define BOOT_CFG_CAN_INIT()           Can_Init()
+#define BOOT_CFG_CAN_MAIN()           Can_MainFunction()
+#endif
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* BOOT_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Boot_Cfg.h                                                  |
+ *| CMARTI  |  user-019   | 17-Oct-2026 | Delta image window                                                           |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | Add BOOT_CFG_FAST_RESETS                                                     |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | FlexCAN driver on target                                                     |
+***********************************************************************************************************************/
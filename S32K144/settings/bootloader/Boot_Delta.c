@@ -0,0 +1,365 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Boot_Delta.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Boot_Delta.c
+    In place delta patcher. Sectors of the new image are erased and programmed in ascending order over the
+    old one, the old contents of the last BOOT_CFG_DELTA_WINDOW erased sectors stay in RAM, so the delta may
+    copy from them and from any old sector not erased yet. tools/DeltaGen/delta_gen.py only emits copies
+    inside that window and mirrors this decoder, keep both in line.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Boot_Delta.h"
+#include "Boot.h"
+#include "Fls.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Decoder stages*/
+#define BOOT_DELTA_HEADER             (0u)
+#define BOOT_DELTA_CONTROL            (1u)
+#define BOOT_DELTA_LENGTH             (2u)            /*LEB128 extension of the length*/
+#define BOOT_DELTA_ARGUMENT           (3u)            /*Fill byte, copy adjust or match distance*/
+#define BOOT_DELTA_DATA               (4u)
+
+/*Bits of a LEB128 value*/
+#define BOOT_DELTA_LEB_BITS           (32u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+/*Old contents of the last saved sectors, slot (address / sector size) % window*/
+static u8bit  Boot_DeltaWindow[BOOT_CFG_DELTA_WINDOW][FLS_SECTOR_SIZE];
+static u32bit Boot_DeltaSaved[BOOT_CFG_DELTA_WINDOW];
+static u32bit Boot_DeltaSavedEnd;               /*Old sectors below are erased*/
+
+static u32bit Boot_DeltaBegin;
+static u32bit Boot_DeltaEnd;
+static u32bit Boot_DeltaOldEnd;                 /*Old image bytes usable by copies, below*/
+static u32bit Boot_DeltaOldLength;
+static u32bit Boot_DeltaOldCrc;
+
+/*Token being decoded*/
+static u8bit  Boot_DeltaStage;
+static u8bit  Boot_DeltaToken;
+static u32bit Boot_DeltaCount;                  /*Header bytes or LEB128 bits read*/
+static u32bit Boot_DeltaValue;
+static u32bit Boot_DeltaLength;                 /*Bytes of the token left*/
+static u32bit Boot_DeltaShift;                  /*Old image source minus output address, modulo 2^32*/
+static u32bit Boot_DeltaDistance;
+static u8bit  Boot_DeltaFill;
+static u8bit  Boot_DeltaHeader[BOOT_DELTA_HEADER_SIZE];
+
+/*Output*/
+static u32bit Boot_DeltaOut;                    /*Address of the next byte*/
+static u8bit  Boot_DeltaPhrase[FLS_PHRASE_SIZE];
+static u32bit Boot_DeltaUsed;                   /*Bytes of Boot_DeltaPhrase*/
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static boolean Boot_DeltaCheckHeader(void);
+static boolean Boot_DeltaOpen(void);
+static boolean Boot_DeltaParse(u8bit byte);
+static boolean Boot_DeltaOld(u32bit address, u8bit * byte);
+static boolean Boot_DeltaNew(u32bit distance, u8bit * byte);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+static inline u32bit Boot_DeltaGet32(const u8bit * data)
+{
+    return ((u32bit)data[0]) | ((u32bit)data[1] << 8) | ((u32bit)data[2] << 16) | ((u32bit)data[3] << 24);
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * The delta has to be made from the image the trailer describes and to the size of the download.
+ */
+static boolean Boot_DeltaCheckHeader(void)
+{
+    return ((Boot_DeltaGet32(&Boot_DeltaHeader[0]) == BOOT_DELTA_MAGIC) &&
+            (Boot_DeltaGet32(&Boot_DeltaHeader[4]) == Boot_DeltaOldLength) &&
+            (Boot_DeltaGet32(&Boot_DeltaHeader[8]) == Boot_DeltaOldCrc) &&
+            (Boot_DeltaGet32(&Boot_DeltaHeader[12]) == (Boot_DeltaEnd - Boot_DeltaBegin))) ? TRUE : FALSE;
+}
+
+/*
+ * Length complete: the argument of the token follows, the data of literals directly.
+ */
+static boolean Boot_DeltaOpen(void)
+{
+    u32bit minimum = ((Boot_DeltaToken == BOOT_DELTA_TOKEN_LIT) || (Boot_DeltaToken == BOOT_DELTA_TOKEN_FILL)) ? 1u :
+                     ((Boot_DeltaToken == BOOT_DELTA_TOKEN_COPY) ? BOOT_DELTA_COPY_MIN : BOOT_DELTA_MATCH_MIN);
+
+    Boot_DeltaLength = Boot_DeltaValue + minimum;
+    Boot_DeltaStage = (Boot_DeltaToken == BOOT_DELTA_TOKEN_LIT) ? BOOT_DELTA_DATA : BOOT_DELTA_ARGUMENT;
+    Boot_DeltaValue = 0u;
+    Boot_DeltaCount = 0u;
+    return (Boot_DeltaLength >= minimum) ? TRUE : FALSE;
+}
+
+/*
+ * One input byte of the header or of a token, up to its data. FALSE when it is invalid.
+ */
+static boolean Boot_DeltaParse(u8bit byte)
+{
+    boolean valid = TRUE;
+
+    switch (Boot_DeltaStage)
+    {
+        case BOOT_DELTA_HEADER:
+            Boot_DeltaHeader[Boot_DeltaCount] = byte;
+            Boot_DeltaCount++;
+            if (Boot_DeltaCount == BOOT_DELTA_HEADER_SIZE)
+            {
+                valid = Boot_DeltaCheckHeader();
+                Boot_DeltaStage = BOOT_DELTA_CONTROL;
+            }
+            break;
+
+        case BOOT_DELTA_CONTROL:
+            Boot_DeltaToken = byte & BOOT_DELTA_TOKEN_MASK;
+            Boot_DeltaValue = byte & BOOT_DELTA_LEN_MASK;
+            Boot_DeltaCount = 0u;
+            if (Boot_DeltaValue == BOOT_DELTA_LEN_MASK)
+            {
+                Boot_DeltaStage = BOOT_DELTA_LENGTH;
+            }
+            else
+            {
+                valid = Boot_DeltaOpen();
+            }
+            break;
+
+        case BOOT_DELTA_LENGTH:
+        case BOOT_DELTA_ARGUMENT:
+            if ((Boot_DeltaStage == BOOT_DELTA_ARGUMENT) && (Boot_DeltaToken == BOOT_DELTA_TOKEN_FILL))
+            {
+                Boot_DeltaFill = byte;
+                Boot_DeltaStage = BOOT_DELTA_DATA;
+            }
+            else if (Boot_DeltaCount >= BOOT_DELTA_LEB_BITS)
+            {
+                valid = FALSE;
+            }
+            else
+            {
+                Boot_DeltaValue += ((u32bit)byte & 0x7Fu) << Boot_DeltaCount;
+                Boot_DeltaCount += 7u;
+                if ((byte & 0x80u) != 0u)
+                {
+                }
+                else if (Boot_DeltaStage == BOOT_DELTA_LENGTH)
+                {
+                    valid = Boot_DeltaOpen();
+                }
+                else if (Boot_DeltaToken == BOOT_DELTA_TOKEN_COPY)
+                {
+                    /*Zigzag: even values move the source forward, odd ones back*/
+                    Boot_DeltaShift += (Boot_DeltaValue >> 1) ^ (0u - (Boot_DeltaValue & 1u));
+                    Boot_DeltaStage = BOOT_DELTA_DATA;
+                }
+                else
+                {
+                    Boot_DeltaDistance = Boot_DeltaValue;
+                    Boot_DeltaStage = BOOT_DELTA_DATA;
+                }
+            }
+            break;
+
+        default:
+            valid = FALSE;
+            break;
+    }
+    return valid;
+}
+
+/*
+ * Old image byte, from the window once its sector is erased. Bytes of the erased sectors older than the
+ * window, of the trailer sector and past the old image are not available.
+ */
+static boolean Boot_DeltaOld(u32bit address, u8bit * byte)
+{
+    u32bit sector = address & ~(FLS_SECTOR_SIZE - 1u);
+    u32bit slot = (address / FLS_SECTOR_SIZE) % BOOT_CFG_DELTA_WINDOW;
+    boolean valid = FALSE;
+
+    if ((address < Boot_DeltaBegin) || (address >= Boot_DeltaOldEnd))
+    {
+    }
+    else if (sector >= Boot_DeltaSavedEnd)
+    {
+        *byte = *Fls_Memory(address);
+        valid = TRUE;
+    }
+    else if (Boot_DeltaSaved[slot] == sector)
+    {
+        *byte = Boot_DeltaWindow[slot][address - sector];
+        valid = TRUE;
+    }
+    else
+    {
+    }
+    return valid;
+}
+
+/*
+ * New image byte distance bytes back, from the phrase being built or from the flash already programmed.
+ */
+static boolean Boot_DeltaNew(u32bit distance, u8bit * byte)
+{
+    boolean valid = FALSE;
+
+    if ((distance != 0u) && (distance <= (Boot_DeltaOut - Boot_DeltaBegin)))
+    {
+        if (distance <= Boot_DeltaUsed)
+        {
+            *byte = Boot_DeltaPhrase[Boot_DeltaUsed - distance];
+        }
+        else
+        {
+            *byte = *Fls_Memory(Boot_DeltaOut - distance);
+        }
+        valid = TRUE;
+    }
+    return valid;
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Boot_DeltaStart(u32bit begin, u32bit end, u32bit oldLength, u32bit oldCrc)
+{
+    u32bit slot;
+
+    for (slot = 0u; slot < BOOT_CFG_DELTA_WINDOW; slot++)
+    {
+        Boot_DeltaSaved[slot] = BOOT_CFG_APP_END;
+    }
+    Boot_DeltaSavedEnd = begin;
+    Boot_DeltaBegin = begin;
+    Boot_DeltaEnd = end;
+    Boot_DeltaOldLength = oldLength;
+    Boot_DeltaOldCrc = oldCrc;
+    Boot_DeltaOldEnd = ((oldLength <= (BOOT_TRAILER_SECTOR - begin)) ? (begin + oldLength) : BOOT_TRAILER_SECTOR);
+    Boot_DeltaStage = BOOT_DELTA_HEADER;
+    Boot_DeltaCount = 0u;
+    Boot_DeltaShift = 0u;
+    Boot_DeltaOut = begin;
+    Boot_DeltaUsed = 0u;
+}
+
+void Boot_DeltaSave(u32bit address)
+{
+    u32bit slot = (address / FLS_SECTOR_SIZE) % BOOT_CFG_DELTA_WINDOW;
+    const u8bit * old = Fls_Memory(address);
+    u32bit i;
+
+    for (i = 0u; i < FLS_SECTOR_SIZE; i++)
+    {
+        Boot_DeltaWindow[slot][i] = old[i];
+    }
+    Boot_DeltaSaved[slot] = address;
+    Boot_DeltaSavedEnd = address + FLS_SECTOR_SIZE;
+}
+
+/*
+ * The last phrase of the image is padded with erased bytes. Output past the end of the image is an error.
+ */
+u8bit Boot_DeltaDecode(const u8bit ** data, u32bit * left, const u8bit ** phrase)
+{
+    u8bit result = BOOT_DELTA_ERROR;
+    u8bit byte = 0u;
+    boolean valid = TRUE;
+    boolean run = TRUE;
+
+    while ((run == TRUE) && (valid == TRUE))
+    {
+        if ((Boot_DeltaUsed == FLS_PHRASE_SIZE) || ((Boot_DeltaOut == Boot_DeltaEnd) && (Boot_DeltaUsed != 0u)))
+        {
+            while (Boot_DeltaUsed < FLS_PHRASE_SIZE)
+            {
+                Boot_DeltaPhrase[Boot_DeltaUsed] = 0xFFu;
+                Boot_DeltaUsed++;
+            }
+            *phrase = Boot_DeltaPhrase;
+            Boot_DeltaUsed = 0u;
+            result = BOOT_DELTA_PHRASE;
+            run = FALSE;
+        }
+        else if ((Boot_DeltaStage == BOOT_DELTA_DATA) && (Boot_DeltaOut == Boot_DeltaEnd))
+        {
+            valid = FALSE;
+        }
+        else if ((Boot_DeltaStage == BOOT_DELTA_DATA) && ((Boot_DeltaToken != BOOT_DELTA_TOKEN_LIT) || (*left != 0u)))
+        {
+            switch (Boot_DeltaToken)
+            {
+                case BOOT_DELTA_TOKEN_LIT:
+                    byte = **data;
+                    (*data)++;
+                    (*left)--;
+                    break;
+                case BOOT_DELTA_TOKEN_FILL:
+                    byte = Boot_DeltaFill;
+                    break;
+                case BOOT_DELTA_TOKEN_COPY:
+                    valid = Boot_DeltaOld(Boot_DeltaOut + Boot_DeltaShift, &byte);
+                    break;
+                default:
+                    valid = Boot_DeltaNew(Boot_DeltaDistance, &byte);
+                    break;
+            }
+            Boot_DeltaPhrase[Boot_DeltaUsed] = byte;
+            Boot_DeltaUsed++;
+            Boot_DeltaOut++;
+            Boot_DeltaLength--;
+            if (Boot_DeltaLength == 0u)
+            {
+                Boot_DeltaStage = BOOT_DELTA_CONTROL;
+            }
+        }
+        else if (*left != 0u)
+        {
+            valid = Boot_DeltaParse(**data);
+            (*data)++;
+            (*left)--;
+        }
+        else
+        {
+            result = BOOT_DELTA_MORE;
+            run = FALSE;
+        }
+    }
+    return result;
+}
+
+boolean Boot_DeltaDone(void)
+{
+    return ((Boot_DeltaStage == BOOT_DELTA_CONTROL) && (Boot_DeltaOut == Boot_DeltaEnd) && (Boot_DeltaUsed == 0u)) ?
+           TRUE : FALSE;
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-019   | 17-Oct-2026 | First version of Boot_Delta.c                                                |
+***********************************************************************************************************************/
@@ -0,0 +1,78 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Boot_Delta.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Boot_Delta.h
+    In place delta patcher of the bootloader. Rebuilds the new application image from a delta produced by
+    tools/DeltaGen and the old image in flash, streaming, phrase by phrase.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef BOOT_DELTA_H_
+#define BOOT_DELTA_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Boot_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Delta image: header {BOOT_DELTA_MAGIC, old image length, old image CRC-32, new image length}, little endian,
+  then the tokens. A token is a control byte, token type in the upper 2 bits, length in the lower 6 bits
+  extended with LEB128 when all of them are set (as the init images of Startup_Mem)*/
+#define BOOT_DELTA_MAGIC              (0x41544C44uL)  /*"DLTA"*/
+#define BOOT_DELTA_HEADER_SIZE        (16u)
+
+#define BOOT_DELTA_TOKEN_MASK         (0xC0u)
+#define BOOT_DELTA_TOKEN_LIT          (0x00u)         /*len + 1 literal bytes follow*/
+#define BOOT_DELTA_TOKEN_FILL         (0x40u)         /*len + 1 times the byte that follows*/
+#define BOOT_DELTA_TOKEN_COPY         (0x80u)         /*len + 3 bytes of the old image, source adjust follows*/
+#define BOOT_DELTA_TOKEN_MATCH        (0xC0u)         /*len + 3 bytes of the new image, LEB128 distance follows*/
+#define BOOT_DELTA_LEN_MASK           (0x3Fu)
+#define BOOT_DELTA_COPY_MIN           (3u)
+#define BOOT_DELTA_MATCH_MIN          (3u)
+
+/*Boot_DeltaDecode results*/
+#define BOOT_DELTA_PHRASE             (0u)            /*Next phrase of the new image ready*/
+#define BOOT_DELTA_MORE               (1u)            /*Input used up*/
+#define BOOT_DELTA_ERROR              (2u)            /*Corrupted delta or not made for the image in flash*/
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*New image from begin to end, patched over the old one of oldLength bytes and CRC-32 oldCrc (trailer)*/
+extern void Boot_DeltaStart(u32bit begin, u32bit end, u32bit oldLength, u32bit oldCrc);
+
+/*Keep the old contents of the sector at address before it is erased. Sectors are saved in ascending
+  order, the last BOOT_CFG_DELTA_WINDOW ones stay readable for copies*/
+extern void Boot_DeltaSave(u32bit address);
+
+/*Decode input until the next phrase is complete, *phrase points to it until the next call. The FTFC
+  must be idle, copies read the flash*/
+extern u8bit Boot_DeltaDecode(const u8bit ** data, u32bit * left, const u8bit ** phrase);
+
+/*TRUE once the new image is complete and every token used*/
+extern boolean Boot_DeltaDone(void);
+
+#endif /* BOOT_DELTA_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-019   | 17-Oct-2026 | First version of Boot_Delta.h                                                |
+***********************************************************************************************************************/
@@ -0,0 +1,119 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Boot_Main.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Boot_Main.c
+    Bootloader main loop (make BOOT=1). A valid application is started unless a programming session is
+    requested within BOOT_CFG_WAIT_TICKS, otherwise the UDS server waits for a download. The FTFC is
+    served on every loop, the communication stack on the 1 ms tick.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Boot.h"
+#include "MemPool.h"
+#include "Timer.h"
+#include "CanTp.h"
+#include "Dcm.h"
+#include "Crc.h"
+#include "Startup_Warm.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+#if defined (HOST_BUILD)
+static boolean Boot_HostTick(void);
+#endif
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+#if defined (HOST_BUILD)
+/*
+ * Simulated time of a loop, TRUE on every millisecond.
+ */
+static boolean Boot_HostTick(void)
+{
+    u32bit before = Ftfc_HostTimeUs / 1000u;
+
+    Ftfc_HostAdvance(BOOT_CFG_HOST_LOOP_US);
+    return ((Ftfc_HostTimeUs / 1000u) != before) ? TRUE : FALSE;
+}
+#endif
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+int main (void)
+{
+    u32bit wait = BOOT_CFG_WAIT_TICKS;
+
+    BOOT_CFG_TICK_INIT();
+    (void)MemPool_Init();
+    Timer_Init();
+    BOOT_CFG_CAN_INIT();
+    CanTp_Init();
+    Dcm_Init();
+    Crc_Init();
+    Boot_Init();
+
+    /* Watchdog, lockup or fault reset of a checked application: restart it without the tester window */
+    if ((StartupWarm_IsWarm() == TRUE) && (StartupWarm_Record.requested == 0u) &&
+        (StartupWarm_Record.warmResets < BOOT_CFG_FAST_RESETS) && (Boot_AppChecked() == TRUE))
+    {
+        Boot_JumpToApp();
+    }
+
+    for (;;)
+    {
+        Boot_MainFunction();
+        if (BOOT_CFG_TICK() == TRUE)
+        {
+            BOOT_CFG_CAN_MAIN();
+            CanTp_MainFunction();
+            Dcm_MainFunction();
+            Timer_Tick();
+            if (wait != 0u)
+            {
+                wait--;
+                if ((wait == 0u) && (Dcm_GetSession() != DCM_SESSION_PROGRAMMING) && (Boot_AppValid() == TRUE))
+                {
+                    Boot_JumpToApp();
+                }
+            }
+        }
+    }
+    return EXIT_PROGRAM;
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Boot_Main.c                                                 |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | Crc_Init                                                                     |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | Warm start fast path                                                         |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | CAN driver initialization                                                    |
+***********************************************************************************************************************/
@@ -0,0 +1,208 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Can_Host.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Can_Host.c
+    Virtual CAN loopback of the host build (make HOST=1). Every frame written is delivered to
+    CanTp_RxIndication in order by Can_HostProcess, so the Dcm channel and the tester channel of CanTp
+    talk to each other through the same bus. Can_HostMcrWrite acknowledges the mode requests of the
+    FlexCAN driver on its register stub.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Can_Host.h"
+#if defined (HOST_BUILD)
+#include "CanTp.h"
+#include "MemPool.h"
+#include "Os.h"
+#include "S32K144.h"
+#include "Queue.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define CAN_HOST_DLC                  (8u)
+
+typedef struct
+{
+    u32bit id;
+    u8bit  data[CAN_HOST_DLC];
+} Can_HostFrameType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+u32bit Can_HostFrameCount = 0u;
+u32bit Can_HostTesterTxFailures = 0u;
+u32bit Can_HostTesterTxConfirmations = 0u;
+u32bit Can_HostTesterLockedCalls = 0u;
+
+QUEUE_SPSC_DEFINE(Can_HostBus, Can_HostFrameType, CAN_HOST_FRAMES);
+
+static u8bit * Can_HostTesterBuffer = NULL;
+static u16bit  Can_HostTesterLength;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void Can_HostTesterCheckUnlocked(void);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Counts a callback made while Os_SuspendAllInterrupts (or an ISR) masks the tick.
+ */
+static void Can_HostTesterCheckUnlocked(void)
+{
+    u32bit state = Os_PortDisableInterrupts();
+
+    if (state != 0u)
+    {
+        Can_HostTesterLockedCalls++;
+    }
+    Os_PortRestoreInterrupts(state);
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Can_HostMcrWrite(u32bit value)
+{
+    u32bit ack = 0u;
+
+    if ((value & CAN_MCR_MDIS_MASK) != 0u)
+    {
+        ack = CAN_MCR_LPMACK_MASK | CAN_MCR_NOTRDY_MASK;
+    }
+    else if ((value & (CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK)) == (CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK))
+    {
+        ack = CAN_MCR_FRZACK_MASK | CAN_MCR_NOTRDY_MASK;
+    }
+    else
+    {
+    }
+    CAN0->MCR = (value & ~(CAN_MCR_LPMACK_MASK | CAN_MCR_FRZACK_MASK | CAN_MCR_NOTRDY_MASK)) | ack;
+}
+
+boolean Can_HostWrite(u32bit id, const u8bit * data)
+{
+    Can_HostFrameType frame;
+    u32bit i;
+    boolean written;
+
+    frame.id = id;
+    for (i = 0u; i < CAN_HOST_DLC; i++)
+    {
+        frame.data[i] = data[i];
+    }
+    written = Queue_SpscPush(&Can_HostBus, &frame);
+    if (written == TRUE)
+    {
+        Can_HostFrameCount++;
+    }
+    return written;
+}
+
+u32bit Can_HostProcess(void)
+{
+    return Can_HostDeliver(0xFFFFFFFFu);
+}
+
+u32bit Can_HostDeliver(u32bit frames)
+{
+    Can_HostFrameType frame;
+    u32bit count = 0u;
+
+    while ((count < frames) && (Queue_SpscPop(&Can_HostBus, &frame) == TRUE))
+    {
+        CanTp_RxIndication(frame.id, frame.data, CAN_HOST_DLC);
+        count++;
+    }
+    return count;
+}
+
+boolean Can_HostRead(u32bit * id, u8bit * data)
+{
+    Can_HostFrameType frame;
+    u32bit i;
+    boolean read = Queue_SpscPop(&Can_HostBus, &frame);
+
+    if (read == TRUE)
+    {
+        *id = frame.id;
+        for (i = 0u; i < CAN_HOST_DLC; i++)
+        {
+            data[i] = frame.data[i];
+        }
+    }
+    return read;
+}
+
+boolean Can_HostTesterRequest(const u8bit * request, u16bit length)
+{
+    return CanTp_Transmit(CANTP_CHANNEL_Tester, NULL, 0u, request, length);
+}
+
+const u8bit * Can_HostTesterResponse(u16bit * length)
+{
+    *length = Can_HostTesterLength;
+    return Can_HostTesterBuffer;
+}
+
+void Can_HostTesterRelease(void)
+{
+    MemPool_Free(Can_HostTesterBuffer);
+    Can_HostTesterBuffer = NULL;
+}
+
+/*
+ * A response not released yet is replaced.
+ */
+void Can_HostTesterRxIndication(u8bit channel, u8bit * buffer, u16bit length)
+{
+    (void)channel;
+    Can_HostTesterCheckUnlocked();
+    MemPool_Free(Can_HostTesterBuffer);
+    Can_HostTesterBuffer = buffer;
+    Can_HostTesterLength = length;
+}
+
+void Can_HostTesterTxConfirmation(u8bit channel, boolean ok)
+{
+    (void)channel;
+    Can_HostTesterCheckUnlocked();
+    Can_HostTesterTxConfirmations++;
+    if (ok == FALSE)
+    {
+        Can_HostTesterTxFailures++;
+    }
+}
+
+#endif /* HOST_BUILD */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of Can_Host.c                                                  |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | Tester confirmation and locked callback counters                             |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | FlexCAN mode simulation for the Can driver                                   |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Can_HostDeliver                                                              |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | Can_HostRead, the far end of a channel in tests                              |
+***********************************************************************************************************************/
@@ -0,0 +1,86 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Can_Host.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Can_Host.h
+    Virtual CAN loopback of the host build (make HOST=1) and the tester end of the diagnostic channel.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CAN_HOST_H_
+#define CAN_HOST_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Frames the bus holds before Can_HostWrite reports no free mailbox, power of two*/
+#define CAN_HOST_FRAMES               (32u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+/*Frames written since start, for bus load figures*/
+extern u32bit Can_HostFrameCount;
+
+/*Tester requests that CanTp could not send completely*/
+extern u32bit Can_HostTesterTxFailures;
+
+/*Tester confirmations, and tester callbacks entered with interrupts masked (CanTp must call them unlocked)*/
+extern u32bit Can_HostTesterTxConfirmations;
+extern u32bit Can_HostTesterLockedCalls;
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*FlexCAN MCR write of the Can driver: the mode acknowledge bits (LPMACK, FRZACK, NOTRDY) follow at once*/
+extern void Can_HostMcrWrite(u32bit value);
+
+/*Put an 8 byte frame on the bus, FALSE when it is full*/
+extern boolean Can_HostWrite(u32bit id, const u8bit * data);
+
+/*Deliver the frames on the bus to CanTp_RxIndication, including the ones written meanwhile. Returns
+  the number of frames delivered*/
+extern u32bit Can_HostProcess(void);
+
+/*Deliver at most frames frames, for bus rate simulations. Returns the number delivered*/
+extern u32bit Can_HostDeliver(u32bit frames);
+
+/*Take the oldest frame off the bus without delivering it, FALSE when the bus is empty. Lets a test play the
+  other end of a channel, its flow control frames included*/
+extern boolean Can_HostRead(u32bit * id, u8bit * data);
+
+/*Send a request to the Dcm channel, request is used in place until it is sent*/
+extern boolean Can_HostTesterRequest(const u8bit * request, u16bit length);
+
+/*Last response received by the tester, NULL when none. Valid until Can_HostTesterRelease*/
+extern const u8bit * Can_HostTesterResponse(u16bit * length);
+extern void Can_HostTesterRelease(void);
+
+/*CanTp callbacks of the Tester channel*/
+extern void Can_HostTesterRxIndication(u8bit channel, u8bit * buffer, u16bit length);
+extern void Can_HostTesterTxConfirmation(u8bit channel, boolean ok);
+
+#endif /* CAN_HOST_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of Can_Host.h                                                  |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | Tester confirmation and locked callback counters                             |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | FlexCAN mode simulation for the Can driver                                   |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Can_HostDeliver                                                              |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | Can_HostRead, the far end of a channel in tests                              |
+***********************************************************************************************************************/
@@ -0,0 +1,137 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Crc_Host.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Crc_Host.c
+    CRC peripheral simulation of the host build, see Crc_Host.h.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Crc_Host.h"
+#if defined (HOST_BUILD)
+#include "Core_CM4.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+/*Internal CRC register, 16 bit CRCs use the low half*/
+static u32bit Crc_HostValue = 0u;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static u32bit Crc_HostTranspose(u32bit value, u32bit size, u32bit type);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Width mask of the configured CRC.
+ */
+static inline u32bit Crc_HostMask(void)
+{
+    return ((CRC->CTRL & CRC_CTRL_TCRC_MASK) != 0u) ? 0xFFFFFFFFuL : 0x0000FFFFuL;
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Transposition type of TOT/TOTR applied to the size bytes of value.
+ */
+static u32bit Crc_HostTranspose(u32bit value, u32bit size, u32bit type)
+{
+    u32bit result = value;
+    u32bit bits;
+
+    if ((type == CRC_TRANSPOSE_BITS) || (type == CRC_TRANSPOSE_BITS_AND_BYTES))
+    {
+        REV_BITS_32(value, bits);
+        /*Bits in every byte: reverse all, then the byte order back*/
+        REV_BYTES_32(bits, result);
+    }
+    else
+    {
+    }
+    if ((size == 4u) && ((type == CRC_TRANSPOSE_BITS_AND_BYTES) || (type == CRC_TRANSPOSE_BYTES)))
+    {
+        bits = result;
+        REV_BYTES_32(bits, result);
+    }
+    else
+    {
+    }
+    return result;
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Crc_HostWrite(u32bit value, u32bit size)
+{
+    u32bit ctrl = CRC->CTRL;
+    u32bit mask = Crc_HostMask();
+    u32bit top = (mask >> 1) + 1u;
+    u32bit data;
+    u32bit bit;
+
+    if ((ctrl & CRC_CTRL_WAS_MASK) != 0u)
+    {
+        Crc_HostValue = value & mask;
+    }
+    else
+    {
+        data = Crc_HostTranspose(value, size, (ctrl >> CRC_CTRL_TOT_SHIFT) & 3u);
+        for (bit = size * 8u; bit != 0u; bit--)
+        {
+            if ((((Crc_HostValue & top) != 0u) ? 1u : 0u) != ((data >> (bit - 1u)) & 1u))
+            {
+                Crc_HostValue = ((Crc_HostValue << 1) ^ CRC->GPOLY) & mask;
+            }
+            else
+            {
+                Crc_HostValue = (Crc_HostValue << 1) & mask;
+            }
+        }
+    }
+}
+
+u32bit Crc_HostRead(void)
+{
+    u32bit ctrl = CRC->CTRL;
+    u32bit value = Crc_HostTranspose(Crc_HostValue, 4u, (ctrl >> CRC_CTRL_TOTR_SHIFT) & 3u);
+
+    if ((ctrl & CRC_CTRL_FXOR_MASK) != 0u)
+    {
+        value ^= Crc_HostMask();
+    }
+    else
+    {
+    }
+    return value;
+}
+
+#endif /* HOST_BUILD */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | First version of Crc_Host.c                                                  |
+***********************************************************************************************************************/
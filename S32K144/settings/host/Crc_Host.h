@@ -0,0 +1,51 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Crc_Host.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Crc_Host.h
+    CRC peripheral simulation of the host build (make HOST=1), after the reference manual: GPOLY and CTRL are
+    taken from the CRC register stub, data is shifted MSB first after the TOT transposition, seeds (CTRL WAS)
+    are loaded as written and reads apply TOTR and FXOR.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CRC_HOST_H_
+#define CRC_HOST_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Write of size bytes (1 = DATA LL lane, 4 = DATA) to the data register*/
+extern void Crc_HostWrite(u32bit value, u32bit size);
+
+/*Read of the data register*/
+extern u32bit Crc_HostRead(void);
+
+#endif /* CRC_HOST_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | First version of Crc_Host.h                                                  |
+***********************************************************************************************************************/
@@ -0,0 +1,168 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Ftfc_Host.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Ftfc_Host.c
+    FTFC simulation of the host build (make HOST=1). A launched command runs for its data sheet time
+    in simulated microseconds, its effect on the P-Flash contents is applied on completion. Programming
+    clears bits only, like the flash cells, a phrase that does not read back as written sets MGSTAT0.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Ftfc_Host.h"
+#if defined (HOST_BUILD)
+#include "S32K144.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define FTFC_HOST_ERRORS              (FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+u32bit Ftfc_HostTimeUs = 0u;
+u32bit Ftfc_HostBusyUs = 0u;
+
+static u8bit   Ftfc_HostFlash[FEATURE_FLS_PF_SIZE];
+static boolean Ftfc_HostErased = FALSE;
+
+/*Running command, applied when Ftfc_HostLeftUs reaches 0*/
+static u8bit  Ftfc_HostCommand;
+static u32bit Ftfc_HostAddress;
+static u8bit  Ftfc_HostData[FEATURE_FLS_PF_WRITE_UNIT_SIZE];
+static u32bit Ftfc_HostLeftUs = 0u;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void Ftfc_HostComplete(void);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+static inline u8bit Ftfc_HostFccob(u32bit n)
+{
+    return FTFC->FCCOB[FTFC_FCCOB_INDEX(n)];
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+static void Ftfc_HostComplete(void)
+{
+    u8bit * flash = Ftfc_HostMemory();
+    u32bit i;
+
+    if (Ftfc_HostCommand == FTFC_CMD_ERASE_SECTOR)
+    {
+        for (i = 0u; i < FEATURE_FLS_PF_SECTOR_SIZE; i++)
+        {
+            flash[Ftfc_HostAddress + i] = 0xFFu;
+        }
+    }
+    else
+    {
+        for (i = 0u; i < FEATURE_FLS_PF_WRITE_UNIT_SIZE; i++)
+        {
+            flash[Ftfc_HostAddress + i] &= Ftfc_HostData[i];
+            if (flash[Ftfc_HostAddress + i] != Ftfc_HostData[i])
+            {
+                FTFC->FSTAT |= FTFC_FSTAT_MGSTAT0_MASK;
+            }
+        }
+    }
+    FTFC->FSTAT |= FTFC_FSTAT_CCIF_MASK;
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+u8bit * Ftfc_HostMemory(void)
+{
+    u32bit i;
+
+    if (Ftfc_HostErased == FALSE)
+    {
+        for (i = 0u; i < FEATURE_FLS_PF_SIZE; i++)
+        {
+            Ftfc_HostFlash[i] = 0xFFu;
+        }
+        Ftfc_HostErased = TRUE;
+    }
+    return Ftfc_HostFlash;
+}
+
+/*
+ * Launch with an error flag still set, an unknown command or a misaligned address sets ACCERR and
+ * completes at once, as the FTFC does.
+ */
+void Ftfc_HostLaunch(void)
+{
+    u32bit align;
+    u32bit i;
+
+    if ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) != 0u)
+    {
+        Ftfc_HostCommand = Ftfc_HostFccob(0u);
+        Ftfc_HostAddress = ((u32bit)Ftfc_HostFccob(1u) << 16) | ((u32bit)Ftfc_HostFccob(2u) << 8) |
+                           Ftfc_HostFccob(3u);
+        align = (Ftfc_HostCommand == FTFC_CMD_ERASE_SECTOR) ? FEATURE_FLS_PF_SECTOR_SIZE :
+                                                              FEATURE_FLS_PF_WRITE_UNIT_SIZE;
+        FTFC->FSTAT &= (u8bit)~FTFC_FSTAT_MGSTAT0_MASK;
+        if (((FTFC->FSTAT & FTFC_HOST_ERRORS) != 0u) || ((Ftfc_HostAddress & (align - 1u)) != 0u) ||
+            (Ftfc_HostAddress >= FEATURE_FLS_PF_SIZE) ||
+            ((Ftfc_HostCommand != FTFC_CMD_ERASE_SECTOR) && (Ftfc_HostCommand != FTFC_CMD_PROGRAM_PHRASE)))
+        {
+            FTFC->FSTAT |= FTFC_FSTAT_ACCERR_MASK;
+        }
+        else
+        {
+            for (i = 0u; i < FEATURE_FLS_PF_WRITE_UNIT_SIZE; i++)
+            {
+                Ftfc_HostData[i] = Ftfc_HostFccob(4u + i);
+            }
+            Ftfc_HostLeftUs = (Ftfc_HostCommand == FTFC_CMD_ERASE_SECTOR) ? FTFC_HOST_ERASE_SECTOR_US :
+                                                                            FTFC_HOST_PROGRAM_PHRASE_US;
+            FTFC->FSTAT &= (u8bit)~FTFC_FSTAT_CCIF_MASK;
+        }
+    }
+}
+
+void Ftfc_HostAdvance(u32bit us)
+{
+    u32bit step;
+
+    Ftfc_HostTimeUs += us;
+    if (Ftfc_HostLeftUs != 0u)
+    {
+        step = (us < Ftfc_HostLeftUs) ? us : Ftfc_HostLeftUs;
+        Ftfc_HostLeftUs -= step;
+        Ftfc_HostBusyUs += step;
+        if (Ftfc_HostLeftUs == 0u)
+        {
+            Ftfc_HostComplete();
+        }
+    }
+}
+
+#endif /* HOST_BUILD */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Ftfc_Host.c                                                 |
+***********************************************************************************************************************/
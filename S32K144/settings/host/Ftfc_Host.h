@@ -0,0 +1,58 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Ftfc_Host.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Ftfc_Host.h
+    FTFC simulation of the host build (make HOST=1): P-Flash contents and command timing.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef FTFC_HOST_H_
+#define FTFC_HOST_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Command times, typical values of the S32K144 data sheet*/
+#define FTFC_HOST_PROGRAM_PHRASE_US   (90u)
+#define FTFC_HOST_ERASE_SECTOR_US     (12000u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+/*Simulated time and the part of it the FTFC was running a command*/
+extern u32bit Ftfc_HostTimeUs;
+extern u32bit Ftfc_HostBusyUs;
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Simulated P-Flash, FEATURE_FLS_PF_SIZE bytes, erased on the first call*/
+extern u8bit * Ftfc_HostMemory(void);
+
+/*Command launch (FSTAT CCIF written with 1): checks the FCCOB command and clears CCIF*/
+extern void Ftfc_HostLaunch(void);
+
+/*Advance the simulated time by us, the running command completes when its time has elapsed*/
+extern void Ftfc_HostAdvance(u32bit us);
+
+#endif /* FTFC_HOST_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Ftfc_Host.h                                                 |
+***********************************************************************************************************************/
@@ -0,0 +1,66 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: S32K144_Host.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \S32K144_Host.c
+    Register stubs of the host build (make HOST=1).
+    Every peripheral of S32K144.h is a plain RAM structure here, drivers read back what they wrote and
+    host code can preset status bits before calling them. Registers start at their reset value.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "S32K144.h"
+#if defined (HOST_BUILD)
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define S32K144_HOST_CPUID                  (0x410FC241u)   /*Cortex-M4 r0p1*/
+#define S32K144_HOST_WDOG_CS                (0x00002980u)   /*Watchdog enabled, LPO clock, updates allowed*/
+#define S32K144_HOST_WDOG_TOVAL             (0x00000400u)
+#define S32K144_HOST_FTFC_FSTAT             (0x80u)         /*No command running*/
+#define S32K144_HOST_RCM_SRS                (0x82u)         /*Power on reset*/
+#define S32K144_HOST_CAN_MCR                (0xD890000Fu)   /*Disabled, freeze and halt requested*/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+S32_SCB_Type       S32_SCB_Type_Stub       = { .CPUID = S32K144_HOST_CPUID };
+S32_SysTick_Type   S32_SysTick_Type_Stub;
+S32_CoreDebug_Type S32_CoreDebug_Type_Stub;
+S32_DWT_Type       S32_DWT_Type_Stub;
+S32_NVIC_Type      S32_NVIC_Type_Stub;
+WDOG_Type          WDOG_Type_Stub          = { .CS = S32K144_HOST_WDOG_CS, .TOVAL = S32K144_HOST_WDOG_TOVAL };
+SMC_Type           SMC_Type_Stub;
+FTFC_Type          FTFC_Type_Stub          = { .FSTAT = S32K144_HOST_FTFC_FSTAT };
+PCC_Type           PCC_Type_Stub;
+CRC_Type           CRC_Type_Stub;
+RCM_Type           RCM_Type_Stub           = { .SRS = S32K144_HOST_RCM_SRS };
+PORT_Type          PORT_Type_Stub;
+CAN_Type           CAN_Type_Stub           = { .MCR = S32K144_HOST_CAN_MCR };
+
+#endif /* HOST_BUILD */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-013   | 17-Oct-2026 | First version of S32K144_Host.c                                              |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Add FTFC                                                                     |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | Add PCC and CRC                                                              |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | Add RCM stub, power on reset status                                          |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Add PORT and FlexCAN stubs                                                   |
+***********************************************************************************************************************/
@@ -0,0 +1,437 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Startup_Mem.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Startup_Mem.c
+    Startup memory engine used to initialize .data, .code_ram, .bss and the RAM vector table.
+    Every routine runs before .data and .bss exist, so no static storage is used here and nothing
+    in this file may be placed in .code_ram.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Startup_Mem.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define STARTUP_MEM_WORD_SIZE     ((u32bit)sizeof(u32bit))
+#define STARTUP_MEM_WORD_MASK     ((uaddr)(sizeof(u32bit) - 1u))
+#define STARTUP_MEM_BURST_SIZE    (STARTUP_MEM_BURST_WORDS * STARTUP_MEM_WORD_SIZE)
+
+/*Burst loops are written in assembly only for Thumb-2 cores, other targets use the C version*/
+#if defined (__GNUC__) && defined (__thumb2__)
+#define STARTUP_MEM_ASM_BURST
+#endif
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+#if !defined (HOST_BUILD)
+/*Main stack, linker script*/
+extern u32bit __StackLimit[];
+extern u32bit __StackTop[];
+#endif
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void StartupMem_CopyBursts(u32bit ** dst, const u32bit ** src, u32bit bursts);
+static void StartupMem_CopyMerged(u32bit ** dst, const u8bit ** src, u32bit words);
+static void StartupMem_ZeroBursts(u32bit ** dst, u32bit bursts);
+static u32bit StartupMem_ReadLength(const u8bit ** src, u32bit length);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Copy bursts of STARTUP_MEM_BURST_WORDS words, both pointers are updated.
+ * bursts must be greater than zero.
+ */
+static void StartupMem_CopyBursts(u32bit ** dst, const u32bit ** src, u32bit bursts)
+{
+#if defined (STARTUP_MEM_ASM_BURST)
+    u32bit * d = *dst;
+    const u32bit * s = *src;
+
+    /* r7 is left out of the list because it is the Thumb frame pointer */
+    __asm volatile ("1:  ldmia %[s]!, {r3-r6, r8-r10, r12} \n\t"
+                    "    stmia %[d]!, {r3-r6, r8-r10, r12} \n\t"
+                    "    subs  %[n], %[n], #1             \n\t"
+                    "    bne   1b                         \n\t"
+                    : [d] "+r" (d), [s] "+r" (s), [n] "+r" (bursts)
+                    :
+                    : "r3", "r4", "r5", "r6", "r8", "r9", "r10", "r12", "cc", "memory");
+    *dst = d;
+    *src = s;
+#else
+    u32bit * d = *dst;
+    const u32bit * s = *src;
+    u32bit w0, w1, w2, w3, w4, w5, w6, w7;
+
+    do
+    {
+        /* All loads first so the compiler can merge them into LDM/STM */
+        w0 = s[0]; w1 = s[1]; w2 = s[2]; w3 = s[3];
+        w4 = s[4]; w5 = s[5]; w6 = s[6]; w7 = s[7];
+        d[0] = w0; d[1] = w1; d[2] = w2; d[3] = w3;
+        d[4] = w4; d[5] = w5; d[6] = w6; d[7] = w7;
+        d += STARTUP_MEM_BURST_WORDS;
+        s += STARTUP_MEM_BURST_WORDS;
+        bursts--;
+    } while (bursts != 0u);
+    *dst = d;
+    *src = s;
+#endif
+}
+
+/*
+ * Copy words to an aligned dst from a src with another offset inside its word, both pointers are updated.
+ * Source words are read from their aligned address and each pair is shifted and merged into one
+ * destination word (little endian). The first and last reads stay inside the words holding src bytes.
+ * words must be greater than zero.
+ */
+static void StartupMem_CopyMerged(u32bit ** dst, const u8bit ** src, u32bit words)
+{
+    u32bit * d = *dst;
+    const u32bit * s = (const u32bit *)(((uaddr)*src) & ~STARTUP_MEM_WORD_MASK);
+    const u32bit shift = ((u32bit)(((uaddr)*src) & STARTUP_MEM_WORD_MASK)) * 8u;
+    u32bit low = *s;
+    u32bit high;
+
+    *src += words * STARTUP_MEM_WORD_SIZE;
+    do
+    {
+        s++;
+        high = *s;
+        *d = (low >> shift) | (high << (32u - shift));
+        d++;
+        low = high;
+        words--;
+    } while (words != 0u);
+    *dst = d;
+}
+
+/*
+ * Clear bursts of STARTUP_MEM_BURST_WORDS words, pointer is updated.
+ * bursts must be greater than zero.
+ */
+static void StartupMem_ZeroBursts(u32bit ** dst, u32bit bursts)
+{
+#if defined (STARTUP_MEM_ASM_BURST)
+    u32bit * d = *dst;
+
+    __asm volatile ("    movs  r3, #0                     \n\t"
+                    "    movs  r4, #0                     \n\t"
+                    "    movs  r5, #0                     \n\t"
+                    "    movs  r6, #0                     \n\t"
+                    "    mov   r8, r3                     \n\t"
+                    "    mov   r9, r3                     \n\t"
+                    "    mov   r10, r3                    \n\t"
+                    "    mov   r12, r3                    \n\t"
+                    "1:  stmia %[d]!, {r3-r6, r8-r10, r12} \n\t"
+                    "    subs  %[n], %[n], #1             \n\t"
+                    "    bne   1b                         \n\t"
+                    : [d] "+r" (d), [n] "+r" (bursts)
+                    :
+                    : "r3", "r4", "r5", "r6", "r8", "r9", "r10", "r12", "cc", "memory");
+    *dst = d;
+#else
+    u32bit * d = *dst;
+
+    do
+    {
+        d[0] = 0u; d[1] = 0u; d[2] = 0u; d[3] = 0u;
+        d[4] = 0u; d[5] = 0u; d[6] = 0u; d[7] = 0u;
+        d += STARTUP_MEM_BURST_WORDS;
+        bursts--;
+    } while (bursts != 0u);
+    *dst = d;
+#endif
+}
+
+/*
+ * Extend a 6 bit token length with the LEB128 value that follows it when all its bits are set.
+ */
+static u32bit StartupMem_ReadLength(const u8bit ** src, u32bit length)
+{
+    const u8bit * s = *src;
+    u32bit shift = 0u;
+
+    if (length == STARTUP_MEM_LEN_MASK)
+    {
+        do
+        {
+            length += ((u32bit)(*s & 0x7Fu)) << shift;
+            shift += 7u;
+            s++;
+        } while ((s[-1] & 0x80u) != 0u);
+        *src = s;
+    }
+    return length;
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+/*
+ * Copy size bytes from src to dst.
+ * Bursts are used when both pointers have the same offset inside a word, otherwise the words
+ * are shifted and merged from aligned source reads.
+ */
+void StartupMem_Copy(u8bit * dst, const u8bit * src, u32bit size)
+{
+    u32bit * dst32;
+    const u32bit * src32;
+
+    if (((((uaddr)dst) ^ ((uaddr)src)) & STARTUP_MEM_WORD_MASK) == 0u)
+    {
+        /* Unaligned head */
+        while ((size != 0u) && ((((uaddr)dst) & STARTUP_MEM_WORD_MASK) != 0u))
+        {
+            *dst = *src;
+            dst++;
+            src++;
+            size--;
+        }
+
+        dst32 = (u32bit *)dst;
+        src32 = (const u32bit *)src;
+
+        /* Bursts */
+        if (size >= STARTUP_MEM_BURST_SIZE)
+        {
+            StartupMem_CopyBursts(&dst32, &src32, size / STARTUP_MEM_BURST_SIZE);
+            size %= STARTUP_MEM_BURST_SIZE;
+        }
+
+        /* Remaining words */
+        while (size >= STARTUP_MEM_WORD_SIZE)
+        {
+            *dst32 = *src32;
+            dst32++;
+            src32++;
+            size -= STARTUP_MEM_WORD_SIZE;
+        }
+
+        dst = (u8bit *)dst32;
+        src = (const u8bit *)src32;
+    }
+    else
+    {
+        /* Unaligned head of dst */
+        while ((size != 0u) && ((((uaddr)dst) & STARTUP_MEM_WORD_MASK) != 0u))
+        {
+            *dst = *src;
+            dst++;
+            src++;
+            size--;
+        }
+
+        /* Merged words */
+        if (size >= STARTUP_MEM_WORD_SIZE)
+        {
+            dst32 = (u32bit *)dst;
+            StartupMem_CopyMerged(&dst32, &src, size / STARTUP_MEM_WORD_SIZE);
+            size %= STARTUP_MEM_WORD_SIZE;
+            dst = (u8bit *)dst32;
+        }
+    }
+
+    /* Unaligned tail */
+    while (size != 0u)
+    {
+        *dst = *src;
+        dst++;
+        src++;
+        size--;
+    }
+}
+
+/*
+ * Clear size bytes starting at dst.
+ */
+void StartupMem_Zero(u8bit * dst, u32bit size)
+{
+    u32bit * dst32;
+
+    /* Unaligned head */
+    while ((size != 0u) && ((((uaddr)dst) & STARTUP_MEM_WORD_MASK) != 0u))
+    {
+        *dst = 0u;
+        dst++;
+        size--;
+    }
+
+    dst32 = (u32bit *)dst;
+
+    /* Bursts */
+    if (size >= STARTUP_MEM_BURST_SIZE)
+    {
+        StartupMem_ZeroBursts(&dst32, size / STARTUP_MEM_BURST_SIZE);
+        size %= STARTUP_MEM_BURST_SIZE;
+    }
+
+    /* Remaining words */
+    while (size >= STARTUP_MEM_WORD_SIZE)
+    {
+        *dst32 = 0u;
+        dst32++;
+        size -= STARTUP_MEM_WORD_SIZE;
+    }
+
+    /* Unaligned tail */
+    dst = (u8bit *)dst32;
+    while (size != 0u)
+    {
+        *dst = 0u;
+        dst++;
+        size--;
+    }
+}
+
+/*
+ * Decompress size bytes into dst.
+ * Flash is read only once, sequentially. Matches are copied from the output already written in RAM.
+ */
+const u8bit * StartupMem_Unpack(u8bit * dst, const u8bit * src, u32bit size)
+{
+    const u8bit * ref;
+    u8bit * end = dst + size;
+    u32bit control;
+    u32bit length;
+
+    while (dst < end)
+    {
+        control = *src;
+        src++;
+        length = StartupMem_ReadLength(&src, control & STARTUP_MEM_LEN_MASK);
+
+        switch (control & STARTUP_MEM_TOKEN_MASK)
+        {
+            case STARTUP_MEM_TOKEN_LIT:
+                length += 1u;
+                StartupMem_Copy(dst, src, length);
+                src += length;
+                break;
+
+            case STARTUP_MEM_TOKEN_ZERO:
+                length += 1u;
+                StartupMem_Zero(dst, length);
+                break;
+
+            case STARTUP_MEM_TOKEN_MATCH:
+                length += STARTUP_MEM_MATCH_MIN;
+                ref = dst - ((u32bit)src[0] | ((u32bit)src[1] << 8u));
+                src += 2u;
+                /* Byte wise on purpose, source and destination may overlap (repeated patterns) */
+                for (control = 0u; control < length; control++)
+                {
+                    dst[control] = ref[control];
+                }
+                break;
+
+            default:
+                /* Reserved token, corrupted image. Stop before writing outside the section */
+                length = (u32bit)(end - dst);
+                break;
+        }
+        dst += length;
+    }
+    return src;
+}
+
+/*
+ * Unpack the .data and .code_ram records of an init image.
+ * The image is accepted only if its magic and both raw sizes match the linked sections.
+ */
+boolean StartupMem_UnpackImage(const u8bit * image, u8bit * dataRam, u32bit dataSize,
+                               u8bit * codeRam, u32bit codeSize)
+{
+    const u32bit * header = (const u32bit *)image;
+    const u32bit * codeRecord;
+    boolean valid = FALSE;
+
+    if ((header[0] == STARTUP_MEM_IMAGE_MAGIC) && (header[1] == dataSize))
+    {
+        /* Second record starts after the first packed stream, padded to a word */
+        codeRecord = &header[3u + ((header[2] + 3u) / 4u)];
+
+        if (codeRecord[0] == codeSize)
+        {
+            (void)StartupMem_Unpack(dataRam, (const u8bit *)&header[3], dataSize);
+            (void)StartupMem_Unpack(codeRam, (const u8bit *)&codeRecord[2], codeSize);
+            valid = TRUE;
+        }
+    }
+    return valid;
+}
+
+/*
+ * Paint words words starting at dst.
+ */
+void StartupMem_Paint(u32bit * dst, u32bit words)
+{
+    u32bit i;
+
+    for (i = 0u; i < words; i++)
+    {
+        dst[i] = STARTUP_MEM_STACK_PATTERN;
+    }
+}
+
+/*
+ * Scan upwards from the stack limit: a descending stack overwrites its painted words from the top down.
+ */
+u32bit StartupMem_Unused(const u32bit * dst, u32bit words)
+{
+    u32bit count = 0u;
+
+    while ((count < words) && (dst[count] == STARTUP_MEM_STACK_PATTERN))
+    {
+        count++;
+    }
+    return count;
+}
+
+u32bit StartupMem_MainStackSize(void)
+{
+#if defined (HOST_BUILD)
+    return 0u;
+#else
+    return (u32bit)(__StackTop - __StackLimit) * STARTUP_MEM_WORD_SIZE;
+#endif
+}
+
+u32bit StartupMem_MainStackUnused(void)
+{
+#if defined (HOST_BUILD)
+    return 0u;
+#else
+    return StartupMem_Unused(__StackLimit, (u32bit)(__StackTop - __StackLimit)) * STARTUP_MEM_WORD_SIZE;
+#endif
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-001   | 17-Oct-2026 | First version of Startup_Mem.c                                               |
+ *| CMARTI  |  user-002   | 17-Oct-2026 | Add StartupMem_Unpack/UnpackImage for compressed init images                 |
+ *| CMARTI  |  user-022   | 17-Oct-2026 | Add StartupMem_Paint/Unused and main stack high-water mark                   |
+ *| CMARTI  |  user-001   | 17-Oct-2026 | Shift and merge word copy for mutually misaligned buffers                  |
+***********************************************************************************************************************/
@@ -0,0 +1,92 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Startup_Mem.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Startup_Mem.h
+    Startup memory engine.
+    Copy and clear routines used by init_data_bss() before main is called. They work on aligned words and
+    8 word bursts (LDM/STM) and only fall back to bytes for the unaligned head and tail.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef STARTUP_MEM_H_
+#define STARTUP_MEM_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Number of words moved by one burst (one LDM/STM pair)*/
+#define STARTUP_MEM_BURST_WORDS   (8u)
+
+/*Compressed init image produced by tools/InitPack/init_pack.py.
+ *Image  : magic, then one section record for .data and one for .code_ram, each record padded to 4 bytes.
+ *Record : raw size (u32), packed size (u32), packed stream.
+ *Stream : tokens of one control byte, type in the 2 upper bits and length in the 6 lower bits.
+ *         Length 63 means a LEB128 extension follows and is added to it.*/
+#define STARTUP_MEM_IMAGE_MAGIC   (0x474D4943uL) /*"CIMG"*/
+#define STARTUP_MEM_TOKEN_MASK    (0xC0u)
+#define STARTUP_MEM_TOKEN_LIT     (0x00u)        /*len + 1 literal bytes follow*/
+#define STARTUP_MEM_TOKEN_ZERO    (0x40u)        /*len + 1 zero bytes*/
+#define STARTUP_MEM_TOKEN_MATCH   (0x80u)        /*len + 3 bytes copied from 16 bit LE offset back in output*/
+#define STARTUP_MEM_LEN_MASK      (0x3Fu)
+#define STARTUP_MEM_MATCH_MIN     (3u)
+
+/*Stack painting: unused stack words keep this value, the high-water mark is the lowest word overwritten*/
+#define STARTUP_MEM_STACK_PATTERN (0xCDCDCDCDuL)
+
+/*Main stack words left unpainted by Reset_Handler below its own frame, room for the StartupMem_Paint call*/
+#define STARTUP_MEM_PAINT_MARGIN  (16u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Copy size bytes from src to dst. Areas must not overlap. Safe to call before .data/.bss are initialized*/
+extern void StartupMem_Copy(u8bit * dst, const u8bit * src, u32bit size);
+
+/*Clear size bytes starting at dst. Safe to call before .data/.bss are initialized*/
+extern void StartupMem_Zero(u8bit * dst, u32bit size);
+
+/*Decompress one packed stream of size output bytes into dst in a single pass, returns end of consumed input*/
+extern const u8bit * StartupMem_Unpack(u8bit * dst, const u8bit * src, u32bit size);
+
+/*Unpack a whole init image into .data and .code_ram, returns FALSE (nothing written) when image does not match*/
+extern boolean StartupMem_UnpackImage(const u8bit * image, u8bit * dataRam, u32bit dataSize,
+                                      u8bit * codeRam, u32bit codeSize);
+
+/*Paint words words from dst with STARTUP_MEM_STACK_PATTERN. Safe to call before .data/.bss are initialized*/
+extern void StartupMem_Paint(u32bit * dst, u32bit words);
+
+/*Words from dst upwards still holding STARTUP_MEM_STACK_PATTERN, the never used part of a descending stack*/
+extern u32bit StartupMem_Unused(const u32bit * dst, u32bit words);
+
+/*Main stack (MSP: startup, main before Os_Start, ISRs and kernel handlers) size and bytes never used since
+  Reset_Handler painted it. Host builds have no main stack of their own and return 0*/
+extern u32bit StartupMem_MainStackSize(void);
+extern u32bit StartupMem_MainStackUnused(void);
+
+#endif /* STARTUP_MEM_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-001   | 17-Oct-2026 | First version of Startup_Mem.h                                               |
+ *| CMARTI  |  user-002   | 17-Oct-2026 | Compressed init image format and StartupMem_Unpack                           |
+ *| CMARTI  |  user-022   | 17-Oct-2026 | Stack painting and main stack high-water mark                                |
+***********************************************************************************************************************/
@@ -0,0 +1,247 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Startup_Warm.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Startup_Warm.c
+    Warm-boot record, validation of the NO_INIT block at start up and crash context of HardFault_Handler.
+    The CRC is the CRC-32 of Crc_CalculateCRC32 computed bit by bit: it runs from init_data_bss, before
+    Crc_Init and, in the bootloader, before the Crc service is copied to RAM. The block is a few hundred bytes.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Startup_Warm.h"
+#include "Startup_Mem.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*CRC-32 of Crc_CalculateCRC32 (CRC_POLY32_REFLECTED, CRC_INIT32, CRC_XOR32)*/
+#define STARTUP_WARM_POLY         (0xEDB88320uL)
+#define STARTUP_WARM_CRC_INIT     (0xFFFFFFFFuL)
+#define STARTUP_WARM_CRC_XOR      (0xFFFFFFFFuL)
+
+/*Bytes before the CRC covered part of the record*/
+#define STARTUP_WARM_CRC_OFFSET   ((u32bit)sizeof(u32bit))
+
+#if defined (HOST_BUILD)
+/*No linker script, the block is the record alone*/
+#define STARTUP_WARM_USED         ((u32bit)sizeof(StartupWarm_RecordType))
+#define STARTUP_WARM_BLOCK_SIZE   ((u32bit)sizeof(StartupWarm_RecordType))
+#else
+/*NO_INIT block, linker script. The record is its first object*/
+#define STARTUP_WARM_USED         ((u32bit)(__noinit_used__ - __noinit_start__))
+#define STARTUP_WARM_BLOCK_SIZE   ((u32bit)(__noinit_end__ - __noinit_start__))
+#endif
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+#if !defined (HOST_BUILD)
+extern u8bit __noinit_start__[];
+extern u8bit __noinit_used__[];
+extern u8bit __noinit_end__[];
+#endif
+
+__attribute__ ((section(".noinit.record")))
+StartupWarm_RecordType StartupWarm_Record;
+
+static boolean StartupWarm_Warm;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static u32bit StartupWarm_Crc(const u8bit * data, u32bit size);
+static boolean StartupWarm_Sealed(void);
+static boolean StartupWarm_Valid(u32bit resetCause);
+static void StartupWarm_Restart(void);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+static u32bit StartupWarm_Crc(const u8bit * data, u32bit size)
+{
+    u32bit crc = STARTUP_WARM_CRC_INIT;
+    u32bit i;
+    u32bit bit;
+
+    for (i = 0u; i < size; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0u; bit < 8u; bit++)
+        {
+            crc = (crc >> 1u) ^ (STARTUP_WARM_POLY & (0u - (crc & 1u)));
+        }
+    }
+    return crc ^ STARTUP_WARM_CRC_XOR;
+}
+
+/*
+ * A record inside the block with a matching CRC, sealed by the bootloader or an application.
+ */
+static boolean StartupWarm_Sealed(void)
+{
+    u32bit size = StartupWarm_Record.size;
+
+    return ((StartupWarm_Record.magic == STARTUP_WARM_MAGIC) &&
+            (size >= (u32bit)sizeof(StartupWarm_RecordType)) && (size <= STARTUP_WARM_BLOCK_SIZE) &&
+            (StartupWarm_Crc((const u8bit *)&StartupWarm_Record + STARTUP_WARM_CRC_OFFSET,
+                             size - STARTUP_WARM_CRC_OFFSET) == StartupWarm_Record.crc)) ? TRUE : FALSE;
+}
+
+/*
+ * A warm reset cause and a sealed record. The application also needs its own layout, a block sealed by the
+ * bootloader or by another application version is cleared.
+ */
+static boolean StartupWarm_Valid(u32bit resetCause)
+{
+    boolean valid = FALSE;
+
+    if (((resetCause & STARTUP_WARM_CAUSES) != 0u) && (StartupWarm_Sealed() == TRUE))
+    {
+#if defined (BOOT_BUILD)
+        valid = TRUE;
+#else
+        valid = ((StartupWarm_Record.layout == STARTUP_WARM_LAYOUT) &&
+                 (StartupWarm_Record.size == STARTUP_WARM_USED)) ? TRUE : FALSE;
+#endif
+    }
+    else
+    {
+    }
+    return valid;
+}
+
+static void StartupWarm_Restart(void)
+{
+    S32_SCB->AIRCR = S32_SCB_AIRCR_VECTKEY | S32_SCB_AIRCR_SYSRESETREQ_MASK;
+    for (;;)
+    {
+    }
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+/*
+ * A cold start of the application keeps the image CRC of a record the bootloader sealed during the same
+ * start (Boot_AppValid), so the first fault reset after power on can already take the fast path.
+ */
+boolean StartupWarm_Init(u32bit resetCause)
+{
+    u32bit appCrc = 0u;
+
+    StartupWarm_Warm = StartupWarm_Valid(resetCause);
+
+    if (StartupWarm_Warm == TRUE)
+    {
+#if !defined (BOOT_BUILD)
+        StartupWarm_Record.warmResets++;
+        StartupWarm_Record.requested = 0u;
+#endif
+    }
+    else
+    {
+#if !defined (BOOT_BUILD)
+        if (StartupWarm_Sealed() == TRUE)
+        {
+            appCrc = StartupWarm_Record.appCrc;
+        }
+#endif
+        StartupMem_Zero((u8bit *)&StartupWarm_Record, STARTUP_WARM_BLOCK_SIZE);
+        StartupWarm_Record.magic = STARTUP_WARM_MAGIC;
+        StartupWarm_Record.size = STARTUP_WARM_USED;
+        StartupWarm_Record.layout = STARTUP_WARM_LAYOUT;
+        StartupWarm_Record.appCrc = appCrc;
+    }
+    StartupWarm_Record.resetCause = resetCause;
+    StartupWarm_Seal();
+    return StartupWarm_Warm;
+}
+
+boolean StartupWarm_IsWarm(void)
+{
+    return StartupWarm_Warm;
+}
+
+/*
+ * Nothing to seal before StartupWarm_Init started a record (host builds, fault during the startup).
+ */
+void StartupWarm_Seal(void)
+{
+    u32bit size = StartupWarm_Record.size;
+
+    if ((size >= (u32bit)sizeof(StartupWarm_RecordType)) && (size <= STARTUP_WARM_BLOCK_SIZE))
+    {
+        StartupWarm_Record.crc = StartupWarm_Crc((const u8bit *)&StartupWarm_Record + STARTUP_WARM_CRC_OFFSET,
+                                                 size - STARTUP_WARM_CRC_OFFSET);
+    }
+    else
+    {
+    }
+}
+
+void StartupWarm_Healthy(void)
+{
+    StartupWarm_Record.warmResets = 0u;
+    StartupWarm_Seal();
+}
+
+/*
+ * The frame is only read when it lies in RAM: a stack overflow fault may leave the stack pointer outside.
+ */
+void StartupWarm_SaveFault(const u32bit * frame, u32bit excReturn)
+{
+    StartupWarm_CrashType * crash = &StartupWarm_Record.crash;
+    uaddr sp = (uaddr)frame;
+    u32bit i;
+
+    for (i = 0u; i < STARTUP_WARM_FRAME_WORDS; i++)
+    {
+        crash->frame[i] = ((sp >= STARTUP_WARM_RAM_START) &&
+                           (sp <= (STARTUP_WARM_RAM_END - (STARTUP_WARM_FRAME_WORDS * sizeof(u32bit))))) ? frame[i] : 0u;
+    }
+    crash->sp = (u32bit)sp;
+    crash->excReturn = excReturn;
+    crash->cfsr = S32_SCB->CFSR;
+    crash->hfsr = S32_SCB->HFSR;
+    crash->mmfar = S32_SCB->MMFAR;
+    crash->bfar = S32_SCB->BFAR;
+    crash->valid = STARTUP_WARM_MAGIC;
+    StartupWarm_Seal();
+}
+
+void StartupWarm_Reset(void)
+{
+    StartupWarm_Record.requested = 1u;
+    StartupWarm_Seal();
+    StartupWarm_Restart();
+}
+
+void StartupWarm_Fault(const u32bit * frame, u32bit excReturn)
+{
+    StartupWarm_SaveFault(frame, excReturn);
+    StartupWarm_Restart();
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | First version of Startup_Warm.c                                              |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | Image CRC of the bootloader kept on a cold start                             |
+ ***********************************************************************************************************************/
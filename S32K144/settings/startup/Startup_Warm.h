@@ -0,0 +1,113 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Startup_Warm.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Startup_Warm.h
+    Warm-boot record.
+    The NO_INIT block at the end of SRAM_U (settings/linker) starts with StartupWarm_Record, a CRC-32 tagged
+    record followed by the NO_INIT variables of the application (calibration, learned values). init_data_bss()
+    keeps the whole block after a software, watchdog or lockup reset when the record is valid, and clears it
+    on any other reset. HardFault_Handler stores the crash context in the record before it resets.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef STARTUP_WARM_H_
+#define STARTUP_WARM_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "S32K144.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define STARTUP_WARM_MAGIC        (0x4D524157uL) /*"WARM"*/
+
+/*Version of the NO_INIT variables of the application, change it with them: the next start is then cold*/
+#define STARTUP_WARM_LAYOUT       (1u)
+
+/*RCM SRS causes that keep the NO_INIT block*/
+#define STARTUP_WARM_CAUSES       (RCM_SRS_SW_MASK | RCM_SRS_WDOG_MASK | RCM_SRS_LOCKUP_MASK)
+
+/*SRAM_L and SRAM_U, a crash frame outside is not read*/
+#define STARTUP_WARM_RAM_START    (0x1FFF8000uL)
+#define STARTUP_WARM_RAM_END      (0x20007000uL)
+
+/*Exception frame stacked by the core: r0-r3, r12, lr, pc, xpsr*/
+#define STARTUP_WARM_FRAME_WORDS  (8u)
+
+typedef struct
+{
+    u32bit valid;                               /*STARTUP_WARM_MAGIC once a fault was stored*/
+    u32bit frame[STARTUP_WARM_FRAME_WORDS];     /*Stacked r0-r3, r12, lr, pc, xpsr, 0 when sp was not in RAM*/
+    u32bit sp;                                  /*Frame address, stack pointer of the faulting context*/
+    u32bit excReturn;                           /*EXC_RETURN, bit 2 set when the fault hit a task (PSP)*/
+    u32bit cfsr;                                /*SCB fault status and address registers*/
+    u32bit hfsr;
+    u32bit mmfar;
+    u32bit bfar;
+} StartupWarm_CrashType;
+
+typedef struct
+{
+    u32bit crc;                                 /*CRC-32 of the next size - 4 bytes of the block*/
+    u32bit magic;                               /*STARTUP_WARM_MAGIC*/
+    u32bit size;                                /*Bytes of the block covered, record and NO_INIT variables*/
+    u32bit layout;                              /*STARTUP_WARM_LAYOUT of the image that cleared the block*/
+    u32bit resetCause;                          /*RCM SRS of the last reset*/
+    u32bit warmResets;                          /*Warm starts of the application since StartupWarm_Healthy*/
+    u32bit appCrc;                              /*Image CRC of the application the bootloader checked, 0 = none*/
+    u32bit requested;                           /*1 = reset of StartupWarm_Reset, the bootloader waits for a tester*/
+    StartupWarm_CrashType crash;
+} StartupWarm_RecordType;
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+/*First object of the NO_INIT block, same address in the bootloader and the application*/
+extern StartupWarm_RecordType StartupWarm_Record;
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Called by init_data_bss after .bss is cleared. Keeps the block (TRUE, warm start) or clears it and starts a
+  new record (FALSE, cold start). The bootloader accepts any valid record, the application only its layout.
+  A cold start of the application keeps appCrc from a sealed record*/
+extern boolean StartupWarm_Init(u32bit resetCause);
+
+/*Result of StartupWarm_Init*/
+extern boolean StartupWarm_IsWarm(void);
+
+/*Recompute the CRC, call it after writing NO_INIT variables: a reset before sealing makes the next start cold*/
+extern void StartupWarm_Seal(void);
+
+/*The application runs fine, the warm start count of the bootloader fast path starts again*/
+extern void StartupWarm_Healthy(void);
+
+/*Software reset with the block sealed, e.g. UDS ECU reset: warm start, the bootloader keeps its tester window*/
+extern void StartupWarm_Reset(void);
+
+/*Store the crash context of the exception frame at frame and seal*/
+extern void StartupWarm_SaveFault(const u32bit * frame, u32bit excReturn);
+
+/*HardFault_Handler: StartupWarm_SaveFault, then a software reset*/
+extern void StartupWarm_Fault(const u32bit * frame, u32bit excReturn);
+
+#endif /* STARTUP_WARM_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | First version of Startup_Warm.h                                              |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | Image CRC of the bootloader kept on a cold start                             |
+***********************************************************************************************************************/
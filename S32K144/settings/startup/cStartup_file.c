@@ -26,180 +26,26 @@
 /*                                                       Includes                                                    */
 /*********************************************************************************************************************/
 #include "Std_Types.h"
+#include "S32K144.h"
+#include "Core_CM4.h"
+#include "Startup_Mem.h"
+#include "Startup_Warm.h"
 
 /*                                                        Macros                                                     */
 /*********************************************************************************************************************/
-#if !defined (CORE_CM4_H)
-#define CORE_CM4_H
-
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/** \brief  INT_VECTOR_Reg
- *
- *   Register in which the start of vector table needs to be configured
- */
-#define INT_VECTOR_Reg S32_SCB->VTOR
-
-/** \brief  BKPT_ASM
- *
- *   Macro to be used to trigger an debug interrupt
- */
-#define BKPT_ASM __asm("BKPT #0\n\t")
-
-
-/** \brief  Enable FPU
- *
- *   ENABLE_FPU indicates whether SystemInit will enable the Floating point unit (FPU)
- */
-#if defined (__GNUC__)
-#if defined (__VFP_FP__) && !defined (__SOFTFP__)
-#define ENABLE_FPU
-#endif
-
-#elif defined (__ICCARM__)
-#if defined __ARMVFP__
-#define ENABLE_FPU
-#endif
-
-#elif defined (__ghs__) || defined (__DCC__)
-#if defined (__VFP__)
-#define ENABLE_FPU
-#endif
-
-#elif defined (__CSMC__)
-#if (__CSMC__ & 0x400U) /* bit 10: set if hardware FPU selected (+fpu) */
-#define ENABLE_FPU
-#endif
-#endif /* if defined (__GNUC__) */
-
-
-/** \brief  Enable interrupts
- */
-#if defined (__GNUC__)
-#define ENABLE_INTERRUPTS() __asm volatile ("cpsie i" : : : "memory");
-#else
-#define ENABLE_INTERRUPTS() __asm("cpsie i")
-#endif
-
-
-/** \brief  Disable interrupts
- */
-#if defined (__GNUC__)
-#define DISABLE_INTERRUPTS() __asm volatile ("cpsid i" : : : "memory");
-#else
-#define DISABLE_INTERRUPTS() __asm("cpsid i")
-#endif
-
-
-/** \brief  Enter low-power standby state
- *    WFI (Wait For Interrupt) makes the processor suspend execution (Clock is stopped) until an IRQ interrupts.
- */
-#if defined (__GNUC__)
-#define STANDBY() __asm volatile ("wfi")
-#else
-#define STANDBY() __asm("wfi")
-#endif
-
-
-/** \brief  Reverse byte order in a word.
- */
-#if defined (__GNUC__) || defined (__ICCARM__) || defined (__ghs__)
-#define REV_BYTES_32(a, b) __asm volatile ("rev %0, %1" : "=r" (b) : "r" (a))
-#else
-#define REV_BYTES_32(a, b) (b = ((a & 0xFF000000U) >> 24U) | ((a & 0xFF0000U) >> 8U) \
-                                | ((a & 0xFF00U) << 8U) | ((a & 0xFFU) << 24U))
-#endif
-
-/** \brief  Reverse byte order in each halfword independently.
- */
-#if defined (__GNUC__) || defined (__ICCARM__) || defined (__ghs__)
-#define REV_BYTES_16(a, b) __asm volatile ("rev16 %0, %1" : "=r" (b) : "r" (a))
-#else
-#define REV_BYTES_16(a, b) (b = ((a & 0xFF000000U) >> 8U) | ((a & 0xFF0000U) << 8U) \
-                                | ((a & 0xFF00U) >> 8U) | ((a & 0xFFU) << 8U))
-#endif
-
-/** \brief  Places a function in RAM.
- */
-#if defined ( __GNUC__ )
-    #define START_FUNCTION_DECLARATION_RAMSECTION
-    #define END_FUNCTION_DECLARATION_RAMSECTION        __attribute__((section (".code_ram")));
-#elif defined ( __ghs__ )
-    #define START_FUNCTION_DECLARATION_RAMSECTION      _Pragma("ghs callmode=far")
-    #define END_FUNCTION_DECLARATION_RAMSECTION        __attribute__((section (".code_ram")));\
-                                                       _Pragma("ghs callmode=default")
-#elif defined ( __ICCARM__ )
-    #define START_FUNCTION_DECLARATION_RAMSECTION      __ramfunc
-    #define END_FUNCTION_DECLARATION_RAMSECTION        ;
-#elif defined ( __DCC__ )
-    #define START_FUNCTION_DECLARATION_RAMSECTION      _Pragma("section CODE \".code_ram\"") \
-                                                       _Pragma("use_section CODE")
-    #define END_FUNCTION_DECLARATION_RAMSECTION        ; \
-                                                       _Pragma("section CODE \".text\"")
-#elif defined ( __CSMC__ )
-    #define START_FUNCTION_DECLARATION_RAMSECTION      @ext
-    #define END_FUNCTION_DECLARATION_RAMSECTION        ;
-#else
-    /* Keep compatibility with software analysis tools */
-    #define START_FUNCTION_DECLARATION_RAMSECTION
-    #define END_FUNCTION_DECLARATION_RAMSECTION        ;
-#endif
-
-#if defined ( __CSMC__ )
-    #define START_FUNCTION_DEFINITION_RAMSECTION       _Pragma("section (code_ram)")
-    #define END_FUNCTION_DEFINITION_RAMSECTION         _Pragma("section ()")
-#else
-    /* For GCC, IAR, GHS and Diab there is no need to specify the section when
-    defining a function, it is enough to specify it at the declaration. This
-    also enables compatibility with software analysis tools. */
-    #define START_FUNCTION_DEFINITION_RAMSECTION
-    #define END_FUNCTION_DEFINITION_RAMSECTION
-#endif
-
-#if defined (__ICCARM__)
-    #define DISABLE_CHECK_RAMSECTION_FUNCTION_CALL     _Pragma("diag_suppress=Ta022")
-    #define ENABLE_CHECK_RAMSECTION_FUNCTION_CALL      _Pragma("diag_default=Ta022")
-#else
-    #define DISABLE_CHECK_RAMSECTION_FUNCTION_CALL
-    #define ENABLE_CHECK_RAMSECTION_FUNCTION_CALL
-#endif
-
-
-/** \brief  Data alignment.
- */
-#if defined ( __GNUC__ ) || defined ( __ghs__ ) || defined ( __DCC__ )
-    #define ALIGNED(x)      __attribute__((aligned(x)))
-#elif defined ( __ICCARM__ )
-    #define stringify(s) tostring(s)
-    #define tostring(s) #s
-    #define ALIGNED(x)      _Pragma(stringify(data_alignment=x))
-#else
-    /* Keep compatibility with software analysis tools */
-    #define ALIGNED(x)
-#endif
-
-/** \brief  Endianness.
- */
-#define CORE_LITTLE_ENDIAN
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* CORE_CM4_H */
-
-
 #if (defined(__ICCARM__))
     #pragma section = ".data"
     #pragma section = ".data_init"
     #pragma section = ".bss"
+    #pragma section = ".bss.fast"
 #endif
 
 /*                                           External functions prototypes                                           */
 /*********************************************************************************************************************/
+extern int  main               ( void );
+extern u32bit __StackTop[];
+extern u32bit __StackLimit[];
+
 extern void Reset_Handler      ( void );
 extern void NMI_Handler        ( void );
 extern void HardFault_Handler  ( void );
@@ -240,7 +86,7 @@ typedef struct
 
 /*Exceptions table*/
 __attribute__ ((section(".__isr_vector")))
-const intVecElement __isr_vector[] =
+const intVectElement __isr_vector[] =
 {
     __StackTop,                                      /* Top Stack at 0x00000000 address*/
 	Reset_Handler,                                   /* Reset_Handler,*/
@@ -518,28 +364,42 @@ const flashConfiguration flashConfsetup ={ /*See reference manual 3.3 Flash memo
 /*********** CORTEX M4 Exceptions *************/
 void Reset_Handler      ( void ) /*Reset exception calls main function*/
 {
-	SystemInit(void);
-	init_data_bss(void);
-	main(void);
+	u32bit top;
+
+	/* Paint the main stack up to the frame of Reset_Handler, StartupMem_MainStackUnused() reads the high-water mark */
+	StartupMem_Paint(__StackLimit, (u32bit)(&top - __StackLimit) - STARTUP_MEM_PAINT_MARGIN);
+	SystemInit();
+	init_data_bss();
+	main();
 	while(1){}
 }
 
-void NMI_Handler        ( void ) { while (1) {} }
-void HardFault_Handler  ( void ) { while (1) {} }
-void MemManage_Handler  ( void ) { while (1) {} }
-void BusFault_Handler   ( void ) { while (1) {} }
-void UsageFault_Handler ( void ) { while (1) {} }
-void SVC_Handler        ( void ) { while (1) {} }
-void DebugMon_Handler   ( void ) { while (1) {} }
-void PendSV_Handler     ( void ) { while (1) {} }
-void SysTick_Handler    ( void ) { while (1) {} }
+/* Default handlers are weak, drivers and the OS replace them by defining a handler with the same name */
+WEAK void NMI_Handler        ( void ) { while (1) {} }
+/* Crash context of the stacked frame (MSP or task PSP) into StartupWarm_Record, then a warm software reset */
+WEAK __attribute__((naked)) void HardFault_Handler ( void )
+{
+    __asm volatile ("tst   lr, #4             \n\t"
+                    "ite   eq                 \n\t"
+                    "mrseq r0, msp            \n\t"
+                    "mrsne r0, psp            \n\t"
+                    "mov   r1, lr             \n\t"
+                    "b     StartupWarm_Fault  \n\t");
+}
+WEAK void MemManage_Handler  ( void ) { while (1) {} }
+WEAK void BusFault_Handler   ( void ) { while (1) {} }
+WEAK void UsageFault_Handler ( void ) { while (1) {} }
+WEAK void SVC_Handler        ( void ) { while (1) {} }
+WEAK void DebugMon_Handler   ( void ) { while (1) {} }
+WEAK void PendSV_Handler     ( void ) { while (1) {} }
+WEAK void SysTick_Handler    ( void ) { while (1) {} }
 
 /************ s32K144 Specific Interrupts *******************/
-void PORTA_IRQHandler   ( void ) { while (1) {} }
-void PORTB_IRQHandler   ( void ) { while (1) {} }
-void PORTC_IRQHandler   ( void ) { while (1) {} }
-void PORTD_IRQHandler   ( void ) { while (1) {} }
-void PORTE_IRQHandler   ( void ) { while (1) {} }
+WEAK void PORTA_IRQHandler   ( void ) { while (1) {} }
+WEAK void PORTB_IRQHandler   ( void ) { while (1) {} }
+WEAK void PORTC_IRQHandler   ( void ) { while (1) {} }
+WEAK void PORTD_IRQHandler   ( void ) { while (1) {} }
+WEAK void PORTE_IRQHandler   ( void ) { while (1) {} }
 
 /*                                           Internal functions implementation                                       */
 /*********************************************************************************************************************/
@@ -548,18 +408,21 @@ void PORTE_IRQHandler   ( void ) { while (1) {} }
  * Copy initialized data from ROM to RAM.
  * Clear the zero-initialized data section.
  * Copy the vector table from ROM to RAM.
+ * Keep or clear the NO_INIT block (warm-boot record, Startup_Warm.c).
+ * Every transfer goes through the startup memory engine (word and burst wide), see Startup_Mem.c
  */
 void init_data_bss(void)
 {
-	u32bit n;
 	/* Declare pointers for various data sections. These pointers
 	 * are initialized using values pulled in from the linker file */
 	u8bit * data_ram;
 	u8bit * code_ram;
 	u8bit * bss_start;
+	u8bit * fast_bss_start;
 	const u8bit * data_rom, * data_rom_end;
 	const u8bit * code_rom, * code_rom_end;
 	const u8bit * bss_end;
+	const u8bit * fast_bss_end;
 
 	/* Addresses for VECTOR_TABLE and VECTOR_RAM come from the linker file */
 	extern u32bit __RAM_VECTOR_TABLE_SIZE[];
@@ -583,6 +446,8 @@ void init_data_bss(void)
 	/* BSS */
 	bss_start       = __section_begin(".bss");
 	bss_end         = __section_end(".bss");
+	fast_bss_start  = __section_begin(".bss.fast");
+	fast_bss_end    = __section_end(".bss.fast");
 #else
 	extern u32bit __DATA_ROM[];
 	extern u32bit __DATA_RAM[];
@@ -594,28 +459,30 @@ void init_data_bss(void)
 
 	extern u32bit __BSS_START[];
     extern u32bit __BSS_END[];
+    extern u32bit __FAST_BSS_START[];
+    extern u32bit __FAST_BSS_END[];
 
     /* Data */
-    data_ram        = (ubit8 *)__DATA_RAM;
-    data_rom        = (ubit8 *)__DATA_ROM;
-    data_rom_end    = (ubit8 *)__DATA_END;
+    data_ram        = (u8bit *)__DATA_RAM;
+    data_rom        = (u8bit *)__DATA_ROM;
+    data_rom_end    = (u8bit *)__DATA_END;
     /* CODE RAM */
-    code_ram        = (ubit8 *)__CODE_RAM;
-    code_rom        = (ubit8 *)__CODE_ROM;
-    code_rom_end    = (ubit8 *)__CODE_END;
+    code_ram        = (u8bit *)__CODE_RAM;
+    code_rom        = (u8bit *)__CODE_ROM;
+    code_rom_end    = (u8bit *)__CODE_END;
     /* BSS */
-    bss_start       = (ubit8 *)__BSS_START;
-    bss_end         = (ubit8 *)__BSS_END;
+    bss_start       = (u8bit *)__BSS_START;
+    bss_end         = (u8bit *)__BSS_END;
+    /* FAST_BSS, SRAM_L */
+    fast_bss_start  = (u8bit *)__FAST_BSS_START;
+    fast_bss_end    = (u8bit *)__FAST_BSS_END;
 #endif
 
     /* Check if VECTOR_TABLE copy is needed */
     if (__VECTOR_RAM != __VECTOR_TABLE)
     {
         /* Copy the vector table from ROM to RAM */
-        for (n = 0; n < (((u32bit)__RAM_VECTOR_TABLE_SIZE)/sizeof(u32bit)); n++)
-        {
-            __VECTOR_RAM[n] = __VECTOR_TABLE[n];
-        }
+        StartupMem_Copy((u8bit *)__VECTOR_RAM, (const u8bit *)__VECTOR_TABLE, (u32bit)__RAM_VECTOR_TABLE_SIZE);
         /* Point the VTOR to the position of vector table */
             INT_VECTOR_Reg = (u32bit)__VECTOR_RAM;
     }
@@ -625,28 +492,28 @@ void init_data_bss(void)
         INT_VECTOR_Reg = (u32bit)__VECTOR_TABLE;
     }
 
-    /* Copy initialized data from ROM to RAM */
-    while (data_rom_end != data_rom)
+#if defined (STARTUP_COMPRESSED_INIT) && !defined (__ICCARM__)
+    /* tools/InitPack/init_pack.py replaces the raw .data/.code_ram images at __DATA_ROM with a packed image.
+     * A raw image (e.g. loaded from the debugger) is rejected by the unpacker and copied as usual. */
+    if (StartupMem_UnpackImage(data_rom, data_ram, (u32bit)(data_rom_end - data_rom),
+                               code_ram, (u32bit)(code_rom_end - code_rom)) == FALSE)
+#endif
     {
-        *data_ram = *data_rom;
-        data_ram++;
-        data_rom++;
-    }
+        /* Copy initialized data from ROM to RAM */
+        StartupMem_Copy(data_ram, data_rom, (u32bit)(data_rom_end - data_rom));
 
-    /* Copy functions from ROM to RAM */
-    while (code_rom_end != code_rom)
-    {
-        *code_ram = *code_rom;
-        code_ram++;
-        code_rom++;
+        /* Copy functions from ROM to RAM */
+        StartupMem_Copy(code_ram, code_rom, (u32bit)(code_rom_end - code_rom));
     }
 
-    /* Clear the zero-initialized data section */
-    while(bss_end != bss_start)
-    {
-        *bss_start = 0;
-        bss_start++;
-    }
+    /* Clear the zero-initialized data sections, DMA_BUFFER and .bss in SRAM_U, FAST_BSS in SRAM_L.
+     * NO_INIT variables are left as they are */
+    StartupMem_Zero(bss_start, (u32bit)(bss_end - bss_start));
+    StartupMem_Zero(fast_bss_start, (u32bit)(fast_bss_end - fast_bss_start));
+
+    /* NO_INIT block: kept after a software, watchdog or lockup reset with a valid warm-boot record,
+     * cleared otherwise */
+    (void)StartupWarm_Init(RCM->SRS);
 }
 
 void SystemInit (void)
@@ -657,11 +524,20 @@ void SystemInit (void)
 #ifdef ENABLE_FPU
 /* Enable CP10 and CP11 coprocessors */
     S32_SCB->CPACR |= (S32_SCB_CPACR_CP10_MASK | S32_SCB_CPACR_CP11_MASK);
+/* Automatic FP state preservation: CONTROL.FPCA is only set once a context executes an FP instruction,
+ * exceptions and the Os context switch stack FP registers only for those contexts */
+    S32_SCB->FPCCR |= S32_SCB_FPCCR_ASPEN_MASK;
 #ifdef  ERRATA_E6940
 /* Disable lazy context save of floating point state by clearing LSPEN bit
- * Workaround for errata e6940 */
+ * Workaround for errata e6940. Only contexts owning FP state pay the full FP stacking,
+ * integer only tasks and ISRs keep the basic frame */
     S32_SCB->FPCCR &= ~(S32_SCB_FPCCR_LSPEN_MASK);
+#else
+/* Lazy stacking: FP registers are only written when the exception handler uses the FPU */
+    S32_SCB->FPCCR |= S32_SCB_FPCCR_LSPEN_MASK;
 #endif
+    __asm volatile ("dsb \n\t"
+                    "isb \n\t" : : : "memory");
 #endif /* ENABLE_FPU */
 
 /**************************************************************************/
@@ -706,4 +582,11 @@ void SystemInit (void)
 /***************************************************Log Projects********************************************************
  *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
  *| CMARTI  |     NA      | 28-Apr-2021 | First version of cStartup_file.c                                             |
+ *| CMARTI  |  user-001   | 17-Oct-2026 | init_data_bss uses word/burst startup memory engine                          |
+ *| CMARTI  |  user-002   | 17-Oct-2026 | Optional compressed .data/.code_ram init image (STARTUP_COMPRESSED_INIT)     |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | Core macros moved to Core_CM4.h, default handlers are weak                   |
+ *| CMARTI  |  user-004   | 17-Oct-2026 | Explicit ASPEN/LSPEN setup for per task FP context tracking                  |
+ *| CMARTI  |  user-022   | 17-Oct-2026 | Paint the main stack in Reset_Handler                                        |
+ *| CMARTI  |  user-023   | 17-Oct-2026 | Clear FAST_BSS in init_data_bss                                              |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | Warm-boot record check, HardFault_Handler stores the crash context           |
 ***********************************************************************************************************************/
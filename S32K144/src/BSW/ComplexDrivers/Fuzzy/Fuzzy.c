@@ -0,0 +1,139 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Fuzzy.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Fuzzy.c
+    Table driven fuzzy inference. tools/FuzzyGen/fuzzy_gen.py emulates this code to check the generated
+    tables, keep both in line.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Fuzzy.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static const Fuzzy_LutEntryType * Fuzzy_Fuzzify(const Fuzzy_InputType * input, s32bit value);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Lookup table entry of value, inputs outside the table range use the first or last entry.
+ */
+static const Fuzzy_LutEntryType * Fuzzy_Fuzzify(const Fuzzy_InputType * input, s32bit value)
+{
+    s64bit index = ((s64bit)value - input->offset) * (s64bit)input->scale;
+
+    index >>= 16;
+    if (index < 0)
+    {
+        index = 0;
+    }
+    else if (index >= (s64bit)input->lutSize)
+    {
+        index = (s64bit)input->lutSize - 1;
+    }
+    else
+    {
+        /* In range */
+    }
+    return &input->lut[(u32bit)index];
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+/*
+ * The fired rules are built input by input: every combination so far is extended with the one or two
+ * active terms of the next input, keeping the rule table index and the minimum degree.
+ */
+s32bit Fuzzy_Infer(const Fuzzy_SystemType * system, const s32bit * inputs)
+{
+    u32bit index[FUZZY_MAX_ACTIVE];
+    u16bit weight[FUZZY_MAX_ACTIVE];
+    u32bit count = 1u;
+    u32bit input;
+    u32bit n;
+    u16bit mu;
+    u8bit  rule;
+    u32bit area;
+    s64bit num = 0;
+    s64bit den = 0;
+    const Fuzzy_LutEntryType * entry;
+    const Fuzzy_InputType * desc;
+
+    index[0] = 0u;
+    weight[0] = 0x7FFFu;
+
+    for (input = 0u; input < system->inputCount; input++)
+    {
+        desc = &system->inputs[input];
+        entry = Fuzzy_Fuzzify(desc, inputs[input]);
+
+        /* Second term: new combinations appended after the current ones */
+        if (entry->mu[1] != 0u)
+        {
+            for (n = 0u; n < count; n++)
+            {
+                mu = entry->mu[1];
+                index[count + n] = index[n] + ((u32bit)entry->term[1] * desc->stride);
+                weight[count + n] = (weight[n] < mu) ? weight[n] : mu;
+            }
+        }
+        /* First term: combinations updated in place */
+        for (n = 0u; n < count; n++)
+        {
+            mu = entry->mu[0];
+            index[n] += (u32bit)entry->term[0] * desc->stride;
+            weight[n] = (weight[n] < mu) ? weight[n] : mu;
+        }
+        if (entry->mu[1] != 0u)
+        {
+            count <<= 1;
+        }
+    }
+
+    for (n = 0u; n < count; n++)
+    {
+        rule = system->rules[index[n]];
+        if ((rule != FUZZY_NO_RULE) && (weight[n] != 0u))
+        {
+            area = ((u32bit)weight[n] * system->area[rule]) >> 15;
+            num += (s64bit)area * system->centroid[rule];
+            den += (s64bit)area;
+        }
+    }
+
+    return (den != 0) ? (s32bit)(num / den) : system->defaultOutput;
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-009   | 17-Oct-2026 | First version of Fuzzy.c                                                     |
+***********************************************************************************************************************/
@@ -0,0 +1,83 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Fuzzy.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Fuzzy.h
+    Table driven fuzzy inference.
+    Membership functions and rule base are compiled offline by tools/FuzzyGen into Fuzzy_Cfg.c: one
+    lookup table per input giving the (at most two) active terms and their Q15 degrees, a dense rule
+    table indexed by the combination of input terms, and the area and centroid of every output term.
+    Semantics: AND = min, product implication, sum aggregation, centroid defuzzification, which reduces
+    to sum(w * area * centroid) / sum(w * area) over the fired rules.
+    One inference costs one table read per input and at most 2^FUZZY_MAX_INPUTS rule reads and MACs.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef FUZZY_H_
+#define FUZZY_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define FUZZY_MAX_INPUTS    (4u)
+#define FUZZY_MAX_ACTIVE    (1u << FUZZY_MAX_INPUTS)   /*Rules fired by one inference at most*/
+
+/*Rule table value of a term combination without rule*/
+#define FUZZY_NO_RULE       (0xFFu)
+
+/*One input value: active terms and their degrees (Q15, 0 = second term unused)*/
+typedef struct
+{
+    u8bit  term[2];
+    u16bit mu[2];
+} Fuzzy_LutEntryType;
+
+typedef struct
+{
+    const Fuzzy_LutEntryType * lut;
+    s32bit                     offset;  /*Input value of lut[0]*/
+    u32bit                     scale;   /*Lut entries per input unit, Q16*/
+    u16bit                     lutSize;
+    u16bit                     stride;  /*Rule table stride of this input*/
+} Fuzzy_InputType;
+
+typedef struct
+{
+    const Fuzzy_InputType * inputs;
+    const u8bit *           rules;          /*Output term per input term combination, FUZZY_NO_RULE if none*/
+    const u16bit *          area;           /*Output term area, Q15 of the largest one*/
+    const s32bit *          centroid;       /*Output term centroid, output units*/
+    s32bit                  defaultOutput;  /*Returned when no rule fires*/
+    u8bit                   inputCount;
+} Fuzzy_SystemType;
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Crisp output of system for inputs[system->inputCount]*/
+extern s32bit Fuzzy_Infer(const Fuzzy_SystemType * system, const s32bit * inputs);
+
+#endif /* FUZZY_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-009   | 17-Oct-2026 | First version of Fuzzy.h                                                     |
+***********************************************************************************************************************/
@@ -0,0 +1,247 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                                OBJECT SPECIFICATION                                               */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Fuzzy_Cfg.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Fuzzy_Cfg.c
+    Fuzzy systems, generated by tools/FuzzyGen/fuzzy_gen.py from Fuzzy_Cfg.json. Do not edit.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Fuzzy_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+/*SpeedCtrl.error, NB NS Z PS PB*/
+static const Fuzzy_LutEntryType Fuzzy_SpeedCtrl_Lut0[256u] =
+{
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 1u }, { 32511u, 256u } }, { { 0u, 1u }, { 31658u, 1109u } }, { { 0u, 1u }, { 30804u, 1963u } },
+    { { 0u, 1u }, { 29951u, 2816u } }, { { 0u, 1u }, { 29098u, 3669u } }, { { 0u, 1u }, { 28244u, 4523u } },
+    { { 0u, 1u }, { 27391u, 5376u } }, { { 0u, 1u }, { 26538u, 6229u } }, { { 0u, 1u }, { 25685u, 7082u } },
+    { { 0u, 1u }, { 24831u, 7936u } }, { { 0u, 1u }, { 23978u, 8789u } }, { { 0u, 1u }, { 23125u, 9642u } },
+    { { 0u, 1u }, { 22271u, 10496u } }, { { 0u, 1u }, { 21418u, 11349u } }, { { 0u, 1u }, { 20565u, 12202u } },
+    { { 0u, 1u }, { 19711u, 13056u } }, { { 0u, 1u }, { 18858u, 13909u } }, { { 0u, 1u }, { 18005u, 14762u } },
+    { { 0u, 1u }, { 17151u, 15616u } }, { { 0u, 1u }, { 16298u, 16469u } }, { { 0u, 1u }, { 15445u, 17322u } },
+    { { 0u, 1u }, { 14592u, 18175u } }, { { 0u, 1u }, { 13738u, 19029u } }, { { 0u, 1u }, { 12885u, 19882u } },
+    { { 0u, 1u }, { 12032u, 20735u } }, { { 0u, 1u }, { 11178u, 21589u } }, { { 0u, 1u }, { 10325u, 22442u } },
+    { { 0u, 1u }, { 9472u, 23295u } }, { { 0u, 1u }, { 8618u, 24149u } }, { { 0u, 1u }, { 7765u, 25002u } },
+    { { 0u, 1u }, { 6912u, 25855u } }, { { 0u, 1u }, { 6058u, 26709u } }, { { 0u, 1u }, { 5205u, 27562u } },
+    { { 0u, 1u }, { 4352u, 28415u } }, { { 0u, 1u }, { 3499u, 29268u } }, { { 0u, 1u }, { 2645u, 30122u } },
+    { { 0u, 1u }, { 1792u, 30975u } }, { { 0u, 1u }, { 939u, 31828u } }, { { 0u, 1u }, { 85u, 32682u } },
+    { { 1u, 2u }, { 31999u, 768u } }, { { 1u, 2u }, { 31146u, 1621u } }, { { 1u, 2u }, { 30292u, 2475u } },
+    { { 1u, 2u }, { 29439u, 3328u } }, { { 1u, 2u }, { 28586u, 4181u } }, { { 1u, 2u }, { 27732u, 5035u } },
+    { { 1u, 2u }, { 26879u, 5888u } }, { { 1u, 2u }, { 26026u, 6741u } }, { { 1u, 2u }, { 25173u, 7594u } },
+    { { 1u, 2u }, { 24319u, 8448u } }, { { 1u, 2u }, { 23466u, 9301u } }, { { 1u, 2u }, { 22613u, 10154u } },
+    { { 1u, 2u }, { 21759u, 11008u } }, { { 1u, 2u }, { 20906u, 11861u } }, { { 1u, 2u }, { 20053u, 12714u } },
+    { { 1u, 2u }, { 19199u, 13568u } }, { { 1u, 2u }, { 18346u, 14421u } }, { { 1u, 2u }, { 17493u, 15274u } },
+    { { 1u, 2u }, { 16639u, 16128u } }, { { 1u, 2u }, { 15786u, 16981u } }, { { 1u, 2u }, { 14933u, 17834u } },
+    { { 1u, 2u }, { 14080u, 18687u } }, { { 1u, 2u }, { 13226u, 19541u } }, { { 1u, 2u }, { 12373u, 20394u } },
+    { { 1u, 2u }, { 11520u, 21247u } }, { { 1u, 2u }, { 10666u, 22101u } }, { { 1u, 2u }, { 9813u, 22954u } },
+    { { 1u, 2u }, { 8960u, 23807u } }, { { 1u, 2u }, { 8106u, 24661u } }, { { 1u, 2u }, { 7253u, 25514u } },
+    { { 1u, 2u }, { 6400u, 26367u } }, { { 1u, 2u }, { 5546u, 27221u } }, { { 1u, 2u }, { 4693u, 28074u } },
+    { { 1u, 2u }, { 3840u, 28927u } }, { { 1u, 2u }, { 2987u, 29780u } }, { { 1u, 2u }, { 2133u, 30634u } },
+    { { 1u, 2u }, { 1280u, 31487u } }, { { 1u, 2u }, { 427u, 32340u } }, { { 2u, 3u }, { 32340u, 427u } },
+    { { 2u, 3u }, { 31487u, 1280u } }, { { 2u, 3u }, { 30634u, 2133u } }, { { 2u, 3u }, { 29780u, 2987u } },
+    { { 2u, 3u }, { 28927u, 3840u } }, { { 2u, 3u }, { 28074u, 4693u } }, { { 2u, 3u }, { 27221u, 5546u } },
+    { { 2u, 3u }, { 26367u, 6400u } }, { { 2u, 3u }, { 25514u, 7253u } }, { { 2u, 3u }, { 24661u, 8106u } },
+    { { 2u, 3u }, { 23807u, 8960u } }, { { 2u, 3u }, { 22954u, 9813u } }, { { 2u, 3u }, { 22101u, 10666u } },
+    { { 2u, 3u }, { 21247u, 11520u } }, { { 2u, 3u }, { 20394u, 12373u } }, { { 2u, 3u }, { 19541u, 13226u } },
+    { { 2u, 3u }, { 18687u, 14080u } }, { { 2u, 3u }, { 17834u, 14933u } }, { { 2u, 3u }, { 16981u, 15786u } },
+    { { 2u, 3u }, { 16128u, 16639u } }, { { 2u, 3u }, { 15274u, 17493u } }, { { 2u, 3u }, { 14421u, 18346u } },
+    { { 2u, 3u }, { 13568u, 19199u } }, { { 2u, 3u }, { 12714u, 20053u } }, { { 2u, 3u }, { 11861u, 20906u } },
+    { { 2u, 3u }, { 11008u, 21759u } }, { { 2u, 3u }, { 10154u, 22613u } }, { { 2u, 3u }, { 9301u, 23466u } },
+    { { 2u, 3u }, { 8448u, 24319u } }, { { 2u, 3u }, { 7594u, 25173u } }, { { 2u, 3u }, { 6741u, 26026u } },
+    { { 2u, 3u }, { 5888u, 26879u } }, { { 2u, 3u }, { 5035u, 27732u } }, { { 2u, 3u }, { 4181u, 28586u } },
+    { { 2u, 3u }, { 3328u, 29439u } }, { { 2u, 3u }, { 2475u, 30292u } }, { { 2u, 3u }, { 1621u, 31146u } },
+    { { 2u, 3u }, { 768u, 31999u } }, { { 3u, 4u }, { 32682u, 85u } }, { { 3u, 4u }, { 31828u, 939u } },
+    { { 3u, 4u }, { 30975u, 1792u } }, { { 3u, 4u }, { 30122u, 2645u } }, { { 3u, 4u }, { 29268u, 3499u } },
+    { { 3u, 4u }, { 28415u, 4352u } }, { { 3u, 4u }, { 27562u, 5205u } }, { { 3u, 4u }, { 26709u, 6058u } },
+    { { 3u, 4u }, { 25855u, 6912u } }, { { 3u, 4u }, { 25002u, 7765u } }, { { 3u, 4u }, { 24149u, 8618u } },
+    { { 3u, 4u }, { 23295u, 9472u } }, { { 3u, 4u }, { 22442u, 10325u } }, { { 3u, 4u }, { 21589u, 11178u } },
+    { { 3u, 4u }, { 20735u, 12032u } }, { { 3u, 4u }, { 19882u, 12885u } }, { { 3u, 4u }, { 19029u, 13738u } },
+    { { 3u, 4u }, { 18175u, 14592u } }, { { 3u, 4u }, { 17322u, 15445u } }, { { 3u, 4u }, { 16469u, 16298u } },
+    { { 3u, 4u }, { 15616u, 17151u } }, { { 3u, 4u }, { 14762u, 18005u } }, { { 3u, 4u }, { 13909u, 18858u } },
+    { { 3u, 4u }, { 13056u, 19711u } }, { { 3u, 4u }, { 12202u, 20565u } }, { { 3u, 4u }, { 11349u, 21418u } },
+    { { 3u, 4u }, { 10496u, 22271u } }, { { 3u, 4u }, { 9642u, 23125u } }, { { 3u, 4u }, { 8789u, 23978u } },
+    { { 3u, 4u }, { 7936u, 24831u } }, { { 3u, 4u }, { 7082u, 25685u } }, { { 3u, 4u }, { 6229u, 26538u } },
+    { { 3u, 4u }, { 5376u, 27391u } }, { { 3u, 4u }, { 4523u, 28244u } }, { { 3u, 4u }, { 3669u, 29098u } },
+    { { 3u, 4u }, { 2816u, 29951u } }, { { 3u, 4u }, { 1963u, 30804u } }, { { 3u, 4u }, { 1109u, 31658u } },
+    { { 3u, 4u }, { 256u, 32511u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } }, { { 4u, 0u }, { 32767u, 0u } },
+    { { 4u, 0u }, { 32767u, 0u } }
+};
+
+/*SpeedCtrl.errorRate, N Z P*/
+static const Fuzzy_LutEntryType Fuzzy_SpeedCtrl_Lut1[256u] =
+{
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 0u }, { 32767u, 0u } }, { { 0u, 1u }, { 32511u, 256u } }, { { 0u, 1u }, { 31999u, 768u } },
+    { { 0u, 1u }, { 31487u, 1280u } }, { { 0u, 1u }, { 30975u, 1792u } }, { { 0u, 1u }, { 30463u, 2304u } },
+    { { 0u, 1u }, { 29951u, 2816u } }, { { 0u, 1u }, { 29439u, 3328u } }, { { 0u, 1u }, { 28927u, 3840u } },
+    { { 0u, 1u }, { 28415u, 4352u } }, { { 0u, 1u }, { 27903u, 4864u } }, { { 0u, 1u }, { 27391u, 5376u } },
+    { { 0u, 1u }, { 26879u, 5888u } }, { { 0u, 1u }, { 26367u, 6400u } }, { { 0u, 1u }, { 25855u, 6912u } },
+    { { 0u, 1u }, { 25343u, 7424u } }, { { 0u, 1u }, { 24831u, 7936u } }, { { 0u, 1u }, { 24319u, 8448u } },
+    { { 0u, 1u }, { 23807u, 8960u } }, { { 0u, 1u }, { 23295u, 9472u } }, { { 0u, 1u }, { 22783u, 9984u } },
+    { { 0u, 1u }, { 22271u, 10496u } }, { { 0u, 1u }, { 21759u, 11008u } }, { { 0u, 1u }, { 21247u, 11520u } },
+    { { 0u, 1u }, { 20735u, 12032u } }, { { 0u, 1u }, { 20223u, 12544u } }, { { 0u, 1u }, { 19711u, 13056u } },
+    { { 0u, 1u }, { 19199u, 13568u } }, { { 0u, 1u }, { 18687u, 14080u } }, { { 0u, 1u }, { 18175u, 14592u } },
+    { { 0u, 1u }, { 17663u, 15104u } }, { { 0u, 1u }, { 17151u, 15616u } }, { { 0u, 1u }, { 16639u, 16128u } },
+    { { 0u, 1u }, { 16128u, 16639u } }, { { 0u, 1u }, { 15616u, 17151u } }, { { 0u, 1u }, { 15104u, 17663u } },
+    { { 0u, 1u }, { 14592u, 18175u } }, { { 0u, 1u }, { 14080u, 18687u } }, { { 0u, 1u }, { 13568u, 19199u } },
+    { { 0u, 1u }, { 13056u, 19711u } }, { { 0u, 1u }, { 12544u, 20223u } }, { { 0u, 1u }, { 12032u, 20735u } },
+    { { 0u, 1u }, { 11520u, 21247u } }, { { 0u, 1u }, { 11008u, 21759u } }, { { 0u, 1u }, { 10496u, 22271u } },
+    { { 0u, 1u }, { 9984u, 22783u } }, { { 0u, 1u }, { 9472u, 23295u } }, { { 0u, 1u }, { 8960u, 23807u } },
+    { { 0u, 1u }, { 8448u, 24319u } }, { { 0u, 1u }, { 7936u, 24831u } }, { { 0u, 1u }, { 7424u, 25343u } },
+    { { 0u, 1u }, { 6912u, 25855u } }, { { 0u, 1u }, { 6400u, 26367u } }, { { 0u, 1u }, { 5888u, 26879u } },
+    { { 0u, 1u }, { 5376u, 27391u } }, { { 0u, 1u }, { 4864u, 27903u } }, { { 0u, 1u }, { 4352u, 28415u } },
+    { { 0u, 1u }, { 3840u, 28927u } }, { { 0u, 1u }, { 3328u, 29439u } }, { { 0u, 1u }, { 2816u, 29951u } },
+    { { 0u, 1u }, { 2304u, 30463u } }, { { 0u, 1u }, { 1792u, 30975u } }, { { 0u, 1u }, { 1280u, 31487u } },
+    { { 0u, 1u }, { 768u, 31999u } }, { { 0u, 1u }, { 256u, 32511u } }, { { 1u, 2u }, { 32511u, 256u } },
+    { { 1u, 2u }, { 31999u, 768u } }, { { 1u, 2u }, { 31487u, 1280u } }, { { 1u, 2u }, { 30975u, 1792u } },
+    { { 1u, 2u }, { 30463u, 2304u } }, { { 1u, 2u }, { 29951u, 2816u } }, { { 1u, 2u }, { 29439u, 3328u } },
+    { { 1u, 2u }, { 28927u, 3840u } }, { { 1u, 2u }, { 28415u, 4352u } }, { { 1u, 2u }, { 27903u, 4864u } },
+    { { 1u, 2u }, { 27391u, 5376u } }, { { 1u, 2u }, { 26879u, 5888u } }, { { 1u, 2u }, { 26367u, 6400u } },
+    { { 1u, 2u }, { 25855u, 6912u } }, { { 1u, 2u }, { 25343u, 7424u } }, { { 1u, 2u }, { 24831u, 7936u } },
+    { { 1u, 2u }, { 24319u, 8448u } }, { { 1u, 2u }, { 23807u, 8960u } }, { { 1u, 2u }, { 23295u, 9472u } },
+    { { 1u, 2u }, { 22783u, 9984u } }, { { 1u, 2u }, { 22271u, 10496u } }, { { 1u, 2u }, { 21759u, 11008u } },
+    { { 1u, 2u }, { 21247u, 11520u } }, { { 1u, 2u }, { 20735u, 12032u } }, { { 1u, 2u }, { 20223u, 12544u } },
+    { { 1u, 2u }, { 19711u, 13056u } }, { { 1u, 2u }, { 19199u, 13568u } }, { { 1u, 2u }, { 18687u, 14080u } },
+    { { 1u, 2u }, { 18175u, 14592u } }, { { 1u, 2u }, { 17663u, 15104u } }, { { 1u, 2u }, { 17151u, 15616u } },
+    { { 1u, 2u }, { 16639u, 16128u } }, { { 1u, 2u }, { 16128u, 16639u } }, { { 1u, 2u }, { 15616u, 17151u } },
+    { { 1u, 2u }, { 15104u, 17663u } }, { { 1u, 2u }, { 14592u, 18175u } }, { { 1u, 2u }, { 14080u, 18687u } },
+    { { 1u, 2u }, { 13568u, 19199u } }, { { 1u, 2u }, { 13056u, 19711u } }, { { 1u, 2u }, { 12544u, 20223u } },
+    { { 1u, 2u }, { 12032u, 20735u } }, { { 1u, 2u }, { 11520u, 21247u } }, { { 1u, 2u }, { 11008u, 21759u } },
+    { { 1u, 2u }, { 10496u, 22271u } }, { { 1u, 2u }, { 9984u, 22783u } }, { { 1u, 2u }, { 9472u, 23295u } },
+    { { 1u, 2u }, { 8960u, 23807u } }, { { 1u, 2u }, { 8448u, 24319u } }, { { 1u, 2u }, { 7936u, 24831u } },
+    { { 1u, 2u }, { 7424u, 25343u } }, { { 1u, 2u }, { 6912u, 25855u } }, { { 1u, 2u }, { 6400u, 26367u } },
+    { { 1u, 2u }, { 5888u, 26879u } }, { { 1u, 2u }, { 5376u, 27391u } }, { { 1u, 2u }, { 4864u, 27903u } },
+    { { 1u, 2u }, { 4352u, 28415u } }, { { 1u, 2u }, { 3840u, 28927u } }, { { 1u, 2u }, { 3328u, 29439u } },
+    { { 1u, 2u }, { 2816u, 29951u } }, { { 1u, 2u }, { 2304u, 30463u } }, { { 1u, 2u }, { 1792u, 30975u } },
+    { { 1u, 2u }, { 1280u, 31487u } }, { { 1u, 2u }, { 768u, 31999u } }, { { 1u, 2u }, { 256u, 32511u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } }, { { 2u, 0u }, { 32767u, 0u } },
+    { { 2u, 0u }, { 32767u, 0u } }
+};
+
+static const Fuzzy_InputType Fuzzy_SpeedCtrl_Inputs[2u] =
+{
+    { Fuzzy_SpeedCtrl_Lut0, -1000, 8389u, 256u, 1u },
+    { Fuzzy_SpeedCtrl_Lut1, -200, 41943u, 256u, 5u }
+};
+
+static const u8bit Fuzzy_SpeedCtrl_Rules[15u] =
+{
+    0u, 0u, 1u, 2u, 4u, 0u, 1u, 2u, 3u, 4u, 0u, 2u, 3u, 4u, 4u
+};
+
+/*SpeedCtrl.torque, NB NS Z PS PB*/
+static const u16bit Fuzzy_SpeedCtrl_Area[5u] =
+{
+    21845u, 32767u, 21845u, 32767u, 21845u
+};
+
+static const s32bit Fuzzy_SpeedCtrl_Centroid[5u] =
+{
+    -750, -375, 0, 375, 750
+};
+
+const Fuzzy_SystemType Fuzzy_SpeedCtrl =
+{
+    Fuzzy_SpeedCtrl_Inputs, Fuzzy_SpeedCtrl_Rules, Fuzzy_SpeedCtrl_Area, Fuzzy_SpeedCtrl_Centroid, 0, 2u
+};
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-009   | 17-Oct-2026 | Generated Fuzzy_Cfg.c                                                        |
+***********************************************************************************************************************/
@@ -0,0 +1,45 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                                OBJECT SPECIFICATION                                               */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Fuzzy_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Fuzzy_Cfg.h
+    Fuzzy systems, generated by tools/FuzzyGen/fuzzy_gen.py from Fuzzy_Cfg.json. Do not edit.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef FUZZY_CFG_H_
+#define FUZZY_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Fuzzy.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+extern const Fuzzy_SystemType Fuzzy_SpeedCtrl;
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* FUZZY_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-009   | 17-Oct-2026 | Generated Fuzzy_Cfg.h                                                        |
+***********************************************************************************************************************/
@@ -0,0 +1,203 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: NeuralNet.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \NeuralNet.c
+    Quantized neural network inference. tools/NnConvert/nn_convert.py emulates these kernels to produce
+    the reference outputs, keep both in line.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "NeuralNet.h"
+#include "Core_CM4.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+u32bit NeuralNet_LayerCycles[NEURALNET_CFG_MAX_LAYERS];
+
+/*Tensor arena, offsets come from the converter*/
+static u8bit NeuralNet_Arena[NEURALNET_CFG_ARENA_SIZE] ALIGNED(8);
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static s32bit NeuralNet_DotS8(const s8bit * x, const s8bit * w, u32bit n, s32bit acc);
+static s32bit NeuralNet_DotS16(const s16bit * x, const s8bit * w, u32bit n, s32bit acc);
+static void   NeuralNet_Layer(const NeuralNet_LayerType * layer, u8bit elemBytes);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Four bytes as a little endian word, a single (unaligned) LDR on the target.
+ */
+static inline u32bit NeuralNet_Load4(const s8bit * p)
+{
+    return ((u32bit)(u8bit)p[0]) | ((u32bit)(u8bit)p[1] << 8) | ((u32bit)(u8bit)p[2] << 16) |
+           ((u32bit)(u8bit)p[3] << 24);
+}
+
+/*
+ * Rounding fixed point multiply: acc * mult / 2^shift.
+ */
+static inline s32bit NeuralNet_Requant(s32bit acc, s32bit mult, u8bit shift)
+{
+    return (s32bit)((((s64bit)acc * mult) + ((s64bit)1 << (shift - 1u))) >> shift);
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * int8 x int8 dot product. SXTB16 splits four bytes into the even and odd halfword pairs of both
+ * operands, two SMLAD then add the four products.
+ */
+static s32bit NeuralNet_DotS8(const s8bit * x, const s8bit * w, u32bit n, s32bit acc)
+{
+    u32bit i;
+    u32bit xWord;
+    u32bit wWord;
+
+    for (i = 0u; (i + 4u) <= n; i += 4u)
+    {
+        xWord = NeuralNet_Load4(&x[i]);
+        wWord = NeuralNet_Load4(&w[i]);
+        acc = Core_Smlad(Core_Sxtb16(xWord), Core_Sxtb16(wWord), acc);
+        acc = Core_Smlad(Core_Sxtb16Ror8(xWord), Core_Sxtb16Ror8(wWord), acc);
+    }
+    for (; i < n; i++)
+    {
+        acc += (s32bit)x[i] * w[i];
+    }
+    return acc;
+}
+
+/*
+ * int16 x int8 dot product, the weight halfword pairs are put back in input order before SMLAD.
+ */
+static s32bit NeuralNet_DotS16(const s16bit * x, const s8bit * w, u32bit n, s32bit acc)
+{
+    u32bit i;
+    u32bit wEven;
+    u32bit wOdd;
+
+    for (i = 0u; (i + 4u) <= n; i += 4u)
+    {
+        wEven = Core_Sxtb16(NeuralNet_Load4(&w[i]));
+        wOdd = Core_Sxtb16Ror8(NeuralNet_Load4(&w[i]));
+        acc = Core_Smlad(Core_Pack16(x[i], x[i + 1u]), Core_Pack16(CORE_LO16(wEven), CORE_LO16(wOdd)), acc);
+        acc = Core_Smlad(Core_Pack16(x[i + 2u], x[i + 3u]), Core_Pack16(CORE_HI16(wEven), CORE_HI16(wOdd)), acc);
+    }
+    for (; i < n; i++)
+    {
+        acc += (s32bit)x[i] * w[i];
+    }
+    return acc;
+}
+
+/*
+ * One dense or convolution layer, output stored position by position, channels last.
+ */
+static void NeuralNet_Layer(const NeuralNet_LayerType * layer, u8bit elemBytes)
+{
+    const u8bit * in = &NeuralNet_Arena[layer->inOffset];
+    u8bit * out = &NeuralNet_Arena[layer->outOffset];
+    const s8bit * weights;
+    u32bit pos;
+    u32bit filter;
+    u32bit index = 0u;
+    s32bit acc;
+
+    for (pos = 0u; pos < layer->outLength; pos++)
+    {
+        weights = layer->weights;
+        for (filter = 0u; filter < layer->filters; filter++)
+        {
+            if (elemBytes == 1u)
+            {
+                acc = NeuralNet_DotS8(&((const s8bit *)in)[pos * layer->step], weights, layer->window,
+                                      layer->bias[filter]);
+            }
+            else
+            {
+                acc = NeuralNet_DotS16(&((const s16bit *)in)[pos * layer->step], weights, layer->window,
+                                       layer->bias[filter]);
+            }
+            weights += layer->window;
+
+            acc = NeuralNet_Requant(acc, layer->mult, layer->shift) + layer->outZero;
+            acc = (acc < layer->actMin) ? layer->actMin : ((acc > layer->actMax) ? layer->actMax : acc);
+            if (elemBytes == 1u)
+            {
+                ((s8bit *)out)[index] = (s8bit)acc;
+            }
+            else
+            {
+                ((s16bit *)out)[index] = (s16bit)acc;
+            }
+            index++;
+        }
+    }
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void * NeuralNet_Input(const NeuralNet_ModelType * model)
+{
+    return &NeuralNet_Arena[model->inOffset];
+}
+
+const void * NeuralNet_Output(const NeuralNet_ModelType * model)
+{
+    return &NeuralNet_Arena[model->outOffset];
+}
+
+/*
+ * Run the layers in order, timing every one of them with NEURALNET_CFG_CYCLES.
+ */
+boolean NeuralNet_Invoke(const NeuralNet_ModelType * model)
+{
+    u32bit layer;
+    u32bit start;
+    boolean fits = FALSE;
+
+    PROF_BEGIN(NeuralNetInvoke);
+    if ((model->arenaBytes <= NEURALNET_CFG_ARENA_SIZE) && (model->layerCount <= NEURALNET_CFG_MAX_LAYERS))
+    {
+        for (layer = 0u; layer < model->layerCount; layer++)
+        {
+            start = NEURALNET_CFG_CYCLES();
+            NeuralNet_Layer(&model->layers[layer], model->elemBytes);
+            NeuralNet_LayerCycles[layer] = NEURALNET_CFG_CYCLES() - start;
+        }
+        fits = TRUE;
+    }
+    PROF_END(NeuralNetInvoke);
+    return fits;
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-010   | 17-Oct-2026 | First version of NeuralNet.c                                                 |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | NeuralNetInvoke profiling probe                                              |
+***********************************************************************************************************************/
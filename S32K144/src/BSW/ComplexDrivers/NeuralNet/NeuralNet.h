@@ -0,0 +1,91 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: NeuralNet.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \NeuralNet.h
+    Quantized neural network inference.
+    Models are converted offline by tools/NnConvert into const tables (NeuralNet_Models.c): int8 weights,
+    int32 biases with the input zero point folded in, and a requantization multiplier per layer.
+    Activations are int8 (asymmetric) or int16 (symmetric) and live in one static tensor arena, the
+    converter places every tensor at a fixed offset reusing the space of tensors that are dead.
+    Dense and 1D convolution layers are both dot products over a window of contiguous activations
+    (channels last), computed two MACs per SMLAD.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef NEURALNET_H_
+#define NEURALNET_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "NeuralNet_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Dense or 1D convolution layer. Output element [t][f] = requant(bias[f] + dot(in + t * step, weights[f], window))*/
+typedef struct
+{
+    const s8bit *  weights;             /*[filters][window]*/
+    const s32bit * bias;                /*[filters]*/
+    u32bit         inOffset;            /*Arena byte offsets*/
+    u32bit         outOffset;
+    u16bit         outLength;           /*Output positions, 1 for dense layers*/
+    u16bit         filters;             /*Output channels*/
+    u16bit         window;              /*Input elements per dot product*/
+    u16bit         step;                /*Input elements between two output positions*/
+    s32bit         mult;                /*Requantization multiplier, Q31*/
+    u8bit          shift;               /*Requantization right shift, 31 included*/
+    s16bit         outZero;             /*Output zero point*/
+    s16bit         actMin;              /*Output clamp, ReLU included*/
+    s16bit         actMax;
+    u32bit         macs;
+} NeuralNet_LayerType;
+
+typedef struct
+{
+    const NeuralNet_LayerType * layers;
+    u32bit                      inOffset;
+    u32bit                      outOffset;
+    u32bit                      arenaBytes;     /*Peak arena use*/
+    u16bit                      inSize;         /*Elements*/
+    u16bit                      outSize;
+    u8bit                       layerCount;
+    u8bit                       elemBytes;      /*1: int8 activations, 2: int16*/
+} NeuralNet_ModelType;
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+/*Cycles of every layer during the last NeuralNet_Invoke, see NEURALNET_CFG_CYCLES*/
+extern u32bit NeuralNet_LayerCycles[NEURALNET_CFG_MAX_LAYERS];
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Input tensor of model in the arena, fill inSize elements before NeuralNet_Invoke*/
+extern void * NeuralNet_Input(const NeuralNet_ModelType * model);
+
+/*Output tensor of model, valid after NeuralNet_Invoke until another model runs*/
+extern const void * NeuralNet_Output(const NeuralNet_ModelType * model);
+
+/*Run every layer, FALSE when the model does not fit the arena*/
+extern boolean NeuralNet_Invoke(const NeuralNet_ModelType * model);
+
+#endif /* NEURALNET_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-010   | 17-Oct-2026 | First version of NeuralNet.h                                                 |
+***********************************************************************************************************************/
@@ -0,0 +1,57 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: NeuralNet_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \NeuralNet_Cfg.h
+    Configuration of the neural network runtime.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef NEURALNET_CFG_H_
+#define NEURALNET_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Prof.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Tensor arena bytes, at least the largest arenaBytes reported by tools/NnConvert*/
+#define NEURALNET_CFG_ARENA_SIZE            (256u)
+
+/*Layers of the largest model*/
+#define NEURALNET_CFG_MAX_LAYERS            (8u)
+
+/*Free running cycle counter read around every layer, 0 disables the per layer measurement*/
+#if (PROF_CFG_ENABLED == 1u)
+#define NEURALNET_CFG_CYCLES()              Prof_Now()
+#else
+#define NEURALNET_CFG_CYCLES()              (0u)
+#endif
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* NEURALNET_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-010   | 17-Oct-2026 | First version of NeuralNet_Cfg.h                                             |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | Per layer cycles from Prof_Now when profiling is enabled                     |
+***********************************************************************************************************************/
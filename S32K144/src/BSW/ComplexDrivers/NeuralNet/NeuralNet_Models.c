@@ -0,0 +1,110 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                                OBJECT SPECIFICATION                                               */
+/*********************************************************************************************************************/
+/*!
+ * $Source: NeuralNet_Models.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \NeuralNet_Models.c
+    Models, generated by tools/NnConvert/nn_convert.py from NeuralNet_Models.json. Do not edit.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "NeuralNet_Models.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+static const s8bit NeuralNet_Vibration_Weights0[12u] =
+{
+    -48, -96, 41, -117, 10, -37, -121, 2, -127, -18, -118, -112
+};
+
+static const s32bit NeuralNet_Vibration_Bias0[4u] =
+{
+    -144, -2452, 3092, 3832
+};
+
+static const s8bit NeuralNet_Vibration_Weights1[448u] =
+{
+    -19, 83, -96, -70, 33, 114, 20, -26, 121, -115, 91, -53, -90, -97, -49, 80,
+    -81, 21, 35, -33, 12, -111, -112, -75, 46, -18, -47, 22, -12, -51, 75, 50,
+    -65, 19, 7, 96, 58, -54, 122, -97, -21, 66, -88, -3, -117, 43, 67, 19,
+    96, -47, 50, 24, 20, -11, 86, 113, -7, 42, -112, 51, 38, 125, 82, -55,
+    -29, 43, -121, -10, -84, -97, -112, 68, -94, -64, -28, 94, -107, -13, 13, 98,
+    81, 92, -56, -21, -36, 98, 116, -89, -82, -68, -68, -4, 23, -60, -126, -21,
+    -33, 17, 115, 48, 4, 30, 45, -113, 102, 71, 95, 76, -27, -26, -101, 34,
+    -111, -110, -74, -86, -41, -114, -127, -88, -101, -35, -120, 95, 29, -89, -63, -39,
+    -35, -96, 88, 125, -9, -4, -105, -101, -40, -60, 83, -86, -121, 114, 7, -90,
+    11, -120, 7, 121, 92, 50, -60, -34, -84, 69, 8, 71, -43, -70, 79, 123,
+    89, 78, 81, 61, -70, 5, -37, -120, -120, -56, -61, 49, 116, -13, 111, 124,
+    116, -35, -71, -70, -77, -75, 31, 102, 86, -5, 39, 76, -106, 41, 104, 72,
+    64, -6, -82, 74, -43, 76, 120, -26, -25, 113, 57, -84, -94, -88, 103, 78,
+    -90, 83, 122, 40, -38, 12, -94, -123, 119, 38, 7, 110, -17, 94, 83, -73,
+    -63, -53, -66, 22, -61, -20, -93, 104, -37, -11, 21, 103, -20, 106, 1, 8,
+    6, -122, -15, -80, -126, 76, -83, -7, 57, 14, -44, 5, 14, 72, -100, 15,
+    -64, -57, 69, 2, 16, 66, 105, -14, 28, 2, 3, 49, -12, 9, -6, 112,
+    51, 96, 112, -61, 15, 113, 86, -92, -96, -15, -109, -66, -108, 43, 72, 101,
+    -88, 55, 41, -91, 97, 119, -71, 115, -26, -3, 124, 84, -86, -17, 4, -41,
+    -77, -46, 56, -122, 14, -15, -122, -43, 31, 3, -111, 123, 73, 120, -101, -59,
+    -117, 71, -58, -94, -20, 105, 81, -61, -89, 107, 18, 51, -104, -112, 48, -19,
+    -109, 111, 34, 77, -106, 90, -110, 92, -12, -41, 14, 108, -59, -94, 7, -67,
+    -99, -86, -114, -76, -48, -49, 66, -53, 0, -82, -39, -122, -63, -123, 59, 13,
+    -79, -7, 110, -100, 81, -17, -1, 85, -27, 2, 48, 122, -40, 84, 52, 35,
+    -24, -39, -113, -94, -109, 61, -62, -85, -106, 87, 94, 43, -55, -66, -52, -10,
+    -87, -14, -60, 117, 120, 12, -65, 118, -48, -37, -126, -30, -7, 1, -76, 1,
+    -126, -60, -104, -25, -116, -121, -50, -68, 22, 8, 64, 40, 55, 97, -28, -44,
+    123, -89, 57, 37, -116, 85, 100, 33, 59, 79, -91, 6, 1, 85, 77, 83
+};
+
+static const s32bit NeuralNet_Vibration_Bias1[8u] =
+{
+    1911, -35673, -153168, 96798, 25546, -72034, -138439, -32017
+};
+
+static const s8bit NeuralNet_Vibration_Weights2[16u] =
+{
+    21, 100, 47, 49, -69, -120, -94, -36, -101, 86, 15, 33, 32, 46, -3, -127
+};
+
+static const s32bit NeuralNet_Vibration_Bias2[2u] =
+{
+    -10616, 10991
+};
+
+static const NeuralNet_LayerType NeuralNet_Vibration_Layers[3u] =
+{
+    { NeuralNet_Vibration_Weights0, NeuralNet_Vibration_Bias0, 56u, 0u, 14u, 4u, 3u, 1u,
+      1350378645, 37u, -128, -128, 127, 168u },
+    { NeuralNet_Vibration_Weights1, NeuralNet_Vibration_Bias1, 0u, 56u, 1u, 8u, 56u, 0u,
+      1823372971, 39u, -128, -128, 127, 448u },
+    { NeuralNet_Vibration_Weights2, NeuralNet_Vibration_Bias2, 56u, 0u, 1u, 2u, 8u, 0u,
+      2144996754, 39u, 7, -128, 127, 16u }
+};
+
+const NeuralNet_ModelType NeuralNet_Vibration =
+{
+    NeuralNet_Vibration_Layers, 56u, 0u, 72u, 16u, 2u, 3u, 1u
+};
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-010   | 17-Oct-2026 | Generated NeuralNet_Models.c                                                 |
+***********************************************************************************************************************/
@@ -0,0 +1,48 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                                OBJECT SPECIFICATION                                               */
+/*********************************************************************************************************************/
+/*!
+ * $Source: NeuralNet_Models.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \NeuralNet_Models.h
+    Models, generated by tools/NnConvert/nn_convert.py from NeuralNet_Models.json. Do not edit.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef NEURALNET_MODELS_H_
+#define NEURALNET_MODELS_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "NeuralNet.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*NeuralNet_Vibration input: value = 0.00555294118 * (q - zero), zero = -1*/
+/*NeuralNet_Vibration output: value = 0.0014702564 * (q - zero), zero = 7*/
+#define NEURALNET_VIBRATION_ARENA_BYTES    (72u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+extern const NeuralNet_ModelType NeuralNet_Vibration;
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* NEURALNET_MODELS_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-010   | 17-Oct-2026 | Generated NeuralNet_Models.h                                                 |
+***********************************************************************************************************************/
@@ -0,0 +1,217 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Pid.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Pid.c
+    PID controllers in float, Q31 and Q15.
+    The Q15 batch uses the DSP extension through the Core_CM4.h helpers, host builds use their C versions
+    which give the same results bit for bit.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Pid.h"
+#include "Core_CM4.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define PID_Q15_ONE         (32767)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Pid_FloatInit(Pid_FloatType * pid, const Pid_FloatParamType * param, float measurement)
+{
+    pid->param = *param;
+    pid->integ = 0.0f;
+    pid->dFilt = 0.0f;
+    pid->prevMeas = measurement;
+}
+
+float Pid_FloatUpdate(Pid_FloatType * pid, float setpoint, float measurement)
+{
+    float error = setpoint - measurement;
+    float integ = pid->integ + (pid->param.ki * error);
+    float output;
+
+    if (integ > pid->param.outMax)
+    {
+        integ = pid->param.outMax;
+    }
+    else if (integ < pid->param.outMin)
+    {
+        integ = pid->param.outMin;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    pid->dFilt += pid->param.alpha * ((pid->prevMeas - measurement) - pid->dFilt);
+    pid->prevMeas = measurement;
+    output = (pid->param.kp * error) + integ + (pid->param.kd * pid->dFilt);
+
+    if (output > pid->param.outMax)
+    {
+        output = pid->param.outMax;
+        integ = (error > 0.0f) ? pid->integ : integ;
+    }
+    else if (output < pid->param.outMin)
+    {
+        output = pid->param.outMin;
+        integ = (error < 0.0f) ? pid->integ : integ;
+    }
+    else
+    {
+        /* Not saturated */
+    }
+    pid->integ = integ;
+    return output;
+}
+
+void Pid_Q31Init(Pid_Q31Type * pid, const Pid_Q31ParamType * param, s32bit measurement)
+{
+    pid->param = *param;
+    pid->integ = 0;
+    pid->dFilt = 0;
+    pid->prevMeas = measurement;
+}
+
+/*
+ * Q31 products keep 31 fractional bits, the sum is scaled by 2^shift and saturated.
+ */
+s32bit Pid_Q31Update(Pid_Q31Type * pid, s32bit setpoint, s32bit measurement)
+{
+    s32bit error = Core_Ssat32((s64bit)setpoint - measurement);
+    s32bit delta = Core_Ssat32((s64bit)pid->prevMeas - measurement);
+    s32bit integMin = pid->param.outMin >> pid->param.shift;
+    s32bit integMax = pid->param.outMax >> pid->param.shift;
+    s32bit integ;
+    s64bit output;
+
+    integ = Core_Qadd(pid->integ, (s32bit)(((s64bit)pid->param.ki * error) >> 31));
+    integ = (integ > integMax) ? integMax : ((integ < integMin) ? integMin : integ);
+
+    pid->dFilt += (s32bit)(((s64bit)pid->param.alpha * ((s64bit)delta - pid->dFilt)) >> 31);
+    pid->prevMeas = measurement;
+
+    output = (s64bit)integ + (((s64bit)pid->param.kp * error) >> 31) + (((s64bit)pid->param.kd * pid->dFilt) >> 31);
+    output *= ((s64bit)1 << pid->param.shift);
+
+    if (output > pid->param.outMax)
+    {
+        output = pid->param.outMax;
+        integ = (error > 0) ? pid->integ : integ;
+    }
+    else if (output < pid->param.outMin)
+    {
+        output = pid->param.outMin;
+        integ = (error < 0) ? pid->integ : integ;
+    }
+    else
+    {
+        /* Not saturated */
+    }
+    pid->integ = integ;
+    return (s32bit)output;
+}
+
+void Pid_Q15Init(Pid_Q15BatchType * batch, u32bit loop, const Pid_Q15ParamType * param, s16bit measurement)
+{
+    s16bit alpha = (param->alpha < 1) ? (s16bit)1 : param->alpha;
+
+    batch->gainPD[loop] = Core_Pack16(param->kp, param->kd);
+    batch->filter[loop] = Core_Pack16(alpha, (s16bit)(PID_Q15_ONE - alpha));
+    batch->ki[loop] = param->ki;
+    batch->shift[loop] = param->shift;
+    batch->integMin[loop] = (s32bit)param->outMin * ((s32bit)1 << (15u - param->shift));
+    batch->integMax[loop] = (s32bit)param->outMax * ((s32bit)1 << (15u - param->shift));
+    batch->outMin[loop] = param->outMin;
+    batch->outMax[loop] = param->outMax;
+    batch->integ[loop] = 0;
+    batch->dFilt[loop] = 0;
+    batch->prevMeas[loop] = measurement;
+}
+
+/*
+ * Per loop: QSUB16 gives error and measurement delta together, SMUAD filters the delta, SMLALD adds the
+ * proportional and derivative terms to the Q30 integrator.
+ */
+void Pid_Q15Update(Pid_Q15BatchType * batch, const s16bit * setpoint, const s16bit * measurement,
+                   s16bit * output)
+{
+    u32bit loop;
+    u32bit diff;
+    s16bit error;
+    s16bit dFilt;
+    s32bit integ;
+    s64bit acc;
+
+    for (loop = 0u; loop < batch->count; loop++)
+    {
+        diff = Core_Qsub16(Core_Pack16(setpoint[loop], batch->prevMeas[loop]),
+                           Core_Pack16(measurement[loop], measurement[loop]));
+        error = CORE_LO16(diff);
+        dFilt = (s16bit)(Core_Smuad(batch->filter[loop], Core_Pack16(CORE_HI16(diff), batch->dFilt[loop])) >> 15);
+
+        integ = Core_Qadd(batch->integ[loop], (s32bit)batch->ki[loop] * error);
+        integ = (integ > batch->integMax[loop]) ? batch->integMax[loop] :
+                ((integ < batch->integMin[loop]) ? batch->integMin[loop] : integ);
+
+        acc = Core_Smlald(batch->gainPD[loop], Core_Pack16(error, dFilt), (s64bit)integ);
+        acc >>= (15u - batch->shift[loop]);
+
+        if (acc > batch->outMax[loop])
+        {
+            acc = batch->outMax[loop];
+            integ = (error > 0) ? batch->integ[loop] : integ;
+        }
+        else if (acc < batch->outMin[loop])
+        {
+            acc = batch->outMin[loop];
+            integ = (error < 0) ? batch->integ[loop] : integ;
+        }
+        else
+        {
+            /* Not saturated */
+        }
+
+        batch->integ[loop] = integ;
+        batch->dFilt[loop] = dFilt;
+        batch->prevMeas[loop] = measurement[loop];
+        output[loop] = (s16bit)acc;
+    }
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-008   | 17-Oct-2026 | First version of Pid.c                                                       |
+***********************************************************************************************************************/
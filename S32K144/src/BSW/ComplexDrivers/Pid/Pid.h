@@ -0,0 +1,147 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Pid.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Pid.h
+    PID controllers in float, Q31 and Q15.
+    Positional form with the derivative on the measurement through a first order filter, integrator
+    clamped to the output range and frozen while the output saturates in the direction of the error
+    (anti-windup), output clamped to [outMin, outMax]. Gains already include the sample time.
+    Q15 loops are kept as structure of arrays (Pid_Q15BatchType) and updated together, one loop costs
+    a QSUB16, a SMUAD, a SMLALD and a QADD.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef PID_H_
+#define PID_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Float controller parameters. alpha: derivative filter weight of the new sample, 1.0 = no filtering*/
+typedef struct
+{
+    float kp;
+    float ki;
+    float kd;
+    float alpha;
+    float outMin;
+    float outMax;
+} Pid_FloatParamType;
+
+typedef struct
+{
+    Pid_FloatParamType param;
+    float              integ;
+    float              dFilt;
+    float              prevMeas;
+} Pid_FloatType;
+
+/*Q31 controller parameters. Gains and alpha in Q31, the effective gain is k * 2^shift*/
+typedef struct
+{
+    s32bit kp;
+    s32bit ki;
+    s32bit kd;
+    s32bit alpha;                       /*Q31, 0x7FFFFFFF = no filtering*/
+    u8bit  shift;                       /*0..30*/
+    s32bit outMin;
+    s32bit outMax;
+} Pid_Q31ParamType;
+
+typedef struct
+{
+    Pid_Q31ParamType param;
+    s32bit           integ;             /*Integral term before the output shift*/
+    s32bit           dFilt;
+    s32bit           prevMeas;
+} Pid_Q31Type;
+
+/*Q15 controller parameters. Gains and alpha in Q15, the effective gain is k * 2^shift*/
+typedef struct
+{
+    s16bit kp;
+    s16bit ki;
+    s16bit kd;
+    s16bit alpha;                       /*1..32767, 32767 = no filtering*/
+    u8bit  shift;                       /*0..15*/
+    s16bit outMin;
+    s16bit outMax;
+} Pid_Q15ParamType;
+
+/*Q15 loops as structure of arrays, declare with PID_Q15_BATCH_DEFINE*/
+typedef struct
+{
+    u32bit   count;
+    u32bit * gainPD;                    /*kp low half, kd high half*/
+    u32bit * filter;                    /*alpha low half, 32767 - alpha high half*/
+    s16bit * ki;
+    u8bit *  shift;
+    s32bit * integMin;                  /*Integrator limits, Q30 before the output shift*/
+    s32bit * integMax;
+    s16bit * outMin;
+    s16bit * outMax;
+    s32bit * integ;
+    s16bit * dFilt;
+    s16bit * prevMeas;
+} Pid_Q15BatchType;
+
+/*Static batch of loops Q15 controllers*/
+#define PID_Q15_BATCH_DEFINE(name, loops)                                                           \
+    static u32bit name##_GainPD[(loops)];                                                           \
+    static u32bit name##_Filter[(loops)];                                                           \
+    static s16bit name##_Ki[(loops)];                                                               \
+    static u8bit  name##_Shift[(loops)];                                                            \
+    static s32bit name##_IntegMin[(loops)];                                                         \
+    static s32bit name##_IntegMax[(loops)];                                                         \
+    static s16bit name##_OutMin[(loops)];                                                           \
+    static s16bit name##_OutMax[(loops)];                                                           \
+    static s32bit name##_Integ[(loops)];                                                            \
+    static s16bit name##_DFilt[(loops)];                                                            \
+    static s16bit name##_PrevMeas[(loops)];                                                         \
+    static Pid_Q15BatchType name = { (loops), name##_GainPD, name##_Filter, name##_Ki, name##_Shift,  \
+                                     name##_IntegMin, name##_IntegMax, name##_OutMin, name##_OutMax, \
+                                     name##_Integ, name##_DFilt, name##_PrevMeas }
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Float controller*/
+extern void  Pid_FloatInit(Pid_FloatType * pid, const Pid_FloatParamType * param, float measurement);
+extern float Pid_FloatUpdate(Pid_FloatType * pid, float setpoint, float measurement);
+
+/*Q31 controller*/
+extern void   Pid_Q31Init(Pid_Q31Type * pid, const Pid_Q31ParamType * param, s32bit measurement);
+extern s32bit Pid_Q31Update(Pid_Q31Type * pid, s32bit setpoint, s32bit measurement);
+
+/*Configure loop of batch and clear its state*/
+extern void Pid_Q15Init(Pid_Q15BatchType * batch, u32bit loop, const Pid_Q15ParamType * param, s16bit measurement);
+
+/*Update every loop of batch, setpoint/measurement/output hold batch->count values*/
+extern void Pid_Q15Update(Pid_Q15BatchType * batch, const s16bit * setpoint, const s16bit * measurement,
+                          s16bit * output);
+
+#endif /* PID_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-008   | 17-Oct-2026 | First version of Pid.h                                                       |
+***********************************************************************************************************************/
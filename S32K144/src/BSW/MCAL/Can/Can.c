@@ -0,0 +1,179 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Can.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Can.c
+    FlexCAN driver. The legacy Rx FIFO (6 frames) holds what arrives between two Can_MainFunction calls,
+    8 filters at MB6-7 accept the configured identifiers. Transmit mailboxes are filled in ascending order
+    and sent lowest first (CTRL1 LBUF), a new batch starts once every written mailbox has been sent, so
+    frames of one identifier never overtake each other.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Can.h"
+#include "Can_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define CAN_FRAME_BYTES               (8u)
+#define CAN_RX_IDS                    (sizeof(Can_RxIds) / sizeof(Can_RxIds[0]))
+
+/*IFLAG1 bits of the transmit mailboxes written so far in the batch*/
+#define CAN_TX_FLAGS(count)           ((((u32bit)1u << (count)) - 1u) << CAN_CFG_TX_FIRST_MB)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+u32bit Can_RxOverflows = 0u;
+
+static const u32bit Can_RxIds[] = { CAN_CFG_RX_IDS };
+
+/*Transmit mailboxes written in the current batch*/
+static u32bit Can_TxCount;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * First word of a message buffer.
+ */
+static inline volatile u32bit * Can_Mb(u32bit mb)
+{
+    return &CAN0->RAMn[mb * CAN_MB_WORDS];
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Can_Init(void)
+{
+    volatile u32bit * mb;
+    u32bit i;
+
+    PCC->PCCn[PCC_PORTE_INDEX] |= PCC_PCCn_CGC_MASK;
+    PORTE->PCR[CAN_CFG_RX_PIN] = PORT_PCR_MUX(CAN_CFG_PIN_MUX);
+    PORTE->PCR[CAN_CFG_TX_PIN] = PORT_PCR_MUX(CAN_CFG_PIN_MUX);
+    PCC->PCCn[PCC_FlexCAN0_INDEX] |= PCC_PCCn_CGC_MASK;
+
+    /* Clock source only while disabled, enabling enters freeze mode (FRZ and HALT out of reset) */
+    CAN_CFG_MCR_WRITE(CAN0->MCR | CAN_MCR_MDIS_MASK);
+    CAN0->CTRL1 = CAN_CTRL1_CLKSRC_MASK;
+    CAN_CFG_MCR_WRITE(CAN0->MCR & ~CAN_MCR_MDIS_MASK);
+    while ((CAN0->MCR & CAN_MCR_FRZACK_MASK) == 0u)
+    {
+    }
+
+    CAN0->CTRL1 = CAN_CFG_CTRL1_TIMING | CAN_CTRL1_CLKSRC_MASK | CAN_CTRL1_LBUF_MASK;
+    for (i = 0u; i < (sizeof(CAN0->RAMn) / sizeof(CAN0->RAMn[0])); i++)
+    {
+        CAN0->RAMn[i] = 0u;
+    }
+    for (i = 0u; i < CAN_FIFO_FILTERS; i++)
+    {
+        /* Unused filters repeat the last identifier */
+        CAN0->RAMn[CAN_FIFO_FILTER_WORD + i] =
+            CAN_FIFO_FILTER_STD(Can_RxIds[(i < CAN_RX_IDS) ? i : (CAN_RX_IDS - 1u)]);
+    }
+    CAN0->RXFGMASK = CAN_FIFO_FILTER_STD_MASK;
+    for (i = 0u; i < CAN_CFG_TX_MBS; i++)
+    {
+        mb = Can_Mb(CAN_CFG_TX_FIRST_MB + i);
+        mb[0] = CAN_CS_CODE(CAN_CODE_TX_INACTIVE);
+    }
+    CAN_CFG_CLEAR_FLAGS(0xFFFFFFFFu);
+    Can_TxCount = 0u;
+
+    CAN_CFG_MCR_WRITE(CAN_MCR_RFEN_MASK | CAN_MCR_SRXDIS_MASK |
+                      CAN_MCR_MAXMB(CAN_CFG_TX_FIRST_MB + CAN_CFG_TX_MBS - 1u));
+    while ((CAN0->MCR & (CAN_MCR_FRZACK_MASK | CAN_MCR_NOTRDY_MASK)) != 0u)
+    {
+    }
+}
+
+boolean Can_Write(u32bit id, const u8bit * data)
+{
+    volatile u32bit * mb;
+    u32bit word0;
+    u32bit word1;
+    boolean written = FALSE;
+
+    /* Restart at the first mailbox once the whole batch is on the bus */
+    if ((Can_TxCount != 0u) && ((CAN0->IFLAG1 & CAN_TX_FLAGS(Can_TxCount)) == CAN_TX_FLAGS(Can_TxCount)))
+    {
+        CAN_CFG_CLEAR_FLAGS(CAN_TX_FLAGS(Can_TxCount));
+        Can_TxCount = 0u;
+    }
+    if (Can_TxCount < CAN_CFG_TX_MBS)
+    {
+        word0 = ((u32bit)data[0] << 24) | ((u32bit)data[1] << 16) | ((u32bit)data[2] << 8) | data[3];
+        word1 = ((u32bit)data[4] << 24) | ((u32bit)data[5] << 16) | ((u32bit)data[6] << 8) | data[7];
+        mb = Can_Mb(CAN_CFG_TX_FIRST_MB + Can_TxCount);
+        mb[1] = CAN_ID_STD(id);
+        mb[2] = word0;
+        mb[3] = word1;
+        mb[0] = CAN_CS_CODE(CAN_CODE_TX_DATA) | CAN_CS_DLC_SET(CAN_FRAME_BYTES);
+        Can_TxCount++;
+        written = TRUE;
+    }
+    return written;
+}
+
+/*
+ * At most one FIFO depth per call, the indication is given once the FIFO entry is released.
+ */
+void Can_MainFunction(void)
+{
+    const volatile u32bit * mb = Can_Mb(0u);
+    u8bit data[CAN_FRAME_BYTES];
+    u32bit id;
+    u32bit dlc;
+    u32bit word;
+    u32bit frames;
+    u32bit i;
+
+    if ((CAN0->IFLAG1 & CAN_IFLAG1_BUF7I_MASK) != 0u)
+    {
+        Can_RxOverflows++;
+        CAN_CFG_CLEAR_FLAGS(CAN_IFLAG1_BUF7I_MASK | CAN_IFLAG1_BUF6I_MASK);
+    }
+    for (frames = 0u; (frames < CAN_FIFO_DEPTH) && ((CAN0->IFLAG1 & CAN_IFLAG1_BUF5I_MASK) != 0u); frames++)
+    {
+        dlc = CAN_CS_DLC(mb[0]);
+        dlc = (dlc > CAN_FRAME_BYTES) ? CAN_FRAME_BYTES : dlc;
+        id = CAN_ID_STD_GET(mb[1]);
+        for (i = 0u; i < CAN_FRAME_BYTES; i++)
+        {
+            word = mb[2u + (i >> 2)];
+            data[i] = (u8bit)(word >> (24u - ((i & 3u) * 8u)));
+        }
+        CAN_CFG_CLEAR_FLAGS(CAN_IFLAG1_BUF5I_MASK);
+        CAN_CFG_RX_INDICATION(id, data, (u8bit)dlc);
+    }
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Can.c                                                       |
+***********************************************************************************************************************/
@@ -0,0 +1,57 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Can.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Can.h
+    FlexCAN driver, CAN0 at 500 kbit/s with standard identifiers, polled. Received frames pass the Rx
+    FIFO filters (CAN_CFG_RX_IDS) and go to CAN_CFG_RX_INDICATION from Can_MainFunction, frames are sent
+    from a batch of transmit mailboxes in the order they were written.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CAN_H_
+#define CAN_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+/*Frames lost because the Rx FIFO was full between two Can_MainFunction calls (counted once per overflow)*/
+extern u32bit Can_RxOverflows;
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Clock, pins, bit timing, Rx FIFO filters and transmit mailboxes, then join the bus*/
+extern void Can_Init(void);
+
+/*Queue an 8 byte frame with a standard identifier, FALSE when no transmit mailbox is free.
+  Not reentrant, CanTp calls it under its lock*/
+extern boolean Can_Write(u32bit id, const u8bit * data);
+
+/*Frames of the Rx FIFO to CAN_CFG_RX_INDICATION, at least every millisecond at full bus load*/
+extern void Can_MainFunction(void);
+
+#endif /* CAN_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Can.h                                                       |
+***********************************************************************************************************************/
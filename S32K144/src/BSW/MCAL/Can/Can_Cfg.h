@@ -0,0 +1,76 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Can_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Can_Cfg.h
+    Configuration of the FlexCAN driver.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CAN_CFG_H_
+#define CAN_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "S32K144.h"
+#include "CanTp.h"
+#if defined (HOST_BUILD)
+#include "Can_Host.h"
+#endif
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Bit timing from SYS_CLK (48 MHz FIRC): PRESDIV 5 (8 MHz quanta), PROPSEG 7, PSEG1 4, PSEG2 4, RJW 4 time
+  quanta, 16 per bit = 500 kbit/s sampled at 75 %*/
+#define CAN_CFG_CTRL1_TIMING          (0x05DB0006uL)
+
+/*CAN0 pins of the S32K144 EVB, PTE4 RX and PTE5 TX, ALT5*/
+#define CAN_CFG_RX_PIN                (4u)
+#define CAN_CFG_TX_PIN                (5u)
+#define CAN_CFG_PIN_MUX               (5u)
+
+/*Transmit mailboxes, after the Rx FIFO and its filters (MB0-7)*/
+#define CAN_CFG_TX_FIRST_MB           (8u)
+#define CAN_CFG_TX_MBS                (8u)
+
+/*Standard identifiers received, the rx identifiers of the CanTp channels, up to CAN_FIFO_FILTERS*/
+#define CAN_CFG_RX_ID(name, rxId, txId, bs, stMin, rxIndication, txConfirmation)  (rxId),
+#define CAN_CFG_RX_IDS                CANTP_CFG_CHANNELS(CAN_CFG_RX_ID)
+
+/*Received frame*/
+#define CAN_CFG_RX_INDICATION(id, data, dlc)  CanTp_RxIndication((id), (data), (dlc))
+
+/*MCR writes and flag clearing (write 1 to clear). Host builds acknowledge the modes on the register stub*/
+#if defined (HOST_BUILD)
+#define CAN_CFG_MCR_WRITE(value)      Can_HostMcrWrite(value)
+#define CAN_CFG_CLEAR_FLAGS(mask)     (CAN0->IFLAG1 &= ~(u32bit)(mask))
+#else
+#define CAN_CFG_MCR_WRITE(value)      (CAN0->MCR = (value))
+#define CAN_CFG_CLEAR_FLAGS(mask)     (CAN0->IFLAG1 = (mask))
+#endif
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* CAN_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Can_Cfg.h                                                   |
+***********************************************************************************************************************/
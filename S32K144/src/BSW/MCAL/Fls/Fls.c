@@ -0,0 +1,138 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Fls.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Fls.c
+    P-Flash driver, FTFC command sequences. Runs from .code_ram.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Fls.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define FLS_ERRORS                    (FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK | FTFC_FSTAT_MGSTAT0_MASK)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+START_FUNCTION_DECLARATION_RAMSECTION
+static boolean Fls_Launch(u8bit command, u32bit address, const u8bit * data)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * FCCOB0 command, FCCOB1-3 address, FCCOB4-B data (programming only).
+ */
+START_FUNCTION_DEFINITION_RAMSECTION
+static boolean Fls_Launch(u8bit command, u32bit address, const u8bit * data)
+{
+    u32bit i;
+    boolean launched = FALSE;
+
+    if ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) != 0u)
+    {
+        FLS_CFG_CLEAR_ERRORS();
+        FTFC->FCCOB[FTFC_FCCOB_INDEX(0u)] = command;
+        FTFC->FCCOB[FTFC_FCCOB_INDEX(1u)] = (u8bit)(address >> 16);
+        FTFC->FCCOB[FTFC_FCCOB_INDEX(2u)] = (u8bit)(address >> 8);
+        FTFC->FCCOB[FTFC_FCCOB_INDEX(3u)] = (u8bit)address;
+        if (data != NULL)
+        {
+            for (i = 0u; i < FLS_PHRASE_SIZE; i++)
+            {
+                FTFC->FCCOB[FTFC_FCCOB_INDEX(4u + i)] = data[i];
+            }
+        }
+        FLS_CFG_LAUNCH();
+        launched = TRUE;
+    }
+    return launched;
+}
+END_FUNCTION_DEFINITION_RAMSECTION
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+START_FUNCTION_DEFINITION_RAMSECTION
+void Fls_Init(void)
+{
+    FLS_CFG_CLEAR_ERRORS();
+}
+END_FUNCTION_DEFINITION_RAMSECTION
+
+START_FUNCTION_DEFINITION_RAMSECTION
+boolean Fls_Erase(u32bit address)
+{
+    boolean launched = FALSE;
+
+    if (((address & (FLS_SECTOR_SIZE - 1u)) == 0u) && (address < FEATURE_FLS_PF_SIZE))
+    {
+        launched = Fls_Launch(FTFC_CMD_ERASE_SECTOR, address, NULL);
+    }
+    return launched;
+}
+END_FUNCTION_DEFINITION_RAMSECTION
+
+START_FUNCTION_DEFINITION_RAMSECTION
+boolean Fls_Write(u32bit address, const u8bit * data)
+{
+    boolean launched = FALSE;
+
+    if (((address & (FLS_PHRASE_SIZE - 1u)) == 0u) && (address < FEATURE_FLS_PF_SIZE))
+    {
+        launched = Fls_Launch(FTFC_CMD_PROGRAM_PHRASE, address, data);
+    }
+    return launched;
+}
+END_FUNCTION_DEFINITION_RAMSECTION
+
+START_FUNCTION_DEFINITION_RAMSECTION
+u8bit Fls_GetStatus(void)
+{
+    u8bit fstat = FTFC->FSTAT;
+    u8bit status = FLS_IDLE;
+
+    if ((fstat & FTFC_FSTAT_CCIF_MASK) == 0u)
+    {
+        status = FLS_BUSY;
+    }
+    else if ((fstat & FLS_ERRORS) != 0u)
+    {
+        status = FLS_FAILED;
+    }
+    else
+    {
+    }
+    return status;
+}
+END_FUNCTION_DEFINITION_RAMSECTION
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Fls.c                                                       |
+***********************************************************************************************************************/
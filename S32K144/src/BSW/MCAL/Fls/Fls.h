@@ -0,0 +1,85 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Fls.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Fls.h
+    P-Flash driver. Erase sector and program phrase commands are launched and polled, never waited for,
+    so the caller keeps running while the FTFC works. Reading the P-Flash during a command is a read
+    collision: the driver is placed in .code_ram and its callers must run from RAM as well (see the
+    bootloader build, settings/bootloader).
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef FLS_H_
+#define FLS_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Core_CM4.h"
+#include "Fls_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Fls_GetStatus*/
+#define FLS_IDLE                      (0u)            /*Last command done*/
+#define FLS_BUSY                      (1u)
+#define FLS_FAILED                    (2u)            /*Last command rejected or verify failed*/
+
+#define FLS_SECTOR_SIZE               FEATURE_FLS_PF_SECTOR_SIZE
+#define FLS_PHRASE_SIZE               FEATURE_FLS_PF_WRITE_UNIT_SIZE
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+START_FUNCTION_DECLARATION_RAMSECTION
+extern void Fls_Init(void)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+/*Launch the erase of the sector at address, FALSE when a command is running or address is not a sector*/
+START_FUNCTION_DECLARATION_RAMSECTION
+extern boolean Fls_Erase(u32bit address)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+/*Launch the programming of the FLS_PHRASE_SIZE bytes of data at address (phrase aligned), data is
+  copied to the FTFC before return. FALSE when a command is running or address is invalid*/
+START_FUNCTION_DECLARATION_RAMSECTION
+extern boolean Fls_Write(u32bit address, const u8bit * data)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+START_FUNCTION_DECLARATION_RAMSECTION
+extern u8bit Fls_GetStatus(void)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * P-Flash contents at address, not while a command is running.
+ */
+static inline const u8bit * Fls_Memory(u32bit address)
+{
+    return FLS_CFG_MEMORY(address);
+}
+
+#endif /* FLS_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Fls.h                                                       |
+***********************************************************************************************************************/
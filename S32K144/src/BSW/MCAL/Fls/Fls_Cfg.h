@@ -0,0 +1,62 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Fls_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Fls_Cfg.h
+    Configuration of the P-Flash driver.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef FLS_CFG_H_
+#define FLS_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "S32K144.h"
+#if defined (HOST_BUILD)
+#include "Ftfc_Host.h"
+#endif
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Command launch and error flag clearing (write 1 to clear). Host builds run the FTFC simulation*/
+#if defined (HOST_BUILD)
+#define FLS_CFG_LAUNCH()              Ftfc_HostLaunch()
+#define FLS_CFG_CLEAR_ERRORS()        (FTFC->FSTAT &= (u8bit)~(FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK))
+#else
+#define FLS_CFG_LAUNCH()              (FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK)
+#define FLS_CFG_CLEAR_ERRORS()        (FTFC->FSTAT = FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK)
+#endif
+
+/*Readable P-Flash contents at address*/
+#if defined (HOST_BUILD)
+#define FLS_CFG_MEMORY(address)       ((const u8bit *)&Ftfc_HostMemory()[(address)])
+#else
+#define FLS_CFG_MEMORY(address)       ((const u8bit *)(uaddr)(address))
+#endif
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* FLS_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Fls_Cfg.h                                                   |
+***********************************************************************************************************************/
@@ -0,0 +1,339 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Irq.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Irq.c
+    Interrupt manager. Irq_Init takes over the PendSV entry of the RAM vector table: Irq_PendSV runs the
+    queued bottom halves and then continues into the previous PendSV handler, so with the Os linked the
+    bottom halves run at kernel priority right before the context switch and a task they make ready is
+    switched to on the same exception.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Irq.h"
+#include "Queue.h"
+#include "Trace.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Core exceptions ahead of the device interrupts in the vector table*/
+#define IRQ_CORE_VECTORS            (16u)
+#define IRQ_VECTORS                 (IRQ_CORE_VECTORS + FEATURE_INTERRUPT_IRQ_COUNT)
+
+/*Priorities live in the upper bits of every priority byte*/
+#define IRQ_PRIO_SHIFT              (8u - FEATURE_NVIC_PRIO_BITS)
+
+/*Vector table index of a device interrupt or core exception*/
+#define IRQ_VECTOR(irq)             ((u32bit)((s32bit)IRQ_CORE_VECTORS + (irq)))
+
+/*Queued bottom half*/
+typedef struct
+{
+    Irq_BottomHalfType bottomHalf;
+    u32bit             data;
+} Irq_DeferredType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+volatile u32bit Irq_DeferLost;
+
+/*Handler PendSV continues into after the bottom halves, read by Irq_PendSV*/
+Irq_HandlerType Irq_PendSVNext;
+
+/*RAM vector table, NULL while the vectors are still fetched from flash*/
+static Irq_HandlerType * Irq_Vectors;
+
+#if defined (HOST_BUILD)
+static Irq_HandlerType Irq_HostVectors[IRQ_VECTORS];
+#endif
+
+QUEUE_MPSC_DEFINE(Irq_BhQueue, Irq_DeferredType, IRQ_CFG_BH_QUEUE_SIZE);
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void Irq_PendSV(void);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Complete the last vector table or NVIC write before the next instruction.
+ */
+static inline void Irq_Sync(void)
+{
+#if !defined (HOST_BUILD)
+    __asm volatile ("dsb \n\t"
+                    "isb \n\t" : : : "memory");
+#endif
+}
+
+/*
+ * TRUE for device interrupts, the ones controlled through the NVIC.
+ */
+static inline boolean Irq_IsDevice(Irq_NumberType irq)
+{
+    return ((irq >= 0) && (irq < (Irq_NumberType)FEATURE_INTERRUPT_IRQ_COUNT)) ? TRUE : FALSE;
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+#if !defined (HOST_BUILD)
+/*
+ * PendSV entry: bottom halves, then the previous PendSV handler with the original EXC_RETURN in lr.
+ */
+__attribute__((naked)) static void Irq_PendSV(void)
+{
+    __asm volatile (
+        "    push     {r0, lr}               \n\t"   /* r0 keeps MSP 8 byte aligned */
+        "    bl       Irq_RunBottomHalves    \n\t"
+        "    pop      {r0, lr}               \n\t"
+#if (IRQ_CFG_PENDSV_CHAIN == 1u)
+        "    ldr      r0, =Irq_PendSVNext    \n\t"
+        "    ldr      r0, [r0]               \n\t"
+        "    bx       r0                     \n\t"
+#else
+        "    bx       lr                     \n\t"
+#endif
+        "    .ltorg                          \n\t"
+    );
+}
+#else
+/*
+ * Host: same sequence, taken through Irq_HostTake when the Os host port finds PendSV pending.
+ */
+static void Irq_PendSV(void)
+{
+    Irq_RunBottomHalves();
+#if (IRQ_CFG_PENDSV_CHAIN == 1u)
+    if (Irq_PendSVNext != NULL)
+    {
+        Irq_PendSVNext();
+    }
+#endif
+}
+#endif /* !HOST_BUILD */
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+/*
+ * Priority grouping from the configuration, RAM vector table lookup and PendSV hook. FALSE when the
+ * vectors are fetched from flash (__flash_vector_table__), handlers can not be installed then.
+ */
+boolean Irq_Init(void)
+{
+#if !defined (HOST_BUILD)
+    /* Addresses for VECTOR_RAM come from the linker file */
+    extern u32bit __VECTOR_RAM[];
+    extern u32bit __RAM_VECTOR_TABLE_SIZE[];
+#endif
+    boolean ramTable = FALSE;
+
+    Irq_SetPriorityGrouping(IRQ_CFG_PRIORITY_GROUPING);
+
+#if defined (HOST_BUILD)
+    Irq_Vectors = Irq_HostVectors;
+#else
+    if (((uaddr)__RAM_VECTOR_TABLE_SIZE >= (IRQ_VECTORS * sizeof(Irq_HandlerType))) &&
+        (S32_SCB->VTOR == (u32bit)__VECTOR_RAM))
+    {
+        Irq_Vectors = (Irq_HandlerType *)__VECTOR_RAM;
+    }
+#endif
+
+    if (Irq_Vectors != NULL)
+    {
+        if (Irq_Vectors[IRQ_VECTOR(IRQ_PENDSV)] != Irq_PendSV)
+        {
+            Irq_PendSVNext = Irq_Vectors[IRQ_VECTOR(IRQ_PENDSV)];
+            Irq_Vectors[IRQ_VECTOR(IRQ_PENDSV)] = Irq_PendSV;
+            Irq_Sync();
+        }
+        ramTable = TRUE;
+    }
+    return ramTable;
+}
+
+/*
+ * Point the vector of irq to handler. PendSV stays on Irq_PendSV, handler becomes the one it continues
+ * into. FALSE without RAM vector table or for NMI and HardFault.
+ */
+boolean Irq_InstallHandler(Irq_NumberType irq, Irq_HandlerType handler)
+{
+    boolean installed = FALSE;
+
+    if ((Irq_Vectors != NULL) && (irq >= IRQ_MEMMANAGE) && (irq < (Irq_NumberType)FEATURE_INTERRUPT_IRQ_COUNT))
+    {
+        if (irq == IRQ_PENDSV)
+        {
+            Irq_PendSVNext = handler;
+        }
+        else
+        {
+            Irq_Vectors[IRQ_VECTOR(irq)] = handler;
+        }
+        Irq_Sync();
+        installed = TRUE;
+    }
+    return installed;
+}
+
+/*
+ * AIRCR PRIGROUP: priority bits above bit group preempt, the rest only order pending interrupts.
+ */
+void Irq_SetPriorityGrouping(u32bit group)
+{
+    u32bit aircr = S32_SCB->AIRCR & ~(S32_SCB_AIRCR_VECTKEY_MASK | S32_SCB_AIRCR_PRIGROUP_MASK);
+
+    S32_SCB->AIRCR = S32_SCB_AIRCR_VECTKEY | aircr |
+                     ((group << S32_SCB_AIRCR_PRIGROUP_SHIFT) & S32_SCB_AIRCR_PRIGROUP_MASK);
+}
+
+/*
+ * Priority 0 (highest) to IRQ_PRIORITY_LOWEST of a device interrupt (NVIC IP) or of a configurable core
+ * exception (SHPR1-3). FALSE for NMI, HardFault and out of range numbers or priorities.
+ */
+boolean Irq_SetPriority(Irq_NumberType irq, u8bit priority)
+{
+    boolean valid = FALSE;
+
+    if (priority <= IRQ_PRIORITY_LOWEST)
+    {
+        if (Irq_IsDevice(irq) == TRUE)
+        {
+            S32_NVIC->IP[irq] = (u8bit)(priority << IRQ_PRIO_SHIFT);
+            valid = TRUE;
+        }
+        else if ((irq >= IRQ_MEMMANAGE) && (irq < 0))
+        {
+            /* SHPR1-3 hold one byte per exception, starting with MemManage (exception 4) */
+            ((volatile u8bit *)&S32_SCB->SHPR1)[IRQ_VECTOR(irq) - 4u] = (u8bit)(priority << IRQ_PRIO_SHIFT);
+            valid = TRUE;
+        }
+        else
+        {
+        }
+    }
+    return valid;
+}
+
+void Irq_Enable(Irq_NumberType irq)
+{
+    if (Irq_IsDevice(irq) == TRUE)
+    {
+        S32_NVIC->ISER[(u32bit)irq >> 5] = 1uL << ((u32bit)irq & 31u);
+    }
+}
+
+/*
+ * The interrupt can not be taken any more once this returns.
+ */
+void Irq_Disable(Irq_NumberType irq)
+{
+    if (Irq_IsDevice(irq) == TRUE)
+    {
+        S32_NVIC->ICER[(u32bit)irq >> 5] = 1uL << ((u32bit)irq & 31u);
+        Irq_Sync();
+    }
+}
+
+void Irq_ClearPending(Irq_NumberType irq)
+{
+    if (Irq_IsDevice(irq) == TRUE)
+    {
+        S32_NVIC->ICPR[(u32bit)irq >> 5] = 1uL << ((u32bit)irq & 31u);
+    }
+}
+
+/*
+ * Queue bottomHalf(data) and pend PendSV. Any context, any priority. FALSE when the queue is full.
+ */
+boolean Irq_Defer(Irq_BottomHalfType bottomHalf, u32bit data)
+{
+    Irq_DeferredType entry;
+    boolean queued = FALSE;
+
+    entry.bottomHalf = bottomHalf;
+    entry.data = data;
+    if (Queue_MpscPush(&Irq_BhQueue, &entry) == TRUE)
+    {
+        S32_SCB->ICSR = S32_SCB_ICSR_PENDSVSET_MASK;
+        queued = TRUE;
+    }
+    else
+    {
+        (void)Core_AtomicAdd(&Irq_DeferLost, 1u);
+    }
+    return queued;
+}
+
+#if defined (HOST_BUILD)
+/*
+ * Host: take irq like the core would, through its vector. A pending PendSV is cleared first. Nothing runs
+ * before Irq_Init or without an installed handler.
+ */
+void Irq_HostTake(Irq_NumberType irq)
+{
+    Irq_HandlerType handler = NULL;
+
+    if ((Irq_Vectors != NULL) && (irq >= IRQ_MEMMANAGE) && (irq < (Irq_NumberType)FEATURE_INTERRUPT_IRQ_COUNT))
+    {
+        handler = Irq_Vectors[IRQ_VECTOR(irq)];
+    }
+    if (irq == IRQ_PENDSV)
+    {
+        S32_SCB->ICSR &= ~S32_SCB_ICSR_PENDSVSET_MASK;
+    }
+    if (handler != NULL)
+    {
+        handler();
+    }
+}
+#endif
+
+/*
+ * Run the queued bottom halves in order, single consumer: PendSV, or the application on host builds.
+ * At most one queue worth per call, bottom halves that keep deferring leave the rest for the next PendSV.
+ */
+void Irq_RunBottomHalves(void)
+{
+    Irq_DeferredType entry;
+    u32bit run = 0u;
+
+    TRACE_ISR_ENTER(TRACE_EXC_PENDSV);
+    while ((run < IRQ_CFG_BH_QUEUE_SIZE) && (Queue_MpscPop(&Irq_BhQueue, &entry) == TRUE))
+    {
+        entry.bottomHalf(entry.data);
+        run++;
+    }
+    if (run == IRQ_CFG_BH_QUEUE_SIZE)
+    {
+        S32_SCB->ICSR = S32_SCB_ICSR_PENDSVSET_MASK;
+    }
+    TRACE_ISR_EXIT(TRACE_EXC_PENDSV);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-014   | 17-Oct-2026 | First version of Irq.c                                                       |
+ *| CMARTI  |  user-025   | 17-Oct-2026 | Trace points around the bottom halves                                        |
+ *| CMARTI  |  user-014   | 17-Oct-2026 | Add Irq_HostTake, PendSV of the host build                                   |
+***********************************************************************************************************************/
@@ -0,0 +1,91 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Irq.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Irq.h
+    Interrupt manager over the RAM copy of the vector table: handlers installed at runtime, NVIC and
+    system handler priorities, priority grouping and deferred interrupt processing.
+    A handler is split in a top half, installed in the vector table, which only acknowledges the
+    peripheral and captures its status, and a bottom half queued with Irq_Defer. Bottom halves run in
+    order from PendSV, at the lowest priority, once every other interrupt has returned:
+
+        static void Can_RxBottomHalf(u32bit status) { ...process the frames... }
+        void Can_RxTopHalf(void)       { u32bit status = CAN0->IFLAG1; CAN0->IFLAG1 = status;
+                                         (void)Irq_Defer(Can_RxBottomHalf, status); }
+
+        (void)Irq_InstallHandler(81, Can_RxTopHalf);           CAN0 message buffers 0-15
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef IRQ_H_
+#define IRQ_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "S32K144.h"
+#include "Irq_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Device interrupts are 0 to FEATURE_INTERRUPT_IRQ_COUNT - 1, core exceptions are negative*/
+typedef s16bit Irq_NumberType;
+
+#define IRQ_MEMMANAGE                 ((Irq_NumberType)-12)
+#define IRQ_BUSFAULT                  ((Irq_NumberType)-11)
+#define IRQ_USAGEFAULT                ((Irq_NumberType)-10)
+#define IRQ_SVCALL                    ((Irq_NumberType)-5)
+#define IRQ_DEBUGMON                  ((Irq_NumberType)-4)
+#define IRQ_PENDSV                    ((Irq_NumberType)-2)
+#define IRQ_SYSTICK                   ((Irq_NumberType)-1)
+
+/*Priority 0 is the highest, FEATURE_NVIC_PRIO_BITS are implemented*/
+#define IRQ_PRIORITY_LOWEST           ((u8bit)((1u << FEATURE_NVIC_PRIO_BITS) - 1u))
+
+/*Vector table entry*/
+typedef void (*Irq_HandlerType)(void);
+
+/*Deferred part of a handler, data is what the top half passed to Irq_Defer*/
+typedef void (*Irq_BottomHalfType)(u32bit data);
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+/*Bottom halves dropped because the queue was full*/
+extern volatile u32bit Irq_DeferLost;
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+boolean Irq_Init(void);
+boolean Irq_InstallHandler(Irq_NumberType irq, Irq_HandlerType handler);
+void    Irq_SetPriorityGrouping(u32bit group);
+boolean Irq_SetPriority(Irq_NumberType irq, u8bit priority);
+void    Irq_Enable(Irq_NumberType irq);
+void    Irq_Disable(Irq_NumberType irq);
+void    Irq_ClearPending(Irq_NumberType irq);
+boolean Irq_Defer(Irq_BottomHalfType bottomHalf, u32bit data);
+void    Irq_RunBottomHalves(void);
+#if defined (HOST_BUILD)
+/*Run the handler of irq as if taken, the Os host port takes a pending PendSV with it*/
+void    Irq_HostTake(Irq_NumberType irq);
+#endif
+
+#endif /* IRQ_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-014   | 17-Oct-2026 | First version of Irq.h                                                       |
+ *| CMARTI  |  user-014   | 17-Oct-2026 | Add Irq_HostTake                                                             |
+***********************************************************************************************************************/
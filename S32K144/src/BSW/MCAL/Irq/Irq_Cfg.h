@@ -0,0 +1,53 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Irq_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Irq_Cfg.h
+    Configuration of the interrupt manager.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef IRQ_CFG_H_
+#define IRQ_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Bottom halves waiting at once, power of two. Irq_Defer fails and counts Irq_DeferLost when full*/
+#define IRQ_CFG_BH_QUEUE_SIZE         (16u)
+
+/*AIRCR PRIGROUP set by Irq_Init. With 4 implemented bits, 3 = 16 preemption levels and no subpriority,
+  4 = 8 levels x 2 subpriorities, ... 7 = no preemption*/
+#define IRQ_CFG_PRIORITY_GROUPING     (3u)
+
+/*1: after the bottom halves PendSV continues into the handler found in the vector table by Irq_Init (the
+  Os context switch), 0: PendSV only runs the bottom halves*/
+#define IRQ_CFG_PENDSV_CHAIN          (1u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* IRQ_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-014   | 17-Oct-2026 | First version of Irq_Cfg.h                                                   |
+***********************************************************************************************************************/
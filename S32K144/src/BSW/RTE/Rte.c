@@ -0,0 +1,42 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                                OBJECT SPECIFICATION                                               */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Rte.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Rte.c
+    Connection buffers, generated by tools/RteGen/rte_gen.py from Rte_Cfg.json. Do not edit.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Rte.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+u16bit Rte_Buf_EngineSpeed = 0u;
+Rte_WheelSpeedType Rte_Buf_WheelSpeed[2u] = { {0}, {0} };
+volatile u32bit Rte_Seq_WheelSpeed = 0u;
+u16bit Rte_Buf_MotorDuty = 0u;
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-007   | 17-Oct-2026 | Generated Rte.c                                                              |
+***********************************************************************************************************************/
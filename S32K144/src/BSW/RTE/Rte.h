@@ -0,0 +1,109 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                                OBJECT SPECIFICATION                                               */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Rte.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Rte.h
+    Runtime environment, generated by tools/RteGen/rte_gen.py from Rte_Cfg.json. Do not edit.
+    Ports resolve at compile time to the connection buffers defined in Rte.c.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef RTE_H_
+#define RTE_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Core_CM4.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+typedef struct { u16bit frontLeft; u16bit frontRight; u16bit rearLeft; u16bit rearRight; } Rte_WheelSpeedType;
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+extern u16bit Rte_Buf_EngineSpeed;
+extern Rte_WheelSpeedType Rte_Buf_WheelSpeed[2u];
+extern volatile u32bit Rte_Seq_WheelSpeed;
+extern u16bit Rte_Buf_MotorDuty;
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*EngineSpeed: CanAdapter_PpEngineSpeed -> SpeedCtrl_RpEngineSpeed*/
+static inline void Rte_Write_CanAdapter_PpEngineSpeed(u16bit data)
+{
+    Rte_Buf_EngineSpeed = data;
+}
+
+static inline void Rte_Read_SpeedCtrl_RpEngineSpeed(u16bit * data)
+{
+    *data = Rte_Buf_EngineSpeed;
+}
+
+/*WheelSpeed: CanAdapter_PpWheelSpeed -> SpeedCtrl_RpWheelSpeed, Diag_RpWheelSpeed, double buffered*/
+static inline void Rte_Write_CanAdapter_PpWheelSpeed(const Rte_WheelSpeedType * data)
+{
+    u32bit seq = Rte_Seq_WheelSpeed;
+
+    Rte_Buf_WheelSpeed[(seq + 1u) & 1u] = *data;
+    Core_StoreRelease(&Rte_Seq_WheelSpeed, seq + 1u);
+}
+
+static inline void Rte_Read_SpeedCtrl_RpWheelSpeed(Rte_WheelSpeedType * data)
+{
+    u32bit seq;
+
+    do
+    {
+        seq = Core_LoadAcquire(&Rte_Seq_WheelSpeed);
+        *data = Rte_Buf_WheelSpeed[seq & 1u];
+        Core_ReadFence();
+    } while ((Rte_Seq_WheelSpeed - seq) > 1u);
+}
+
+static inline void Rte_Read_Diag_RpWheelSpeed(Rte_WheelSpeedType * data)
+{
+    u32bit seq;
+
+    do
+    {
+        seq = Core_LoadAcquire(&Rte_Seq_WheelSpeed);
+        *data = Rte_Buf_WheelSpeed[seq & 1u];
+        Core_ReadFence();
+    } while ((Rte_Seq_WheelSpeed - seq) > 1u);
+}
+
+/*MotorDuty: SpeedCtrl_PpMotorDuty -> PwmAdapter_RpMotorDuty*/
+static inline void Rte_Write_SpeedCtrl_PpMotorDuty(u16bit data)
+{
+    Rte_Buf_MotorDuty = data;
+}
+
+static inline void Rte_Read_PwmAdapter_RpMotorDuty(u16bit * data)
+{
+    *data = Rte_Buf_MotorDuty;
+}
+
+#endif /* RTE_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-007   | 17-Oct-2026 | Generated Rte.h                                                              |
+***********************************************************************************************************************/
@@ -0,0 +1,116 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: CallCount.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \CallCount.c
+    Function call counter. This file and Core_CM4.h must be left out of the instrumentation
+    (-finstrument-functions-exclude-file-list), otherwise the hook would count itself.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "CallCount.h"
+#include "Core_CM4.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define CALLCOUNT_MASK                      (CALLCOUNT_SLOTS - 1u)
+#define CALLCOUNT_HASH                      (2654435761uL)  /*Knuth multiplicative hash*/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+CallCount_EntryType CallCount_Table[CALLCOUNT_SLOTS];
+u32bit CallCount_Lost;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+void __cyg_profile_func_enter(void * function, void * site) NO_INSTRUMENT;
+void __cyg_profile_func_exit(void * function, void * site) NO_INSTRUMENT;
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+/*
+ * Called on entry of every instrumented function. Open addressing with linear probing: a free slot is
+ * claimed with a compare and swap on its address, the count of the owner is then incremented atomically.
+ * Slots are never released, so a function keeps the first slot it got.
+ */
+void __cyg_profile_func_enter(void * function, void * site)
+{
+    u32bit address = (u32bit)(uaddr)function;
+    u32bit slot = (((address * CALLCOUNT_HASH) & 0xFFFFFFFFuL) >> (32u - CALLCOUNT_CFG_SLOT_BITS));
+    u32bit probe;
+    u32bit owner;
+    boolean counted = FALSE;
+
+    (void)site;
+    for (probe = 0u; (probe < CALLCOUNT_SLOTS) && (counted == FALSE); probe++)
+    {
+        owner = CallCount_Table[slot].function;
+        if ((owner == 0u) && (Core_CompareAndSwap(&CallCount_Table[slot].function, 0u, address) == TRUE))
+        {
+            owner = address;
+        }
+        else
+        {
+            owner = CallCount_Table[slot].function;
+        }
+
+        if (owner == address)
+        {
+            (void)Core_AtomicAdd(&CallCount_Table[slot].count, 1u);
+            counted = TRUE;
+        }
+        slot = (slot + 1u) & CALLCOUNT_MASK;
+    }
+
+    if (counted == FALSE)
+    {
+        (void)Core_AtomicAdd(&CallCount_Lost, 1u);
+    }
+}
+
+void __cyg_profile_func_exit(void * function, void * site)
+{
+    (void)function;
+    (void)site;
+}
+
+void CallCount_Reset(void)
+{
+    u32bit slot;
+
+    for (slot = 0u; slot < CALLCOUNT_SLOTS; slot++)
+    {
+        CallCount_Table[slot].function = 0u;
+        CallCount_Table[slot].count = 0u;
+    }
+    CallCount_Lost = 0u;
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-011   | 17-Oct-2026 | First version of CallCount.c                                                 |
+***********************************************************************************************************************/
@@ -0,0 +1,62 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: CallCount.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \CallCount.h
+    Function call counter for profiling builds (make PROFILE_CALLS=1).
+    Every function compiled with -finstrument-functions counts its calls in CallCount_Table through the
+    __cyg_profile_func_enter hook. The table is lock-free, tasks and ISRs of any priority may count at the
+    same time. Read it with the debugger and feed it to tools/HotPlace, e.g. from GDB:
+        dump binary value calls.bin CallCount_Table
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CALLCOUNT_H_
+#define CALLCOUNT_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "CallCount_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define CALLCOUNT_SLOTS                     (1uL << CALLCOUNT_CFG_SLOT_BITS)
+
+typedef struct
+{
+    u32bit function;                    /*Entry address, 0 when the slot is free*/
+    u32bit count;
+} CallCount_EntryType;
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+extern CallCount_EntryType CallCount_Table[CALLCOUNT_SLOTS];
+
+/*Calls not counted because the table was full*/
+extern u32bit CallCount_Lost;
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Forget every count, calls made while clearing may be lost*/
+extern void CallCount_Reset(void);
+
+#endif /* CALLCOUNT_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-011   | 17-Oct-2026 | First version of CallCount.h                                                 |
+***********************************************************************************************************************/
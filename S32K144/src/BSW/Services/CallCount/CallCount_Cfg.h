@@ -0,0 +1,45 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: CallCount_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \CallCount_Cfg.h
+    Configuration of the function call counter.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CALLCOUNT_CFG_H_
+#define CALLCOUNT_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Table of 2^CALLCOUNT_CFG_SLOT_BITS entries, keep it well above the number of instrumented functions*/
+#define CALLCOUNT_CFG_SLOT_BITS             (8u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* CALLCOUNT_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-011   | 17-Oct-2026 | First version of CallCount_Cfg.h                                             |
+***********************************************************************************************************************/
@@ -0,0 +1,573 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: CanTp.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \CanTp.c
+    ISO-TP segmentation and reassembly. Single frames and first frames start a reception, consecutive
+    frames are checked against the sequence number and copied to their final place in the message block.
+    Flow control is answered after the first frame and after every block of BS consecutive frames.
+    The upper layer callbacks are decided under the lock and called once it is released, a transmit
+    confirmation is never given from inside CanTp_Transmit.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "CanTp.h"
+#include "MemPool.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Protocol control information, upper nibble of the first byte*/
+#define CANTP_PCI_SF                (0x00u)
+#define CANTP_PCI_FF                (0x10u)
+#define CANTP_PCI_CF                (0x20u)
+#define CANTP_PCI_FC                (0x30u)
+#define CANTP_PCI_MASK              (0xF0u)
+
+/*Flow status*/
+#define CANTP_FS_CTS                (0u)
+#define CANTP_FS_WAIT               (1u)
+#define CANTP_FS_OVFLW              (2u)
+
+#define CANTP_FRAME_BYTES           (8u)
+#define CANTP_SF_MAX                (7u)
+#define CANTP_FF_DATA               (6u)
+#define CANTP_CF_DATA               (7u)
+
+/*Timeout in CanTp_MainFunction calls*/
+#define CANTP_TIMEOUT_CALLS         (((CANTP_CFG_TIMEOUT_MS * 1000u) + CANTP_CFG_MAIN_PERIOD_US - 1u) / \
+                                     CANTP_CFG_MAIN_PERIOD_US)
+
+/*Channel states*/
+#define CANTP_IDLE                  (0u)
+#define CANTP_RX_CF                 (1u)            /*Reception, consecutive frames expected*/
+#define CANTP_TX_WAIT_FC            (2u)            /*Transmission, flow control expected*/
+#define CANTP_TX_CF                 (3u)            /*Transmission, sending consecutive frames*/
+#define CANTP_TX_DONE               (4u)            /*Transmission, single frame sent, not confirmed yet*/
+
+typedef struct
+{
+    u32bit                   rxId;
+    u32bit                   txId;
+    u8bit                    blockSize;
+    u8bit                    stMin;
+    CanTp_RxIndicationType   rxIndication;
+    CanTp_TxConfirmationType txConfirmation;
+} CanTp_ChannelCfgType;
+
+typedef struct
+{
+    /*Reception*/
+    u8bit *       rxBuffer;                         /*MemPool block of the message*/
+    u16bit        rxLength;
+    u16bit        rxOffset;
+    u16bit        rxTimer;
+    u8bit         rxState;
+    u8bit         rxSn;                             /*Next sequence number*/
+    u8bit         rxBlock;                          /*Consecutive frames left before the next flow control*/
+    /*Transmission*/
+    u8bit         txState;
+    const u8bit * txData;
+    u16bit        txLength;                         /*Head and data*/
+    u16bit        txOffset;
+    u16bit        txTimer;                          /*Timeout, or calls left before the next consecutive frame*/
+    u16bit        txStMin;                          /*Calls between consecutive frames*/
+    u8bit         txHead[CANTP_MAX_HEAD];
+    u8bit         txHeadLength;
+    u8bit         txSn;
+    u8bit         txBlock;                          /*Consecutive frames left before the next flow control, 0 = none*/
+} CanTp_ChannelStateType;
+
+/*Callbacks of one channel copied under the lock, called by CanTp_Notify after it*/
+typedef struct
+{
+    CanTp_RxIndicationType   rxIndication;          /*NULL = no message*/
+    u8bit *                  rxBuffer;
+    u16bit                   rxLength;
+    CanTp_TxConfirmationType txConfirmation;        /*NULL = no confirmation*/
+    boolean                  txOk;
+} CanTp_NotifyType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+#define CANTP_CHANNEL_CFG(name, rxId, txId, bs, stMin, rxIndication, txConfirmation)  \
+    { (rxId), (txId), (bs), (stMin), (rxIndication), (txConfirmation) },
+
+static const CanTp_ChannelCfgType CanTp_Channels[CANTP_NUM_CHANNELS] = { CANTP_CFG_CHANNELS(CANTP_CHANNEL_CFG) };
+
+static CanTp_ChannelStateType CanTp_State[CANTP_NUM_CHANNELS];
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void    CanTp_SendFlowControl(u8bit channel, u8bit flowStatus);
+static boolean CanTp_SendTxFrame(u8bit channel, u8bit pci, u8bit first, u8bit count);
+static void    CanTp_RxStart(u8bit channel, const u8bit * data, u8bit dlc, CanTp_NotifyType * notify);
+static void    CanTp_RxConsecutive(u8bit channel, const u8bit * data, u8bit dlc, CanTp_NotifyType * notify);
+static void    CanTp_RxFlowControl(u8bit channel, const u8bit * data, u8bit dlc, CanTp_NotifyType * notify);
+static void    CanTp_RxAbort(CanTp_ChannelStateType * state);
+static void    CanTp_RxEnd(u8bit channel, u8bit * buffer, u16bit length, CanTp_NotifyType * notify);
+static void    CanTp_TxEnd(u8bit channel, boolean ok, CanTp_NotifyType * notify);
+static void    CanTp_TxConsecutive(u8bit channel, CanTp_NotifyType * notify);
+static void    CanTp_Notify(u8bit channel, const CanTp_NotifyType * notify);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+static inline void CanTp_Copy(u8bit * dst, const u8bit * src, u32bit count)
+{
+    u32bit i;
+
+    for (i = 0u; i < count; i++)
+    {
+        dst[i] = src[i];
+    }
+}
+
+/*
+ * STmin of a flow control frame in CanTp_MainFunction calls, reserved values mean the maximum (127 ms).
+ */
+static inline u16bit CanTp_StMinCalls(u8bit stMin)
+{
+    u32bit us;
+
+    if (stMin <= 0x7Fu)
+    {
+        us = (u32bit)stMin * 1000u;
+    }
+    else if ((stMin >= 0xF1u) && (stMin <= 0xF9u))
+    {
+        us = ((u32bit)stMin - 0xF0u) * 100u;
+    }
+    else
+    {
+        us = 127000u;
+    }
+    return (u16bit)((us + CANTP_CFG_MAIN_PERIOD_US - 1u) / CANTP_CFG_MAIN_PERIOD_US);
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+static void CanTp_SendFlowControl(u8bit channel, u8bit flowStatus)
+{
+    u8bit frame[CANTP_FRAME_BYTES];
+    u32bit i;
+
+    frame[0] = CANTP_PCI_FC | flowStatus;
+    frame[1] = CanTp_Channels[channel].blockSize;
+    frame[2] = CanTp_Channels[channel].stMin;
+    for (i = 3u; i < CANTP_FRAME_BYTES; i++)
+    {
+        frame[i] = CANTP_CFG_PADDING;
+    }
+    (void)CANTP_CFG_CAN_WRITE(CanTp_Channels[channel].txId, frame);
+}
+
+/*
+ * Frame with first PCI bytes in front of the next count bytes of head and data, straight from the buffers.
+ * The offset only moves when the driver took the frame.
+ */
+static boolean CanTp_SendTxFrame(u8bit channel, u8bit pci, u8bit first, u8bit count)
+{
+    CanTp_ChannelStateType * state = &CanTp_State[channel];
+    u8bit frame[CANTP_FRAME_BYTES];
+    u32bit pos = first;
+    u32bit offset = state->txOffset;
+    u32bit end = offset + count;
+    u32bit chunk;
+    boolean sent;
+
+    frame[0] = pci;
+    frame[1] = (u8bit)state->txLength;
+    if (offset < state->txHeadLength)
+    {
+        chunk = ((end < state->txHeadLength) ? end : state->txHeadLength) - offset;
+        CanTp_Copy(&frame[pos], &state->txHead[offset], chunk);
+        pos += chunk;
+        offset += chunk;
+    }
+    CanTp_Copy(&frame[pos], &state->txData[offset - state->txHeadLength], end - offset);
+    pos += end - offset;
+    for (; pos < CANTP_FRAME_BYTES; pos++)
+    {
+        frame[pos] = CANTP_CFG_PADDING;
+    }
+
+    sent = CANTP_CFG_CAN_WRITE(CanTp_Channels[channel].txId, frame);
+    if (sent == TRUE)
+    {
+        state->txOffset = (u16bit)end;
+    }
+    return sent;
+}
+
+static void CanTp_RxAbort(CanTp_ChannelStateType * state)
+{
+    MemPool_Free(state->rxBuffer);
+    state->rxBuffer = NULL;
+    state->rxState = CANTP_IDLE;
+}
+
+/*
+ * Single or first frame: a new reception, any one in progress is dropped. Lock held.
+ */
+static void CanTp_RxStart(u8bit channel, const u8bit * data, u8bit dlc, CanTp_NotifyType * notify)
+{
+    CanTp_ChannelStateType * state = &CanTp_State[channel];
+    u8bit * buffer;
+    u16bit length;
+
+    if (state->rxState != CANTP_IDLE)
+    {
+        CanTp_RxAbort(state);
+    }
+
+    if ((data[0] & CANTP_PCI_MASK) == CANTP_PCI_SF)
+    {
+        length = data[0] & 0x0Fu;
+        if ((length != 0u) && (length <= CANTP_SF_MAX) && (length < dlc))
+        {
+            buffer = (u8bit *)MemPool_Alloc(length);
+            if (buffer != NULL)
+            {
+                CanTp_Copy(buffer, &data[1], length);
+                CanTp_RxEnd(channel, buffer, length, notify);
+            }
+        }
+    }
+    else
+    {
+        length = (u16bit)(((u16bit)(data[0] & 0x0Fu) << 8) | data[1]);
+        if ((length > CANTP_SF_MAX) && (dlc == CANTP_FRAME_BYTES))
+        {
+            buffer = (u8bit *)MemPool_Alloc(length);
+            if (buffer == NULL)
+            {
+                CanTp_SendFlowControl(channel, CANTP_FS_OVFLW);
+            }
+            else
+            {
+                CanTp_Copy(buffer, &data[2], CANTP_FF_DATA);
+                state->rxBuffer = buffer;
+                state->rxLength = length;
+                state->rxOffset = CANTP_FF_DATA;
+                state->rxSn = 1u;
+                state->rxBlock = CanTp_Channels[channel].blockSize;
+                state->rxTimer = CANTP_TIMEOUT_CALLS;
+                state->rxState = CANTP_RX_CF;
+                CanTp_SendFlowControl(channel, CANTP_FS_CTS);
+            }
+        }
+    }
+}
+
+/*
+ * Consecutive frame, copied to its place in the message. A wrong sequence number aborts. Lock held.
+ */
+static void CanTp_RxConsecutive(u8bit channel, const u8bit * data, u8bit dlc, CanTp_NotifyType * notify)
+{
+    CanTp_ChannelStateType * state = &CanTp_State[channel];
+    u32bit count;
+    u8bit * buffer;
+
+    if (state->rxState == CANTP_RX_CF)
+    {
+        count = (u32bit)state->rxLength - state->rxOffset;
+        count = (count > CANTP_CF_DATA) ? CANTP_CF_DATA : count;
+        if (((data[0] & 0x0Fu) != state->rxSn) || (dlc <= count))
+        {
+            CanTp_RxAbort(state);
+        }
+        else
+        {
+            CanTp_Copy(&state->rxBuffer[state->rxOffset], &data[1], count);
+            state->rxOffset += (u16bit)count;
+            state->rxSn = (state->rxSn + 1u) & 0x0Fu;
+            state->rxTimer = CANTP_TIMEOUT_CALLS;
+            if (state->rxOffset == state->rxLength)
+            {
+                buffer = state->rxBuffer;
+                state->rxBuffer = NULL;
+                state->rxState = CANTP_IDLE;
+                CanTp_RxEnd(channel, buffer, state->rxLength, notify);
+            }
+            else if (state->rxBlock != 0u)
+            {
+                state->rxBlock--;
+                if (state->rxBlock == 0u)
+                {
+                    state->rxBlock = CanTp_Channels[channel].blockSize;
+                    CanTp_SendFlowControl(channel, CANTP_FS_CTS);
+                }
+            }
+            else
+            {
+            }
+        }
+    }
+}
+
+/*
+ * Flow control of the receiver of our transmission. Lock held.
+ */
+static void CanTp_RxFlowControl(u8bit channel, const u8bit * data, u8bit dlc, CanTp_NotifyType * notify)
+{
+    CanTp_ChannelStateType * state = &CanTp_State[channel];
+
+    if ((state->txState == CANTP_TX_WAIT_FC) && (dlc >= 3u))
+    {
+        switch (data[0] & 0x0Fu)
+        {
+            case CANTP_FS_CTS:
+                state->txBlock = data[1];
+                state->txStMin = CanTp_StMinCalls(data[2]);
+                state->txTimer = 0u;
+                state->txState = CANTP_TX_CF;
+                break;
+            case CANTP_FS_WAIT:
+                state->txTimer = CANTP_TIMEOUT_CALLS;
+                break;
+            default:
+                CanTp_TxEnd(channel, FALSE, notify);
+                break;
+        }
+    }
+}
+
+/*
+ * Message complete, indicated after the lock. Lock held.
+ */
+static void CanTp_RxEnd(u8bit channel, u8bit * buffer, u16bit length, CanTp_NotifyType * notify)
+{
+    notify->rxIndication = CanTp_Channels[channel].rxIndication;
+    notify->rxBuffer = buffer;
+    notify->rxLength = length;
+}
+
+/*
+ * Transmission over, confirmed after the lock. Lock held.
+ */
+static void CanTp_TxEnd(u8bit channel, boolean ok, CanTp_NotifyType * notify)
+{
+    CanTp_State[channel].txState = CANTP_IDLE;
+    notify->txConfirmation = CanTp_Channels[channel].txConfirmation;
+    notify->txOk = ok;
+}
+
+/*
+ * Callbacks copied by CanTp_RxEnd and CanTp_TxEnd, lock released: the upper layer may call CanTp_Transmit
+ * or take as long as it needs.
+ */
+static void CanTp_Notify(u8bit channel, const CanTp_NotifyType * notify)
+{
+    if (notify->rxIndication != NULL)
+    {
+        notify->rxIndication(channel, notify->rxBuffer, notify->rxLength);
+    }
+    if (notify->txConfirmation != NULL)
+    {
+        notify->txConfirmation(channel, notify->txOk);
+    }
+}
+
+/*
+ * Consecutive frames due now: every STmin, or as many as the driver takes when STmin is 0. Lock held.
+ */
+static void CanTp_TxConsecutive(u8bit channel, CanTp_NotifyType * notify)
+{
+    CanTp_ChannelStateType * state = &CanTp_State[channel];
+    u32bit count;
+    boolean more = TRUE;
+
+    if (state->txTimer != 0u)
+    {
+        state->txTimer--;
+    }
+    while ((more == TRUE) && (state->txTimer == 0u))
+    {
+        count = (u32bit)state->txLength - state->txOffset;
+        count = (count > CANTP_CF_DATA) ? CANTP_CF_DATA : count;
+        if (CanTp_SendTxFrame(channel, CANTP_PCI_CF | state->txSn, 1u, (u8bit)count) == FALSE)
+        {
+            more = FALSE;
+        }
+        else
+        {
+            state->txSn = (state->txSn + 1u) & 0x0Fu;
+            state->txTimer = state->txStMin;
+            if (state->txOffset == state->txLength)
+            {
+                CanTp_TxEnd(channel, TRUE, notify);
+                more = FALSE;
+            }
+            else if ((state->txBlock != 0u) && (--state->txBlock == 0u))
+            {
+                state->txTimer = CANTP_TIMEOUT_CALLS;
+                state->txState = CANTP_TX_WAIT_FC;
+                more = FALSE;
+            }
+            else
+            {
+            }
+        }
+    }
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void CanTp_Init(void)
+{
+    u32bit channel;
+
+    for (channel = 0u; channel < CANTP_NUM_CHANNELS; channel++)
+    {
+        CanTp_State[channel].rxBuffer = NULL;
+        CanTp_State[channel].rxState = CANTP_IDLE;
+        CanTp_State[channel].txState = CANTP_IDLE;
+    }
+}
+
+/*
+ * Single frame when it fits, confirmed by the next CanTp_MainFunction, otherwise first frame and wait for
+ * the flow control.
+ */
+boolean CanTp_Transmit(u8bit channel, const u8bit * head, u8bit headLength, const u8bit * data, u16bit length)
+{
+    CanTp_ChannelStateType * state = &CanTp_State[channel];
+    u32bit total = (u32bit)headLength + length;
+    boolean accepted = FALSE;
+
+    CANTP_CFG_LOCK();
+    if ((state->txState == CANTP_IDLE) && (total != 0u) && (total <= CANTP_MAX_LENGTH) &&
+        (headLength <= CANTP_MAX_HEAD))
+    {
+        CanTp_Copy(state->txHead, head, headLength);
+        state->txHeadLength = headLength;
+        state->txData = data;
+        state->txLength = (u16bit)total;
+        state->txOffset = 0u;
+        if (total <= CANTP_SF_MAX)
+        {
+            accepted = CanTp_SendTxFrame(channel, CANTP_PCI_SF | (u8bit)total, 1u, (u8bit)total);
+            if (accepted == TRUE)
+            {
+                state->txState = CANTP_TX_DONE;
+            }
+        }
+        else
+        {
+            accepted = CanTp_SendTxFrame(channel, CANTP_PCI_FF | (u8bit)(total >> 8), 2u, CANTP_FF_DATA);
+            if (accepted == TRUE)
+            {
+                state->txSn = 1u;
+                state->txTimer = CANTP_TIMEOUT_CALLS;
+                state->txState = CANTP_TX_WAIT_FC;
+            }
+        }
+    }
+    CANTP_CFG_UNLOCK();
+    return accepted;
+}
+
+/*
+ * Dispatch a received frame to the channel listening on its identifier.
+ */
+void CanTp_RxIndication(u32bit canId, const u8bit * data, u8bit dlc)
+{
+    CanTp_NotifyType notify;
+    u32bit channel;
+
+    for (channel = 0u; channel < CANTP_NUM_CHANNELS; channel++)
+    {
+        if ((CanTp_Channels[channel].rxId == canId) && (dlc != 0u))
+        {
+            notify.rxIndication = NULL;
+            notify.txConfirmation = NULL;
+            CANTP_CFG_LOCK();
+            switch (data[0] & CANTP_PCI_MASK)
+            {
+                case CANTP_PCI_SF:
+                case CANTP_PCI_FF:
+                    CanTp_RxStart((u8bit)channel, data, dlc, &notify);
+                    break;
+                case CANTP_PCI_CF:
+                    CanTp_RxConsecutive((u8bit)channel, data, dlc, &notify);
+                    break;
+                case CANTP_PCI_FC:
+                    CanTp_RxFlowControl((u8bit)channel, data, dlc, &notify);
+                    break;
+                default:
+                    break;
+            }
+            CANTP_CFG_UNLOCK();
+            CanTp_Notify((u8bit)channel, &notify);
+        }
+    }
+}
+
+void CanTp_MainFunction(void)
+{
+    CanTp_ChannelStateType * state;
+    CanTp_NotifyType notify;
+    u32bit channel;
+
+    for (channel = 0u; channel < CANTP_NUM_CHANNELS; channel++)
+    {
+        state = &CanTp_State[channel];
+        notify.rxIndication = NULL;
+        notify.txConfirmation = NULL;
+        CANTP_CFG_LOCK();
+        if (state->rxState == CANTP_RX_CF)
+        {
+            state->rxTimer--;
+            if (state->rxTimer == 0u)
+            {
+                CanTp_RxAbort(state);
+            }
+        }
+        if (state->txState == CANTP_TX_CF)
+        {
+            CanTp_TxConsecutive((u8bit)channel, &notify);
+        }
+        else if (state->txState == CANTP_TX_WAIT_FC)
+        {
+            state->txTimer--;
+            if (state->txTimer == 0u)
+            {
+                CanTp_TxEnd((u8bit)channel, FALSE, &notify);
+            }
+        }
+        else if (state->txState == CANTP_TX_DONE)
+        {
+            CanTp_TxEnd((u8bit)channel, TRUE, &notify);
+        }
+        else
+        {
+        }
+        CANTP_CFG_UNLOCK();
+        CanTp_Notify((u8bit)channel, &notify);
+    }
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of CanTp.c                                                     |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | Callbacks after the lock, single frame confirmed by CanTp_MainFunction       |
+***********************************************************************************************************************/
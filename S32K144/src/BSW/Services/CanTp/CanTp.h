@@ -0,0 +1,82 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: CanTp.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \CanTp.h
+    ISO 15765-2 transport layer over classic CAN, normal addressing, messages up to 4095 bytes.
+    Receptions are reassembled directly in a MemPool block handed over to the upper layer with the
+    complete message, transmissions are segmented directly from the caller buffers: no intermediate copy
+    on either side. Flow control is tuned per channel with block size and STmin.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CANTP_H_
+#define CANTP_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "CanTp_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Longest message, 12 bit first frame length*/
+#define CANTP_MAX_LENGTH              (4095u)
+
+/*Bytes of a transmission header*/
+#define CANTP_MAX_HEAD                (7u)
+
+/*Channel identifiers, in CANTP_CFG_CHANNELS order*/
+#define CANTP_CHANNEL_ID(name, rxId, txId, bs, stMin, rxIndication, txConfirmation)   CANTP_CHANNEL_##name,
+
+typedef enum
+{
+    CANTP_CFG_CHANNELS(CANTP_CHANNEL_ID)
+    CANTP_NUM_CHANNELS
+} CanTp_ChannelType;
+
+/*Complete message received in buffer, a MemPool block the upper layer now owns and frees*/
+typedef void (*CanTp_RxIndicationType)(u8bit channel, u8bit * buffer, u16bit length);
+
+/*Transmission finished (ok) or aborted, the buffers passed to CanTp_Transmit are released. Called from
+  CanTp_MainFunction or CanTp_RxIndication, never from inside CanTp_Transmit*/
+typedef void (*CanTp_TxConfirmationType)(u8bit channel, boolean ok);
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+extern void CanTp_Init(void);
+
+/*Send head (copied, up to CANTP_MAX_HEAD bytes) followed by data (used in place until the tx confirmation).
+  FALSE when the channel is still transmitting or the length is 0 or above CANTP_MAX_LENGTH*/
+extern boolean CanTp_Transmit(u8bit channel, const u8bit * head, u8bit headLength, const u8bit * data,
+                              u16bit length);
+
+/*Frame received by the CAN driver, any context*/
+extern void CanTp_RxIndication(u32bit canId, const u8bit * data, u8bit dlc);
+
+/*Consecutive frames, STmin and timeouts, every CANTP_CFG_MAIN_PERIOD_US*/
+extern void CanTp_MainFunction(void);
+
+#endif /* CANTP_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of CanTp.h                                                     |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | Tx confirmation context                                                      |
+***********************************************************************************************************************/
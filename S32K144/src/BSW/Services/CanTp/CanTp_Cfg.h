@@ -0,0 +1,82 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: CanTp_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \CanTp_Cfg.h
+    Configuration of the ISO-TP transport layer.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CANTP_CFG_H_
+#define CANTP_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Os.h"
+#include "Dcm.h"
+#if defined (HOST_BUILD)
+#include "Can_Host.h"
+#else
+#include "Can.h"
+#endif
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Channels, CHANNEL(name, rx CAN id, tx CAN id, block size, STmin, rx indication, tx confirmation).
+  Block size and STmin go in the flow control frames of receptions: BS 0 = one flow control per message,
+  STmin 0x00-0x7F ms or 0xF1-0xF9 100-900 us. Host builds add the tester end of the CAN loopback*/
+#if defined (HOST_BUILD)
+#define CANTP_CFG_CHANNELS(CHANNEL)                                                                                 \
+    CHANNEL(Dcm,    0x7E0uL, 0x7E8uL, 0u, 0u, Dcm_RxIndication, Dcm_TxConfirmation)                                \
+    CHANNEL(Tester, 0x7E8uL, 0x7E0uL, 0u, 0u, Can_HostTesterRxIndication, Can_HostTesterTxConfirmation)
+#else
+#define CANTP_CFG_CHANNELS(CHANNEL)                                                                                 \
+    CHANNEL(Dcm,    0x7E0uL, 0x7E8uL, 0u, 0u, Dcm_RxIndication, Dcm_TxConfirmation)
+#endif
+
+/*Period of CanTp_MainFunction, STmin and timeouts are counted in calls*/
+#define CANTP_CFG_MAIN_PERIOD_US      (1000u)
+
+/*N_Bs (flow control awaited) and N_Cr (consecutive frame awaited) timeout*/
+#define CANTP_CFG_TIMEOUT_MS          (1000u)
+
+/*Value of unused frame bytes, every frame is sent with 8 bytes*/
+#define CANTP_CFG_PADDING             (0xCCu)
+
+/*Protects the channel state against CanTp_RxIndication, nestable*/
+#define CANTP_CFG_LOCK()              Os_SuspendAllInterrupts()
+#define CANTP_CFG_UNLOCK()            Os_ResumeAllInterrupts()
+
+/*Queue one 8 byte frame for transmission, FALSE when no mailbox is free (retried by CanTp_MainFunction)*/
+#if defined (HOST_BUILD)
+#define CANTP_CFG_CAN_WRITE(id, data) Can_HostWrite((id), (data))
+#else
+#define CANTP_CFG_CAN_WRITE(id, data) Can_Write((id), (data))
+#endif
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* CANTP_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of CanTp_Cfg.h                                                 |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Target frames through the FlexCAN driver                                     |
+***********************************************************************************************************************/
@@ -0,0 +1,154 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                                OBJECT SPECIFICATION                                               */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Com.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Com.c
+    CAN signal codecs, generated by tools/ComGen/com_gen.py from Com_Cfg.json. Do not edit.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Com.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Com_Pack_EngineStatus(const Com_EngineStatusType * signals, Com_PayloadType * payload)
+{
+    u32bit be0 = 0u;
+    u32bit be1 = 0u;
+    u32bit raw;
+
+    raw = (u32bit)signals->EngineSpeed & 0xFFFFu;
+    be0 |= raw << 16;
+    raw = (u32bit)(s32bit)signals->CoolantTemp & 0xFFu;
+    be0 |= raw << 8;
+    raw = (u32bit)signals->ThrottlePos & 0x3FFu;
+    be1 |= raw << 30;
+    be0 |= raw >> 2;
+    raw = (u32bit)signals->EngineState & 0x7u;
+    be1 |= raw << 27;
+    raw = (u32bit)(s32bit)signals->EngineTorque & 0xFFFFu;
+    be1 |= raw << 8;
+    raw = (u32bit)signals->AliveCounter & 0xFu;
+    be1 |= raw << 4;
+    raw = (u32bit)signals->Checksum & 0xFu;
+    be1 |= raw;
+
+    REV_BYTES_32(be0, payload->words[0u]);
+    REV_BYTES_32(be1, payload->words[1u]);
+}
+
+void Com_Unpack_EngineStatus(const Com_PayloadType * payload, Com_EngineStatusType * signals)
+{
+    u32bit be0;
+    u32bit be1;
+
+    REV_BYTES_32(payload->words[0u], be0);
+    REV_BYTES_32(payload->words[1u], be1);
+
+    signals->EngineSpeed = (u16bit)(be0 >> 16);
+    signals->CoolantTemp = (s8bit)((s32bit)(((be0 >> 8) & 0xFFu) ^ 0x80u) - (s32bit)0x80u);
+    signals->ThrottlePos = (u16bit)(((be1 >> 30) | (be0 << 2)) & 0x3FFu);
+    signals->EngineState = (u8bit)((be1 >> 27) & 0x7u);
+    signals->EngineTorque = (s16bit)((s32bit)(((be1 >> 8) & 0xFFFFu) ^ 0x8000u) - (s32bit)0x8000u);
+    signals->AliveCounter = (u8bit)((be1 >> 4) & 0xFu);
+    signals->Checksum = (u8bit)(be1 & 0xFu);
+}
+
+void Com_Pack_WheelSpeed(const Com_WheelSpeedType * signals, Com_PayloadType * payload)
+{
+    u32bit le0 = 0u;
+    u32bit le1 = 0u;
+    u32bit raw;
+
+    raw = (u32bit)signals->FrontLeft & 0x3FFFu;
+    le0 |= raw;
+    raw = (u32bit)signals->FrontRight & 0x3FFFu;
+    le0 |= raw << 14;
+    raw = (u32bit)signals->RearLeft & 0x3FFFu;
+    le0 |= raw << 28;
+    le1 |= raw >> 4;
+    raw = (u32bit)signals->RearRight & 0x3FFFu;
+    le1 |= raw << 10;
+    raw = (u32bit)signals->Valid & 0xFu;
+    le1 |= raw << 24;
+    raw = (u32bit)signals->AliveCounter & 0xFu;
+    le1 |= raw << 28;
+
+    payload->words[0u] = le0;
+    payload->words[1u] = le1;
+}
+
+void Com_Unpack_WheelSpeed(const Com_PayloadType * payload, Com_WheelSpeedType * signals)
+{
+    u32bit le0;
+    u32bit le1;
+
+    le0 = payload->words[0u];
+    le1 = payload->words[1u];
+
+    signals->FrontLeft = (u16bit)(le0 & 0x3FFFu);
+    signals->FrontRight = (u16bit)((le0 >> 14) & 0x3FFFu);
+    signals->RearLeft = (u16bit)(((le0 >> 28) | (le1 << 4)) & 0x3FFFu);
+    signals->RearRight = (u16bit)((le1 >> 10) & 0x3FFFu);
+    signals->Valid = (u8bit)((le1 >> 24) & 0xFu);
+    signals->AliveCounter = (u8bit)(le1 >> 28);
+}
+
+void Com_Pack_MotorCmd(const Com_MotorCmdType * signals, Com_PayloadType * payload)
+{
+    u32bit be0 = 0u;
+    u32bit raw;
+
+    raw = (u32bit)signals->MotorDuty & 0xFFFu;
+    be0 |= raw << 20;
+    raw = (u32bit)signals->Direction & 0x3u;
+    be0 |= raw << 18;
+    raw = (u32bit)signals->Enable & 0x1u;
+    be0 |= raw << 17;
+    raw = (u32bit)(s32bit)signals->TargetCurrent & 0xFFFFu;
+    be0 |= raw;
+
+    REV_BYTES_32(be0, payload->words[0u]);
+    payload->words[1u] = 0u;
+}
+
+void Com_Unpack_MotorCmd(const Com_PayloadType * payload, Com_MotorCmdType * signals)
+{
+    u32bit be0;
+
+    REV_BYTES_32(payload->words[0u], be0);
+
+    signals->MotorDuty = (u16bit)(be0 >> 20);
+    signals->Direction = (u8bit)((be0 >> 18) & 0x3u);
+    signals->Enable = (u8bit)((be0 >> 17) & 0x1u);
+    signals->TargetCurrent = (s16bit)((s32bit)((be0 & 0xFFFFu) ^ 0x8000u) - (s32bit)0x8000u);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-021   | 17-Oct-2026 | Generated Com.c                                                              |
+***********************************************************************************************************************/
@@ -0,0 +1,102 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                                OBJECT SPECIFICATION                                               */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Com.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Com.h
+    CAN signal codecs, generated by tools/ComGen/com_gen.py from Com_Cfg.json. Do not edit.
+    Com_Pack_<frame> writes the whole payload (unused bits 0), Com_Unpack_<frame> reads every
+    signal of it. Signal values are raw.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef COM_H_
+#define COM_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Core_CM4.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*CAN payload, word aligned for the codecs*/
+typedef union
+{
+    u8bit  bytes[8u];
+    u32bit words[2u];
+} Com_PayloadType;
+
+/*EngineStatus*/
+#define COM_ID_EngineStatus              (0x100u)
+#define COM_DLC_EngineStatus             (8u)
+
+typedef struct
+{
+    u16bit EngineSpeed;                 /*Motorola 7|16*/
+    s8bit  CoolantTemp;                 /*Motorola 23|8, signed*/
+    u16bit ThrottlePos;                 /*Motorola 31|10*/
+    u8bit  EngineState;                 /*Motorola 37|3*/
+    s16bit EngineTorque;                /*Motorola 47|16, signed*/
+    u8bit  AliveCounter;                /*Motorola 63|4*/
+    u8bit  Checksum;                    /*Motorola 59|4*/
+} Com_EngineStatusType;
+
+/*WheelSpeed*/
+#define COM_ID_WheelSpeed                (0x200u)
+#define COM_DLC_WheelSpeed               (8u)
+
+typedef struct
+{
+    u16bit FrontLeft;                   /*Intel 0|14*/
+    u16bit FrontRight;                  /*Intel 14|14*/
+    u16bit RearLeft;                    /*Intel 28|14*/
+    u16bit RearRight;                   /*Intel 42|14*/
+    u8bit  Valid;                       /*Intel 56|4*/
+    u8bit  AliveCounter;                /*Intel 60|4*/
+} Com_WheelSpeedType;
+
+/*MotorCmd*/
+#define COM_ID_MotorCmd                  (0x300u)
+#define COM_DLC_MotorCmd                 (4u)
+
+typedef struct
+{
+    u16bit MotorDuty;                   /*Motorola 7|12*/
+    u8bit  Direction;                   /*Motorola 11|2*/
+    u8bit  Enable;                      /*Motorola 9|1*/
+    s16bit TargetCurrent;               /*Motorola 23|16, signed*/
+} Com_MotorCmdType;
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+extern void Com_Pack_EngineStatus(const Com_EngineStatusType * signals, Com_PayloadType * payload);
+extern void Com_Unpack_EngineStatus(const Com_PayloadType * payload, Com_EngineStatusType * signals);
+
+extern void Com_Pack_WheelSpeed(const Com_WheelSpeedType * signals, Com_PayloadType * payload);
+extern void Com_Unpack_WheelSpeed(const Com_PayloadType * payload, Com_WheelSpeedType * signals);
+
+extern void Com_Pack_MotorCmd(const Com_MotorCmdType * signals, Com_PayloadType * payload);
+extern void Com_Unpack_MotorCmd(const Com_PayloadType * payload, Com_MotorCmdType * signals);
+
+#endif /* COM_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-021   | 17-Oct-2026 | Generated Com.h                                                              |
+***********************************************************************************************************************/
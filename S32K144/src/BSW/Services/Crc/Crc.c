@@ -0,0 +1,324 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Crc.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Crc.c
+    CRC-32 and CRC-16/CCITT-FALSE engines. The slicing engines process bytes one by one up to the first
+    word aligned address, then whole blocks of 4 or 8 bytes with one table lookup per byte: a block
+    XORed with the CRC register is the same as the CRC of each of its bytes followed by the remaining
+    zero bytes, which table k holds. Words are loaded little endian (Cortex-M4 and host).
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Crc.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Engines of Crc_CalculateCRC32/16 selected in Crc_Cfg.h*/
+#if (CRC_CFG_CRC32_ENGINE == CRC_ENGINE_BITWISE)
+#define CRC_UPDATE32(crc, data, length)     Crc_Update32Bitwise((crc), (data), (length))
+#elif (CRC_CFG_CRC32_ENGINE == CRC_ENGINE_SLICE4)
+#define CRC_UPDATE32(crc, data, length)     Crc_Update32Slice4((crc), (data), (length))
+#elif (CRC_CFG_CRC32_ENGINE == CRC_ENGINE_SLICE8)
+#define CRC_UPDATE32(crc, data, length)     Crc_Update32Slice8((crc), (data), (length))
+#else
+#define CRC_UPDATE32(crc, data, length)     Crc_Update32Hw((crc), (data), (length))
+#endif
+
+#if (CRC_CFG_CRC16_ENGINE == CRC_ENGINE_BITWISE)
+#define CRC_UPDATE16(crc, data, length)     Crc_Update16Bitwise((crc), (data), (length))
+#elif (CRC_CFG_CRC16_ENGINE == CRC_ENGINE_SLICE4)
+#define CRC_UPDATE16(crc, data, length)     Crc_Update16Slice4((crc), (data), (length))
+#elif (CRC_CFG_CRC16_ENGINE == CRC_ENGINE_SLICE8)
+#define CRC_UPDATE16(crc, data, length)     Crc_Update16Slice8((crc), (data), (length))
+#else
+#define CRC_UPDATE16(crc, data, length)     Crc_Update16Hw((crc), (data), (length))
+#endif
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void Crc_HwFeed(const u8bit * data, u32bit length);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Bytes of data to process one by one before data is word aligned, at most length.
+ */
+static inline u32bit Crc_Head(const u8bit * data, u32bit length)
+{
+    u32bit head = (0u - (u32bit)(uaddr)data) & 3u;
+
+    return (head < length) ? head : length;
+}
+
+/*
+ * Little endian word at the word aligned data.
+ */
+static inline u32bit Crc_Load32(const u8bit * data)
+{
+    return *(const u32bit *)(const void *)data;
+}
+
+/*
+ * Raw CRC-32 updated with length bytes of data through table 0.
+ */
+static inline u32bit Crc_Bytes32(u32bit crc, const u8bit * data, u32bit length)
+{
+    u32bit i;
+
+    for (i = 0u; i < length; i++)
+    {
+        crc = (crc >> 8) ^ Crc_Table32[0u][(crc ^ data[i]) & 0xFFu];
+    }
+    return crc;
+}
+
+/*
+ * Raw CRC-16 updated with length bytes of data through table 0.
+ */
+static inline u16bit Crc_Bytes16(u16bit crc, const u8bit * data, u32bit length)
+{
+    u32bit i;
+
+    for (i = 0u; i < length; i++)
+    {
+        crc = (u16bit)((u32bit)crc << 8) ^ Crc_Table16[0u][((u32bit)crc >> 8) ^ data[i]];
+    }
+    return crc;
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Feed length bytes of data to the configured CRC peripheral: bytes through the DATA LL lane up to the
+ * first aligned word and after the last one, words byte swapped so the first byte is shifted in first.
+ */
+static void Crc_HwFeed(const u8bit * data, u32bit length)
+{
+    u32bit head = Crc_Head(data, length);
+    u32bit word;
+    u32bit swapped;
+    u32bit i;
+
+    for (i = 0u; i < head; i++)
+    {
+        CRC_CFG_WRITE8(data[i]);
+    }
+    for (; (length - i) >= 4u; i += 4u)
+    {
+        word = Crc_Load32(&data[i]);
+        REV_BYTES_32(word, swapped);
+        CRC_CFG_WRITE32(swapped);
+    }
+    for (; i < length; i++)
+    {
+        CRC_CFG_WRITE8(data[i]);
+    }
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Crc_Init(void)
+{
+    PCC->PCCn[PCC_CRC_INDEX] |= PCC_PCCn_CGC_MASK;
+}
+
+u32bit Crc_CalculateCRC32(const u8bit * data, u32bit length, u32bit startValue, boolean isFirstCall)
+{
+    u32bit crc = (isFirstCall == TRUE) ? CRC_INIT32 : (startValue ^ CRC_XOR32);
+
+    crc = CRC_UPDATE32(crc, data, length);
+    return crc ^ CRC_XOR32;
+}
+
+u16bit Crc_CalculateCRC16(const u8bit * data, u32bit length, u16bit startValue, boolean isFirstCall)
+{
+    u16bit crc = (isFirstCall == TRUE) ? CRC_INIT16 : startValue;
+
+    return CRC_UPDATE16(crc, data, length);
+}
+
+u32bit Crc_Update32Bitwise(u32bit crc, const u8bit * data, u32bit length)
+{
+    u32bit i;
+    u32bit bit;
+
+    for (i = 0u; i < length; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0u; bit < 8u; bit++)
+        {
+            crc = (crc >> 1) ^ (CRC_POLY32_REFLECTED & (0u - (crc & 1u)));
+        }
+    }
+    return crc;
+}
+
+/*
+ * Four bytes per step: the word XOR crc indexes tables 3..0, one lookup per byte.
+ */
+u32bit Crc_Update32Slice4(u32bit crc, const u8bit * data, u32bit length)
+{
+    u32bit head = Crc_Head(data, length);
+    u32bit word;
+
+    crc = Crc_Bytes32(crc, data, head);
+    data = &data[head];
+    length -= head;
+    while (length >= 4u)
+    {
+        word = Crc_Load32(data) ^ crc;
+        crc = Crc_Table32[3u][word & 0xFFu] ^ Crc_Table32[2u][(word >> 8) & 0xFFu]
+            ^ Crc_Table32[1u][(word >> 16) & 0xFFu] ^ Crc_Table32[0u][word >> 24];
+        data = &data[4u];
+        length -= 4u;
+    }
+    return Crc_Bytes32(crc, data, length);
+}
+
+/*
+ * Eight bytes per step: only the first word depends on crc, the eight lookups are independent.
+ */
+u32bit Crc_Update32Slice8(u32bit crc, const u8bit * data, u32bit length)
+{
+    u32bit head = Crc_Head(data, length);
+    u32bit one;
+    u32bit two;
+
+    crc = Crc_Bytes32(crc, data, head);
+    data = &data[head];
+    length -= head;
+    while (length >= 8u)
+    {
+        one = Crc_Load32(data) ^ crc;
+        two = Crc_Load32(&data[4u]);
+        crc = Crc_Table32[7u][one & 0xFFu] ^ Crc_Table32[6u][(one >> 8) & 0xFFu]
+            ^ Crc_Table32[5u][(one >> 16) & 0xFFu] ^ Crc_Table32[4u][one >> 24]
+            ^ Crc_Table32[3u][two & 0xFFu] ^ Crc_Table32[2u][(two >> 8) & 0xFFu]
+            ^ Crc_Table32[1u][(two >> 16) & 0xFFu] ^ Crc_Table32[0u][two >> 24];
+        data = &data[8u];
+        length -= 8u;
+    }
+    return Crc_Bytes32(crc, data, length);
+}
+
+/*
+ * CRC peripheral in 32 bit mode with bits transposed in every written byte, so it shifts LSB first like
+ * the reflected CRC, and read back bit reversed. The seed is loaded untransposed: crc bit reversed.
+ */
+u32bit Crc_Update32Hw(u32bit crc, const u8bit * data, u32bit length)
+{
+    u32bit seed;
+
+    REV_BITS_32(crc, seed);
+    CRC->CTRL = CRC_CTRL_TCRC_MASK | CRC_CTRL_WAS_MASK | CRC_CTRL_TOT(CRC_TRANSPOSE_BITS)
+              | CRC_CTRL_TOTR(CRC_TRANSPOSE_BITS_AND_BYTES);
+    CRC->GPOLY = CRC_POLY32;
+    CRC_CFG_WRITE32(seed);
+    CRC->CTRL &= ~CRC_CTRL_WAS_MASK;
+    Crc_HwFeed(data, length);
+    return CRC_CFG_READ();
+}
+
+u16bit Crc_Update16Bitwise(u16bit crc, const u8bit * data, u32bit length)
+{
+    u32bit value = crc;
+    u32bit i;
+    u32bit bit;
+
+    for (i = 0u; i < length; i++)
+    {
+        value ^= (u32bit)data[i] << 8;
+        for (bit = 0u; bit < 8u; bit++)
+        {
+            value = ((value << 1) ^ (CRC_POLY16 & (0u - ((value >> 15) & 1u)))) & 0xFFFFu;
+        }
+    }
+    return (u16bit)value;
+}
+
+/*
+ * Four bytes per step, crc is XORed into the first two bytes (MSB first).
+ */
+u16bit Crc_Update16Slice4(u16bit crc, const u8bit * data, u32bit length)
+{
+    u32bit head = Crc_Head(data, length);
+    u32bit word;
+
+    crc = Crc_Bytes16(crc, data, head);
+    data = &data[head];
+    length -= head;
+    while (length >= 4u)
+    {
+        word = Crc_Load32(data) ^ ((u32bit)crc >> 8) ^ (((u32bit)crc & 0xFFu) << 8);
+        crc = Crc_Table16[3u][word & 0xFFu] ^ Crc_Table16[2u][(word >> 8) & 0xFFu]
+            ^ Crc_Table16[1u][(word >> 16) & 0xFFu] ^ Crc_Table16[0u][word >> 24];
+        data = &data[4u];
+        length -= 4u;
+    }
+    return Crc_Bytes16(crc, data, length);
+}
+
+u16bit Crc_Update16Slice8(u16bit crc, const u8bit * data, u32bit length)
+{
+    u32bit head = Crc_Head(data, length);
+    u32bit one;
+    u32bit two;
+
+    crc = Crc_Bytes16(crc, data, head);
+    data = &data[head];
+    length -= head;
+    while (length >= 8u)
+    {
+        one = Crc_Load32(data) ^ ((u32bit)crc >> 8) ^ (((u32bit)crc & 0xFFu) << 8);
+        two = Crc_Load32(&data[4u]);
+        crc = Crc_Table16[7u][one & 0xFFu] ^ Crc_Table16[6u][(one >> 8) & 0xFFu]
+            ^ Crc_Table16[5u][(one >> 16) & 0xFFu] ^ Crc_Table16[4u][one >> 24]
+            ^ Crc_Table16[3u][two & 0xFFu] ^ Crc_Table16[2u][(two >> 8) & 0xFFu]
+            ^ Crc_Table16[1u][(two >> 16) & 0xFFu] ^ Crc_Table16[0u][two >> 24];
+        data = &data[8u];
+        length -= 8u;
+    }
+    return Crc_Bytes16(crc, data, length);
+}
+
+/*
+ * CRC peripheral in 16 bit mode without transposition, the CRC is in the low half of DATA.
+ */
+u16bit Crc_Update16Hw(u16bit crc, const u8bit * data, u32bit length)
+{
+    CRC->CTRL = CRC_CTRL_WAS_MASK | CRC_CTRL_TOT(CRC_TRANSPOSE_NONE) | CRC_CTRL_TOTR(CRC_TRANSPOSE_NONE);
+    CRC->GPOLY = CRC_POLY16;
+    CRC_CFG_WRITE32(crc);
+    CRC->CTRL &= ~CRC_CTRL_WAS_MASK;
+    Crc_HwFeed(data, length);
+    return (u16bit)(CRC_CFG_READ() & 0xFFFFu);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | First version of Crc.c                                                       |
+***********************************************************************************************************************/
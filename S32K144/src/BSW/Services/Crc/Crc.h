@@ -0,0 +1,99 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Crc.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Crc.h
+    CRC service for image and message integrity: CRC-32 (IEEE 802.3, zlib) and CRC-16/CCITT-FALSE.
+    Crc_CalculateCRC32/16 follow the AUTOSAR Crc interface, long data is processed in chunks by passing
+    the previous result as startValue with isFirstCall FALSE:
+
+        crc = Crc_CalculateCRC32(block, 4096u, 0u, TRUE);
+        crc = Crc_CalculateCRC32(&block[4096u], 4096u, crc, FALSE);
+
+    The engine is chosen per CRC in Crc_Cfg.h. Every engine is also exported on the raw CRC register
+    (no initial value, no final XOR) so that they can be cross-checked: bit by bit, slice-by-4 and
+    slice-by-8 over the const tables of Crc_Tables.c (tools/CrcGen/crc_gen.py, make crc), and the
+    CRC peripheral. The peripheral engines reprogram the peripheral on every call and must not be
+    called concurrently from different tasks or interrupts.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CRC_H_
+#define CRC_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Core_CM4.h"
+#include "Crc_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Crc_Cfg.h engines*/
+#define CRC_ENGINE_BITWISE            (0u)
+#define CRC_ENGINE_SLICE4             (1u)
+#define CRC_ENGINE_SLICE8             (2u)
+#define CRC_ENGINE_HW                 (3u)
+
+/*CRC-32: polynomial 0x04C11DB7 processed LSB first, initial value and final XOR 0xFFFFFFFF*/
+#define CRC_POLY32                    (0x04C11DB7uL)
+#define CRC_POLY32_REFLECTED          (0xEDB88320uL)
+#define CRC_INIT32                    (0xFFFFFFFFuL)
+#define CRC_XOR32                     (0xFFFFFFFFuL)
+
+/*CRC-16/CCITT-FALSE: polynomial 0x1021 processed MSB first, initial value 0xFFFF, no final XOR*/
+#define CRC_POLY16                    (0x1021u)
+#define CRC_INIT16                    (0xFFFFu)
+
+/*Tables of Crc_Tables.c*/
+#define CRC_SLICES                    (8u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+/*Table k holds the raw CRC of byte n followed by k zero bytes*/
+extern const u32bit Crc_Table32[CRC_SLICES][256u];
+extern const u16bit Crc_Table16[CRC_SLICES][256u];
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Enable the CRC peripheral clock, call once before the CRC_ENGINE_HW engines*/
+extern void Crc_Init(void);
+
+/*CRC-32 of length bytes of data. isFirstCall TRUE starts a new CRC (startValue ignored), FALSE continues
+  the CRC returned by the previous call given as startValue*/
+extern u32bit Crc_CalculateCRC32(const u8bit * data, u32bit length, u32bit startValue, boolean isFirstCall);
+
+/*CRC-16/CCITT-FALSE of length bytes of data, same chaining as Crc_CalculateCRC32*/
+extern u16bit Crc_CalculateCRC16(const u8bit * data, u32bit length, u16bit startValue, boolean isFirstCall);
+
+/*Raw CRC-32 register crc (reflected) updated with length bytes of data, one function per engine*/
+extern u32bit Crc_Update32Bitwise(u32bit crc, const u8bit * data, u32bit length);
+extern u32bit Crc_Update32Slice4(u32bit crc, const u8bit * data, u32bit length);
+extern u32bit Crc_Update32Slice8(u32bit crc, const u8bit * data, u32bit length);
+extern u32bit Crc_Update32Hw(u32bit crc, const u8bit * data, u32bit length);
+
+/*Raw CRC-16 register crc updated with length bytes of data, one function per engine*/
+extern u16bit Crc_Update16Bitwise(u16bit crc, const u8bit * data, u32bit length);
+extern u16bit Crc_Update16Slice4(u16bit crc, const u8bit * data, u32bit length);
+extern u16bit Crc_Update16Slice8(u16bit crc, const u8bit * data, u32bit length);
+extern u16bit Crc_Update16Hw(u16bit crc, const u8bit * data, u32bit length);
+
+#endif /* CRC_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | First version of Crc.h                                                       |
+***********************************************************************************************************************/
@@ -0,0 +1,62 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Crc_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Crc_Cfg.h
+    Configuration of the CRC service.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef CRC_CFG_H_
+#define CRC_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "S32K144.h"
+#if defined (HOST_BUILD)
+#include "Crc_Host.h"
+#endif
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Engine of Crc_CalculateCRC32 and Crc_CalculateCRC16: CRC_ENGINE_BITWISE (no table), CRC_ENGINE_SLICE4,
+  CRC_ENGINE_SLICE8 (Crc_Tables.c, 12 KB of .rodata shared by both) or CRC_ENGINE_HW (CRC peripheral)*/
+#define CRC_CFG_CRC32_ENGINE          CRC_ENGINE_SLICE8
+#define CRC_CFG_CRC16_ENGINE          CRC_ENGINE_SLICE8
+
+/*CRC peripheral data register accesses. Host builds run the CRC simulation*/
+#if defined (HOST_BUILD)
+#define CRC_CFG_WRITE8(value)         Crc_HostWrite((u32bit)(value), 1u)
+#define CRC_CFG_WRITE32(value)        Crc_HostWrite((value), 4u)
+#define CRC_CFG_READ()                Crc_HostRead()
+#else
+#define CRC_CFG_WRITE8(value)         (CRC->DATAu.DATA_8.LL = (u8bit)(value))
+#define CRC_CFG_WRITE32(value)        (CRC->DATAu.DATA = (value))
+#define CRC_CFG_READ()                (CRC->DATAu.DATA)
+#endif
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* CRC_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | First version of Crc_Cfg.h                                                   |
+***********************************************************************************************************************/
@@ -0,0 +1,599 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                                OBJECT SPECIFICATION                                               */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Crc_Tables.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Crc_Tables.c
+    Slicing tables of the Crc service, generated by tools/CrcGen/crc_gen.py. Do not edit.
+    Table k holds the CRC of every byte value followed by k zero bytes.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Crc.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+const u32bit Crc_Table32[CRC_SLICES][256u] =
+{
+    {
+        0x00000000uL, 0x77073096uL, 0xEE0E612CuL, 0x990951BAuL, 0x076DC419uL, 0x706AF48FuL,
+        0xE963A535uL, 0x9E6495A3uL, 0x0EDB8832uL, 0x79DCB8A4uL, 0xE0D5E91EuL, 0x97D2D988uL,
+        0x09B64C2BuL, 0x7EB17CBDuL, 0xE7B82D07uL, 0x90BF1D91uL, 0x1DB71064uL, 0x6AB020F2uL,
+        0xF3B97148uL, 0x84BE41DEuL, 0x1ADAD47DuL, 0x6DDDE4EBuL, 0xF4D4B551uL, 0x83D385C7uL,
+        0x136C9856uL, 0x646BA8C0uL, 0xFD62F97AuL, 0x8A65C9ECuL, 0x14015C4FuL, 0x63066CD9uL,
+        0xFA0F3D63uL, 0x8D080DF5uL, 0x3B6E20C8uL, 0x4C69105EuL, 0xD56041E4uL, 0xA2677172uL,
+        0x3C03E4D1uL, 0x4B04D447uL, 0xD20D85FDuL, 0xA50AB56BuL, 0x35B5A8FAuL, 0x42B2986CuL,
+        0xDBBBC9D6uL, 0xACBCF940uL, 0x32D86CE3uL, 0x45DF5C75uL, 0xDCD60DCFuL, 0xABD13D59uL,
+        0x26D930ACuL, 0x51DE003AuL, 0xC8D75180uL, 0xBFD06116uL, 0x21B4F4B5uL, 0x56B3C423uL,
+        0xCFBA9599uL, 0xB8BDA50FuL, 0x2802B89EuL, 0x5F058808uL, 0xC60CD9B2uL, 0xB10BE924uL,
+        0x2F6F7C87uL, 0x58684C11uL, 0xC1611DABuL, 0xB6662D3DuL, 0x76DC4190uL, 0x01DB7106uL,
+        0x98D220BCuL, 0xEFD5102AuL, 0x71B18589uL, 0x06B6B51FuL, 0x9FBFE4A5uL, 0xE8B8D433uL,
+        0x7807C9A2uL, 0x0F00F934uL, 0x9609A88EuL, 0xE10E9818uL, 0x7F6A0DBBuL, 0x086D3D2DuL,
+        0x91646C97uL, 0xE6635C01uL, 0x6B6B51F4uL, 0x1C6C6162uL, 0x856530D8uL, 0xF262004EuL,
+        0x6C0695EDuL, 0x1B01A57BuL, 0x8208F4C1uL, 0xF50FC457uL, 0x65B0D9C6uL, 0x12B7E950uL,
+        0x8BBEB8EAuL, 0xFCB9887CuL, 0x62DD1DDFuL, 0x15DA2D49uL, 0x8CD37CF3uL, 0xFBD44C65uL,
+        0x4DB26158uL, 0x3AB551CEuL, 0xA3BC0074uL, 0xD4BB30E2uL, 0x4ADFA541uL, 0x3DD895D7uL,
+        0xA4D1C46DuL, 0xD3D6F4FBuL, 0x4369E96AuL, 0x346ED9FCuL, 0xAD678846uL, 0xDA60B8D0uL,
+        0x44042D73uL, 0x33031DE5uL, 0xAA0A4C5FuL, 0xDD0D7CC9uL, 0x5005713CuL, 0x270241AAuL,
+        0xBE0B1010uL, 0xC90C2086uL, 0x5768B525uL, 0x206F85B3uL, 0xB966D409uL, 0xCE61E49FuL,
+        0x5EDEF90EuL, 0x29D9C998uL, 0xB0D09822uL, 0xC7D7A8B4uL, 0x59B33D17uL, 0x2EB40D81uL,
+        0xB7BD5C3BuL, 0xC0BA6CADuL, 0xEDB88320uL, 0x9ABFB3B6uL, 0x03B6E20CuL, 0x74B1D29AuL,
+        0xEAD54739uL, 0x9DD277AFuL, 0x04DB2615uL, 0x73DC1683uL, 0xE3630B12uL, 0x94643B84uL,
+        0x0D6D6A3EuL, 0x7A6A5AA8uL, 0xE40ECF0BuL, 0x9309FF9DuL, 0x0A00AE27uL, 0x7D079EB1uL,
+        0xF00F9344uL, 0x8708A3D2uL, 0x1E01F268uL, 0x6906C2FEuL, 0xF762575DuL, 0x806567CBuL,
+        0x196C3671uL, 0x6E6B06E7uL, 0xFED41B76uL, 0x89D32BE0uL, 0x10DA7A5AuL, 0x67DD4ACCuL,
+        0xF9B9DF6FuL, 0x8EBEEFF9uL, 0x17B7BE43uL, 0x60B08ED5uL, 0xD6D6A3E8uL, 0xA1D1937EuL,
+        0x38D8C2C4uL, 0x4FDFF252uL, 0xD1BB67F1uL, 0xA6BC5767uL, 0x3FB506DDuL, 0x48B2364BuL,
+        0xD80D2BDAuL, 0xAF0A1B4CuL, 0x36034AF6uL, 0x41047A60uL, 0xDF60EFC3uL, 0xA867DF55uL,
+        0x316E8EEFuL, 0x4669BE79uL, 0xCB61B38CuL, 0xBC66831AuL, 0x256FD2A0uL, 0x5268E236uL,
+        0xCC0C7795uL, 0xBB0B4703uL, 0x220216B9uL, 0x5505262FuL, 0xC5BA3BBEuL, 0xB2BD0B28uL,
+        0x2BB45A92uL, 0x5CB36A04uL, 0xC2D7FFA7uL, 0xB5D0CF31uL, 0x2CD99E8BuL, 0x5BDEAE1DuL,
+        0x9B64C2B0uL, 0xEC63F226uL, 0x756AA39CuL, 0x026D930AuL, 0x9C0906A9uL, 0xEB0E363FuL,
+        0x72076785uL, 0x05005713uL, 0x95BF4A82uL, 0xE2B87A14uL, 0x7BB12BAEuL, 0x0CB61B38uL,
+        0x92D28E9BuL, 0xE5D5BE0DuL, 0x7CDCEFB7uL, 0x0BDBDF21uL, 0x86D3D2D4uL, 0xF1D4E242uL,
+        0x68DDB3F8uL, 0x1FDA836EuL, 0x81BE16CDuL, 0xF6B9265BuL, 0x6FB077E1uL, 0x18B74777uL,
+        0x88085AE6uL, 0xFF0F6A70uL, 0x66063BCAuL, 0x11010B5CuL, 0x8F659EFFuL, 0xF862AE69uL,
+        0x616BFFD3uL, 0x166CCF45uL, 0xA00AE278uL, 0xD70DD2EEuL, 0x4E048354uL, 0x3903B3C2uL,
+        0xA7672661uL, 0xD06016F7uL, 0x4969474DuL, 0x3E6E77DBuL, 0xAED16A4AuL, 0xD9D65ADCuL,
+        0x40DF0B66uL, 0x37D83BF0uL, 0xA9BCAE53uL, 0xDEBB9EC5uL, 0x47B2CF7FuL, 0x30B5FFE9uL,
+        0xBDBDF21CuL, 0xCABAC28AuL, 0x53B39330uL, 0x24B4A3A6uL, 0xBAD03605uL, 0xCDD70693uL,
+        0x54DE5729uL, 0x23D967BFuL, 0xB3667A2EuL, 0xC4614AB8uL, 0x5D681B02uL, 0x2A6F2B94uL,
+        0xB40BBE37uL, 0xC30C8EA1uL, 0x5A05DF1BuL, 0x2D02EF8DuL
+    },
+    {
+        0x00000000uL, 0x191B3141uL, 0x32366282uL, 0x2B2D53C3uL, 0x646CC504uL, 0x7D77F445uL,
+        0x565AA786uL, 0x4F4196C7uL, 0xC8D98A08uL, 0xD1C2BB49uL, 0xFAEFE88AuL, 0xE3F4D9CBuL,
+        0xACB54F0CuL, 0xB5AE7E4DuL, 0x9E832D8EuL, 0x87981CCFuL, 0x4AC21251uL, 0x53D92310uL,
+        0x78F470D3uL, 0x61EF4192uL, 0x2EAED755uL, 0x37B5E614uL, 0x1C98B5D7uL, 0x05838496uL,
+        0x821B9859uL, 0x9B00A918uL, 0xB02DFADBuL, 0xA936CB9AuL, 0xE6775D5DuL, 0xFF6C6C1CuL,
+        0xD4413FDFuL, 0xCD5A0E9EuL, 0x958424A2uL, 0x8C9F15E3uL, 0xA7B24620uL, 0xBEA97761uL,
+        0xF1E8E1A6uL, 0xE8F3D0E7uL, 0xC3DE8324uL, 0xDAC5B265uL, 0x5D5DAEAAuL, 0x44469FEBuL,
+        0x6F6BCC28uL, 0x7670FD69uL, 0x39316BAEuL, 0x202A5AEFuL, 0x0B07092CuL, 0x121C386DuL,
+        0xDF4636F3uL, 0xC65D07B2uL, 0xED705471uL, 0xF46B6530uL, 0xBB2AF3F7uL, 0xA231C2B6uL,
+        0x891C9175uL, 0x9007A034uL, 0x179FBCFBuL, 0x0E848DBAuL, 0x25A9DE79uL, 0x3CB2EF38uL,
+        0x73F379FFuL, 0x6AE848BEuL, 0x41C51B7DuL, 0x58DE2A3CuL, 0xF0794F05uL, 0xE9627E44uL,
+        0xC24F2D87uL, 0xDB541CC6uL, 0x94158A01uL, 0x8D0EBB40uL, 0xA623E883uL, 0xBF38D9C2uL,
+        0x38A0C50DuL, 0x21BBF44CuL, 0x0A96A78FuL, 0x138D96CEuL, 0x5CCC0009uL, 0x45D73148uL,
+        0x6EFA628BuL, 0x77E153CAuL, 0xBABB5D54uL, 0xA3A06C15uL, 0x888D3FD6uL, 0x91960E97uL,
+        0xDED79850uL, 0xC7CCA911uL, 0xECE1FAD2uL, 0xF5FACB93uL, 0x7262D75CuL, 0x6B79E61DuL,
+        0x4054B5DEuL, 0x594F849FuL, 0x160E1258uL, 0x0F152319uL, 0x243870DAuL, 0x3D23419BuL,
+        0x65FD6BA7uL, 0x7CE65AE6uL, 0x57CB0925uL, 0x4ED03864uL, 0x0191AEA3uL, 0x188A9FE2uL,
+        0x33A7CC21uL, 0x2ABCFD60uL, 0xAD24E1AFuL, 0xB43FD0EEuL, 0x9F12832DuL, 0x8609B26CuL,
+        0xC94824ABuL, 0xD05315EAuL, 0xFB7E4629uL, 0xE2657768uL, 0x2F3F79F6uL, 0x362448B7uL,
+        0x1D091B74uL, 0x04122A35uL, 0x4B53BCF2uL, 0x52488DB3uL, 0x7965DE70uL, 0x607EEF31uL,
+        0xE7E6F3FEuL, 0xFEFDC2BFuL, 0xD5D0917CuL, 0xCCCBA03DuL, 0x838A36FAuL, 0x9A9107BBuL,
+        0xB1BC5478uL, 0xA8A76539uL, 0x3B83984BuL, 0x2298A90AuL, 0x09B5FAC9uL, 0x10AECB88uL,
+        0x5FEF5D4FuL, 0x46F46C0EuL, 0x6DD93FCDuL, 0x74C20E8CuL, 0xF35A1243uL, 0xEA412302uL,
+        0xC16C70C1uL, 0xD8774180uL, 0x9736D747uL, 0x8E2DE606uL, 0xA500B5C5uL, 0xBC1B8484uL,
+        0x71418A1AuL, 0x685ABB5BuL, 0x4377E898uL, 0x5A6CD9D9uL, 0x152D4F1EuL, 0x0C367E5FuL,
+        0x271B2D9CuL, 0x3E001CDDuL, 0xB9980012uL, 0xA0833153uL, 0x8BAE6290uL, 0x92B553D1uL,
+        0xDDF4C516uL, 0xC4EFF457uL, 0xEFC2A794uL, 0xF6D996D5uL, 0xAE07BCE9uL, 0xB71C8DA8uL,
+        0x9C31DE6BuL, 0x852AEF2AuL, 0xCA6B79EDuL, 0xD37048ACuL, 0xF85D1B6FuL, 0xE1462A2EuL,
+        0x66DE36E1uL, 0x7FC507A0uL, 0x54E85463uL, 0x4DF36522uL, 0x02B2F3E5uL, 0x1BA9C2A4uL,
+        0x30849167uL, 0x299FA026uL, 0xE4C5AEB8uL, 0xFDDE9FF9uL, 0xD6F3CC3AuL, 0xCFE8FD7BuL,
+        0x80A96BBCuL, 0x99B25AFDuL, 0xB29F093EuL, 0xAB84387FuL, 0x2C1C24B0uL, 0x350715F1uL,
+        0x1E2A4632uL, 0x07317773uL, 0x4870E1B4uL, 0x516BD0F5uL, 0x7A468336uL, 0x635DB277uL,
+        0xCBFAD74EuL, 0xD2E1E60FuL, 0xF9CCB5CCuL, 0xE0D7848DuL, 0xAF96124AuL, 0xB68D230BuL,
+        0x9DA070C8uL, 0x84BB4189uL, 0x03235D46uL, 0x1A386C07uL, 0x31153FC4uL, 0x280E0E85uL,
+        0x674F9842uL, 0x7E54A903uL, 0x5579FAC0uL, 0x4C62CB81uL, 0x8138C51FuL, 0x9823F45EuL,
+        0xB30EA79DuL, 0xAA1596DCuL, 0xE554001BuL, 0xFC4F315AuL, 0xD7626299uL, 0xCE7953D8uL,
+        0x49E14F17uL, 0x50FA7E56uL, 0x7BD72D95uL, 0x62CC1CD4uL, 0x2D8D8A13uL, 0x3496BB52uL,
+        0x1FBBE891uL, 0x06A0D9D0uL, 0x5E7EF3ECuL, 0x4765C2ADuL, 0x6C48916EuL, 0x7553A02FuL,
+        0x3A1236E8uL, 0x230907A9uL, 0x0824546AuL, 0x113F652BuL, 0x96A779E4uL, 0x8FBC48A5uL,
+        0xA4911B66uL, 0xBD8A2A27uL, 0xF2CBBCE0uL, 0xEBD08DA1uL, 0xC0FDDE62uL, 0xD9E6EF23uL,
+        0x14BCE1BDuL, 0x0DA7D0FCuL, 0x268A833FuL, 0x3F91B27EuL, 0x70D024B9uL, 0x69CB15F8uL,
+        0x42E6463BuL, 0x5BFD777AuL, 0xDC656BB5uL, 0xC57E5AF4uL, 0xEE530937uL, 0xF7483876uL,
+        0xB809AEB1uL, 0xA1129FF0uL, 0x8A3FCC33uL, 0x9324FD72uL
+    },
+    {
+        0x00000000uL, 0x01C26A37uL, 0x0384D46EuL, 0x0246BE59uL, 0x0709A8DCuL, 0x06CBC2EBuL,
+        0x048D7CB2uL, 0x054F1685uL, 0x0E1351B8uL, 0x0FD13B8FuL, 0x0D9785D6uL, 0x0C55EFE1uL,
+        0x091AF964uL, 0x08D89353uL, 0x0A9E2D0AuL, 0x0B5C473DuL, 0x1C26A370uL, 0x1DE4C947uL,
+        0x1FA2771EuL, 0x1E601D29uL, 0x1B2F0BACuL, 0x1AED619BuL, 0x18ABDFC2uL, 0x1969B5F5uL,
+        0x1235F2C8uL, 0x13F798FFuL, 0x11B126A6uL, 0x10734C91uL, 0x153C5A14uL, 0x14FE3023uL,
+        0x16B88E7AuL, 0x177AE44DuL, 0x384D46E0uL, 0x398F2CD7uL, 0x3BC9928EuL, 0x3A0BF8B9uL,
+        0x3F44EE3CuL, 0x3E86840BuL, 0x3CC03A52uL, 0x3D025065uL, 0x365E1758uL, 0x379C7D6FuL,
+        0x35DAC336uL, 0x3418A901uL, 0x3157BF84uL, 0x3095D5B3uL, 0x32D36BEAuL, 0x331101DDuL,
+        0x246BE590uL, 0x25A98FA7uL, 0x27EF31FEuL, 0x262D5BC9uL, 0x23624D4CuL, 0x22A0277BuL,
+        0x20E69922uL, 0x2124F315uL, 0x2A78B428uL, 0x2BBADE1FuL, 0x29FC6046uL, 0x283E0A71uL,
+        0x2D711CF4uL, 0x2CB376C3uL, 0x2EF5C89AuL, 0x2F37A2ADuL, 0x709A8DC0uL, 0x7158E7F7uL,
+        0x731E59AEuL, 0x72DC3399uL, 0x7793251CuL, 0x76514F2BuL, 0x7417F172uL, 0x75D59B45uL,
+        0x7E89DC78uL, 0x7F4BB64FuL, 0x7D0D0816uL, 0x7CCF6221uL, 0x798074A4uL, 0x78421E93uL,
+        0x7A04A0CAuL, 0x7BC6CAFDuL, 0x6CBC2EB0uL, 0x6D7E4487uL, 0x6F38FADEuL, 0x6EFA90E9uL,
+        0x6BB5866CuL, 0x6A77EC5BuL, 0x68315202uL, 0x69F33835uL, 0x62AF7F08uL, 0x636D153FuL,
+        0x612BAB66uL, 0x60E9C151uL, 0x65A6D7D4uL, 0x6464BDE3uL, 0x662203BAuL, 0x67E0698DuL,
+        0x48D7CB20uL, 0x4915A117uL, 0x4B531F4EuL, 0x4A917579uL, 0x4FDE63FCuL, 0x4E1C09CBuL,
+        0x4C5AB792uL, 0x4D98DDA5uL, 0x46C49A98uL, 0x4706F0AFuL, 0x45404EF6uL, 0x448224C1uL,
+        0x41CD3244uL, 0x400F5873uL, 0x4249E62AuL, 0x438B8C1DuL, 0x54F16850uL, 0x55330267uL,
+        0x5775BC3EuL, 0x56B7D609uL, 0x53F8C08CuL, 0x523AAABBuL, 0x507C14E2uL, 0x51BE7ED5uL,
+        0x5AE239E8uL, 0x5B2053DFuL, 0x5966ED86uL, 0x58A487B1uL, 0x5DEB9134uL, 0x5C29FB03uL,
+        0x5E6F455AuL, 0x5FAD2F6DuL, 0xE1351B80uL, 0xE0F771B7uL, 0xE2B1CFEEuL, 0xE373A5D9uL,
+        0xE63CB35CuL, 0xE7FED96BuL, 0xE5B86732uL, 0xE47A0D05uL, 0xEF264A38uL, 0xEEE4200FuL,
+        0xECA29E56uL, 0xED60F461uL, 0xE82FE2E4uL, 0xE9ED88D3uL, 0xEBAB368AuL, 0xEA695CBDuL,
+        0xFD13B8F0uL, 0xFCD1D2C7uL, 0xFE976C9EuL, 0xFF5506A9uL, 0xFA1A102CuL, 0xFBD87A1BuL,
+        0xF99EC442uL, 0xF85CAE75uL, 0xF300E948uL, 0xF2C2837FuL, 0xF0843D26uL, 0xF1465711uL,
+        0xF4094194uL, 0xF5CB2BA3uL, 0xF78D95FAuL, 0xF64FFFCDuL, 0xD9785D60uL, 0xD8BA3757uL,
+        0xDAFC890EuL, 0xDB3EE339uL, 0xDE71F5BCuL, 0xDFB39F8BuL, 0xDDF521D2uL, 0xDC374BE5uL,
+        0xD76B0CD8uL, 0xD6A966EFuL, 0xD4EFD8B6uL, 0xD52DB281uL, 0xD062A404uL, 0xD1A0CE33uL,
+        0xD3E6706AuL, 0xD2241A5DuL, 0xC55EFE10uL, 0xC49C9427uL, 0xC6DA2A7EuL, 0xC7184049uL,
+        0xC25756CCuL, 0xC3953CFBuL, 0xC1D382A2uL, 0xC011E895uL, 0xCB4DAFA8uL, 0xCA8FC59FuL,
+        0xC8C97BC6uL, 0xC90B11F1uL, 0xCC440774uL, 0xCD866D43uL, 0xCFC0D31AuL, 0xCE02B92DuL,
+        0x91AF9640uL, 0x906DFC77uL, 0x922B422EuL, 0x93E92819uL, 0x96A63E9CuL, 0x976454ABuL,
+        0x9522EAF2uL, 0x94E080C5uL, 0x9FBCC7F8uL, 0x9E7EADCFuL, 0x9C381396uL, 0x9DFA79A1uL,
+        0x98B56F24uL, 0x99770513uL, 0x9B31BB4AuL, 0x9AF3D17DuL, 0x8D893530uL, 0x8C4B5F07uL,
+        0x8E0DE15EuL, 0x8FCF8B69uL, 0x8A809DECuL, 0x8B42F7DBuL, 0x89044982uL, 0x88C623B5uL,
+        0x839A6488uL, 0x82580EBFuL, 0x801EB0E6uL, 0x81DCDAD1uL, 0x8493CC54uL, 0x8551A663uL,
+        0x8717183AuL, 0x86D5720DuL, 0xA9E2D0A0uL, 0xA820BA97uL, 0xAA6604CEuL, 0xABA46EF9uL,
+        0xAEEB787CuL, 0xAF29124BuL, 0xAD6FAC12uL, 0xACADC625uL, 0xA7F18118uL, 0xA633EB2FuL,
+        0xA4755576uL, 0xA5B73F41uL, 0xA0F829C4uL, 0xA13A43F3uL, 0xA37CFDAAuL, 0xA2BE979DuL,
+        0xB5C473D0uL, 0xB40619E7uL, 0xB640A7BEuL, 0xB782CD89uL, 0xB2CDDB0CuL, 0xB30FB13BuL,
+        0xB1490F62uL, 0xB08B6555uL, 0xBBD72268uL, 0xBA15485FuL, 0xB853F606uL, 0xB9919C31uL,
+        0xBCDE8AB4uL, 0xBD1CE083uL, 0xBF5A5EDAuL, 0xBE9834EDuL
+    },
+    {
+        0x00000000uL, 0xB8BC6765uL, 0xAA09C88BuL, 0x12B5AFEEuL, 0x8F629757uL, 0x37DEF032uL,
+        0x256B5FDCuL, 0x9DD738B9uL, 0xC5B428EFuL, 0x7D084F8AuL, 0x6FBDE064uL, 0xD7018701uL,
+        0x4AD6BFB8uL, 0xF26AD8DDuL, 0xE0DF7733uL, 0x58631056uL, 0x5019579FuL, 0xE8A530FAuL,
+        0xFA109F14uL, 0x42ACF871uL, 0xDF7BC0C8uL, 0x67C7A7ADuL, 0x75720843uL, 0xCDCE6F26uL,
+        0x95AD7F70uL, 0x2D111815uL, 0x3FA4B7FBuL, 0x8718D09EuL, 0x1ACFE827uL, 0xA2738F42uL,
+        0xB0C620ACuL, 0x087A47C9uL, 0xA032AF3EuL, 0x188EC85BuL, 0x0A3B67B5uL, 0xB28700D0uL,
+        0x2F503869uL, 0x97EC5F0CuL, 0x8559F0E2uL, 0x3DE59787uL, 0x658687D1uL, 0xDD3AE0B4uL,
+        0xCF8F4F5AuL, 0x7733283FuL, 0xEAE41086uL, 0x525877E3uL, 0x40EDD80DuL, 0xF851BF68uL,
+        0xF02BF8A1uL, 0x48979FC4uL, 0x5A22302AuL, 0xE29E574FuL, 0x7F496FF6uL, 0xC7F50893uL,
+        0xD540A77DuL, 0x6DFCC018uL, 0x359FD04EuL, 0x8D23B72BuL, 0x9F9618C5uL, 0x272A7FA0uL,
+        0xBAFD4719uL, 0x0241207CuL, 0x10F48F92uL, 0xA848E8F7uL, 0x9B14583DuL, 0x23A83F58uL,
+        0x311D90B6uL, 0x89A1F7D3uL, 0x1476CF6AuL, 0xACCAA80FuL, 0xBE7F07E1uL, 0x06C36084uL,
+        0x5EA070D2uL, 0xE61C17B7uL, 0xF4A9B859uL, 0x4C15DF3CuL, 0xD1C2E785uL, 0x697E80E0uL,
+        0x7BCB2F0EuL, 0xC377486BuL, 0xCB0D0FA2uL, 0x73B168C7uL, 0x6104C729uL, 0xD9B8A04CuL,
+        0x446F98F5uL, 0xFCD3FF90uL, 0xEE66507EuL, 0x56DA371BuL, 0x0EB9274DuL, 0xB6054028uL,
+        0xA4B0EFC6uL, 0x1C0C88A3uL, 0x81DBB01AuL, 0x3967D77FuL, 0x2BD27891uL, 0x936E1FF4uL,
+        0x3B26F703uL, 0x839A9066uL, 0x912F3F88uL, 0x299358EDuL, 0xB4446054uL, 0x0CF80731uL,
+        0x1E4DA8DFuL, 0xA6F1CFBAuL, 0xFE92DFECuL, 0x462EB889uL, 0x549B1767uL, 0xEC277002uL,
+        0x71F048BBuL, 0xC94C2FDEuL, 0xDBF98030uL, 0x6345E755uL, 0x6B3FA09CuL, 0xD383C7F9uL,
+        0xC1366817uL, 0x798A0F72uL, 0xE45D37CBuL, 0x5CE150AEuL, 0x4E54FF40uL, 0xF6E89825uL,
+        0xAE8B8873uL, 0x1637EF16uL, 0x048240F8uL, 0xBC3E279DuL, 0x21E91F24uL, 0x99557841uL,
+        0x8BE0D7AFuL, 0x335CB0CAuL, 0xED59B63BuL, 0x55E5D15EuL, 0x47507EB0uL, 0xFFEC19D5uL,
+        0x623B216CuL, 0xDA874609uL, 0xC832E9E7uL, 0x708E8E82uL, 0x28ED9ED4uL, 0x9051F9B1uL,
+        0x82E4565FuL, 0x3A58313AuL, 0xA78F0983uL, 0x1F336EE6uL, 0x0D86C108uL, 0xB53AA66DuL,
+        0xBD40E1A4uL, 0x05FC86C1uL, 0x1749292FuL, 0xAFF54E4AuL, 0x322276F3uL, 0x8A9E1196uL,
+        0x982BBE78uL, 0x2097D91DuL, 0x78F4C94BuL, 0xC048AE2EuL, 0xD2FD01C0uL, 0x6A4166A5uL,
+        0xF7965E1CuL, 0x4F2A3979uL, 0x5D9F9697uL, 0xE523F1F2uL, 0x4D6B1905uL, 0xF5D77E60uL,
+        0xE762D18EuL, 0x5FDEB6EBuL, 0xC2098E52uL, 0x7AB5E937uL, 0x680046D9uL, 0xD0BC21BCuL,
+        0x88DF31EAuL, 0x3063568FuL, 0x22D6F961uL, 0x9A6A9E04uL, 0x07BDA6BDuL, 0xBF01C1D8uL,
+        0xADB46E36uL, 0x15080953uL, 0x1D724E9AuL, 0xA5CE29FFuL, 0xB77B8611uL, 0x0FC7E174uL,
+        0x9210D9CDuL, 0x2AACBEA8uL, 0x38191146uL, 0x80A57623uL, 0xD8C66675uL, 0x607A0110uL,
+        0x72CFAEFEuL, 0xCA73C99BuL, 0x57A4F122uL, 0xEF189647uL, 0xFDAD39A9uL, 0x45115ECCuL,
+        0x764DEE06uL, 0xCEF18963uL, 0xDC44268DuL, 0x64F841E8uL, 0xF92F7951uL, 0x41931E34uL,
+        0x5326B1DAuL, 0xEB9AD6BFuL, 0xB3F9C6E9uL, 0x0B45A18CuL, 0x19F00E62uL, 0xA14C6907uL,
+        0x3C9B51BEuL, 0x842736DBuL, 0x96929935uL, 0x2E2EFE50uL, 0x2654B999uL, 0x9EE8DEFCuL,
+        0x8C5D7112uL, 0x34E11677uL, 0xA9362ECEuL, 0x118A49ABuL, 0x033FE645uL, 0xBB838120uL,
+        0xE3E09176uL, 0x5B5CF613uL, 0x49E959FDuL, 0xF1553E98uL, 0x6C820621uL, 0xD43E6144uL,
+        0xC68BCEAAuL, 0x7E37A9CFuL, 0xD67F4138uL, 0x6EC3265DuL, 0x7C7689B3uL, 0xC4CAEED6uL,
+        0x591DD66FuL, 0xE1A1B10AuL, 0xF3141EE4uL, 0x4BA87981uL, 0x13CB69D7uL, 0xAB770EB2uL,
+        0xB9C2A15CuL, 0x017EC639uL, 0x9CA9FE80uL, 0x241599E5uL, 0x36A0360BuL, 0x8E1C516EuL,
+        0x866616A7uL, 0x3EDA71C2uL, 0x2C6FDE2CuL, 0x94D3B949uL, 0x090481F0uL, 0xB1B8E695uL,
+        0xA30D497BuL, 0x1BB12E1EuL, 0x43D23E48uL, 0xFB6E592DuL, 0xE9DBF6C3uL, 0x516791A6uL,
+        0xCCB0A91FuL, 0x740CCE7AuL, 0x66B96194uL, 0xDE0506F1uL
+    },
+    {
+        0x00000000uL, 0x3D6029B0uL, 0x7AC05360uL, 0x47A07AD0uL, 0xF580A6C0uL, 0xC8E08F70uL,
+        0x8F40F5A0uL, 0xB220DC10uL, 0x30704BC1uL, 0x0D106271uL, 0x4AB018A1uL, 0x77D03111uL,
+        0xC5F0ED01uL, 0xF890C4B1uL, 0xBF30BE61uL, 0x825097D1uL, 0x60E09782uL, 0x5D80BE32uL,
+        0x1A20C4E2uL, 0x2740ED52uL, 0x95603142uL, 0xA80018F2uL, 0xEFA06222uL, 0xD2C04B92uL,
+        0x5090DC43uL, 0x6DF0F5F3uL, 0x2A508F23uL, 0x1730A693uL, 0xA5107A83uL, 0x98705333uL,
+        0xDFD029E3uL, 0xE2B00053uL, 0xC1C12F04uL, 0xFCA106B4uL, 0xBB017C64uL, 0x866155D4uL,
+        0x344189C4uL, 0x0921A074uL, 0x4E81DAA4uL, 0x73E1F314uL, 0xF1B164C5uL, 0xCCD14D75uL,
+        0x8B7137A5uL, 0xB6111E15uL, 0x0431C205uL, 0x3951EBB5uL, 0x7EF19165uL, 0x4391B8D5uL,
+        0xA121B886uL, 0x9C419136uL, 0xDBE1EBE6uL, 0xE681C256uL, 0x54A11E46uL, 0x69C137F6uL,
+        0x2E614D26uL, 0x13016496uL, 0x9151F347uL, 0xAC31DAF7uL, 0xEB91A027uL, 0xD6F18997uL,
+        0x64D15587uL, 0x59B17C37uL, 0x1E1106E7uL, 0x23712F57uL, 0x58F35849uL, 0x659371F9uL,
+        0x22330B29uL, 0x1F532299uL, 0xAD73FE89uL, 0x9013D739uL, 0xD7B3ADE9uL, 0xEAD38459uL,
+        0x68831388uL, 0x55E33A38uL, 0x124340E8uL, 0x2F236958uL, 0x9D03B548uL, 0xA0639CF8uL,
+        0xE7C3E628uL, 0xDAA3CF98uL, 0x3813CFCBuL, 0x0573E67BuL, 0x42D39CABuL, 0x7FB3B51BuL,
+        0xCD93690BuL, 0xF0F340BBuL, 0xB7533A6BuL, 0x8A3313DBuL, 0x0863840AuL, 0x3503ADBAuL,
+        0x72A3D76AuL, 0x4FC3FEDAuL, 0xFDE322CAuL, 0xC0830B7AuL, 0x872371AAuL, 0xBA43581AuL,
+        0x9932774DuL, 0xA4525EFDuL, 0xE3F2242DuL, 0xDE920D9DuL, 0x6CB2D18DuL, 0x51D2F83DuL,
+        0x167282EDuL, 0x2B12AB5DuL, 0xA9423C8CuL, 0x9422153CuL, 0xD3826FECuL, 0xEEE2465CuL,
+        0x5CC29A4CuL, 0x61A2B3FCuL, 0x2602C92CuL, 0x1B62E09CuL, 0xF9D2E0CFuL, 0xC4B2C97FuL,
+        0x8312B3AFuL, 0xBE729A1FuL, 0x0C52460FuL, 0x31326FBFuL, 0x7692156FuL, 0x4BF23CDFuL,
+        0xC9A2AB0EuL, 0xF4C282BEuL, 0xB362F86EuL, 0x8E02D1DEuL, 0x3C220DCEuL, 0x0142247EuL,
+        0x46E25EAEuL, 0x7B82771EuL, 0xB1E6B092uL, 0x8C869922uL, 0xCB26E3F2uL, 0xF646CA42uL,
+        0x44661652uL, 0x79063FE2uL, 0x3EA64532uL, 0x03C66C82uL, 0x8196FB53uL, 0xBCF6D2E3uL,
+        0xFB56A833uL, 0xC6368183uL, 0x74165D93uL, 0x49767423uL, 0x0ED60EF3uL, 0x33B62743uL,
+        0xD1062710uL, 0xEC660EA0uL, 0xABC67470uL, 0x96A65DC0uL, 0x248681D0uL, 0x19E6A860uL,
+        0x5E46D2B0uL, 0x6326FB00uL, 0xE1766CD1uL, 0xDC164561uL, 0x9BB63FB1uL, 0xA6D61601uL,
+        0x14F6CA11uL, 0x2996E3A1uL, 0x6E369971uL, 0x5356B0C1uL, 0x70279F96uL, 0x4D47B626uL,
+        0x0AE7CCF6uL, 0x3787E546uL, 0x85A73956uL, 0xB8C710E6uL, 0xFF676A36uL, 0xC2074386uL,
+        0x4057D457uL, 0x7D37FDE7uL, 0x3A978737uL, 0x07F7AE87uL, 0xB5D77297uL, 0x88B75B27uL,
+        0xCF1721F7uL, 0xF2770847uL, 0x10C70814uL, 0x2DA721A4uL, 0x6A075B74uL, 0x576772C4uL,
+        0xE547AED4uL, 0xD8278764uL, 0x9F87FDB4uL, 0xA2E7D404uL, 0x20B743D5uL, 0x1DD76A65uL,
+        0x5A7710B5uL, 0x67173905uL, 0xD537E515uL, 0xE857CCA5uL, 0xAFF7B675uL, 0x92979FC5uL,
+        0xE915E8DBuL, 0xD475C16BuL, 0x93D5BBBBuL, 0xAEB5920BuL, 0x1C954E1BuL, 0x21F567ABuL,
+        0x66551D7BuL, 0x5B3534CBuL, 0xD965A31AuL, 0xE4058AAAuL, 0xA3A5F07AuL, 0x9EC5D9CAuL,
+        0x2CE505DAuL, 0x11852C6AuL, 0x562556BAuL, 0x6B457F0AuL, 0x89F57F59uL, 0xB49556E9uL,
+        0xF3352C39uL, 0xCE550589uL, 0x7C75D999uL, 0x4115F029uL, 0x06B58AF9uL, 0x3BD5A349uL,
+        0xB9853498uL, 0x84E51D28uL, 0xC34567F8uL, 0xFE254E48uL, 0x4C059258uL, 0x7165BBE8uL,
+        0x36C5C138uL, 0x0BA5E888uL, 0x28D4C7DFuL, 0x15B4EE6FuL, 0x521494BFuL, 0x6F74BD0FuL,
+        0xDD54611FuL, 0xE03448AFuL, 0xA794327FuL, 0x9AF41BCFuL, 0x18A48C1EuL, 0x25C4A5AEuL,
+        0x6264DF7EuL, 0x5F04F6CEuL, 0xED242ADEuL, 0xD044036EuL, 0x97E479BEuL, 0xAA84500EuL,
+        0x4834505DuL, 0x755479EDuL, 0x32F4033DuL, 0x0F942A8DuL, 0xBDB4F69DuL, 0x80D4DF2DuL,
+        0xC774A5FDuL, 0xFA148C4DuL, 0x78441B9CuL, 0x4524322CuL, 0x028448FCuL, 0x3FE4614CuL,
+        0x8DC4BD5CuL, 0xB0A494ECuL, 0xF704EE3CuL, 0xCA64C78CuL
+    },
+    {
+        0x00000000uL, 0xCB5CD3A5uL, 0x4DC8A10BuL, 0x869472AEuL, 0x9B914216uL, 0x50CD91B3uL,
+        0xD659E31DuL, 0x1D0530B8uL, 0xEC53826DuL, 0x270F51C8uL, 0xA19B2366uL, 0x6AC7F0C3uL,
+        0x77C2C07BuL, 0xBC9E13DEuL, 0x3A0A6170uL, 0xF156B2D5uL, 0x03D6029BuL, 0xC88AD13EuL,
+        0x4E1EA390uL, 0x85427035uL, 0x9847408DuL, 0x531B9328uL, 0xD58FE186uL, 0x1ED33223uL,
+        0xEF8580F6uL, 0x24D95353uL, 0xA24D21FDuL, 0x6911F258uL, 0x7414C2E0uL, 0xBF481145uL,
+        0x39DC63EBuL, 0xF280B04EuL, 0x07AC0536uL, 0xCCF0D693uL, 0x4A64A43DuL, 0x81387798uL,
+        0x9C3D4720uL, 0x57619485uL, 0xD1F5E62BuL, 0x1AA9358EuL, 0xEBFF875BuL, 0x20A354FEuL,
+        0xA6372650uL, 0x6D6BF5F5uL, 0x706EC54DuL, 0xBB3216E8uL, 0x3DA66446uL, 0xF6FAB7E3uL,
+        0x047A07ADuL, 0xCF26D408uL, 0x49B2A6A6uL, 0x82EE7503uL, 0x9FEB45BBuL, 0x54B7961EuL,
+        0xD223E4B0uL, 0x197F3715uL, 0xE82985C0uL, 0x23755665uL, 0xA5E124CBuL, 0x6EBDF76EuL,
+        0x73B8C7D6uL, 0xB8E41473uL, 0x3E7066DDuL, 0xF52CB578uL, 0x0F580A6CuL, 0xC404D9C9uL,
+        0x4290AB67uL, 0x89CC78C2uL, 0x94C9487AuL, 0x5F959BDFuL, 0xD901E971uL, 0x125D3AD4uL,
+        0xE30B8801uL, 0x28575BA4uL, 0xAEC3290AuL, 0x659FFAAFuL, 0x789ACA17uL, 0xB3C619B2uL,
+        0x35526B1CuL, 0xFE0EB8B9uL, 0x0C8E08F7uL, 0xC7D2DB52uL, 0x4146A9FCuL, 0x8A1A7A59uL,
+        0x971F4AE1uL, 0x5C439944uL, 0xDAD7EBEAuL, 0x118B384FuL, 0xE0DD8A9AuL, 0x2B81593FuL,
+        0xAD152B91uL, 0x6649F834uL, 0x7B4CC88CuL, 0xB0101B29uL, 0x36846987uL, 0xFDD8BA22uL,
+        0x08F40F5AuL, 0xC3A8DCFFuL, 0x453CAE51uL, 0x8E607DF4uL, 0x93654D4CuL, 0x58399EE9uL,
+        0xDEADEC47uL, 0x15F13FE2uL, 0xE4A78D37uL, 0x2FFB5E92uL, 0xA96F2C3CuL, 0x6233FF99uL,
+        0x7F36CF21uL, 0xB46A1C84uL, 0x32FE6E2AuL, 0xF9A2BD8FuL, 0x0B220DC1uL, 0xC07EDE64uL,
+        0x46EAACCAuL, 0x8DB67F6FuL, 0x90B34FD7uL, 0x5BEF9C72uL, 0xDD7BEEDCuL, 0x16273D79uL,
+        0xE7718FACuL, 0x2C2D5C09uL, 0xAAB92EA7uL, 0x61E5FD02uL, 0x7CE0CDBAuL, 0xB7BC1E1FuL,
+        0x31286CB1uL, 0xFA74BF14uL, 0x1EB014D8uL, 0xD5ECC77DuL, 0x5378B5D3uL, 0x98246676uL,
+        0x852156CEuL, 0x4E7D856BuL, 0xC8E9F7C5uL, 0x03B52460uL, 0xF2E396B5uL, 0x39BF4510uL,
+        0xBF2B37BEuL, 0x7477E41BuL, 0x6972D4A3uL, 0xA22E0706uL, 0x24BA75A8uL, 0xEFE6A60DuL,
+        0x1D661643uL, 0xD63AC5E6uL, 0x50AEB748uL, 0x9BF264EDuL, 0x86F75455uL, 0x4DAB87F0uL,
+        0xCB3FF55EuL, 0x006326FBuL, 0xF135942EuL, 0x3A69478BuL, 0xBCFD3525uL, 0x77A1E680uL,
+        0x6AA4D638uL, 0xA1F8059DuL, 0x276C7733uL, 0xEC30A496uL, 0x191C11EEuL, 0xD240C24BuL,
+        0x54D4B0E5uL, 0x9F886340uL, 0x828D53F8uL, 0x49D1805DuL, 0xCF45F2F3uL, 0x04192156uL,
+        0xF54F9383uL, 0x3E134026uL, 0xB8873288uL, 0x73DBE12DuL, 0x6EDED195uL, 0xA5820230uL,
+        0x2316709EuL, 0xE84AA33BuL, 0x1ACA1375uL, 0xD196C0D0uL, 0x5702B27EuL, 0x9C5E61DBuL,
+        0x815B5163uL, 0x4A0782C6uL, 0xCC93F068uL, 0x07CF23CDuL, 0xF6999118uL, 0x3DC542BDuL,
+        0xBB513013uL, 0x700DE3B6uL, 0x6D08D30EuL, 0xA65400ABuL, 0x20C07205uL, 0xEB9CA1A0uL,
+        0x11E81EB4uL, 0xDAB4CD11uL, 0x5C20BFBFuL, 0x977C6C1AuL, 0x8A795CA2uL, 0x41258F07uL,
+        0xC7B1FDA9uL, 0x0CED2E0CuL, 0xFDBB9CD9uL, 0x36E74F7CuL, 0xB0733DD2uL, 0x7B2FEE77uL,
+        0x662ADECFuL, 0xAD760D6AuL, 0x2BE27FC4uL, 0xE0BEAC61uL, 0x123E1C2FuL, 0xD962CF8AuL,
+        0x5FF6BD24uL, 0x94AA6E81uL, 0x89AF5E39uL, 0x42F38D9CuL, 0xC467FF32uL, 0x0F3B2C97uL,
+        0xFE6D9E42uL, 0x35314DE7uL, 0xB3A53F49uL, 0x78F9ECECuL, 0x65FCDC54uL, 0xAEA00FF1uL,
+        0x28347D5FuL, 0xE368AEFAuL, 0x16441B82uL, 0xDD18C827uL, 0x5B8CBA89uL, 0x90D0692CuL,
+        0x8DD55994uL, 0x46898A31uL, 0xC01DF89FuL, 0x0B412B3AuL, 0xFA1799EFuL, 0x314B4A4AuL,
+        0xB7DF38E4uL, 0x7C83EB41uL, 0x6186DBF9uL, 0xAADA085CuL, 0x2C4E7AF2uL, 0xE712A957uL,
+        0x15921919uL, 0xDECECABCuL, 0x585AB812uL, 0x93066BB7uL, 0x8E035B0FuL, 0x455F88AAuL,
+        0xC3CBFA04uL, 0x089729A1uL, 0xF9C19B74uL, 0x329D48D1uL, 0xB4093A7FuL, 0x7F55E9DAuL,
+        0x6250D962uL, 0xA90C0AC7uL, 0x2F987869uL, 0xE4C4ABCCuL
+    },
+    {
+        0x00000000uL, 0xA6770BB4uL, 0x979F1129uL, 0x31E81A9DuL, 0xF44F2413uL, 0x52382FA7uL,
+        0x63D0353AuL, 0xC5A73E8EuL, 0x33EF4E67uL, 0x959845D3uL, 0xA4705F4EuL, 0x020754FAuL,
+        0xC7A06A74uL, 0x61D761C0uL, 0x503F7B5DuL, 0xF64870E9uL, 0x67DE9CCEuL, 0xC1A9977AuL,
+        0xF0418DE7uL, 0x56368653uL, 0x9391B8DDuL, 0x35E6B369uL, 0x040EA9F4uL, 0xA279A240uL,
+        0x5431D2A9uL, 0xF246D91DuL, 0xC3AEC380uL, 0x65D9C834uL, 0xA07EF6BAuL, 0x0609FD0EuL,
+        0x37E1E793uL, 0x9196EC27uL, 0xCFBD399CuL, 0x69CA3228uL, 0x582228B5uL, 0xFE552301uL,
+        0x3BF21D8FuL, 0x9D85163BuL, 0xAC6D0CA6uL, 0x0A1A0712uL, 0xFC5277FBuL, 0x5A257C4FuL,
+        0x6BCD66D2uL, 0xCDBA6D66uL, 0x081D53E8uL, 0xAE6A585CuL, 0x9F8242C1uL, 0x39F54975uL,
+        0xA863A552uL, 0x0E14AEE6uL, 0x3FFCB47BuL, 0x998BBFCFuL, 0x5C2C8141uL, 0xFA5B8AF5uL,
+        0xCBB39068uL, 0x6DC49BDCuL, 0x9B8CEB35uL, 0x3DFBE081uL, 0x0C13FA1CuL, 0xAA64F1A8uL,
+        0x6FC3CF26uL, 0xC9B4C492uL, 0xF85CDE0FuL, 0x5E2BD5BBuL, 0x440B7579uL, 0xE27C7ECDuL,
+        0xD3946450uL, 0x75E36FE4uL, 0xB044516AuL, 0x16335ADEuL, 0x27DB4043uL, 0x81AC4BF7uL,
+        0x77E43B1EuL, 0xD19330AAuL, 0xE07B2A37uL, 0x460C2183uL, 0x83AB1F0DuL, 0x25DC14B9uL,
+        0x14340E24uL, 0xB2430590uL, 0x23D5E9B7uL, 0x85A2E203uL, 0xB44AF89EuL, 0x123DF32AuL,
+        0xD79ACDA4uL, 0x71EDC610uL, 0x4005DC8DuL, 0xE672D739uL, 0x103AA7D0uL, 0xB64DAC64uL,
+        0x87A5B6F9uL, 0x21D2BD4DuL, 0xE47583C3uL, 0x42028877uL, 0x73EA92EAuL, 0xD59D995EuL,
+        0x8BB64CE5uL, 0x2DC14751uL, 0x1C295DCCuL, 0xBA5E5678uL, 0x7FF968F6uL, 0xD98E6342uL,
+        0xE86679DFuL, 0x4E11726BuL, 0xB8590282uL, 0x1E2E0936uL, 0x2FC613ABuL, 0x89B1181FuL,
+        0x4C162691uL, 0xEA612D25uL, 0xDB8937B8uL, 0x7DFE3C0CuL, 0xEC68D02BuL, 0x4A1FDB9FuL,
+        0x7BF7C102uL, 0xDD80CAB6uL, 0x1827F438uL, 0xBE50FF8CuL, 0x8FB8E511uL, 0x29CFEEA5uL,
+        0xDF879E4CuL, 0x79F095F8uL, 0x48188F65uL, 0xEE6F84D1uL, 0x2BC8BA5FuL, 0x8DBFB1EBuL,
+        0xBC57AB76uL, 0x1A20A0C2uL, 0x8816EAF2uL, 0x2E61E146uL, 0x1F89FBDBuL, 0xB9FEF06FuL,
+        0x7C59CEE1uL, 0xDA2EC555uL, 0xEBC6DFC8uL, 0x4DB1D47CuL, 0xBBF9A495uL, 0x1D8EAF21uL,
+        0x2C66B5BCuL, 0x8A11BE08uL, 0x4FB68086uL, 0xE9C18B32uL, 0xD82991AFuL, 0x7E5E9A1BuL,
+        0xEFC8763CuL, 0x49BF7D88uL, 0x78576715uL, 0xDE206CA1uL, 0x1B87522FuL, 0xBDF0599BuL,
+        0x8C184306uL, 0x2A6F48B2uL, 0xDC27385BuL, 0x7A5033EFuL, 0x4BB82972uL, 0xEDCF22C6uL,
+        0x28681C48uL, 0x8E1F17FCuL, 0xBFF70D61uL, 0x198006D5uL, 0x47ABD36EuL, 0xE1DCD8DAuL,
+        0xD034C247uL, 0x7643C9F3uL, 0xB3E4F77DuL, 0x1593FCC9uL, 0x247BE654uL, 0x820CEDE0uL,
+        0x74449D09uL, 0xD23396BDuL, 0xE3DB8C20uL, 0x45AC8794uL, 0x800BB91AuL, 0x267CB2AEuL,
+        0x1794A833uL, 0xB1E3A387uL, 0x20754FA0uL, 0x86024414uL, 0xB7EA5E89uL, 0x119D553DuL,
+        0xD43A6BB3uL, 0x724D6007uL, 0x43A57A9AuL, 0xE5D2712EuL, 0x139A01C7uL, 0xB5ED0A73uL,
+        0x840510EEuL, 0x22721B5AuL, 0xE7D525D4uL, 0x41A22E60uL, 0x704A34FDuL, 0xD63D3F49uL,
+        0xCC1D9F8BuL, 0x6A6A943FuL, 0x5B828EA2uL, 0xFDF58516uL, 0x3852BB98uL, 0x9E25B02CuL,
+        0xAFCDAAB1uL, 0x09BAA105uL, 0xFFF2D1ECuL, 0x5985DA58uL, 0x686DC0C5uL, 0xCE1ACB71uL,
+        0x0BBDF5FFuL, 0xADCAFE4BuL, 0x9C22E4D6uL, 0x3A55EF62uL, 0xABC30345uL, 0x0DB408F1uL,
+        0x3C5C126CuL, 0x9A2B19D8uL, 0x5F8C2756uL, 0xF9FB2CE2uL, 0xC813367FuL, 0x6E643DCBuL,
+        0x982C4D22uL, 0x3E5B4696uL, 0x0FB35C0BuL, 0xA9C457BFuL, 0x6C636931uL, 0xCA146285uL,
+        0xFBFC7818uL, 0x5D8B73ACuL, 0x03A0A617uL, 0xA5D7ADA3uL, 0x943FB73EuL, 0x3248BC8AuL,
+        0xF7EF8204uL, 0x519889B0uL, 0x6070932DuL, 0xC6079899uL, 0x304FE870uL, 0x9638E3C4uL,
+        0xA7D0F959uL, 0x01A7F2EDuL, 0xC400CC63uL, 0x6277C7D7uL, 0x539FDD4AuL, 0xF5E8D6FEuL,
+        0x647E3AD9uL, 0xC209316DuL, 0xF3E12BF0uL, 0x55962044uL, 0x90311ECAuL, 0x3646157EuL,
+        0x07AE0FE3uL, 0xA1D90457uL, 0x579174BEuL, 0xF1E67F0AuL, 0xC00E6597uL, 0x66796E23uL,
+        0xA3DE50ADuL, 0x05A95B19uL, 0x34414184uL, 0x92364A30uL
+    },
+    {
+        0x00000000uL, 0xCCAA009EuL, 0x4225077DuL, 0x8E8F07E3uL, 0x844A0EFAuL, 0x48E00E64uL,
+        0xC66F0987uL, 0x0AC50919uL, 0xD3E51BB5uL, 0x1F4F1B2BuL, 0x91C01CC8uL, 0x5D6A1C56uL,
+        0x57AF154FuL, 0x9B0515D1uL, 0x158A1232uL, 0xD92012ACuL, 0x7CBB312BuL, 0xB01131B5uL,
+        0x3E9E3656uL, 0xF23436C8uL, 0xF8F13FD1uL, 0x345B3F4FuL, 0xBAD438ACuL, 0x767E3832uL,
+        0xAF5E2A9EuL, 0x63F42A00uL, 0xED7B2DE3uL, 0x21D12D7DuL, 0x2B142464uL, 0xE7BE24FAuL,
+        0x69312319uL, 0xA59B2387uL, 0xF9766256uL, 0x35DC62C8uL, 0xBB53652BuL, 0x77F965B5uL,
+        0x7D3C6CACuL, 0xB1966C32uL, 0x3F196BD1uL, 0xF3B36B4FuL, 0x2A9379E3uL, 0xE639797DuL,
+        0x68B67E9EuL, 0xA41C7E00uL, 0xAED97719uL, 0x62737787uL, 0xECFC7064uL, 0x205670FAuL,
+        0x85CD537DuL, 0x496753E3uL, 0xC7E85400uL, 0x0B42549EuL, 0x01875D87uL, 0xCD2D5D19uL,
+        0x43A25AFAuL, 0x8F085A64uL, 0x562848C8uL, 0x9A824856uL, 0x140D4FB5uL, 0xD8A74F2BuL,
+        0xD2624632uL, 0x1EC846ACuL, 0x9047414FuL, 0x5CED41D1uL, 0x299DC2EDuL, 0xE537C273uL,
+        0x6BB8C590uL, 0xA712C50EuL, 0xADD7CC17uL, 0x617DCC89uL, 0xEFF2CB6AuL, 0x2358CBF4uL,
+        0xFA78D958uL, 0x36D2D9C6uL, 0xB85DDE25uL, 0x74F7DEBBuL, 0x7E32D7A2uL, 0xB298D73CuL,
+        0x3C17D0DFuL, 0xF0BDD041uL, 0x5526F3C6uL, 0x998CF358uL, 0x1703F4BBuL, 0xDBA9F425uL,
+        0xD16CFD3CuL, 0x1DC6FDA2uL, 0x9349FA41uL, 0x5FE3FADFuL, 0x86C3E873uL, 0x4A69E8EDuL,
+        0xC4E6EF0EuL, 0x084CEF90uL, 0x0289E689uL, 0xCE23E617uL, 0x40ACE1F4uL, 0x8C06E16AuL,
+        0xD0EBA0BBuL, 0x1C41A025uL, 0x92CEA7C6uL, 0x5E64A758uL, 0x54A1AE41uL, 0x980BAEDFuL,
+        0x1684A93CuL, 0xDA2EA9A2uL, 0x030EBB0EuL, 0xCFA4BB90uL, 0x412BBC73uL, 0x8D81BCEDuL,
+        0x8744B5F4uL, 0x4BEEB56AuL, 0xC561B289uL, 0x09CBB217uL, 0xAC509190uL, 0x60FA910EuL,
+        0xEE7596EDuL, 0x22DF9673uL, 0x281A9F6AuL, 0xE4B09FF4uL, 0x6A3F9817uL, 0xA6959889uL,
+        0x7FB58A25uL, 0xB31F8ABBuL, 0x3D908D58uL, 0xF13A8DC6uL, 0xFBFF84DFuL, 0x37558441uL,
+        0xB9DA83A2uL, 0x7570833CuL, 0x533B85DAuL, 0x9F918544uL, 0x111E82A7uL, 0xDDB48239uL,
+        0xD7718B20uL, 0x1BDB8BBEuL, 0x95548C5DuL, 0x59FE8CC3uL, 0x80DE9E6FuL, 0x4C749EF1uL,
+        0xC2FB9912uL, 0x0E51998CuL, 0x04949095uL, 0xC83E900BuL, 0x46B197E8uL, 0x8A1B9776uL,
+        0x2F80B4F1uL, 0xE32AB46FuL, 0x6DA5B38CuL, 0xA10FB312uL, 0xABCABA0BuL, 0x6760BA95uL,
+        0xE9EFBD76uL, 0x2545BDE8uL, 0xFC65AF44uL, 0x30CFAFDAuL, 0xBE40A839uL, 0x72EAA8A7uL,
+        0x782FA1BEuL, 0xB485A120uL, 0x3A0AA6C3uL, 0xF6A0A65DuL, 0xAA4DE78CuL, 0x66E7E712uL,
+        0xE868E0F1uL, 0x24C2E06FuL, 0x2E07E976uL, 0xE2ADE9E8uL, 0x6C22EE0BuL, 0xA088EE95uL,
+        0x79A8FC39uL, 0xB502FCA7uL, 0x3B8DFB44uL, 0xF727FBDAuL, 0xFDE2F2C3uL, 0x3148F25DuL,
+        0xBFC7F5BEuL, 0x736DF520uL, 0xD6F6D6A7uL, 0x1A5CD639uL, 0x94D3D1DAuL, 0x5879D144uL,
+        0x52BCD85DuL, 0x9E16D8C3uL, 0x1099DF20uL, 0xDC33DFBEuL, 0x0513CD12uL, 0xC9B9CD8CuL,
+        0x4736CA6FuL, 0x8B9CCAF1uL, 0x8159C3E8uL, 0x4DF3C376uL, 0xC37CC495uL, 0x0FD6C40BuL,
+        0x7AA64737uL, 0xB60C47A9uL, 0x3883404AuL, 0xF42940D4uL, 0xFEEC49CDuL, 0x32464953uL,
+        0xBCC94EB0uL, 0x70634E2EuL, 0xA9435C82uL, 0x65E95C1CuL, 0xEB665BFFuL, 0x27CC5B61uL,
+        0x2D095278uL, 0xE1A352E6uL, 0x6F2C5505uL, 0xA386559BuL, 0x061D761CuL, 0xCAB77682uL,
+        0x44387161uL, 0x889271FFuL, 0x825778E6uL, 0x4EFD7878uL, 0xC0727F9BuL, 0x0CD87F05uL,
+        0xD5F86DA9uL, 0x19526D37uL, 0x97DD6AD4uL, 0x5B776A4AuL, 0x51B26353uL, 0x9D1863CDuL,
+        0x1397642EuL, 0xDF3D64B0uL, 0x83D02561uL, 0x4F7A25FFuL, 0xC1F5221CuL, 0x0D5F2282uL,
+        0x079A2B9BuL, 0xCB302B05uL, 0x45BF2CE6uL, 0x89152C78uL, 0x50353ED4uL, 0x9C9F3E4AuL,
+        0x121039A9uL, 0xDEBA3937uL, 0xD47F302EuL, 0x18D530B0uL, 0x965A3753uL, 0x5AF037CDuL,
+        0xFF6B144AuL, 0x33C114D4uL, 0xBD4E1337uL, 0x71E413A9uL, 0x7B211AB0uL, 0xB78B1A2EuL,
+        0x39041DCDuL, 0xF5AE1D53uL, 0x2C8E0FFFuL, 0xE0240F61uL, 0x6EAB0882uL, 0xA201081CuL,
+        0xA8C40105uL, 0x646E019BuL, 0xEAE10678uL, 0x264B06E6uL
+    }
+};
+
+const u16bit Crc_Table16[CRC_SLICES][256u] =
+{
+    {
+        0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u, 0x8108u, 0x9129u, 0xA14Au, 0xB16Bu,
+        0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu, 0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+        0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu, 0x2462u, 0x3443u, 0x0420u, 0x1401u,
+        0x64E6u, 0x74C7u, 0x44A4u, 0x5485u, 0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+        0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u, 0xB75Bu, 0xA77Au, 0x9719u, 0x8738u,
+        0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu, 0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+        0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu, 0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u,
+        0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u, 0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+        0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u, 0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu,
+        0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u, 0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+        0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u, 0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu,
+        0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu, 0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+        0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu, 0x02B1u, 0x1290u, 0x22F3u, 0x32D2u,
+        0x4235u, 0x5214u, 0x6277u, 0x7256u, 0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+        0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u, 0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u,
+        0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu, 0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+        0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu, 0x5844u, 0x4865u, 0x7806u, 0x6827u,
+        0x18C0u, 0x08E1u, 0x3882u, 0x28A3u, 0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+        0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u, 0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du,
+        0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u, 0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+        0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u, 0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u,
+        0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+    },
+    {
+        0x0000u, 0x3331u, 0x6662u, 0x5553u, 0xCCC4u, 0xFFF5u, 0xAAA6u, 0x9997u, 0x89A9u, 0xBA98u, 0xEFCBu, 0xDCFAu,
+        0x456Du, 0x765Cu, 0x230Fu, 0x103Eu, 0x0373u, 0x3042u, 0x6511u, 0x5620u, 0xCFB7u, 0xFC86u, 0xA9D5u, 0x9AE4u,
+        0x8ADAu, 0xB9EBu, 0xECB8u, 0xDF89u, 0x461Eu, 0x752Fu, 0x207Cu, 0x134Du, 0x06E6u, 0x35D7u, 0x6084u, 0x53B5u,
+        0xCA22u, 0xF913u, 0xAC40u, 0x9F71u, 0x8F4Fu, 0xBC7Eu, 0xE92Du, 0xDA1Cu, 0x438Bu, 0x70BAu, 0x25E9u, 0x16D8u,
+        0x0595u, 0x36A4u, 0x63F7u, 0x50C6u, 0xC951u, 0xFA60u, 0xAF33u, 0x9C02u, 0x8C3Cu, 0xBF0Du, 0xEA5Eu, 0xD96Fu,
+        0x40F8u, 0x73C9u, 0x269Au, 0x15ABu, 0x0DCCu, 0x3EFDu, 0x6BAEu, 0x589Fu, 0xC108u, 0xF239u, 0xA76Au, 0x945Bu,
+        0x8465u, 0xB754u, 0xE207u, 0xD136u, 0x48A1u, 0x7B90u, 0x2EC3u, 0x1DF2u, 0x0EBFu, 0x3D8Eu, 0x68DDu, 0x5BECu,
+        0xC27Bu, 0xF14Au, 0xA419u, 0x9728u, 0x8716u, 0xB427u, 0xE174u, 0xD245u, 0x4BD2u, 0x78E3u, 0x2DB0u, 0x1E81u,
+        0x0B2Au, 0x381Bu, 0x6D48u, 0x5E79u, 0xC7EEu, 0xF4DFu, 0xA18Cu, 0x92BDu, 0x8283u, 0xB1B2u, 0xE4E1u, 0xD7D0u,
+        0x4E47u, 0x7D76u, 0x2825u, 0x1B14u, 0x0859u, 0x3B68u, 0x6E3Bu, 0x5D0Au, 0xC49Du, 0xF7ACu, 0xA2FFu, 0x91CEu,
+        0x81F0u, 0xB2C1u, 0xE792u, 0xD4A3u, 0x4D34u, 0x7E05u, 0x2B56u, 0x1867u, 0x1B98u, 0x28A9u, 0x7DFAu, 0x4ECBu,
+        0xD75Cu, 0xE46Du, 0xB13Eu, 0x820Fu, 0x9231u, 0xA100u, 0xF453u, 0xC762u, 0x5EF5u, 0x6DC4u, 0x3897u, 0x0BA6u,
+        0x18EBu, 0x2BDAu, 0x7E89u, 0x4DB8u, 0xD42Fu, 0xE71Eu, 0xB24Du, 0x817Cu, 0x9142u, 0xA273u, 0xF720u, 0xC411u,
+        0x5D86u, 0x6EB7u, 0x3BE4u, 0x08D5u, 0x1D7Eu, 0x2E4Fu, 0x7B1Cu, 0x482Du, 0xD1BAu, 0xE28Bu, 0xB7D8u, 0x84E9u,
+        0x94D7u, 0xA7E6u, 0xF2B5u, 0xC184u, 0x5813u, 0x6B22u, 0x3E71u, 0x0D40u, 0x1E0Du, 0x2D3Cu, 0x786Fu, 0x4B5Eu,
+        0xD2C9u, 0xE1F8u, 0xB4ABu, 0x879Au, 0x97A4u, 0xA495u, 0xF1C6u, 0xC2F7u, 0x5B60u, 0x6851u, 0x3D02u, 0x0E33u,
+        0x1654u, 0x2565u, 0x7036u, 0x4307u, 0xDA90u, 0xE9A1u, 0xBCF2u, 0x8FC3u, 0x9FFDu, 0xACCCu, 0xF99Fu, 0xCAAEu,
+        0x5339u, 0x6008u, 0x355Bu, 0x066Au, 0x1527u, 0x2616u, 0x7345u, 0x4074u, 0xD9E3u, 0xEAD2u, 0xBF81u, 0x8CB0u,
+        0x9C8Eu, 0xAFBFu, 0xFAECu, 0xC9DDu, 0x504Au, 0x637Bu, 0x3628u, 0x0519u, 0x10B2u, 0x2383u, 0x76D0u, 0x45E1u,
+        0xDC76u, 0xEF47u, 0xBA14u, 0x8925u, 0x991Bu, 0xAA2Au, 0xFF79u, 0xCC48u, 0x55DFu, 0x66EEu, 0x33BDu, 0x008Cu,
+        0x13C1u, 0x20F0u, 0x75A3u, 0x4692u, 0xDF05u, 0xEC34u, 0xB967u, 0x8A56u, 0x9A68u, 0xA959u, 0xFC0Au, 0xCF3Bu,
+        0x56ACu, 0x659Du, 0x30CEu, 0x03FFu
+    },
+    {
+        0x0000u, 0x3730u, 0x6E60u, 0x5950u, 0xDCC0u, 0xEBF0u, 0xB2A0u, 0x8590u, 0xA9A1u, 0x9E91u, 0xC7C1u, 0xF0F1u,
+        0x7561u, 0x4251u, 0x1B01u, 0x2C31u, 0x4363u, 0x7453u, 0x2D03u, 0x1A33u, 0x9FA3u, 0xA893u, 0xF1C3u, 0xC6F3u,
+        0xEAC2u, 0xDDF2u, 0x84A2u, 0xB392u, 0x3602u, 0x0132u, 0x5862u, 0x6F52u, 0x86C6u, 0xB1F6u, 0xE8A6u, 0xDF96u,
+        0x5A06u, 0x6D36u, 0x3466u, 0x0356u, 0x2F67u, 0x1857u, 0x4107u, 0x7637u, 0xF3A7u, 0xC497u, 0x9DC7u, 0xAAF7u,
+        0xC5A5u, 0xF295u, 0xABC5u, 0x9CF5u, 0x1965u, 0x2E55u, 0x7705u, 0x4035u, 0x6C04u, 0x5B34u, 0x0264u, 0x3554u,
+        0xB0C4u, 0x87F4u, 0xDEA4u, 0xE994u, 0x1DADu, 0x2A9Du, 0x73CDu, 0x44FDu, 0xC16Du, 0xF65Du, 0xAF0Du, 0x983Du,
+        0xB40Cu, 0x833Cu, 0xDA6Cu, 0xED5Cu, 0x68CCu, 0x5FFCu, 0x06ACu, 0x319Cu, 0x5ECEu, 0x69FEu, 0x30AEu, 0x079Eu,
+        0x820Eu, 0xB53Eu, 0xEC6Eu, 0xDB5Eu, 0xF76Fu, 0xC05Fu, 0x990Fu, 0xAE3Fu, 0x2BAFu, 0x1C9Fu, 0x45CFu, 0x72FFu,
+        0x9B6Bu, 0xAC5Bu, 0xF50Bu, 0xC23Bu, 0x47ABu, 0x709Bu, 0x29CBu, 0x1EFBu, 0x32CAu, 0x05FAu, 0x5CAAu, 0x6B9Au,
+        0xEE0Au, 0xD93Au, 0x806Au, 0xB75Au, 0xD808u, 0xEF38u, 0xB668u, 0x8158u, 0x04C8u, 0x33F8u, 0x6AA8u, 0x5D98u,
+        0x71A9u, 0x4699u, 0x1FC9u, 0x28F9u, 0xAD69u, 0x9A59u, 0xC309u, 0xF439u, 0x3B5Au, 0x0C6Au, 0x553Au, 0x620Au,
+        0xE79Au, 0xD0AAu, 0x89FAu, 0xBECAu, 0x92FBu, 0xA5CBu, 0xFC9Bu, 0xCBABu, 0x4E3Bu, 0x790Bu, 0x205Bu, 0x176Bu,
+        0x7839u, 0x4F09u, 0x1659u, 0x2169u, 0xA4F9u, 0x93C9u, 0xCA99u, 0xFDA9u, 0xD198u, 0xE6A8u, 0xBFF8u, 0x88C8u,
+        0x0D58u, 0x3A68u, 0x6338u, 0x5408u, 0xBD9Cu, 0x8AACu, 0xD3FCu, 0xE4CCu, 0x615Cu, 0x566Cu, 0x0F3Cu, 0x380Cu,
+        0x143Du, 0x230Du, 0x7A5Du, 0x4D6Du, 0xC8FDu, 0xFFCDu, 0xA69Du, 0x91ADu, 0xFEFFu, 0xC9CFu, 0x909Fu, 0xA7AFu,
+        0x223Fu, 0x150Fu, 0x4C5Fu, 0x7B6Fu, 0x575Eu, 0x606Eu, 0x393Eu, 0x0E0Eu, 0x8B9Eu, 0xBCAEu, 0xE5FEu, 0xD2CEu,
+        0x26F7u, 0x11C7u, 0x4897u, 0x7FA7u, 0xFA37u, 0xCD07u, 0x9457u, 0xA367u, 0x8F56u, 0xB866u, 0xE136u, 0xD606u,
+        0x5396u, 0x64A6u, 0x3DF6u, 0x0AC6u, 0x6594u, 0x52A4u, 0x0BF4u, 0x3CC4u, 0xB954u, 0x8E64u, 0xD734u, 0xE004u,
+        0xCC35u, 0xFB05u, 0xA255u, 0x9565u, 0x10F5u, 0x27C5u, 0x7E95u, 0x49A5u, 0xA031u, 0x9701u, 0xCE51u, 0xF961u,
+        0x7CF1u, 0x4BC1u, 0x1291u, 0x25A1u, 0x0990u, 0x3EA0u, 0x67F0u, 0x50C0u, 0xD550u, 0xE260u, 0xBB30u, 0x8C00u,
+        0xE352u, 0xD462u, 0x8D32u, 0xBA02u, 0x3F92u, 0x08A2u, 0x51F2u, 0x66C2u, 0x4AF3u, 0x7DC3u, 0x2493u, 0x13A3u,
+        0x9633u, 0xA103u, 0xF853u, 0xCF63u
+    },
+    {
+        0x0000u, 0x76B4u, 0xED68u, 0x9BDCu, 0xCAF1u, 0xBC45u, 0x2799u, 0x512Du, 0x85C3u, 0xF377u, 0x68ABu, 0x1E1Fu,
+        0x4F32u, 0x3986u, 0xA25Au, 0xD4EEu, 0x1BA7u, 0x6D13u, 0xF6CFu, 0x807Bu, 0xD156u, 0xA7E2u, 0x3C3Eu, 0x4A8Au,
+        0x9E64u, 0xE8D0u, 0x730Cu, 0x05B8u, 0x5495u, 0x2221u, 0xB9FDu, 0xCF49u, 0x374Eu, 0x41FAu, 0xDA26u, 0xAC92u,
+        0xFDBFu, 0x8B0Bu, 0x10D7u, 0x6663u, 0xB28Du, 0xC439u, 0x5FE5u, 0x2951u, 0x787Cu, 0x0EC8u, 0x9514u, 0xE3A0u,
+        0x2CE9u, 0x5A5Du, 0xC181u, 0xB735u, 0xE618u, 0x90ACu, 0x0B70u, 0x7DC4u, 0xA92Au, 0xDF9Eu, 0x4442u, 0x32F6u,
+        0x63DBu, 0x156Fu, 0x8EB3u, 0xF807u, 0x6E9Cu, 0x1828u, 0x83F4u, 0xF540u, 0xA46Du, 0xD2D9u, 0x4905u, 0x3FB1u,
+        0xEB5Fu, 0x9DEBu, 0x0637u, 0x7083u, 0x21AEu, 0x571Au, 0xCCC6u, 0xBA72u, 0x753Bu, 0x038Fu, 0x9853u, 0xEEE7u,
+        0xBFCAu, 0xC97Eu, 0x52A2u, 0x2416u, 0xF0F8u, 0x864Cu, 0x1D90u, 0x6B24u, 0x3A09u, 0x4CBDu, 0xD761u, 0xA1D5u,
+        0x59D2u, 0x2F66u, 0xB4BAu, 0xC20Eu, 0x9323u, 0xE597u, 0x7E4Bu, 0x08FFu, 0xDC11u, 0xAAA5u, 0x3179u, 0x47CDu,
+        0x16E0u, 0x6054u, 0xFB88u, 0x8D3Cu, 0x4275u, 0x34C1u, 0xAF1Du, 0xD9A9u, 0x8884u, 0xFE30u, 0x65ECu, 0x1358u,
+        0xC7B6u, 0xB102u, 0x2ADEu, 0x5C6Au, 0x0D47u, 0x7BF3u, 0xE02Fu, 0x969Bu, 0xDD38u, 0xAB8Cu, 0x3050u, 0x46E4u,
+        0x17C9u, 0x617Du, 0xFAA1u, 0x8C15u, 0x58FBu, 0x2E4Fu, 0xB593u, 0xC327u, 0x920Au, 0xE4BEu, 0x7F62u, 0x09D6u,
+        0xC69Fu, 0xB02Bu, 0x2BF7u, 0x5D43u, 0x0C6Eu, 0x7ADAu, 0xE106u, 0x97B2u, 0x435Cu, 0x35E8u, 0xAE34u, 0xD880u,
+        0x89ADu, 0xFF19u, 0x64C5u, 0x1271u, 0xEA76u, 0x9CC2u, 0x071Eu, 0x71AAu, 0x2087u, 0x5633u, 0xCDEFu, 0xBB5Bu,
+        0x6FB5u, 0x1901u, 0x82DDu, 0xF469u, 0xA544u, 0xD3F0u, 0x482Cu, 0x3E98u, 0xF1D1u, 0x8765u, 0x1CB9u, 0x6A0Du,
+        0x3B20u, 0x4D94u, 0xD648u, 0xA0FCu, 0x7412u, 0x02A6u, 0x997Au, 0xEFCEu, 0xBEE3u, 0xC857u, 0x538Bu, 0x253Fu,
+        0xB3A4u, 0xC510u, 0x5ECCu, 0x2878u, 0x7955u, 0x0FE1u, 0x943Du, 0xE289u, 0x3667u, 0x40D3u, 0xDB0Fu, 0xADBBu,
+        0xFC96u, 0x8A22u, 0x11FEu, 0x674Au, 0xA803u, 0xDEB7u, 0x456Bu, 0x33DFu, 0x62F2u, 0x1446u, 0x8F9Au, 0xF92Eu,
+        0x2DC0u, 0x5B74u, 0xC0A8u, 0xB61Cu, 0xE731u, 0x9185u, 0x0A59u, 0x7CEDu, 0x84EAu, 0xF25Eu, 0x6982u, 0x1F36u,
+        0x4E1Bu, 0x38AFu, 0xA373u, 0xD5C7u, 0x0129u, 0x779Du, 0xEC41u, 0x9AF5u, 0xCBD8u, 0xBD6Cu, 0x26B0u, 0x5004u,
+        0x9F4Du, 0xE9F9u, 0x7225u, 0x0491u, 0x55BCu, 0x2308u, 0xB8D4u, 0xCE60u, 0x1A8Eu, 0x6C3Au, 0xF7E6u, 0x8152u,
+        0xD07Fu, 0xA6CBu, 0x3D17u, 0x4BA3u
+    },
+    {
+        0x0000u, 0xAA51u, 0x4483u, 0xEED2u, 0x8906u, 0x2357u, 0xCD85u, 0x67D4u, 0x022Du, 0xA87Cu, 0x46AEu, 0xECFFu,
+        0x8B2Bu, 0x217Au, 0xCFA8u, 0x65F9u, 0x045Au, 0xAE0Bu, 0x40D9u, 0xEA88u, 0x8D5Cu, 0x270Du, 0xC9DFu, 0x638Eu,
+        0x0677u, 0xAC26u, 0x42F4u, 0xE8A5u, 0x8F71u, 0x2520u, 0xCBF2u, 0x61A3u, 0x08B4u, 0xA2E5u, 0x4C37u, 0xE666u,
+        0x81B2u, 0x2BE3u, 0xC531u, 0x6F60u, 0x0A99u, 0xA0C8u, 0x4E1Au, 0xE44Bu, 0x839Fu, 0x29CEu, 0xC71Cu, 0x6D4Du,
+        0x0CEEu, 0xA6BFu, 0x486Du, 0xE23Cu, 0x85E8u, 0x2FB9u, 0xC16Bu, 0x6B3Au, 0x0EC3u, 0xA492u, 0x4A40u, 0xE011u,
+        0x87C5u, 0x2D94u, 0xC346u, 0x6917u, 0x1168u, 0xBB39u, 0x55EBu, 0xFFBAu, 0x986Eu, 0x323Fu, 0xDCEDu, 0x76BCu,
+        0x1345u, 0xB914u, 0x57C6u, 0xFD97u, 0x9A43u, 0x3012u, 0xDEC0u, 0x7491u, 0x1532u, 0xBF63u, 0x51B1u, 0xFBE0u,
+        0x9C34u, 0x3665u, 0xD8B7u, 0x72E6u, 0x171Fu, 0xBD4Eu, 0x539Cu, 0xF9CDu, 0x9E19u, 0x3448u, 0xDA9Au, 0x70CBu,
+        0x19DCu, 0xB38Du, 0x5D5Fu, 0xF70Eu, 0x90DAu, 0x3A8Bu, 0xD459u, 0x7E08u, 0x1BF1u, 0xB1A0u, 0x5F72u, 0xF523u,
+        0x92F7u, 0x38A6u, 0xD674u, 0x7C25u, 0x1D86u, 0xB7D7u, 0x5905u, 0xF354u, 0x9480u, 0x3ED1u, 0xD003u, 0x7A52u,
+        0x1FABu, 0xB5FAu, 0x5B28u, 0xF179u, 0x96ADu, 0x3CFCu, 0xD22Eu, 0x787Fu, 0x22D0u, 0x8881u, 0x6653u, 0xCC02u,
+        0xABD6u, 0x0187u, 0xEF55u, 0x4504u, 0x20FDu, 0x8AACu, 0x647Eu, 0xCE2Fu, 0xA9FBu, 0x03AAu, 0xED78u, 0x4729u,
+        0x268Au, 0x8CDBu, 0x6209u, 0xC858u, 0xAF8Cu, 0x05DDu, 0xEB0Fu, 0x415Eu, 0x24A7u, 0x8EF6u, 0x6024u, 0xCA75u,
+        0xADA1u, 0x07F0u, 0xE922u, 0x4373u, 0x2A64u, 0x8035u, 0x6EE7u, 0xC4B6u, 0xA362u, 0x0933u, 0xE7E1u, 0x4DB0u,
+        0x2849u, 0x8218u, 0x6CCAu, 0xC69Bu, 0xA14Fu, 0x0B1Eu, 0xE5CCu, 0x4F9Du, 0x2E3Eu, 0x846Fu, 0x6ABDu, 0xC0ECu,
+        0xA738u, 0x0D69u, 0xE3BBu, 0x49EAu, 0x2C13u, 0x8642u, 0x6890u, 0xC2C1u, 0xA515u, 0x0F44u, 0xE196u, 0x4BC7u,
+        0x33B8u, 0x99E9u, 0x773Bu, 0xDD6Au, 0xBABEu, 0x10EFu, 0xFE3Du, 0x546Cu, 0x3195u, 0x9BC4u, 0x7516u, 0xDF47u,
+        0xB893u, 0x12C2u, 0xFC10u, 0x5641u, 0x37E2u, 0x9DB3u, 0x7361u, 0xD930u, 0xBEE4u, 0x14B5u, 0xFA67u, 0x5036u,
+        0x35CFu, 0x9F9Eu, 0x714Cu, 0xDB1Du, 0xBCC9u, 0x1698u, 0xF84Au, 0x521Bu, 0x3B0Cu, 0x915Du, 0x7F8Fu, 0xD5DEu,
+        0xB20Au, 0x185Bu, 0xF689u, 0x5CD8u, 0x3921u, 0x9370u, 0x7DA2u, 0xD7F3u, 0xB027u, 0x1A76u, 0xF4A4u, 0x5EF5u,
+        0x3F56u, 0x9507u, 0x7BD5u, 0xD184u, 0xB650u, 0x1C01u, 0xF2D3u, 0x5882u, 0x3D7Bu, 0x972Au, 0x79F8u, 0xD3A9u,
+        0xB47Du, 0x1E2Cu, 0xF0FEu, 0x5AAFu
+    },
+    {
+        0x0000u, 0x45A0u, 0x8B40u, 0xCEE0u, 0x06A1u, 0x4301u, 0x8DE1u, 0xC841u, 0x0D42u, 0x48E2u, 0x8602u, 0xC3A2u,
+        0x0BE3u, 0x4E43u, 0x80A3u, 0xC503u, 0x1A84u, 0x5F24u, 0x91C4u, 0xD464u, 0x1C25u, 0x5985u, 0x9765u, 0xD2C5u,
+        0x17C6u, 0x5266u, 0x9C86u, 0xD926u, 0x1167u, 0x54C7u, 0x9A27u, 0xDF87u, 0x3508u, 0x70A8u, 0xBE48u, 0xFBE8u,
+        0x33A9u, 0x7609u, 0xB8E9u, 0xFD49u, 0x384Au, 0x7DEAu, 0xB30Au, 0xF6AAu, 0x3EEBu, 0x7B4Bu, 0xB5ABu, 0xF00Bu,
+        0x2F8Cu, 0x6A2Cu, 0xA4CCu, 0xE16Cu, 0x292Du, 0x6C8Du, 0xA26Du, 0xE7CDu, 0x22CEu, 0x676Eu, 0xA98Eu, 0xEC2Eu,
+        0x246Fu, 0x61CFu, 0xAF2Fu, 0xEA8Fu, 0x6A10u, 0x2FB0u, 0xE150u, 0xA4F0u, 0x6CB1u, 0x2911u, 0xE7F1u, 0xA251u,
+        0x6752u, 0x22F2u, 0xEC12u, 0xA9B2u, 0x61F3u, 0x2453u, 0xEAB3u, 0xAF13u, 0x7094u, 0x3534u, 0xFBD4u, 0xBE74u,
+        0x7635u, 0x3395u, 0xFD75u, 0xB8D5u, 0x7DD6u, 0x3876u, 0xF696u, 0xB336u, 0x7B77u, 0x3ED7u, 0xF037u, 0xB597u,
+        0x5F18u, 0x1AB8u, 0xD458u, 0x91F8u, 0x59B9u, 0x1C19u, 0xD2F9u, 0x9759u, 0x525Au, 0x17FAu, 0xD91Au, 0x9CBAu,
+        0x54FBu, 0x115Bu, 0xDFBBu, 0x9A1Bu, 0x459Cu, 0x003Cu, 0xCEDCu, 0x8B7Cu, 0x433Du, 0x069Du, 0xC87Du, 0x8DDDu,
+        0x48DEu, 0x0D7Eu, 0xC39Eu, 0x863Eu, 0x4E7Fu, 0x0BDFu, 0xC53Fu, 0x809Fu, 0xD420u, 0x9180u, 0x5F60u, 0x1AC0u,
+        0xD281u, 0x9721u, 0x59C1u, 0x1C61u, 0xD962u, 0x9CC2u, 0x5222u, 0x1782u, 0xDFC3u, 0x9A63u, 0x5483u, 0x1123u,
+        0xCEA4u, 0x8B04u, 0x45E4u, 0x0044u, 0xC805u, 0x8DA5u, 0x4345u, 0x06E5u, 0xC3E6u, 0x8646u, 0x48A6u, 0x0D06u,
+        0xC547u, 0x80E7u, 0x4E07u, 0x0BA7u, 0xE128u, 0xA488u, 0x6A68u, 0x2FC8u, 0xE789u, 0xA229u, 0x6CC9u, 0x2969u,
+        0xEC6Au, 0xA9CAu, 0x672Au, 0x228Au, 0xEACBu, 0xAF6Bu, 0x618Bu, 0x242Bu, 0xFBACu, 0xBE0Cu, 0x70ECu, 0x354Cu,
+        0xFD0Du, 0xB8ADu, 0x764Du, 0x33EDu, 0xF6EEu, 0xB34Eu, 0x7DAEu, 0x380Eu, 0xF04Fu, 0xB5EFu, 0x7B0Fu, 0x3EAFu,
+        0xBE30u, 0xFB90u, 0x3570u, 0x70D0u, 0xB891u, 0xFD31u, 0x33D1u, 0x7671u, 0xB372u, 0xF6D2u, 0x3832u, 0x7D92u,
+        0xB5D3u, 0xF073u, 0x3E93u, 0x7B33u, 0xA4B4u, 0xE114u, 0x2FF4u, 0x6A54u, 0xA215u, 0xE7B5u, 0x2955u, 0x6CF5u,
+        0xA9F6u, 0xEC56u, 0x22B6u, 0x6716u, 0xAF57u, 0xEAF7u, 0x2417u, 0x61B7u, 0x8B38u, 0xCE98u, 0x0078u, 0x45D8u,
+        0x8D99u, 0xC839u, 0x06D9u, 0x4379u, 0x867Au, 0xC3DAu, 0x0D3Au, 0x489Au, 0x80DBu, 0xC57Bu, 0x0B9Bu, 0x4E3Bu,
+        0x91BCu, 0xD41Cu, 0x1AFCu, 0x5F5Cu, 0x971Du, 0xD2BDu, 0x1C5Du, 0x59FDu, 0x9CFEu, 0xD95Eu, 0x17BEu, 0x521Eu,
+        0x9A5Fu, 0xDFFFu, 0x111Fu, 0x54BFu
+    },
+    {
+        0x0000u, 0xB861u, 0x60E3u, 0xD882u, 0xC1C6u, 0x79A7u, 0xA125u, 0x1944u, 0x93ADu, 0x2BCCu, 0xF34Eu, 0x4B2Fu,
+        0x526Bu, 0xEA0Au, 0x3288u, 0x8AE9u, 0x377Bu, 0x8F1Au, 0x5798u, 0xEFF9u, 0xF6BDu, 0x4EDCu, 0x965Eu, 0x2E3Fu,
+        0xA4D6u, 0x1CB7u, 0xC435u, 0x7C54u, 0x6510u, 0xDD71u, 0x05F3u, 0xBD92u, 0x6EF6u, 0xD697u, 0x0E15u, 0xB674u,
+        0xAF30u, 0x1751u, 0xCFD3u, 0x77B2u, 0xFD5Bu, 0x453Au, 0x9DB8u, 0x25D9u, 0x3C9Du, 0x84FCu, 0x5C7Eu, 0xE41Fu,
+        0x598Du, 0xE1ECu, 0x396Eu, 0x810Fu, 0x984Bu, 0x202Au, 0xF8A8u, 0x40C9u, 0xCA20u, 0x7241u, 0xAAC3u, 0x12A2u,
+        0x0BE6u, 0xB387u, 0x6B05u, 0xD364u, 0xDDECu, 0x658Du, 0xBD0Fu, 0x056Eu, 0x1C2Au, 0xA44Bu, 0x7CC9u, 0xC4A8u,
+        0x4E41u, 0xF620u, 0x2EA2u, 0x96C3u, 0x8F87u, 0x37E6u, 0xEF64u, 0x5705u, 0xEA97u, 0x52F6u, 0x8A74u, 0x3215u,
+        0x2B51u, 0x9330u, 0x4BB2u, 0xF3D3u, 0x793Au, 0xC15Bu, 0x19D9u, 0xA1B8u, 0xB8FCu, 0x009Du, 0xD81Fu, 0x607Eu,
+        0xB31Au, 0x0B7Bu, 0xD3F9u, 0x6B98u, 0x72DCu, 0xCABDu, 0x123Fu, 0xAA5Eu, 0x20B7u, 0x98D6u, 0x4054u, 0xF835u,
+        0xE171u, 0x5910u, 0x8192u, 0x39F3u, 0x8461u, 0x3C00u, 0xE482u, 0x5CE3u, 0x45A7u, 0xFDC6u, 0x2544u, 0x9D25u,
+        0x17CCu, 0xAFADu, 0x772Fu, 0xCF4Eu, 0xD60Au, 0x6E6Bu, 0xB6E9u, 0x0E88u, 0xABF9u, 0x1398u, 0xCB1Au, 0x737Bu,
+        0x6A3Fu, 0xD25Eu, 0x0ADCu, 0xB2BDu, 0x3854u, 0x8035u, 0x58B7u, 0xE0D6u, 0xF992u, 0x41F3u, 0x9971u, 0x2110u,
+        0x9C82u, 0x24E3u, 0xFC61u, 0x4400u, 0x5D44u, 0xE525u, 0x3DA7u, 0x85C6u, 0x0F2Fu, 0xB74Eu, 0x6FCCu, 0xD7ADu,
+        0xCEE9u, 0x7688u, 0xAE0Au, 0x166Bu, 0xC50Fu, 0x7D6Eu, 0xA5ECu, 0x1D8Du, 0x04C9u, 0xBCA8u, 0x642Au, 0xDC4Bu,
+        0x56A2u, 0xEEC3u, 0x3641u, 0x8E20u, 0x9764u, 0x2F05u, 0xF787u, 0x4FE6u, 0xF274u, 0x4A15u, 0x9297u, 0x2AF6u,
+        0x33B2u, 0x8BD3u, 0x5351u, 0xEB30u, 0x61D9u, 0xD9B8u, 0x013Au, 0xB95Bu, 0xA01Fu, 0x187Eu, 0xC0FCu, 0x789Du,
+        0x7615u, 0xCE74u, 0x16F6u, 0xAE97u, 0xB7D3u, 0x0FB2u, 0xD730u, 0x6F51u, 0xE5B8u, 0x5DD9u, 0x855Bu, 0x3D3Au,
+        0x247Eu, 0x9C1Fu, 0x449Du, 0xFCFCu, 0x416Eu, 0xF90Fu, 0x218Du, 0x99ECu, 0x80A8u, 0x38C9u, 0xE04Bu, 0x582Au,
+        0xD2C3u, 0x6AA2u, 0xB220u, 0x0A41u, 0x1305u, 0xAB64u, 0x73E6u, 0xCB87u, 0x18E3u, 0xA082u, 0x7800u, 0xC061u,
+        0xD925u, 0x6144u, 0xB9C6u, 0x01A7u, 0x8B4Eu, 0x332Fu, 0xEBADu, 0x53CCu, 0x4A88u, 0xF2E9u, 0x2A6Bu, 0x920Au,
+        0x2F98u, 0x97F9u, 0x4F7Bu, 0xF71Au, 0xEE5Eu, 0x563Fu, 0x8EBDu, 0x36DCu, 0xBC35u, 0x0454u, 0xDCD6u, 0x64B7u,
+        0x7DF3u, 0xC592u, 0x1D10u, 0xA571u
+    },
+    {
+        0x0000u, 0x47D3u, 0x8FA6u, 0xC875u, 0x0F6Du, 0x48BEu, 0x80CBu, 0xC718u, 0x1EDAu, 0x5909u, 0x917Cu, 0xD6AFu,
+        0x11B7u, 0x5664u, 0x9E11u, 0xD9C2u, 0x3DB4u, 0x7A67u, 0xB212u, 0xF5C1u, 0x32D9u, 0x750Au, 0xBD7Fu, 0xFAACu,
+        0x236Eu, 0x64BDu, 0xACC8u, 0xEB1Bu, 0x2C03u, 0x6BD0u, 0xA3A5u, 0xE476u, 0x7B68u, 0x3CBBu, 0xF4CEu, 0xB31Du,
+        0x7405u, 0x33D6u, 0xFBA3u, 0xBC70u, 0x65B2u, 0x2261u, 0xEA14u, 0xADC7u, 0x6ADFu, 0x2D0Cu, 0xE579u, 0xA2AAu,
+        0x46DCu, 0x010Fu, 0xC97Au, 0x8EA9u, 0x49B1u, 0x0E62u, 0xC617u, 0x81C4u, 0x5806u, 0x1FD5u, 0xD7A0u, 0x9073u,
+        0x576Bu, 0x10B8u, 0xD8CDu, 0x9F1Eu, 0xF6D0u, 0xB103u, 0x7976u, 0x3EA5u, 0xF9BDu, 0xBE6Eu, 0x761Bu, 0x31C8u,
+        0xE80Au, 0xAFD9u, 0x67ACu, 0x207Fu, 0xE767u, 0xA0B4u, 0x68C1u, 0x2F12u, 0xCB64u, 0x8CB7u, 0x44C2u, 0x0311u,
+        0xC409u, 0x83DAu, 0x4BAFu, 0x0C7Cu, 0xD5BEu, 0x926Du, 0x5A18u, 0x1DCBu, 0xDAD3u, 0x9D00u, 0x5575u, 0x12A6u,
+        0x8DB8u, 0xCA6Bu, 0x021Eu, 0x45CDu, 0x82D5u, 0xC506u, 0x0D73u, 0x4AA0u, 0x9362u, 0xD4B1u, 0x1CC4u, 0x5B17u,
+        0x9C0Fu, 0xDBDCu, 0x13A9u, 0x547Au, 0xB00Cu, 0xF7DFu, 0x3FAAu, 0x7879u, 0xBF61u, 0xF8B2u, 0x30C7u, 0x7714u,
+        0xAED6u, 0xE905u, 0x2170u, 0x66A3u, 0xA1BBu, 0xE668u, 0x2E1Du, 0x69CEu, 0xFD81u, 0xBA52u, 0x7227u, 0x35F4u,
+        0xF2ECu, 0xB53Fu, 0x7D4Au, 0x3A99u, 0xE35Bu, 0xA488u, 0x6CFDu, 0x2B2Eu, 0xEC36u, 0xABE5u, 0x6390u, 0x2443u,
+        0xC035u, 0x87E6u, 0x4F93u, 0x0840u, 0xCF58u, 0x888Bu, 0x40FEu, 0x072Du, 0xDEEFu, 0x993Cu, 0x5149u, 0x169Au,
+        0xD182u, 0x9651u, 0x5E24u, 0x19F7u, 0x86E9u, 0xC13Au, 0x094Fu, 0x4E9Cu, 0x8984u, 0xCE57u, 0x0622u, 0x41F1u,
+        0x9833u, 0xDFE0u, 0x1795u, 0x5046u, 0x975Eu, 0xD08Du, 0x18F8u, 0x5F2Bu, 0xBB5Du, 0xFC8Eu, 0x34FBu, 0x7328u,
+        0xB430u, 0xF3E3u, 0x3B96u, 0x7C45u, 0xA587u, 0xE254u, 0x2A21u, 0x6DF2u, 0xAAEAu, 0xED39u, 0x254Cu, 0x629Fu,
+        0x0B51u, 0x4C82u, 0x84F7u, 0xC324u, 0x043Cu, 0x43EFu, 0x8B9Au, 0xCC49u, 0x158Bu, 0x5258u, 0x9A2Du, 0xDDFEu,
+        0x1AE6u, 0x5D35u, 0x9540u, 0xD293u, 0x36E5u, 0x7136u, 0xB943u, 0xFE90u, 0x3988u, 0x7E5Bu, 0xB62Eu, 0xF1FDu,
+        0x283Fu, 0x6FECu, 0xA799u, 0xE04Au, 0x2752u, 0x6081u, 0xA8F4u, 0xEF27u, 0x7039u, 0x37EAu, 0xFF9Fu, 0xB84Cu,
+        0x7F54u, 0x3887u, 0xF0F2u, 0xB721u, 0x6EE3u, 0x2930u, 0xE145u, 0xA696u, 0x618Eu, 0x265Du, 0xEE28u, 0xA9FBu,
+        0x4D8Du, 0x0A5Eu, 0xC22Bu, 0x85F8u, 0x42E0u, 0x0533u, 0xCD46u, 0x8A95u, 0x5357u, 0x1484u, 0xDCF1u, 0x9B22u,
+        0x5C3Au, 0x1BE9u, 0xD39Cu, 0x944Fu
+    }
+};
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | Generated Crc_Tables.c                                                       |
+***********************************************************************************************************************/
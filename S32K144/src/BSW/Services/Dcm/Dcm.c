@@ -0,0 +1,840 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Dcm.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Dcm.c
+    UDS server. One request is served at a time: Dcm_RxIndication keeps the MemPool block CanTp
+    reassembled the request in, Dcm_MainFunction answers it. Responses are a short head plus data sent
+    in place by CanTp, either a MemPool block (read data by identifier) or the memory itself (read memory
+    by address), so no response is copied before segmentation.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Dcm.h"
+#include "CanTp.h"
+#include "Timer.h"
+#include "Trace.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Negative response codes*/
+#define DCM_NRC_SERVICE_NOT_SUPPORTED       (0x11u)
+#define DCM_NRC_SUBFUNCTION_NOT_SUPPORTED   (0x12u)
+#define DCM_NRC_INCORRECT_LENGTH            (0x13u)
+#define DCM_NRC_RESPONSE_TOO_LONG           (0x14u)
+#define DCM_NRC_CONDITIONS_NOT_CORRECT      (0x22u)
+#define DCM_NRC_REQUEST_SEQUENCE_ERROR      (0x24u)
+#define DCM_NRC_REQUEST_OUT_OF_RANGE        (0x31u)
+#define DCM_NRC_DOWNLOAD_NOT_ACCEPTED       (0x70u)
+#define DCM_NRC_PROGRAMMING_FAILURE         (0x72u)
+#define DCM_NRC_WRONG_BLOCK_SEQUENCE        (0x73u)
+#define DCM_NRC_RESPONSE_PENDING            (0x78u)         /*Handler not done, called again*/
+#define DCM_NRC_SERVICE_NOT_IN_SESSION      (0x7Fu)
+
+#define DCM_NEGATIVE_RESPONSE               (0x7Fu)
+#define DCM_POSITIVE_RESPONSE               (0x40u)         /*Added to the service id*/
+#define DCM_SUPPRESS_POSITIVE               (0x80u)         /*Sub-function bit*/
+
+/*Session control timings: P2 50 ms (1 ms units), P2* 5000 ms (10 ms units)*/
+#define DCM_P2_MS                           (50u)
+#define DCM_P2_EXT_10MS                     (500u)
+
+/*Routine control sub-functions*/
+#define DCM_ROUTINE_START                   (0x01u)
+#define DCM_ROUTINE_RESULTS                 (0x03u)
+
+/*ECU reset sub-functions*/
+#define DCM_RESET_HARD                      (0x01u)
+
+/*Request download: no compression nor encryption or delta image (compressionMethod 1, tools/DeltaGen),
+  maxNumberOfBlockLength in 2 bytes*/
+#define DCM_DATA_FORMAT_PLAIN               (0x00u)
+#define DCM_DATA_FORMAT_DELTA               (0x10u)
+#define DCM_BLOCK_LENGTH_FORMAT             (0x20u)
+
+typedef u8bit (*Dcm_HandlerType)(const u8bit * request, u16bit length);
+
+typedef struct
+{
+    u8bit           sid;
+    u8bit           sessions;
+    Dcm_HandlerType handler;
+} Dcm_ServiceType;
+
+typedef struct
+{
+    u16bit id;
+    u16bit length;
+    void   (*read)(u8bit * data);
+    u8bit  (*write)(const u8bit * data);
+    u8bit  writeSessions;
+} Dcm_DidType;
+
+typedef struct
+{
+    u16bit id;
+    u8bit  (*start)(const u8bit * options, u16bit length);
+    u8bit  (*results)(u8bit * status, u8bit * count);
+} Dcm_RoutineType;
+
+typedef struct
+{
+    u32bit start;
+    u32bit size;
+} Dcm_MemoryType;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static u8bit Dcm_SessionControl(const u8bit * request, u16bit length);
+static u8bit Dcm_EcuReset(const u8bit * request, u16bit length);
+static u8bit Dcm_TesterPresent(const u8bit * request, u16bit length);
+static u8bit Dcm_ReadDataById(const u8bit * request, u16bit length);
+static u8bit Dcm_WriteDataById(const u8bit * request, u16bit length);
+static u8bit Dcm_RoutineControl(const u8bit * request, u16bit length);
+static u8bit Dcm_ReadMemoryByAddress(const u8bit * request, u16bit length);
+#if (DCM_CFG_DOWNLOAD == 1u)
+static u8bit Dcm_RequestDownload(const u8bit * request, u16bit length);
+static u8bit Dcm_TransferData(const u8bit * request, u16bit length);
+static u8bit Dcm_RequestTransferExit(const u8bit * request, u16bit length);
+#endif
+static u8bit Dcm_Dispatch(const u8bit * request, u16bit length);
+static void  Dcm_Pending(void);
+static const Dcm_DidType * Dcm_FindDid(u16bit id);
+static void  Dcm_Release(void);
+static void  Dcm_S3Expired(void * arg);
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+#define DCM_SERVICE_CFG(sid, handler, sessions)                 { (sid), (u8bit)(sessions), (handler) },
+#define DCM_DID_CFG(id, length, read, write, writeSessions)     { (id), (length), (read), (write), (writeSessions) },
+#define DCM_ROUTINE_CFG(id, start, results)                     { (id), (start), (results) },
+#define DCM_MEMORY_CFG(start, size)                             { (start), (size) },
+
+static const Dcm_ServiceType Dcm_Services[] = { DCM_CFG_SERVICES(DCM_SERVICE_CFG) };
+static const Dcm_DidType     Dcm_Dids[]     = { DCM_CFG_DIDS(DCM_DID_CFG) };
+static const Dcm_RoutineType Dcm_Routines[] = { DCM_CFG_ROUTINES(DCM_ROUTINE_CFG) };
+static const Dcm_MemoryType  Dcm_Memory[]   = { DCM_CFG_MEMORY(DCM_MEMORY_CFG) };
+
+#define DCM_NUM_SERVICES    (sizeof(Dcm_Services) / sizeof(Dcm_Services[0]))
+#define DCM_NUM_DIDS        (sizeof(Dcm_Dids) / sizeof(Dcm_Dids[0]))
+#define DCM_NUM_ROUTINES    (sizeof(Dcm_Routines) / sizeof(Dcm_Routines[0]))
+#define DCM_NUM_MEMORY      (sizeof(Dcm_Memory) / sizeof(Dcm_Memory[0]))
+
+static u8bit * Dcm_Request = NULL;              /*Pending request, MemPool block from CanTp*/
+static u16bit  Dcm_RequestLength;
+static volatile boolean Dcm_Sending = FALSE;    /*CanTp sending a response, final or pending*/
+static volatile u8bit Dcm_Session = DCM_SESSION_DEFAULT;
+
+/*Request being served, kept while its handler answers response pending*/
+static u8bit * Dcm_Serving = NULL;
+static u16bit  Dcm_ServingLength;
+static boolean Dcm_RequestTaken;                /*Block handed over by the handler, not freed by Dcm*/
+static u16bit  Dcm_PendingCalls;
+static u16bit  Dcm_PendingLimit;                /*Calls before the next response pending, P2 then P2**/
+static volatile boolean Dcm_ResetPending = FALSE;
+
+/*Download in progress, the block sequence counter expected next and whether a block of this transfer was
+  programmed already (only then is the previous counter a repeat)*/
+static boolean Dcm_Downloading = FALSE;
+#if (DCM_CFG_DOWNLOAD == 1u)
+static u8bit   Dcm_BlockCounter;
+static boolean Dcm_BlockAccepted;
+#endif
+
+/*Response of the request being served*/
+static u8bit         Dcm_Head[CANTP_MAX_HEAD];
+static u8bit         Dcm_HeadLength;
+static const u8bit * Dcm_Data;
+static u16bit        Dcm_DataLength;
+static u8bit *       Dcm_Block;                 /*MemPool block of Dcm_Data, freed once sent*/
+static boolean       Dcm_Suppress;              /*Positive response not wanted*/
+
+TIMER_DEFINE(Dcm_S3Timer, Dcm_S3Expired, NULL, TIMER_MODE_TICK);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+static inline u16bit Dcm_Get16(const u8bit * data)
+{
+    return (u16bit)(((u16bit)data[0] << 8) | data[1]);
+}
+
+static inline void Dcm_Put16(u8bit * data, u16bit value)
+{
+    data[0] = (u8bit)(value >> 8);
+    data[1] = (u8bit)value;
+}
+
+/*
+ * Big endian value of 1 to 4 bytes.
+ */
+static inline u32bit Dcm_GetN(const u8bit * data, u32bit bytes)
+{
+    u32bit value = 0u;
+    u32bit i;
+
+    for (i = 0u; i < bytes; i++)
+    {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * 0x10: session change, the timings go in the head.
+ */
+static u8bit Dcm_SessionControl(const u8bit * request, u16bit length)
+{
+    u8bit session;
+    u8bit nrc = DCM_NRC_INCORRECT_LENGTH;
+
+    if (length == 2u)
+    {
+        session = request[1] & (u8bit)~DCM_SUPPRESS_POSITIVE;
+        if ((session == 0u) || ((DCM_SESSION_MASK(session) & DCM_SESSION_ALL) == 0u))
+        {
+            nrc = DCM_NRC_SUBFUNCTION_NOT_SUPPORTED;
+        }
+        else
+        {
+            Dcm_Session = session;
+            Dcm_Downloading = FALSE;
+            Dcm_Suppress = ((request[1] & DCM_SUPPRESS_POSITIVE) != 0u) ? TRUE : FALSE;
+            Dcm_Head[1] = session;
+            Dcm_Put16(&Dcm_Head[2], DCM_P2_MS);
+            Dcm_Put16(&Dcm_Head[4], DCM_P2_EXT_10MS);
+            Dcm_HeadLength = 6u;
+            nrc = 0u;
+        }
+    }
+    return nrc;
+}
+
+/*
+ * 0x11: hard reset, done once the positive response is sent.
+ */
+static u8bit Dcm_EcuReset(const u8bit * request, u16bit length)
+{
+    u8bit nrc = DCM_NRC_INCORRECT_LENGTH;
+
+    if (length == 2u)
+    {
+        if ((request[1] & (u8bit)~DCM_SUPPRESS_POSITIVE) != DCM_RESET_HARD)
+        {
+            nrc = DCM_NRC_SUBFUNCTION_NOT_SUPPORTED;
+        }
+        else
+        {
+            Dcm_Suppress = ((request[1] & DCM_SUPPRESS_POSITIVE) != 0u) ? TRUE : FALSE;
+            Dcm_ResetPending = TRUE;
+            Dcm_Head[1] = DCM_RESET_HARD;
+            Dcm_HeadLength = 2u;
+            nrc = 0u;
+        }
+    }
+    return nrc;
+}
+
+/*
+ * 0x3E: only keeps the session alive, done by Dcm_MainFunction for every request.
+ */
+static u8bit Dcm_TesterPresent(const u8bit * request, u16bit length)
+{
+    u8bit nrc = DCM_NRC_INCORRECT_LENGTH;
+
+    if (length == 2u)
+    {
+        if ((request[1] & (u8bit)~DCM_SUPPRESS_POSITIVE) != 0u)
+        {
+            nrc = DCM_NRC_SUBFUNCTION_NOT_SUPPORTED;
+        }
+        else
+        {
+            Dcm_Suppress = ((request[1] & DCM_SUPPRESS_POSITIVE) != 0u) ? TRUE : FALSE;
+            Dcm_Head[1] = 0u;
+            Dcm_HeadLength = 2u;
+            nrc = 0u;
+        }
+    }
+    return nrc;
+}
+
+static const Dcm_DidType * Dcm_FindDid(u16bit id)
+{
+    const Dcm_DidType * did = NULL;
+    u32bit i;
+
+    for (i = 0u; (i < DCM_NUM_DIDS) && (did == NULL); i++)
+    {
+        if (Dcm_Dids[i].id == id)
+        {
+            did = &Dcm_Dids[i];
+        }
+    }
+    return did;
+}
+
+/*
+ * 0x22: the records of the supported identifiers, unknown ones are skipped. They are read straight into
+ * the MemPool block CanTp sends from.
+ */
+static u8bit Dcm_ReadDataById(const u8bit * request, u16bit length)
+{
+    const Dcm_DidType * did;
+    u32bit total = 0u;
+    u32bit pos;
+    u32bit i;
+    u8bit nrc = DCM_NRC_INCORRECT_LENGTH;
+
+    if ((length >= 3u) && ((length & 1u) != 0u))
+    {
+        for (i = 1u; i < length; i += 2u)
+        {
+            did = Dcm_FindDid(Dcm_Get16(&request[i]));
+            total += (did != NULL) ? (2u + did->length) : 0u;
+        }
+
+        if (total == 0u)
+        {
+            nrc = DCM_NRC_REQUEST_OUT_OF_RANGE;
+        }
+        else if ((1u + total) > CANTP_MAX_LENGTH)
+        {
+            nrc = DCM_NRC_RESPONSE_TOO_LONG;
+        }
+        else
+        {
+            Dcm_Block = (u8bit *)MemPool_Alloc(total);
+            if (Dcm_Block == NULL)
+            {
+                nrc = DCM_NRC_CONDITIONS_NOT_CORRECT;
+            }
+            else
+            {
+                pos = 0u;
+                for (i = 1u; i < length; i += 2u)
+                {
+                    did = Dcm_FindDid(Dcm_Get16(&request[i]));
+                    if (did != NULL)
+                    {
+                        Dcm_Put16(&Dcm_Block[pos], did->id);
+                        did->read(&Dcm_Block[pos + 2u]);
+                        pos += 2u + did->length;
+                    }
+                }
+                Dcm_HeadLength = 1u;
+                Dcm_Data = Dcm_Block;
+                Dcm_DataLength = (u16bit)total;
+                nrc = 0u;
+            }
+        }
+    }
+    return nrc;
+}
+
+/*
+ * 0x2E: whole record of a writable identifier, in one of its write sessions.
+ */
+static u8bit Dcm_WriteDataById(const u8bit * request, u16bit length)
+{
+    const Dcm_DidType * did = NULL;
+    u8bit nrc = DCM_NRC_INCORRECT_LENGTH;
+
+    if (length >= 3u)
+    {
+        did = Dcm_FindDid(Dcm_Get16(&request[1]));
+        if ((did == NULL) || (did->write == NULL) || ((did->writeSessions & DCM_SESSION_MASK(Dcm_Session)) == 0u))
+        {
+            nrc = DCM_NRC_REQUEST_OUT_OF_RANGE;
+        }
+        else if (length == (3u + did->length))
+        {
+            nrc = did->write(&request[3]);
+            Dcm_Head[1] = request[1];
+            Dcm_Head[2] = request[2];
+            Dcm_HeadLength = 3u;
+        }
+        else
+        {
+        }
+    }
+    return nrc;
+}
+
+/*
+ * 0x31: start a routine or get its results, status bytes in the head.
+ */
+static u8bit Dcm_RoutineControl(const u8bit * request, u16bit length)
+{
+    const Dcm_RoutineType * routine = NULL;
+    u8bit subFunction;
+    u8bit count = 0u;
+    u32bit i;
+    u8bit nrc = DCM_NRC_INCORRECT_LENGTH;
+
+    if (length >= 4u)
+    {
+        subFunction = request[1] & (u8bit)~DCM_SUPPRESS_POSITIVE;
+        for (i = 0u; (i < DCM_NUM_ROUTINES) && (routine == NULL); i++)
+        {
+            if (Dcm_Routines[i].id == Dcm_Get16(&request[2]))
+            {
+                routine = &Dcm_Routines[i];
+            }
+        }
+
+        if ((subFunction != DCM_ROUTINE_START) && (subFunction != DCM_ROUTINE_RESULTS))
+        {
+            nrc = DCM_NRC_SUBFUNCTION_NOT_SUPPORTED;
+        }
+        else if (routine == NULL)
+        {
+            nrc = DCM_NRC_REQUEST_OUT_OF_RANGE;
+        }
+        else if (subFunction == DCM_ROUTINE_START)
+        {
+            nrc = routine->start(&request[4], length - 4u);
+        }
+        else if (length == 4u)
+        {
+            nrc = routine->results(&Dcm_Head[4], &count);
+        }
+        else
+        {
+        }
+
+        if (nrc == 0u)
+        {
+            Dcm_Suppress = ((request[1] & DCM_SUPPRESS_POSITIVE) != 0u) ? TRUE : FALSE;
+            Dcm_Head[1] = subFunction;
+            Dcm_Head[2] = request[2];
+            Dcm_Head[3] = request[3];
+            Dcm_HeadLength = 4u + ((count > DCM_ROUTINE_STATUS_MAX) ? DCM_ROUTINE_STATUS_MAX : count);
+        }
+    }
+    return nrc;
+}
+
+/*
+ * 0x23: address and size of 1 to 4 bytes each (addressAndLengthFormatIdentifier), inside one of the
+ * readable areas. CanTp segments the memory in place.
+ */
+static u8bit Dcm_ReadMemoryByAddress(const u8bit * request, u16bit length)
+{
+    u32bit addressBytes;
+    u32bit sizeBytes;
+    u32bit address;
+    u32bit size;
+    u32bit i;
+    u8bit nrc = DCM_NRC_INCORRECT_LENGTH;
+
+    if (length >= 2u)
+    {
+        addressBytes = request[1] & 0x0Fu;
+        sizeBytes = (u32bit)request[1] >> 4;
+        if ((addressBytes == 0u) || (addressBytes > 4u) || (sizeBytes == 0u) || (sizeBytes > 4u))
+        {
+            nrc = DCM_NRC_REQUEST_OUT_OF_RANGE;
+        }
+        else if (length == (2u + addressBytes + sizeBytes))
+        {
+            address = Dcm_GetN(&request[2], addressBytes);
+            size = Dcm_GetN(&request[2u + addressBytes], sizeBytes);
+
+            nrc = DCM_NRC_REQUEST_OUT_OF_RANGE;
+            for (i = 0u; (i < DCM_NUM_MEMORY) && (nrc != 0u); i++)
+            {
+                if ((size != 0u) && (address >= Dcm_Memory[i].start) && (size <= Dcm_Memory[i].size) &&
+                    ((address - Dcm_Memory[i].start) <= (Dcm_Memory[i].size - size)))
+                {
+                    nrc = 0u;
+                }
+            }
+            if ((nrc == 0u) && ((1u + size) > CANTP_MAX_LENGTH))
+            {
+                nrc = DCM_NRC_RESPONSE_TOO_LONG;
+            }
+            else if (nrc == 0u)
+            {
+                Dcm_HeadLength = 1u;
+                Dcm_Data = DCM_CFG_MEMORY_PTR(address);
+                Dcm_DataLength = (u16bit)size;
+            }
+            else
+            {
+            }
+        }
+        else
+        {
+        }
+    }
+    return nrc;
+}
+
+#if (DCM_CFG_DOWNLOAD == 1u)
+/*
+ * 0x34: plain or delta image of the whole application from its start, see Boot_Start. The size is the one
+ * of the image programmed. The blocks accepted hold BOOT_CFG_BLOCK_SIZE bytes of data.
+ */
+static u8bit Dcm_RequestDownload(const u8bit * request, u16bit length)
+{
+    u32bit addressBytes;
+    u32bit sizeBytes;
+    u8bit nrc = DCM_NRC_INCORRECT_LENGTH;
+
+    if (length >= 3u)
+    {
+        addressBytes = request[2] & 0x0Fu;
+        sizeBytes = (u32bit)request[2] >> 4;
+        if (((request[1] != DCM_DATA_FORMAT_PLAIN) && (request[1] != DCM_DATA_FORMAT_DELTA)) || (addressBytes == 0u) || (addressBytes > 4u) ||
+            (sizeBytes == 0u) || (sizeBytes > 4u))
+        {
+            nrc = DCM_NRC_REQUEST_OUT_OF_RANGE;
+        }
+        else if (length != (3u + addressBytes + sizeBytes))
+        {
+        }
+        else if (Boot_Start(Dcm_GetN(&request[3], addressBytes), Dcm_GetN(&request[3u + addressBytes], sizeBytes),
+                            (request[1] == DCM_DATA_FORMAT_DELTA) ? TRUE : FALSE) == FALSE)
+        {
+            nrc = DCM_NRC_DOWNLOAD_NOT_ACCEPTED;
+        }
+        else
+        {
+            Dcm_Downloading = TRUE;
+            Dcm_BlockCounter = 1u;
+            Dcm_BlockAccepted = FALSE;
+            Dcm_Head[1] = DCM_BLOCK_LENGTH_FORMAT;
+            Dcm_Put16(&Dcm_Head[2], BOOT_CFG_BLOCK_SIZE + 2u);
+            Dcm_HeadLength = 4u;
+            nrc = 0u;
+        }
+    }
+    return nrc;
+}
+
+/*
+ * 0x36: the request block itself goes to Boot_Write, the response is sent while it is programmed so the
+ * next block arrives in the other MemPool block. Response pending while the previous block is still being
+ * programmed. A repeated block (lost response) is confirmed again without programming it, counter 0 before
+ * the first block is a wrong sequence.
+ */
+static u8bit Dcm_TransferData(const u8bit * request, u16bit length)
+{
+    u8bit result;
+    u8bit nrc = DCM_NRC_INCORRECT_LENGTH;
+
+    if (length >= 3u)
+    {
+        if (Dcm_Downloading == FALSE)
+        {
+            nrc = DCM_NRC_REQUEST_SEQUENCE_ERROR;
+        }
+        else if ((Dcm_BlockAccepted == TRUE) && (request[1] == (u8bit)(Dcm_BlockCounter - 1u)))
+        {
+            nrc = 0u;
+        }
+        else if (request[1] != Dcm_BlockCounter)
+        {
+            nrc = DCM_NRC_WRONG_BLOCK_SEQUENCE;
+        }
+        else
+        {
+            result = Boot_Write(Dcm_Serving, &request[2], length - 2u);
+            if (result == BOOT_OK)
+            {
+                Dcm_RequestTaken = TRUE;
+                Dcm_BlockAccepted = TRUE;
+                Dcm_BlockCounter++;
+                nrc = 0u;
+            }
+            else
+            {
+                nrc = (result == BOOT_PENDING) ? DCM_NRC_RESPONSE_PENDING : DCM_NRC_PROGRAMMING_FAILURE;
+            }
+        }
+
+        if (nrc == 0u)
+        {
+            Dcm_Head[1] = request[1];
+            Dcm_HeadLength = 2u;
+        }
+    }
+    return nrc;
+}
+
+/*
+ * 0x37: CRC-32 of the whole image, big endian. Response pending until the last block is programmed, the
+ * image verified and the trailer programmed.
+ */
+static u8bit Dcm_RequestTransferExit(const u8bit * request, u16bit length)
+{
+    u8bit result;
+    u8bit nrc = DCM_NRC_INCORRECT_LENGTH;
+
+    if (length == 5u)
+    {
+        if (Dcm_Downloading == FALSE)
+        {
+            nrc = DCM_NRC_REQUEST_SEQUENCE_ERROR;
+        }
+        else
+        {
+            result = Boot_Finish(Dcm_GetN(&request[1], 4u));
+            if (result == BOOT_PENDING)
+            {
+                nrc = DCM_NRC_RESPONSE_PENDING;
+            }
+            else
+            {
+                Dcm_Downloading = FALSE;
+                nrc = (result == BOOT_OK) ? 0u : DCM_NRC_PROGRAMMING_FAILURE;
+            }
+        }
+    }
+    return nrc;
+}
+#endif
+
+static u8bit Dcm_Dispatch(const u8bit * request, u16bit length)
+{
+    const Dcm_ServiceType * service = NULL;
+    u32bit i;
+    u8bit nrc = DCM_NRC_SERVICE_NOT_SUPPORTED;
+
+    for (i = 0u; (i < DCM_NUM_SERVICES) && (service == NULL); i++)
+    {
+        if (Dcm_Services[i].sid == request[0])
+        {
+            service = &Dcm_Services[i];
+        }
+    }
+
+    if (service != NULL)
+    {
+        if ((service->sessions & DCM_SESSION_MASK(Dcm_Session)) == 0u)
+        {
+            nrc = DCM_NRC_SERVICE_NOT_IN_SESSION;
+        }
+        else
+        {
+            Dcm_Head[0] = request[0] + DCM_POSITIVE_RESPONSE;
+            Dcm_HeadLength = 1u;
+            nrc = service->handler(request, length);
+        }
+    }
+    return nrc;
+}
+
+/*
+ * Response pending (0x78) once the request has been pending for the P2 calls, then every P2* calls.
+ * Retried on the next call when CanTp is still busy.
+ */
+static void Dcm_Pending(void)
+{
+    u8bit head[3];
+
+    Dcm_PendingCalls++;
+    if (Dcm_PendingCalls >= Dcm_PendingLimit)
+    {
+        head[0] = DCM_NEGATIVE_RESPONSE;
+        head[1] = Dcm_Serving[0];
+        head[2] = DCM_NRC_RESPONSE_PENDING;
+        Dcm_Sending = TRUE;
+        if (CanTp_Transmit(CANTP_CHANNEL_Dcm, head, 3u, NULL, 0u) == TRUE)
+        {
+            Dcm_PendingCalls = 0u;
+            Dcm_PendingLimit = DCM_CFG_P2_EXT_CALLS;
+        }
+        else
+        {
+            Dcm_Sending = FALSE;
+        }
+    }
+}
+
+/*
+ * End of a response, the ECU reset requested by the served one is done here.
+ */
+static void Dcm_Release(void)
+{
+    MemPool_Free(Dcm_Block);
+    Dcm_Block = NULL;
+    Dcm_Sending = FALSE;
+    if (Dcm_Serving == NULL)
+    {
+        if (Dcm_ResetPending == TRUE)
+        {
+            Dcm_ResetPending = FALSE;
+            DCM_CFG_RESET();
+        }
+    }
+}
+
+static void Dcm_S3Expired(void * arg)
+{
+    (void)arg;
+    Dcm_Session = DCM_SESSION_DEFAULT;
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Dcm_Init(void)
+{
+    Timer_Stop(&Dcm_S3Timer);
+    DCM_CFG_LOCK();
+    MemPool_Free(Dcm_Request);
+    Dcm_Request = NULL;
+    MemPool_Free(Dcm_Serving);
+    Dcm_Serving = NULL;
+    Dcm_Sending = FALSE;
+    Dcm_ResetPending = FALSE;
+    Dcm_Downloading = FALSE;
+    Dcm_Session = DCM_SESSION_DEFAULT;
+    DCM_CFG_UNLOCK();
+}
+
+u8bit Dcm_GetSession(void)
+{
+    return Dcm_Session;
+}
+
+/*
+ * A request is accepted once the previous one has been answered, even while its response still waits for the
+ * CanTp confirmation: the tester may ask again as soon as the last frame is on the bus. It is served after
+ * that confirmation. Requests during a pending one or before an ECU reset are dropped.
+ */
+void Dcm_RxIndication(u8bit channel, u8bit * buffer, u16bit length)
+{
+    (void)channel;
+    DCM_CFG_LOCK();
+    if ((Dcm_Request == NULL) && (Dcm_Serving == NULL) && (Dcm_ResetPending == FALSE))
+    {
+        Dcm_Request = buffer;
+        Dcm_RequestLength = length;
+    }
+    else
+    {
+        MemPool_Free(buffer);
+    }
+    DCM_CFG_UNLOCK();
+}
+
+void Dcm_TxConfirmation(u8bit channel, boolean ok)
+{
+    (void)channel;
+    (void)ok;
+    Dcm_Release();
+}
+
+/*
+ * Serve the pending request and start sending its response, restarting S3 outside the default session.
+ * A handler answering response pending is called again with the same request, nothing is served while
+ * CanTp sends.
+ */
+void Dcm_MainFunction(void)
+{
+    u8bit nrc;
+
+    if (Dcm_Serving == NULL)
+    {
+        DCM_CFG_LOCK();
+        Dcm_Serving = Dcm_Request;
+        Dcm_ServingLength = Dcm_RequestLength;
+        Dcm_Request = NULL;
+        DCM_CFG_UNLOCK();
+        Dcm_PendingCalls = 0u;
+        Dcm_PendingLimit = DCM_CFG_P2_CALLS;
+    }
+
+    if ((Dcm_Serving != NULL) && (Dcm_Sending == FALSE))
+    {
+        Dcm_Data = NULL;
+        Dcm_DataLength = 0u;
+        Dcm_Block = NULL;
+        Dcm_Suppress = FALSE;
+        Dcm_RequestTaken = FALSE;
+        TRACE_MARK(DcmRequest, Dcm_Serving[0]);
+        nrc = Dcm_Dispatch(Dcm_Serving, Dcm_ServingLength);
+
+        if (Dcm_Session != DCM_SESSION_DEFAULT)
+        {
+            Timer_Start(&Dcm_S3Timer, DCM_CFG_S3_TICKS, 0u);
+        }
+        else
+        {
+            Timer_Stop(&Dcm_S3Timer);
+        }
+
+        if (nrc == DCM_NRC_RESPONSE_PENDING)
+        {
+            Dcm_Pending();
+        }
+        else
+        {
+            if (nrc != 0u)
+            {
+                MemPool_Free(Dcm_Block);
+                Dcm_Block = NULL;
+                Dcm_Data = NULL;
+                Dcm_DataLength = 0u;
+                Dcm_Suppress = FALSE;
+                Dcm_ResetPending = FALSE;
+                Dcm_Head[0] = DCM_NEGATIVE_RESPONSE;
+                Dcm_Head[1] = Dcm_Serving[0];
+                Dcm_Head[2] = nrc;
+                Dcm_HeadLength = 3u;
+            }
+            if (Dcm_RequestTaken == FALSE)
+            {
+                MemPool_Free(Dcm_Serving);
+            }
+            Dcm_Serving = NULL;
+
+            Dcm_Sending = TRUE;
+            if (Dcm_Suppress == TRUE)
+            {
+                Dcm_Release();
+            }
+            else if (CanTp_Transmit(CANTP_CHANNEL_Dcm, Dcm_Head, Dcm_HeadLength, Dcm_Data, Dcm_DataLength) == FALSE)
+            {
+                Dcm_Release();
+            }
+            else
+            {
+            }
+        }
+    }
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of Dcm.c                                                       |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | ECU reset, response pending, download services of the bootloader             |
+ *| CMARTI  |  user-019   | 17-Oct-2026 | Delta image download format                                                  |
+ *| CMARTI  |  user-025   | 17-Oct-2026 | DcmRequest trace marker                                                      |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | Next request accepted before the confirmation of the last response           |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | Block counter repeat only after a block of the transfer                      |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Request download of the whole application only                               |
+***********************************************************************************************************************/
@@ -0,0 +1,67 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Dcm.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Dcm.h
+    UDS diagnostic server (ISO 14229) on the Dcm channel of CanTp: session control, tester present,
+    read/write data by identifier, routine control and read memory by address.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef DCM_H_
+#define DCM_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Dcm_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Diagnostic sessions*/
+#define DCM_SESSION_DEFAULT           (0x01u)
+#define DCM_SESSION_PROGRAMMING       (0x02u)
+#define DCM_SESSION_EXTENDED          (0x03u)
+
+/*Set of sessions, for the session masks of Dcm_Cfg.h*/
+#define DCM_SESSION_MASK(session)     (1u << (session))
+#define DCM_SESSION_ALL               (DCM_SESSION_MASK(DCM_SESSION_DEFAULT) | \
+                                       DCM_SESSION_MASK(DCM_SESSION_PROGRAMMING) | \
+                                       DCM_SESSION_MASK(DCM_SESSION_EXTENDED))
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+extern void Dcm_Init(void);
+
+/*Serve the pending request, if any. Call it from a task, after CanTp_MainFunction*/
+extern void Dcm_MainFunction(void);
+
+/*Active diagnostic session, falls back to DCM_SESSION_DEFAULT when the S3 timer expires*/
+extern u8bit Dcm_GetSession(void);
+
+/*CanTp callbacks. A request received while the previous one is being served is dropped*/
+extern void Dcm_RxIndication(u8bit channel, u8bit * buffer, u16bit length);
+extern void Dcm_TxConfirmation(u8bit channel, boolean ok);
+
+#endif /* DCM_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of Dcm.h                                                       |
+***********************************************************************************************************************/
@@ -0,0 +1,157 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Dcm_Cfg.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Dcm_Cfg.c
+    Data identifier and routine callbacks of Dcm_Cfg.h.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Dcm.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define DCM_VIN_LENGTH                (17u)
+
+/*Negative response codes of the callbacks*/
+#define DCM_NRC_SEQUENCE_ERROR        (0x24u)
+#define DCM_NRC_OUT_OF_RANGE          (0x31u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+#if defined (HOST_BUILD)
+u8bit Dcm_HostMemory[DCM_CFG_HOST_MEMORY_SIZE];
+u32bit Dcm_HostResets = 0u;
+#endif
+
+/*Vehicle identification number, RAM only until there is a non volatile memory manager*/
+static u8bit Dcm_Vin[DCM_VIN_LENGTH] = { 'W', 'S', '3', '2', 'K', '1', '4', '4', '0', '0', '0', '0', '0', '0', '0',
+                                         '0', '1' };
+
+/*Pools found exhausted or with refused allocations by the last check, bit per pool*/
+static u8bit Dcm_PoolCheck;
+static boolean Dcm_PoolCheckDone = FALSE;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+static inline void Dcm_Put16(u8bit * data, u32bit value)
+{
+    data[0] = (u8bit)(value >> 8);
+    data[1] = (u8bit)value;
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Dcm_ReadSession(u8bit * data)
+{
+    data[0] = Dcm_GetSession();
+}
+
+void Dcm_ReadVin(u8bit * data)
+{
+    u32bit i;
+
+    for (i = 0u; i < DCM_VIN_LENGTH; i++)
+    {
+        data[i] = Dcm_Vin[i];
+    }
+}
+
+u8bit Dcm_WriteVin(const u8bit * data)
+{
+    u32bit i;
+
+    for (i = 0u; i < DCM_VIN_LENGTH; i++)
+    {
+        Dcm_Vin[i] = data[i];
+    }
+    return 0u;
+}
+
+void Dcm_ReadPoolStats(u8bit * data)
+{
+    MemPool_StatsType stats;
+    u8bit pool;
+
+    for (pool = 0u; pool < MEMPOOL_NUM_POOLS; pool++)
+    {
+        (void)MemPool_GetStats(pool, &stats);
+        Dcm_Put16(&data[0], stats.blockSize);
+        Dcm_Put16(&data[2], stats.blockCount);
+        Dcm_Put16(&data[4], stats.used);
+        Dcm_Put16(&data[6], stats.highWater);
+        Dcm_Put16(&data[8], stats.failures);
+        data = &data[10];
+    }
+}
+
+/*
+ * Pool check, a bit for every pool without a free block or with refused allocations. No option record.
+ */
+u8bit Dcm_CheckPoolsStart(const u8bit * options, u16bit length)
+{
+    MemPool_StatsType stats;
+    u8bit pool;
+    u8bit nrc = DCM_NRC_OUT_OF_RANGE;
+
+    (void)options;
+    if (length == 0u)
+    {
+        Dcm_PoolCheck = 0u;
+        for (pool = 0u; pool < MEMPOOL_NUM_POOLS; pool++)
+        {
+            (void)MemPool_GetStats(pool, &stats);
+            if ((stats.used == stats.blockCount) || (stats.failures != 0u))
+            {
+                Dcm_PoolCheck |= (u8bit)(1u << pool);
+            }
+        }
+        Dcm_PoolCheckDone = TRUE;
+        nrc = 0u;
+    }
+    return nrc;
+}
+
+u8bit Dcm_CheckPoolsResults(u8bit * status, u8bit * count)
+{
+    u8bit nrc = DCM_NRC_SEQUENCE_ERROR;
+
+    if (Dcm_PoolCheckDone == TRUE)
+    {
+        status[0] = Dcm_PoolCheck;
+        *count = 1u;
+        nrc = 0u;
+    }
+    return nrc;
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of Dcm_Cfg.c                                                   |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Host reset counter                                                           |
+***********************************************************************************************************************/
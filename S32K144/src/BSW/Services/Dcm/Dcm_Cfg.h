@@ -0,0 +1,138 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Dcm_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Dcm_Cfg.h
+    Configuration of the UDS server: services, data identifiers, routines and readable memory.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef DCM_CFG_H_
+#define DCM_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Os.h"
+#include "MemPool.h"
+#include "S32K144.h"
+#include "Startup_Warm.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Services, SERVICE(service id, handler in Dcm.c, sessions allowed)*/
+#define DCM_CFG_SERVICES(SERVICE)                                                                   \
+    SERVICE(0x10u, Dcm_SessionControl,      DCM_SESSION_ALL)                                        \
+    SERVICE(0x11u, Dcm_EcuReset,            DCM_SESSION_ALL)                                        \
+    SERVICE(0x22u, Dcm_ReadDataById,        DCM_SESSION_ALL)                                        \
+    SERVICE(0x23u, Dcm_ReadMemoryByAddress, DCM_SESSION_MASK(DCM_SESSION_EXTENDED))                 \
+    SERVICE(0x2Eu, Dcm_WriteDataById,       DCM_SESSION_ALL)                                        \
+    SERVICE(0x31u, Dcm_RoutineControl,      DCM_SESSION_ALL)                                        \
+    SERVICE(0x3Eu, Dcm_TesterPresent,       DCM_SESSION_ALL)                                        \
+    DCM_CFG_DOWNLOAD_SERVICES(SERVICE)
+
+/*Download services of the bootloader (make BOOT=1, settings/bootloader), programming session only*/
+#if defined (BOOT_BUILD)
+#define DCM_CFG_DOWNLOAD              (1u)
+#define DCM_CFG_DOWNLOAD_SERVICES(SERVICE)                                                          \
+    SERVICE(0x34u, Dcm_RequestDownload,     DCM_SESSION_MASK(DCM_SESSION_PROGRAMMING))              \
+    SERVICE(0x36u, Dcm_TransferData,        DCM_SESSION_MASK(DCM_SESSION_PROGRAMMING))              \
+    SERVICE(0x37u, Dcm_RequestTransferExit, DCM_SESSION_MASK(DCM_SESSION_PROGRAMMING))
+#else
+#define DCM_CFG_DOWNLOAD              (0u)
+#define DCM_CFG_DOWNLOAD_SERVICES(SERVICE)
+#endif
+
+/*Data identifiers, DID(id, length, read, write or NULL, sessions allowed to write).
+  read fills length bytes, write gets length bytes and returns 0 or a negative response code*/
+#define DCM_CFG_DIDS(DID)                                                                           \
+    DID(0xF186u,  1u,                           Dcm_ReadSession,   NULL,          0u)               \
+    DID(0xF190u, 17u,                           Dcm_ReadVin,       Dcm_WriteVin,                    \
+        DCM_SESSION_MASK(DCM_SESSION_EXTENDED))                                                     \
+    DID(0x0210u, DCM_CFG_POOL_STATS_LENGTH,     Dcm_ReadPoolStats, NULL,          0u)
+
+/*DID 0x0210: per pool block size, block count, used, high water and failures, 16 bit big endian each*/
+#define DCM_CFG_POOL_STATS_LENGTH     (10u * MEMPOOL_NUM_POOLS)
+
+/*Routines, ROUTINE(id, start, results). start gets the option record, results writes up to
+  DCM_ROUTINE_STATUS_MAX status bytes and their number. Both return 0 or a negative response code*/
+#define DCM_CFG_ROUTINES(ROUTINE)                                                                   \
+    ROUTINE(0x0200u, Dcm_CheckPoolsStart, Dcm_CheckPoolsResults)
+
+#define DCM_ROUTINE_STATUS_MAX        (3u)
+
+/*Readable memory, MEMORY(start address, size in bytes). Host builds read a RAM image instead*/
+#if defined (HOST_BUILD)
+#define DCM_CFG_HOST_MEMORY_SIZE      (0xF000uL)
+#define DCM_CFG_MEMORY(MEMORY)                                                                      \
+    MEMORY(0x1FFF8000uL, DCM_CFG_HOST_MEMORY_SIZE)
+#define DCM_CFG_MEMORY_PTR(address)   ((const u8bit *)&Dcm_HostMemory[(address) - 0x1FFF8000uL])
+#else
+#define DCM_CFG_MEMORY(MEMORY)                                                                      \
+    MEMORY(0x00000000uL, 0x00080000uL)                              /*P-Flash*/                     \
+    MEMORY(0x1FFF8000uL, 0x0000F000uL)                              /*SRAM_L and SRAM_U*/
+#define DCM_CFG_MEMORY_PTR(address)   ((const u8bit *)(uaddr)(address))
+#endif
+
+/*Dcm_MainFunction calls a request may stay pending before a response pending (0x78) is sent, within P2,
+  and between the next ones, within P2* (see the timings of the session control response)*/
+#define DCM_CFG_P2_CALLS              (40u)
+#define DCM_CFG_P2_EXT_CALLS          (2000u)
+
+/*Reset after the positive response of ECU reset, a warm reset that keeps the tester window of the bootloader.
+  Host builds only count them*/
+#if defined (HOST_BUILD)
+#define DCM_CFG_RESET()               (Dcm_HostResets++)
+#else
+#define DCM_CFG_RESET()               StartupWarm_Reset()
+#endif
+
+/*S3 server timeout in Timer_Tick calls, a non default session without requests ends after it*/
+#define DCM_CFG_S3_TICKS              (5000u)
+
+/*Protects the pending request against Dcm_RxIndication, nestable*/
+#define DCM_CFG_LOCK()                Os_SuspendAllInterrupts()
+#define DCM_CFG_UNLOCK()              Os_ResumeAllInterrupts()
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+#if defined (HOST_BUILD)
+extern u8bit Dcm_HostMemory[DCM_CFG_HOST_MEMORY_SIZE];
+extern u32bit Dcm_HostResets;
+#endif
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*DID and routine callbacks, Dcm_Cfg.c*/
+extern void  Dcm_ReadSession(u8bit * data);
+extern void  Dcm_ReadVin(u8bit * data);
+extern u8bit Dcm_WriteVin(const u8bit * data);
+extern void  Dcm_ReadPoolStats(u8bit * data);
+extern u8bit Dcm_CheckPoolsStart(const u8bit * options, u16bit length);
+extern u8bit Dcm_CheckPoolsResults(u8bit * status, u8bit * count);
+
+#if (DCM_CFG_DOWNLOAD == 1u)
+#include "Boot.h"
+#endif
+
+#endif /* DCM_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of Dcm_Cfg.h                                                   |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | ECU reset, response pending timing, bootloader download services             |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | ECU reset through StartupWarm_Reset                                          |
+***********************************************************************************************************************/
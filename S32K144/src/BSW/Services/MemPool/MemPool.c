@@ -0,0 +1,253 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: MemPool.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \MemPool.c
+    Fixed block pools carved from the linker heap.
+    Every pool keeps a LIFO free list of block indexes. The list head packs a 16 bit modification tag
+    with the index of the first free block and is updated with compare and swap (LDREX/STREX), the tag
+    changes on every update so a preempted pop can never install a stale next index (ABA).
+    A free block stores the index of the next free block in its first word.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "MemPool.h"
+#include "Core_CM4.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Free list head: tag in the upper half word, index + 1 of the first free block in the lower (0 = empty)*/
+#define MEMPOOL_HEAD_INDEX_MASK   (0x0000FFFFuL)
+#define MEMPOOL_HEAD_TAG_INC      (0x00010000uL)
+#define MEMPOOL_HEAD_TAG_MASK     (0xFFFF0000uL)
+
+#define MEMPOOL_ALIGN             (8u)
+
+typedef struct
+{
+    u8bit *         base;               /*First block*/
+    u8bit *         end;                /*After the last block*/
+    u32bit          blockSize;
+    u32bit          blockCount;
+    volatile u32bit head;
+    volatile u32bit used;
+    volatile u32bit highWater;
+    volatile u32bit failures;
+} MemPool_PoolType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+#define MEMPOOL_INIT_POOL(size, count)  { NULL, NULL, (size), (count), 0u, 0u, 0u, 0u },
+static MemPool_PoolType MemPool_Pools[MEMPOOL_NUM_POOLS] = { MEMPOOL_CFG_POOLS(MEMPOOL_INIT_POOL) };
+
+#if defined (HOST_BUILD)
+static u8bit MemPool_HostHeap[MEMPOOL_CFG_HOST_HEAP_SIZE] ALIGNED(MEMPOOL_ALIGN);
+#else
+/*Heap region from the linker script*/
+extern u8bit __HeapBase[];
+extern u8bit __HeapLimit[];
+#endif
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void * MemPool_Pop(MemPool_PoolType * pool);
+static void   MemPool_Push(MemPool_PoolType * pool, u8bit * block);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Take the first free block of pool and update usage counters.
+ */
+static void * MemPool_Pop(MemPool_PoolType * pool)
+{
+    u32bit oldHead;
+    u32bit newHead;
+    u32bit index;
+    u32bit used;
+    u32bit highWater;
+    u8bit * block;
+
+    do
+    {
+        oldHead = pool->head;
+        index = oldHead & MEMPOOL_HEAD_INDEX_MASK;
+        if (index == 0u)
+        {
+            (void)Core_AtomicAdd(&pool->failures, 1u);
+            return NULL;
+        }
+        block = &pool->base[(index - 1u) * pool->blockSize];
+        /* Next index may be stale if another context popped this block meanwhile, the tag makes the CAS fail */
+        newHead = ((oldHead + MEMPOOL_HEAD_TAG_INC) & MEMPOOL_HEAD_TAG_MASK) | *(volatile u32bit *)block;
+    } while (Core_CompareAndSwap(&pool->head, oldHead, newHead) == FALSE);
+
+    used = Core_AtomicAdd(&pool->used, 1u);
+    highWater = pool->highWater;
+    while ((used > highWater) && (Core_CompareAndSwap(&pool->highWater, highWater, used) == FALSE))
+    {
+        highWater = pool->highWater;
+    }
+    return block;
+}
+
+/*
+ * Link block at the head of the free list of pool.
+ */
+static void MemPool_Push(MemPool_PoolType * pool, u8bit * block)
+{
+    u32bit oldHead;
+    u32bit newHead;
+    u32bit index = ((u32bit)(block - pool->base) / pool->blockSize) + 1u;
+
+    do
+    {
+        oldHead = pool->head;
+        *(volatile u32bit *)block = oldHead & MEMPOOL_HEAD_INDEX_MASK;
+        newHead = ((oldHead + MEMPOOL_HEAD_TAG_INC) & MEMPOOL_HEAD_TAG_MASK) | index;
+    } while (Core_CompareAndSwap(&pool->head, oldHead, newHead) == FALSE);
+
+    (void)Core_AtomicAdd(&pool->used, (u32bit)-1);
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+/*
+ * Lay the pools out one after the other from the start of the heap and chain their blocks.
+ */
+boolean MemPool_Init(void)
+{
+    u8bit * next;
+    u8bit * limit;
+    u32bit poolId;
+    u32bit index;
+    MemPool_PoolType * pool;
+    boolean fits = TRUE;
+
+#if defined (HOST_BUILD)
+    next = MemPool_HostHeap;
+    limit = &MemPool_HostHeap[MEMPOOL_CFG_HOST_HEAP_SIZE];
+#else
+    next = __HeapBase;
+    limit = __HeapLimit;
+#endif
+
+    for (poolId = 0u; poolId < MEMPOOL_NUM_POOLS; poolId++)
+    {
+        pool = &MemPool_Pools[poolId];
+        next = (u8bit *)(((uaddr)next + (MEMPOOL_ALIGN - 1u)) & ~(uaddr)(MEMPOOL_ALIGN - 1u));
+
+        if ((pool->blockSize < sizeof(u32bit)) || (pool->blockCount > MEMPOOL_HEAD_INDEX_MASK) ||
+            ((u32bit)(limit - next) < (pool->blockSize * pool->blockCount)))
+        {
+            /* Pool left empty, every allocation from it fails */
+            pool->base = next;
+            pool->end = next;
+            pool->head = 0u;
+            fits = FALSE;
+        }
+        else
+        {
+            pool->base = next;
+            pool->end = &next[pool->blockSize * pool->blockCount];
+            for (index = 1u; index <= pool->blockCount; index++)
+            {
+                /* Block index - 1 links to block index + 1, the last one ends the list */
+                *(u32bit *)&pool->base[(index - 1u) * pool->blockSize] =
+                    (index < pool->blockCount) ? (index + 1u) : 0u;
+            }
+            pool->head = (pool->blockCount != 0u) ? 1u : 0u;
+            next = pool->end;
+        }
+        pool->used = 0u;
+        pool->highWater = 0u;
+        pool->failures = 0u;
+    }
+    return fits;
+}
+
+/*
+ * Smallest fitting pool first, bigger ones when it is exhausted.
+ */
+void * MemPool_Alloc(u32bit size)
+{
+    u32bit poolId;
+    void * block = NULL;
+
+    for (poolId = 0u; (poolId < MEMPOOL_NUM_POOLS) && (block == NULL); poolId++)
+    {
+        if (MemPool_Pools[poolId].blockSize >= size)
+        {
+            block = MemPool_Pop(&MemPool_Pools[poolId]);
+        }
+    }
+    return block;
+}
+
+void * MemPool_AllocFromPool(u8bit pool)
+{
+    return (pool < MEMPOOL_NUM_POOLS) ? MemPool_Pop(&MemPool_Pools[pool]) : NULL;
+}
+
+/*
+ * The owner pool is found from the block address, there is no header in front of blocks.
+ */
+void MemPool_Free(void * block)
+{
+    u32bit poolId;
+    u8bit * address = (u8bit *)block;
+
+    if (block != NULL)
+    {
+        for (poolId = 0u; poolId < MEMPOOL_NUM_POOLS; poolId++)
+        {
+            if ((address >= MemPool_Pools[poolId].base) && (address < MemPool_Pools[poolId].end))
+            {
+                MemPool_Push(&MemPool_Pools[poolId], address);
+                break;
+            }
+        }
+    }
+}
+
+boolean MemPool_GetStats(u8bit pool, MemPool_StatsType * stats)
+{
+    boolean valid = FALSE;
+
+    if (pool < MEMPOOL_NUM_POOLS)
+    {
+        stats->blockSize = MemPool_Pools[pool].blockSize;
+        stats->blockCount = MemPool_Pools[pool].blockCount;
+        stats->used = MemPool_Pools[pool].used;
+        stats->highWater = MemPool_Pools[pool].highWater;
+        stats->failures = MemPool_Pools[pool].failures;
+        valid = TRUE;
+    }
+    return valid;
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-005   | 17-Oct-2026 | First version of MemPool.c                                                   |
+***********************************************************************************************************************/
@@ -0,0 +1,74 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: MemPool.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \MemPool.h
+    Fixed block pool allocator.
+    Deterministic replacement of malloc for drivers and RTE message buffers. Alloc and free are O(1)
+    lock-free operations that can be used from tasks and ISRs. Every pool records its high-water mark.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef MEMPOOL_H_
+#define MEMPOOL_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "MemPool_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Pool identifiers, in MEMPOOL_CFG_POOLS order*/
+#define MEMPOOL_COUNT_POOL(size, count) +1u
+#define MEMPOOL_NUM_POOLS               (0u MEMPOOL_CFG_POOLS(MEMPOOL_COUNT_POOL))
+
+/*Usage of one pool*/
+typedef struct
+{
+    u32bit blockSize;
+    u32bit blockCount;
+    u32bit used;                        /*Blocks allocated now*/
+    u32bit highWater;                   /*Maximum of used since MemPool_Init*/
+    u32bit failures;                    /*Allocations refused because the pool was empty*/
+} MemPool_StatsType;
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Carve the pools from the heap region, FALSE when the configuration does not fit*/
+extern boolean MemPool_Init(void);
+
+/*Block of at least size bytes from the smallest pool that has one free, NULL when none*/
+extern void * MemPool_Alloc(u32bit size);
+
+/*Block from a given pool, NULL when it is empty*/
+extern void * MemPool_AllocFromPool(u8bit pool);
+
+/*Give a block back to its pool, NULL is ignored*/
+extern void MemPool_Free(void * block);
+
+/*Usage of a pool, FALSE when pool does not exist*/
+extern boolean MemPool_GetStats(u8bit pool, MemPool_StatsType * stats);
+
+#endif /* MEMPOOL_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-005   | 17-Oct-2026 | First version of MemPool.h                                                   |
+***********************************************************************************************************************/
@@ -0,0 +1,54 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: MemPool_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \MemPool_Cfg.h
+    Configuration of the fixed block pools carved from the linker heap (__HeapBase/__HeapLimit).
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef MEMPOOL_CFG_H_
+#define MEMPOOL_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Pools, POOL(block size in bytes, number of blocks).
+ *Keep them sorted by ascending block size, sizes multiple of 8. Total must fit HEAP_SIZE of the linker script*/
+#define MEMPOOL_CFG_POOLS(POOL)             \
+    POOL(16u,  16u)                         \
+    POOL(64u,   8u)                         \
+    POOL(256u,  1u)                         \
+    POOL(4096u, 2u)
+
+/*Heap size used by host builds, there is no linker heap there*/
+#define MEMPOOL_CFG_HOST_HEAP_SIZE          (9216u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* MEMPOOL_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-005   | 17-Oct-2026 | First version of MemPool_Cfg.h                                               |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | 4 KB pool for diagnostic messages                                            |
+***********************************************************************************************************************/
@@ -0,0 +1,534 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Os.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Os.c
+    Portable part of the preemptive fixed priority kernel: ready queue, delay list and scheduling.
+    Context switch and tick source live in the port (Os_Port_CM4.c / Os_Port_Host.c).
+    Tickless idle: when only the idle task is ready it asks the port to suppress the tick until the head of
+    the delay list is due, then accounts every tick that elapsed at once. The port keeps the tick phase, so
+    delays stay exact across idle periods.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Os.h"
+#include "Startup_Mem.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*TRUE when tick a is at or after tick b, valid across counter wrap around*/
+#define OS_TICK_REACHED(a, b)   ((s32bit)((u32bit)(a) - (u32bit)(b)) >= 0)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+/*Scheduler state read by every tick and context switch, kept in SRAM_L (FAST_BSS)*/
+FAST_BSS Os_TaskType * volatile Os_CurrentTask;
+FAST_BSS Os_TaskType * volatile Os_NextTask;
+
+/*One circular FIFO per priority, Os_ReadyList[p] is the head. Bit p of Os_ReadyMask is set when not empty*/
+FAST_BSS static Os_TaskType * Os_ReadyList[OS_PRIO_LEVELS];
+FAST_BSS static u32bit        Os_ReadyMask;
+
+/*Delayed tasks sorted by wake up tick*/
+FAST_BSS static Os_TaskType * Os_DelayList;
+
+FAST_BSS static volatile Os_TickType Os_TickCount;
+static boolean       Os_Started;
+
+/*Os_SuspendAllInterrupts nesting*/
+static u32bit        Os_IntNesting;
+static u32bit        Os_IntSavedState;
+
+static Os_IdleStatsType Os_IdleStats;
+
+OS_TASK_DEFINE(Os_IdleTask, OS_CFG_IDLE_STACK_WORDS);
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void Os_ReadyInsert(Os_TaskType * task);
+static void Os_ReadyRemove(Os_TaskType * task);
+static void Os_DelayInsert(Os_TaskType * task);
+static void Os_DelayRemove(Os_TaskType * task);
+static void Os_Schedule(void);
+static void Os_TickAdvance(Os_TickType ticks);
+static Os_TickType Os_IdleTicks(void);
+static void Os_IdleEntry(void * arg);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Append task at the tail of its priority FIFO. Interrupts must be masked.
+ */
+static void Os_ReadyInsert(Os_TaskType * task)
+{
+    Os_TaskType * head = Os_ReadyList[task->priority];
+
+    if (head == NULL)
+    {
+        task->next = task;
+        task->prev = task;
+        Os_ReadyList[task->priority] = task;
+        Os_ReadyMask |= (1uL << task->priority);
+    }
+    else
+    {
+        task->next = head;
+        task->prev = head->prev;
+        head->prev->next = task;
+        head->prev = task;
+    }
+    task->state = OS_TASK_READY;
+}
+
+/*
+ * Unlink task from its priority FIFO. Interrupts must be masked.
+ */
+static void Os_ReadyRemove(Os_TaskType * task)
+{
+    if (task->next == task)
+    {
+        Os_ReadyList[task->priority] = NULL;
+        Os_ReadyMask &= ~(1uL << task->priority);
+    }
+    else
+    {
+        task->prev->next = task->next;
+        task->next->prev = task->prev;
+        if (Os_ReadyList[task->priority] == task)
+        {
+            Os_ReadyList[task->priority] = task->next;
+        }
+    }
+    task->next = NULL;
+    task->prev = NULL;
+}
+
+/*
+ * Insert task in the delay list keeping it sorted by wakeTick. Interrupts must be masked.
+ */
+static void Os_DelayInsert(Os_TaskType * task)
+{
+    Os_TaskType * prev = NULL;
+    Os_TaskType * node = Os_DelayList;
+
+    while ((node != NULL) && OS_TICK_REACHED(task->wakeTick, node->wakeTick))
+    {
+        prev = node;
+        node = node->next;
+    }
+
+    task->prev = prev;
+    task->next = node;
+    if (node != NULL)
+    {
+        node->prev = task;
+    }
+    if (prev != NULL)
+    {
+        prev->next = task;
+    }
+    else
+    {
+        Os_DelayList = task;
+    }
+    task->state = OS_TASK_DELAYED;
+}
+
+/*
+ * Unlink task from the delay list. Interrupts must be masked.
+ */
+static void Os_DelayRemove(Os_TaskType * task)
+{
+    if (task->prev != NULL)
+    {
+        task->prev->next = task->next;
+    }
+    else
+    {
+        Os_DelayList = task->next;
+    }
+    if (task->next != NULL)
+    {
+        task->next->prev = task->prev;
+    }
+    task->next = NULL;
+    task->prev = NULL;
+}
+
+/*
+ * Select the head of the highest non empty priority FIFO and request a switch if it is not running.
+ * Interrupts must be masked, the switch (PendSV) happens when they are restored.
+ */
+static void Os_Schedule(void)
+{
+    Os_TaskType * next;
+
+    if (Os_Started == TRUE)
+    {
+        next = Os_ReadyList[OS_PORT_HIGHEST_BIT(Os_ReadyMask)];
+        Os_NextTask = next;
+        if (next != Os_CurrentTask)
+        {
+            Os_PortRequestSwitch();
+        }
+    }
+}
+
+/*
+ * Advance time by ticks and wake up every task whose delay expired. Interrupts must be masked.
+ */
+static void Os_TickAdvance(Os_TickType ticks)
+{
+    Os_TaskType * task;
+
+    Os_TickCount += ticks;
+    while ((Os_DelayList != NULL) && OS_TICK_REACHED(Os_TickCount, Os_DelayList->wakeTick))
+    {
+        task = Os_DelayList;
+        Os_DelayRemove(task);
+        Os_ReadyInsert(task);
+    }
+}
+
+/*
+ * Ticks the idle task may sleep: 0 when another task is ready, up to the first wake up otherwise.
+ * Interrupts must be masked.
+ */
+static Os_TickType Os_IdleTicks(void)
+{
+    Os_TickType ticks = 0u;
+
+    if (OS_PORT_HIGHEST_BIT(Os_ReadyMask) == OS_PRIO_IDLE)
+    {
+        if (Os_DelayList == NULL)
+        {
+            ticks = OS_PORT_MAX_IDLE_TICKS;
+        }
+        else if (!OS_TICK_REACHED(Os_TickCount, Os_DelayList->wakeTick))
+        {
+            ticks = Os_DelayList->wakeTick - Os_TickCount;
+            ticks = (ticks > OS_PORT_MAX_IDLE_TICKS) ? OS_PORT_MAX_IDLE_TICKS : ticks;
+        }
+        else
+        {
+        }
+    }
+    return ticks;
+}
+
+/*
+ * Idle task, runs when nothing else is ready. Sleeps with interrupts masked: a pending interrupt ends WFI
+ * and is taken as soon as they are restored, none is lost between the check and the sleep.
+ */
+static void Os_IdleEntry(void * arg)
+{
+#if (OS_CFG_TICKLESS_IDLE == 1u)
+    u32bit state;
+    Os_TickType ticks;
+#endif
+    (void)arg;
+
+    while (1)
+    {
+#if (OS_CFG_TICKLESS_IDLE == 1u)
+        state = Os_PortDisableInterrupts();
+        ticks = Os_IdleTicks();
+        if (ticks >= OS_CFG_IDLE_MIN_TICKS)
+        {
+            ticks = Os_PortSuppressTicks(ticks);
+            Os_IdleStats.sleeps++;
+            Os_IdleStats.idleTicks += ticks;
+            Os_TickAdvance(ticks);
+            Os_Schedule();
+        }
+        else if (ticks != 0u)
+        {
+            STANDBY();
+        }
+        else
+        {
+        }
+        Os_PortRestoreInterrupts(state);
+#else
+        STANDBY();
+#endif
+    }
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+/*
+ * Reset kernel state.
+ */
+void Os_Init(void)
+{
+    u32bit prio;
+
+    for (prio = 0u; prio < OS_PRIO_LEVELS; prio++)
+    {
+        Os_ReadyList[prio] = NULL;
+    }
+    Os_ReadyMask = 0u;
+    Os_DelayList = NULL;
+    Os_TickCount = 0u;
+    Os_Started = FALSE;
+    Os_IntNesting = 0u;
+    Os_IdleStats.sleeps = 0u;
+    Os_IdleStats.idleTicks = 0u;
+    Os_CurrentTask = NULL;
+    Os_NextTask = NULL;
+
+    Os_TaskCreate(&Os_IdleTask, Os_IdleEntry, NULL, OS_PRIO_IDLE, OS_TASK_STACK(Os_IdleTask));
+}
+
+/*
+ * Paint the stack, build the initial context of task and make it ready.
+ */
+void Os_TaskCreate(Os_TaskType * task, Os_TaskEntryType entry, void * arg, u8bit priority,
+                   u32bit * stack, u32bit stackWords)
+{
+    u32bit state;
+
+    task->entry = entry;
+    task->arg = arg;
+    task->stackBase = stack;
+    task->stackWords = stackWords;
+    task->priority = (priority > OS_PRIO_MAX) ? (u8bit)OS_PRIO_MAX : priority;
+    task->wakeTick = 0u;
+    StartupMem_Paint(stack, stackWords);
+    Os_PortInitStack(task);
+
+    state = Os_PortDisableInterrupts();
+    Os_ReadyInsert(task);
+    Os_Schedule();
+    Os_PortRestoreInterrupts(state);
+}
+
+/*
+ * Start scheduling.
+ */
+void Os_Start(void)
+{
+    (void)Os_PortDisableInterrupts();
+    Os_Started = TRUE;
+    Os_NextTask = Os_ReadyList[OS_PORT_HIGHEST_BIT(Os_ReadyMask)];
+    Os_PortStart();
+}
+
+/*
+ * Stop scheduling.
+ */
+void Os_Shutdown(void)
+{
+    (void)Os_PortDisableInterrupts();
+    Os_Started = FALSE;
+    Os_PortShutdown();
+}
+
+/*
+ * Move running task to the delay list.
+ */
+void Os_Delay(Os_TickType ticks)
+{
+    u32bit state;
+    Os_TaskType * task;
+
+    if (ticks == 0u)
+    {
+        Os_Yield();
+    }
+    else
+    {
+        state = Os_PortDisableInterrupts();
+        task = Os_CurrentTask;
+        Os_ReadyRemove(task);
+        task->wakeTick = Os_TickCount + ticks;
+        Os_DelayInsert(task);
+        Os_Schedule();
+        Os_PortRestoreInterrupts(state);
+    }
+}
+
+/*
+ * Move running task to the tail of its priority FIFO.
+ */
+void Os_Yield(void)
+{
+    u32bit state;
+    Os_TaskType * task;
+
+    state = Os_PortDisableInterrupts();
+    task = Os_CurrentTask;
+    Os_ReadyList[task->priority] = task->next;
+    Os_Schedule();
+    Os_PortRestoreInterrupts(state);
+}
+
+/*
+ * Suspend a ready or delayed task.
+ */
+void Os_TaskSuspend(Os_TaskType * task)
+{
+    u32bit state;
+
+    state = Os_PortDisableInterrupts();
+    if (task == NULL)
+    {
+        task = Os_CurrentTask;
+    }
+
+    if (task->state == OS_TASK_READY)
+    {
+        Os_ReadyRemove(task);
+    }
+    else if (task->state == OS_TASK_DELAYED)
+    {
+        Os_DelayRemove(task);
+    }
+    else
+    {
+        /* Already suspended or dormant */
+    }
+
+    if (task->state != OS_TASK_DORMANT)
+    {
+        task->state = OS_TASK_SUSPENDED;
+    }
+    Os_Schedule();
+    Os_PortRestoreInterrupts(state);
+}
+
+/*
+ * Resume a suspended task.
+ */
+void Os_TaskResume(Os_TaskType * task)
+{
+    u32bit state;
+
+    state = Os_PortDisableInterrupts();
+    if (task->state == OS_TASK_SUSPENDED)
+    {
+        Os_ReadyInsert(task);
+        Os_Schedule();
+    }
+    Os_PortRestoreInterrupts(state);
+}
+
+/*
+ * Called when a task body returns, the task becomes dormant.
+ */
+void Os_TaskExit(void)
+{
+    Os_TaskType * task;
+
+    (void)Os_PortDisableInterrupts();
+    task = Os_CurrentTask;
+    Os_ReadyRemove(task);
+    task->state = OS_TASK_DORMANT;
+    Os_Schedule();
+    Os_PortRestoreInterrupts(0u);
+
+    /* Not reached, the switch happens as soon as interrupts are enabled */
+    while (1)
+    {
+    }
+}
+
+/*
+ * Advance time by one tick.
+ */
+void Os_Tick(void)
+{
+    u32bit state;
+
+    state = Os_PortDisableInterrupts();
+    Os_TickAdvance(1u);
+    Os_Schedule();
+    Os_PortRestoreInterrupts(state);
+}
+
+Os_TickType Os_GetTickCount(void)
+{
+    return Os_TickCount;
+}
+
+Os_TaskType * Os_GetCurrentTask(void)
+{
+    return Os_CurrentTask;
+}
+
+void Os_GetIdleStats(Os_IdleStatsType * stats)
+{
+    u32bit state;
+
+    state = Os_PortDisableInterrupts();
+    *stats = Os_IdleStats;
+    Os_PortRestoreInterrupts(state);
+}
+
+boolean Os_TaskUsesFpu(const Os_TaskType * task)
+{
+    return Os_PortTaskUsesFpu(task);
+}
+
+u32bit Os_TaskStackUnused(const Os_TaskType * task)
+{
+    return StartupMem_Unused(task->stackBase, task->stackWords) * (u32bit)sizeof(u32bit);
+}
+
+/*
+ * Nestable interrupt masking, the state of the outermost call is restored.
+ */
+void Os_SuspendAllInterrupts(void)
+{
+    u32bit state = Os_PortDisableInterrupts();
+
+    if (Os_IntNesting == 0u)
+    {
+        Os_IntSavedState = state;
+    }
+    Os_IntNesting++;
+}
+
+void Os_ResumeAllInterrupts(void)
+{
+    if (Os_IntNesting != 0u)
+    {
+        Os_IntNesting--;
+        if (Os_IntNesting == 0u)
+        {
+            Os_PortRestoreInterrupts(Os_IntSavedState);
+        }
+    }
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | First version of Os.c                                                        |
+ *| CMARTI  |  user-004   | 17-Oct-2026 | Add Os_TaskUsesFpu                                                           |
+ *| CMARTI  |  user-015   | 17-Oct-2026 | Tickless idle, ticks accounted in one step after a suppressed period         |
+ *| CMARTI  |  user-022   | 17-Oct-2026 | Paint task stacks, add Os_TaskStackUnused                                    |
+ *| CMARTI  |  user-023   | 17-Oct-2026 | Scheduler state in FAST_BSS                                                  |
+***********************************************************************************************************************/
@@ -0,0 +1,144 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Os.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Os.h
+    Preemptive fixed priority kernel.
+    32 priority levels, 0 is the idle task and 31 the most urgent. Ready tasks are kept in one FIFO
+    list per priority plus a bitmap, so the next task is found with a single CLZ.
+    Task control blocks and stacks are static (OS_TASK_DEFINE), the kernel never uses a heap.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef OS_H_
+#define OS_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Os_Cfg.h"
+#include "Os_Port.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Priority levels*/
+#define OS_PRIO_LEVELS      (32u)
+#define OS_PRIO_IDLE        (0u)
+#define OS_PRIO_MAX         (OS_PRIO_LEVELS - 1u)
+
+/*Task states*/
+#define OS_TASK_DORMANT     (0u)
+#define OS_TASK_READY       (1u)
+#define OS_TASK_DELAYED     (2u)
+#define OS_TASK_SUSPENDED   (3u)
+
+/*Tick counter, wraps around*/
+typedef u32bit Os_TickType;
+
+/*Task body*/
+typedef void (*Os_TaskEntryType)(void * arg);
+
+/*Task control block*/
+typedef struct Os_Task
+{
+    Os_PortContextType context;         /*Saved context, must be the first member*/
+    struct Os_Task *   next;            /*Ready or delay list*/
+    struct Os_Task *   prev;
+    Os_TaskEntryType   entry;
+    void *             arg;
+    u32bit *           stackBase;
+    u32bit             stackWords;
+    Os_TickType        wakeTick;        /*Valid while delayed*/
+    u8bit              priority;
+    u8bit              state;
+} Os_TaskType;
+
+/*Tickless idle statistics, idle ratio = idleTicks / Os_GetTickCount()*/
+typedef struct
+{
+    u32bit      sleeps;                 /*Tick suppressed sleeps, each ended by one wake up*/
+    Os_TickType idleTicks;              /*Ticks elapsed while the tick was suppressed*/
+} Os_IdleStatsType;
+
+/*Static task control block and stack*/
+#define OS_TASK_DEFINE(name, words)                                                                 \
+    static Os_TaskType name;                                                                        \
+    static u32bit name##_Stack[(words) + OS_PORT_STACK_EXTRA_WORDS] ALIGNED(8)
+
+/*Stack arguments of Os_TaskCreate for a task declared with OS_TASK_DEFINE*/
+#define OS_TASK_STACK(name)  name##_Stack, ((u32bit)(sizeof(name##_Stack) / sizeof(u32bit)))
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Reset kernel state, call once before creating tasks*/
+extern void Os_Init(void);
+
+/*Make a task ready. priority 1..OS_PRIO_MAX, tasks with the same priority run in FIFO order*/
+extern void Os_TaskCreate(Os_TaskType * task, Os_TaskEntryType entry, void * arg, u8bit priority,
+                          u32bit * stack, u32bit stackWords);
+
+/*Start the tick and the highest priority task, does not return until Os_Shutdown (host port)*/
+extern void Os_Start(void);
+
+/*Stop scheduling. Target: interrupts masked forever. Host: Os_Start returns*/
+extern void Os_Shutdown(void);
+
+/*Block the running task for ticks kernel ticks, 0 behaves like Os_Yield*/
+extern void Os_Delay(Os_TickType ticks);
+
+/*Let other ready tasks of the same priority run*/
+extern void Os_Yield(void);
+
+/*Suspend task (NULL: running task) until Os_TaskResume*/
+extern void Os_TaskSuspend(Os_TaskType * task);
+
+/*Resume a suspended task, can be called from an ISR*/
+extern void Os_TaskResume(Os_TaskType * task);
+
+/*Kernel tick, called by the port tick interrupt*/
+extern void Os_Tick(void);
+
+/*Tick counter*/
+extern Os_TickType Os_GetTickCount(void);
+
+/*Running task*/
+extern Os_TaskType * Os_GetCurrentTask(void);
+
+/*Copy of the tickless idle statistics*/
+extern void Os_GetIdleStats(Os_IdleStatsType * stats);
+
+/*TRUE when task owned an FP context the last time it was switched out (its switches save S16-S31)*/
+extern boolean Os_TaskUsesFpu(const Os_TaskType * task);
+
+/*Bytes of the task stack never used since Os_TaskCreate painted it, 0 = overflow likely. Size: stackWords*/
+extern u32bit Os_TaskStackUnused(const Os_TaskType * task);
+
+/*Nestable critical section, must not be held across a blocking call*/
+extern void Os_SuspendAllInterrupts(void);
+extern void Os_ResumeAllInterrupts(void);
+
+#endif /* OS_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | First version of Os.h                                                        |
+ *| CMARTI  |  user-004   | 17-Oct-2026 | Add Os_TaskUsesFpu                                                           |
+ *| CMARTI  |  user-015   | 17-Oct-2026 | Add Os_GetIdleStats                                                          |
+ *| CMARTI  |  user-022   | 17-Oct-2026 | Add Os_TaskStackUnused                                                       |
+***********************************************************************************************************************/
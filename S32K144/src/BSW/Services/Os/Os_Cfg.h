@@ -0,0 +1,69 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Os_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Os_Cfg.h
+    Configuration of the preemptive kernel.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Core clock feeding SysTick, FIRC 48 MHz after reset*/
+#define OS_CFG_CORE_CLOCK_HZ          (48000000uL)
+
+/*Kernel tick frequency*/
+#define OS_CFG_TICK_HZ                (1000uL)
+
+/*Stack of the idle task in words*/
+#define OS_CFG_IDLE_STACK_WORDS       (128u)
+
+/*Priority of PendSV and SysTick, lowest so the kernel never delays an ISR*/
+#define OS_CFG_KERNEL_IRQ_PRIORITY    (0xFFu)
+
+/*Host port only: 1 = SIGALRM drives the tick in real time, 0 = application calls Os_Tick() and tickless idle
+  periods elapse at once in virtual time (make HOST=1 SIM_TIME=1)*/
+#ifndef OS_CFG_HOST_TICK_TIMER
+#define OS_CFG_HOST_TICK_TIMER        (1u)
+#endif
+
+/*1 = tickless idle: with only the idle task ready the tick is stopped until the next delayed task is due and
+  the core sleeps, 0 = the idle task sleeps until the next tick*/
+#define OS_CFG_TICKLESS_IDLE          (1u)
+
+/*Shortest idle period in ticks worth reprogramming the tick timer for*/
+#define OS_CFG_IDLE_MIN_TICKS         (2u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* OS_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | First version of Os_Cfg.h                                                    |
+ *| CMARTI  |  user-015   | 17-Oct-2026 | Tickless idle configuration                                                  |
+ *| CMARTI  |  user-015   | 17-Oct-2026 | OS_CFG_HOST_TICK_TIMER set from the build (SIM_TIME)                         |
+***********************************************************************************************************************/
@@ -0,0 +1,132 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Os_Port.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Os_Port.h
+    Interface between the portable kernel (Os.c) and the port.
+    Os_Port_CM4.c  : Cortex-M4, PendSV context switch and SysTick.
+    Os_Port_Host.c : Linux, ucontext context switch and SIGALRM tick (HOST_BUILD).
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef OS_PORT_H_
+#define OS_PORT_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Os_Cfg.h"
+#include "Core_CM4.h"
+#if defined (HOST_BUILD)
+#include <ucontext.h>
+#endif
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#if defined (HOST_BUILD)
+/*Saved task context*/
+typedef struct
+{
+    ucontext_t uc;
+} Os_PortContextType;
+
+/*Host code (libc, signal frames) needs far more stack than the target, words added to every task stack*/
+#define OS_PORT_STACK_EXTRA_WORDS     (4096u)
+
+/*Index of the most significant bit set, mask must not be 0*/
+#define OS_PORT_HIGHEST_BIT(mask)     (31u - (u32bit)__builtin_clz((unsigned int)(mask)))
+
+/*Longest tickless idle period*/
+#define OS_PORT_MAX_IDLE_TICKS        (0x00FFFFFFuL)
+#else
+/*Saved task context, must stay the first TCB member, PendSV uses offsets 0 and 4.
+ *excReturn bit 4 cleared means the task owns an FP context (CONTROL.FPCA was set when it was preempted)*/
+typedef struct
+{
+    u32bit * sp;                        /*Stack pointer after the software frame was pushed*/
+    u32bit   excReturn;                 /*EXC_RETURN used to resume the task*/
+} Os_PortContextType;
+
+#define OS_PORT_STACK_EXTRA_WORDS     (0u)
+
+/*Index of the most significant bit set (CLZ instruction), mask must not be 0*/
+#define OS_PORT_HIGHEST_BIT(mask)     (31u - (u32bit)__builtin_clz(mask))
+
+/*SysTick cycles per kernel tick*/
+#define OS_PORT_CYCLES_PER_TICK       (OS_CFG_CORE_CLOCK_HZ / OS_CFG_TICK_HZ)
+
+/*Longest tickless idle period, bounded by the 24 bit SysTick reload (349 ticks at 48 MHz and 1 kHz)*/
+#define OS_PORT_MAX_IDLE_TICKS        (S32_SysTick_RVR_RELOAD_MASK / OS_PORT_CYCLES_PER_TICK)
+#endif
+
+struct Os_Task;
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+/*Running task and task selected by the scheduler, the context switch copies Os_NextTask to Os_CurrentTask*/
+extern struct Os_Task * volatile Os_CurrentTask;
+extern struct Os_Task * volatile Os_NextTask;
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Port services used by the kernel*/
+extern void   Os_PortInitStack(struct Os_Task * task);
+extern void   Os_PortStart(void);
+extern void   Os_PortShutdown(void);
+extern void   Os_PortRequestSwitch(void);
+extern boolean Os_PortTaskUsesFpu(const struct Os_Task * task);
+
+/*Tickless idle, interrupts masked: stop the tick for up to ticks periods and sleep until the last one ends or
+  an interrupt is pending. Returns the tick periods completed and not yet counted by the tick interrupt*/
+extern u32bit Os_PortSuppressTicks(u32bit ticks);
+
+/*Kernel services used by the port*/
+extern void   Os_TaskExit(void);
+
+#if defined (HOST_BUILD)
+extern u32bit Os_PortDisableInterrupts(void);
+extern void   Os_PortRestoreInterrupts(u32bit state);
+
+/*STANDBY() of host builds, WFI on the SIGALRM tick*/
+extern void   Os_PortStandby(void);
+#else
+/*Mask interrupts, returns previous PRIMASK*/
+static inline u32bit Os_PortDisableInterrupts(void)
+{
+    u32bit state;
+
+    __asm volatile ("mrs %0, primask \n\t"
+                    "cpsid i         \n\t"
+                    : "=r" (state) : : "memory");
+    return state;
+}
+
+/*Restore PRIMASK returned by Os_PortDisableInterrupts, a pending PendSV fires here*/
+static inline void Os_PortRestoreInterrupts(u32bit state)
+{
+    __asm volatile ("msr primask, %0" : : "r" (state) : "memory");
+}
+#endif
+
+#endif /* OS_PORT_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | First version of Os_Port.h                                                   |
+ *| CMARTI  |  user-004   | 17-Oct-2026 | EXC_RETURN kept in the context, FPU ownership query                          |
+ *| CMARTI  |  user-015   | 17-Oct-2026 | Os_PortSuppressTicks for tickless idle                                       |
+ *| CMARTI  |  user-013   | 17-Oct-2026 | Add Os_PortStandby                                                           |
+***********************************************************************************************************************/
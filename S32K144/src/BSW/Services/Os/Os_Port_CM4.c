@@ -0,0 +1,314 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Os_Port_CM4.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Os_Port_CM4.c
+    Cortex-M4 port of the kernel.
+    Tasks run in thread mode on PSP, ISRs and the kernel handlers on MSP. SysTick drives the tick and
+    PendSV, at the lowest priority, switches context once no other exception is active.
+    FPU ownership is tracked per task with the EXC_RETURN saved in the TCB: tasks that never executed a
+    floating point instruction run with CONTROL.FPCA cleared, the hardware stacks a basic frame for them
+    and PendSV skips S16-S31, so they pay no FP stack or cycles on any switch or interrupt.
+    Task stack frame, from the saved stack pointer upwards:
+      r4-r11, [s16-s31] | r0-r3, r12, lr, pc, xPSR, [s0-s15, FPSCR, reserved] (pushed by hardware)
+    Bracketed parts only exist for tasks owning an FP context.
+    Tickless idle reloads SysTick with the whole idle period measured from the start of the current tick,
+    sleeps, and afterwards restarts it on the original tick phase: only the cycles spent with the counter
+    stopped are lost, OS_PORT_STOPPED_CYCLES compensates them.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#if !defined (HOST_BUILD)
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Os.h"
+#include "Prof.h"
+#include "Trace.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*FP tasks keep S16-S31 and the extended frame only with the FPU in the image (Makefile FPU)*/
+#if !defined (ENABLE_FPU)
+#error "Os_Port_CM4.c: ENABLE_FPU not defined, build with -mfpu=fpv4-sp-d16 -mfloat-abi=hard"
+#endif
+
+/*xPSR with only the Thumb bit set*/
+#define OS_PORT_INITIAL_XPSR        (0x01000000uL)
+
+/*Return to thread mode, PSP, basic frame. Every task starts without FP context*/
+#define OS_PORT_EXC_RETURN_PSP      (0xFFFFFFFDuL)
+
+/*EXC_RETURN bit cleared when the stacked frame is an extended (FP) frame*/
+#define OS_PORT_EXC_RETURN_FTYPE    (0x00000010uL)
+
+/*Words of the basic hardware frame and of the software frame (r4-r11)*/
+#define OS_PORT_HW_FRAME_WORDS      (8u)
+#define OS_PORT_SW_FRAME_WORDS      (8u)
+
+/*SysTick control, counting or stopped with the configuration kept*/
+#define OS_PORT_SYSTICK_RUNNING     (S32_SysTick_CSR_CLKSOURCE_MASK | S32_SysTick_CSR_TICKINT_MASK | \
+                                     S32_SysTick_CSR_ENABLE_MASK)
+#define OS_PORT_SYSTICK_STOPPED     (S32_SysTick_CSR_CLKSOURCE_MASK | S32_SysTick_CSR_TICKINT_MASK)
+
+/*Core cycles SysTick stands still between stopping and restarting it*/
+#define OS_PORT_STOPPED_CYCLES      (94u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+/*
+ * Build a frame so that the first switch to task looks like returning from an exception into entry(arg).
+ */
+void Os_PortInitStack(Os_TaskType * task)
+{
+    u32bit * sp = &task->stackBase[task->stackWords];
+    u32bit word;
+
+    /* AAPCS requires 8 byte alignment at exception entry */
+    sp = (u32bit *)((uaddr)sp & ~(uaddr)7u);
+
+    /* Hardware frame */
+    sp -= OS_PORT_HW_FRAME_WORDS;
+    sp[0] = (u32bit)task->arg;                     /* r0 */
+    sp[1] = 0u;                                    /* r1 */
+    sp[2] = 0u;                                    /* r2 */
+    sp[3] = 0u;                                    /* r3 */
+    sp[4] = 0u;                                    /* r12 */
+    sp[5] = (u32bit)Os_TaskExit;                   /* lr, task body returned */
+    sp[6] = (u32bit)task->entry & ~1uL;            /* pc */
+    sp[7] = OS_PORT_INITIAL_XPSR;                  /* xPSR */
+
+    /* Software frame r4-r11 */
+    sp -= OS_PORT_SW_FRAME_WORDS;
+    for (word = 0u; word < OS_PORT_SW_FRAME_WORDS; word++)
+    {
+        sp[word] = 0u;
+    }
+
+    task->context.excReturn = OS_PORT_EXC_RETURN_PSP;
+    task->context.sp = sp;
+}
+
+/*
+ * Configure kernel exceptions and tick, then switch to Os_NextTask. Does not return.
+ */
+void Os_PortStart(void)
+{
+    /* PendSV and SysTick at the lowest priority */
+    S32_SCB->SHPR3 = (S32_SCB->SHPR3 & 0x0000FFFFuL) |
+                     ((u32bit)OS_CFG_KERNEL_IRQ_PRIORITY << S32_SCB_SHPR3_PRI_14_SHIFT) |
+                     ((u32bit)OS_CFG_KERNEL_IRQ_PRIORITY << S32_SCB_SHPR3_PRI_15_SHIFT);
+
+    /* Tick from the core clock */
+    S32_SysTick->CSR = 0u;
+    S32_SysTick->RVR = (OS_PORT_CYCLES_PER_TICK - 1u) & S32_SysTick_RVR_RELOAD_MASK;
+    S32_SysTick->CVR = 0u;
+    S32_SysTick->CSR = OS_PORT_SYSTICK_RUNNING;
+
+    /* Os_CurrentTask is NULL, PendSV only restores Os_NextTask and returns to it on PSP */
+    S32_SCB->ICSR = S32_SCB_ICSR_PENDSVSET_MASK;
+    Os_PortRestoreInterrupts(0u);
+    __asm volatile ("dsb \n\t"
+                    "isb \n\t" : : : "memory");
+
+    while (1)
+    {
+    }
+}
+
+/*
+ * Stop the tick and keep interrupts masked.
+ */
+void Os_PortShutdown(void)
+{
+    S32_SysTick->CSR = 0u;
+    while (1)
+    {
+    }
+}
+
+/*
+ * Pend PendSV, it runs as soon as interrupts are unmasked and no other ISR is active.
+ */
+void Os_PortRequestSwitch(void)
+{
+    S32_SCB->ICSR = S32_SCB_ICSR_PENDSVSET_MASK;
+    __asm volatile ("dsb \n\t"
+                    "isb \n\t" : : : "memory");
+}
+
+/*
+ * Tickless idle. SysTick is reloaded so that it expires ticks periods after the start of the current one,
+ * the core sleeps with interrupts masked until the expiry or any other pending interrupt.
+ *  - expired: the pending SysTick interrupt counts the last period, ticks - 1 are returned
+ *  - woken early: the completed periods are returned and the counter finishes the current one
+ * Either way SysTick restarts with the remainder of the current period, then free runs on the normal reload.
+ */
+u32bit Os_PortSuppressTicks(u32bit ticks)
+{
+    u32bit elapsed = 0u;
+    u32bit reload;
+    u32bit counted;
+    u32bit next;
+
+    ticks = (ticks > OS_PORT_MAX_IDLE_TICKS) ? OS_PORT_MAX_IDLE_TICKS : ticks;
+
+    S32_SysTick->CSR = OS_PORT_SYSTICK_STOPPED;
+    reload = S32_SysTick->CVR + ((ticks - 1u) * OS_PORT_CYCLES_PER_TICK);
+    if (((S32_SCB->ICSR & S32_SCB_ICSR_PENDSTSET_MASK) != 0u) || (reload <= OS_PORT_STOPPED_CYCLES))
+    {
+        /* A tick is due already, carry on with the current period */
+        S32_SysTick->CSR = OS_PORT_SYSTICK_RUNNING;
+    }
+    else
+    {
+        reload -= OS_PORT_STOPPED_CYCLES;
+        S32_SysTick->RVR = reload;
+        S32_SysTick->CVR = 0u;
+        S32_SysTick->CSR = OS_PORT_SYSTICK_RUNNING;
+
+        __asm volatile ("dsb" : : : "memory");
+        STANDBY();
+        __asm volatile ("isb" : : : "memory");
+
+        S32_SysTick->CSR = OS_PORT_SYSTICK_STOPPED;
+        if ((S32_SysTick->CSR & S32_SysTick_CSR_COUNTFLAG_MASK) != 0u)
+        {
+            /* Cycles counted since the expiry */
+            counted = reload - S32_SysTick->CVR;
+            next = ((counted + OS_PORT_STOPPED_CYCLES) < OS_PORT_CYCLES_PER_TICK) ?
+                   (OS_PORT_CYCLES_PER_TICK - counted - OS_PORT_STOPPED_CYCLES) : OS_PORT_CYCLES_PER_TICK;
+            elapsed = ticks - 1u;
+        }
+        else
+        {
+            /* Cycles counted since the start of the tick period the sleep began in */
+            counted = (ticks * OS_PORT_CYCLES_PER_TICK) - S32_SysTick->CVR;
+            elapsed = counted / OS_PORT_CYCLES_PER_TICK;
+            next = ((elapsed + 1u) * OS_PORT_CYCLES_PER_TICK) - counted;
+            next = (next > OS_PORT_STOPPED_CYCLES) ? (next - OS_PORT_STOPPED_CYCLES) : next;
+        }
+
+        /* Remainder of the current period, the normal reload applies from its end */
+        S32_SysTick->RVR = next - 1u;
+        S32_SysTick->CVR = 0u;
+        S32_SysTick->CSR = OS_PORT_SYSTICK_RUNNING;
+        S32_SysTick->RVR = OS_PORT_CYCLES_PER_TICK - 1u;
+    }
+    return elapsed;
+}
+
+/*
+ * Kernel tick.
+ */
+void SysTick_Handler(void)
+{
+    TRACE_ISR_ENTER(TRACE_EXC_SYSTICK);
+    PROF_BEGIN(OsTick);
+    Os_Tick();
+    PROF_END(OsTick);
+    TRACE_ISR_EXIT(TRACE_EXC_SYSTICK);
+}
+
+/*
+ * TRUE when task was preempted while owning an FP context.
+ */
+boolean Os_PortTaskUsesFpu(const Os_TaskType * task)
+{
+    return ((task->context.excReturn & OS_PORT_EXC_RETURN_FTYPE) == 0u) ? TRUE : FALSE;
+}
+
+#if (TRACE_CFG_ENABLED == 1u)
+/*
+ * Task switch event, called by PendSV_Handler with interrupts masked once task is Os_CurrentTask.
+ */
+__attribute__((used)) static void Os_PortTraceSwitch(const Os_TaskType * task)
+{
+    TRACE_TASK_SWITCH(task->priority, task);
+}
+#endif
+
+/*
+ * Context switch: save running task on its PSP stack, load Os_NextTask.
+ * S16-S31 are only saved/restored for tasks owning an FP context (EXC_RETURN bit 4 cleared). With lazy
+ * stacking the VSTMDB also triggers the deferred push of S0-S15/FPSCR into the space reserved by hardware.
+ */
+__attribute__((naked)) void PendSV_Handler(void)
+{
+    __asm volatile (
+        "    mrs      r0, psp                \n\t"
+        "    isb                             \n\t"
+        "    ldr      r3, =Os_CurrentTask    \n\t"
+        "    ldr      r2, [r3]               \n\t"
+        "    cbz      r2, 1f                 \n\t"   /* First switch, nothing to save */
+#if defined (ENABLE_FPU)
+        "    tst      lr, #0x10              \n\t"
+        "    it       eq                     \n\t"
+        "    vstmdbeq r0!, {s16-s31}         \n\t"
+#endif
+        "    stmdb    r0!, {r4-r11}          \n\t"
+        "    str      r0, [r2]               \n\t"   /* context.sp */
+        "    str      lr, [r2, #4]           \n\t"   /* context.excReturn */
+        "1:  cpsid    i                      \n\t"
+        "    ldr      r1, =Os_NextTask       \n\t"
+        "    ldr      r1, [r1]               \n\t"
+        "    str      r1, [r3]               \n\t"
+#if (TRACE_CFG_ENABLED == 1u)
+        "    push     {r1, lr}               \n\t"
+        "    mov      r0, r1                 \n\t"
+        "    bl       Os_PortTraceSwitch     \n\t"
+        "    pop      {r1, lr}               \n\t"
+#endif
+        "    cpsie    i                      \n\t"
+        "    ldr      r0, [r1]               \n\t"
+        "    ldr      lr, [r1, #4]           \n\t"
+        "    ldmia    r0!, {r4-r11}          \n\t"
+#if defined (ENABLE_FPU)
+        "    tst      lr, #0x10              \n\t"
+        "    it       eq                     \n\t"
+        "    vldmiaeq r0!, {s16-s31}         \n\t"
+#endif
+        "    msr      psp, r0                \n\t"
+        "    isb                             \n\t"
+        "    bx       lr                     \n\t"
+        "    .ltorg                          \n\t"
+    );
+}
+
+#endif /* !HOST_BUILD */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | First version of Os_Port_CM4.c                                               |
+ *| CMARTI  |  user-004   | 17-Oct-2026 | Save S16-S31 only for tasks owning an FP context                             |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | OsTick profiling probe in SysTick_Handler                                    |
+ *| CMARTI  |  user-015   | 17-Oct-2026 | SysTick tickless idle with phase compensation                                |
+ *| CMARTI  |  user-025   | 17-Oct-2026 | Trace points in SysTick_Handler and PendSV_Handler                           |
+ *| CMARTI  |  user-004   | 17-Oct-2026 | Refuse target builds without ENABLE_FPU                                      |
+***********************************************************************************************************************/
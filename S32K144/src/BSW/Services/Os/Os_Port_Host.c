@@ -0,0 +1,373 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Os_Port_Host.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Os_Port_Host.c
+    Linux port of the kernel, used to run the scheduler in host builds (HOST_BUILD).
+    Interrupt masking is SIGALRM blocking, the tick is an interval timer and the context switch
+    is swapcontext(). A switch requested while "interrupts" are masked is delayed until they are
+    restored, like a pended PendSV on the target. A PendSV pended by Irq_Defer is taken at the same points,
+    through the host vector table of Irq, so the bottom halves run like an interrupt before the switch.
+    Tickless idle stretches the interval timer to the end of the idle period and waits in sigsuspend(),
+    which like WFI with masked interrupts returns once a signal arrived. With OS_CFG_HOST_TICK_TIMER = 0
+    the idle period elapses at once, time jumps to the next deadline (simulated time).
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#if defined (HOST_BUILD)
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <signal.h>
+#include <sys/time.h>
+#include "Os.h"
+#include "Irq.h"
+#include "Trace.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define OS_PORT_TICK_US     (1000000uL / OS_CFG_TICK_HZ)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+/*Context of the thread that called Os_Start, restored by Os_Shutdown*/
+static ucontext_t            Os_PortMainContext;
+
+static volatile sig_atomic_t Os_PortMasked;
+static volatile sig_atomic_t Os_PortInIsr;
+static volatile sig_atomic_t Os_PortSwitchPending;
+
+/*Set while the idle task waits in Os_PortSuppressTicks, the tick handler then only ends the wait*/
+static volatile sig_atomic_t Os_PortIdling;
+static volatile sig_atomic_t Os_PortIdleExpired;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void Os_PortSwitch(void);
+static void Os_PortPendSV(void);
+static void Os_PortTaskEntry(void);
+static void Os_PortTickHandler(int signal);
+static void Os_PortSignalMask(int how);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+static void Os_PortSignalMask(int how)
+{
+    sigset_t set;
+
+    sigemptyset(&set);
+    sigaddset(&set, SIGALRM);
+    (void)sigprocmask(how, &set, NULL);
+}
+
+/*
+ * Equivalent of PendSV, SIGALRM must be blocked.
+ */
+static void Os_PortSwitch(void)
+{
+    Os_TaskType * prev = Os_CurrentTask;
+
+    Os_PortSwitchPending = 0;
+    Os_CurrentTask = Os_NextTask;
+    if (prev != Os_CurrentTask)
+    {
+        TRACE_TASK_SWITCH(Os_CurrentTask->priority, Os_CurrentTask);
+        (void)swapcontext(&prev->context.uc, &Os_CurrentTask->context.uc);
+    }
+}
+
+/*
+ * Take PendSV when Irq_Defer pended it, in interrupt context. SIGALRM must be blocked.
+ */
+static void Os_PortPendSV(void)
+{
+    if ((S32_SCB->ICSR & S32_SCB_ICSR_PENDSVSET_MASK) != 0u)
+    {
+        Os_PortInIsr = 1;
+        Irq_HostTake(IRQ_PENDSV);
+        Os_PortInIsr = 0;
+    }
+}
+
+/*
+ * First code executed by every task.
+ */
+static void Os_PortTaskEntry(void)
+{
+    Os_TaskType * task = Os_CurrentTask;
+
+    task->entry(task->arg);
+    Os_TaskExit();
+}
+
+/*
+ * SIGALRM handler, equivalent of SysTick. The switch is done before returning like a tail chained PendSV.
+ */
+static void Os_PortTickHandler(int signal)
+{
+    (void)signal;
+
+    if (Os_PortIdling != 0)
+    {
+        /* End of a suppressed period, Os_PortSuppressTicks accounts for it */
+        Os_PortIdleExpired = 1;
+    }
+    else
+    {
+        Os_PortInIsr = 1;
+        TRACE_ISR_ENTER(TRACE_EXC_SYSTICK);
+        Os_Tick();
+        TRACE_ISR_EXIT(TRACE_EXC_SYSTICK);
+        Os_PortInIsr = 0;
+        Os_PortPendSV();
+        if (Os_PortSwitchPending != 0)
+        {
+            Os_PortSwitch();
+        }
+    }
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+/*
+ * Prepare a ucontext that starts in Os_PortTaskEntry on the task stack with SIGALRM unblocked.
+ */
+void Os_PortInitStack(Os_TaskType * task)
+{
+    (void)getcontext(&task->context.uc);
+    task->context.uc.uc_stack.ss_sp = task->stackBase;
+    task->context.uc.uc_stack.ss_size = (size_t)task->stackWords * sizeof(u32bit);
+    task->context.uc.uc_link = NULL;
+    sigemptyset(&task->context.uc.uc_sigmask);
+    makecontext(&task->context.uc, Os_PortTaskEntry, 0);
+}
+
+/*
+ * Start the tick timer and run Os_NextTask. Returns after Os_Shutdown.
+ */
+void Os_PortStart(void)
+{
+    struct sigaction action;
+    struct itimerval timer;
+
+    action.sa_handler = Os_PortTickHandler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    (void)sigaction(SIGALRM, &action, NULL);
+
+#if (OS_CFG_HOST_TICK_TIMER == 1u)
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = (suseconds_t)OS_PORT_TICK_US;
+    timer.it_value = timer.it_interval;
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+#else
+    (void)timer;
+#endif
+
+    Os_PortSwitchPending = 0;
+    Os_PortMasked = 0;
+    Os_CurrentTask = Os_NextTask;
+    TRACE_TASK_SWITCH(Os_CurrentTask->priority, Os_CurrentTask);
+    (void)swapcontext(&Os_PortMainContext, &Os_CurrentTask->context.uc);
+
+    /* Back from Os_Shutdown */
+    Os_PortMasked = 0;
+    Os_PortSignalMask(SIG_UNBLOCK);
+}
+
+/*
+ * Stop the tick timer and return to the thread that called Os_Start.
+ */
+void Os_PortShutdown(void)
+{
+    struct itimerval timer = { { 0, 0 }, { 0, 0 } };
+
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+    Os_CurrentTask = NULL;
+    (void)setcontext(&Os_PortMainContext);
+}
+
+/*
+ * Switch now when possible, otherwise when interrupts are restored or the tick handler ends.
+ */
+void Os_PortRequestSwitch(void)
+{
+    Os_PortSwitchPending = 1;
+    if ((Os_PortMasked == 0) && (Os_PortInIsr == 0) && (Os_CurrentTask != NULL))
+    {
+        Os_PortSignalMask(SIG_BLOCK);
+        Os_PortSwitch();
+        Os_PortSignalMask(SIG_UNBLOCK);
+    }
+}
+
+/*
+ * FP context is part of every ucontext on the host, ownership is not tracked.
+ */
+boolean Os_PortTaskUsesFpu(const Os_TaskType * task)
+{
+    (void)task;
+    return FALSE;
+}
+
+#if (OS_CFG_HOST_TICK_TIMER == 1u)
+/*
+ * Tickless idle with SIGALRM blocked. The timer is stretched to the end of ticks periods counted from the
+ * start of the current one and keeps its interval, so the tick phase is unchanged after an expiry. A wait
+ * ended by another signal restarts the timer on the remainder of the current period.
+ */
+u32bit Os_PortSuppressTicks(u32bit ticks)
+{
+    struct itimerval timer;
+    sigset_t waitMask;
+    u64bit programmed;
+    u64bit counted;
+    u64bit next;
+    u32bit elapsed = 0u;
+
+    ticks = (ticks > OS_PORT_MAX_IDLE_TICKS) ? OS_PORT_MAX_IDLE_TICKS : ticks;
+
+    (void)getitimer(ITIMER_REAL, &timer);
+    programmed = ((u64bit)timer.it_value.tv_sec * 1000000uL) + (u64bit)timer.it_value.tv_usec;
+    if (programmed != 0u)
+    {
+        programmed += (u64bit)(ticks - 1u) * OS_PORT_TICK_US;
+        timer.it_value.tv_sec = (time_t)(programmed / 1000000uL);
+        timer.it_value.tv_usec = (suseconds_t)(programmed % 1000000uL);
+        Os_PortIdleExpired = 0;
+        Os_PortIdling = 1;
+        (void)setitimer(ITIMER_REAL, &timer, NULL);
+
+        sigemptyset(&waitMask);
+        (void)sigsuspend(&waitMask);
+        Os_PortIdling = 0;
+
+        if (Os_PortIdleExpired != 0)
+        {
+            elapsed = ticks;
+        }
+        else
+        {
+            /* Time counted since the start of the period the wait began in */
+            (void)getitimer(ITIMER_REAL, &timer);
+            counted = ((u64bit)ticks * OS_PORT_TICK_US) -
+                      (((u64bit)timer.it_value.tv_sec * 1000000uL) + (u64bit)timer.it_value.tv_usec);
+            elapsed = (u32bit)(counted / OS_PORT_TICK_US);
+            next = ((u64bit)(elapsed + 1u) * OS_PORT_TICK_US) - counted;
+            timer.it_value.tv_sec = (time_t)(next / 1000000uL);
+            timer.it_value.tv_usec = (suseconds_t)(next % 1000000uL);
+            (void)setitimer(ITIMER_REAL, &timer, NULL);
+        }
+    }
+    return elapsed;
+}
+#else
+/*
+ * Simulated time: the whole idle period elapses at once.
+ */
+u32bit Os_PortSuppressTicks(u32bit ticks)
+{
+    return (ticks > OS_PORT_MAX_IDLE_TICKS) ? OS_PORT_MAX_IDLE_TICKS : ticks;
+}
+#endif
+
+/*
+ * WFI. With SIGALRM blocked (masked interrupts or inside the tick handler) the tick is waited for and left
+ * pending, it runs once interrupts are restored. Otherwise the tick handler runs before the return. Without
+ * a running interval timer nothing can wake the core, the wait ends at once, except in simulated time where
+ * the next tick of the started kernel is due at once.
+ */
+void Os_PortStandby(void)
+{
+    struct itimerval timer;
+    sigset_t set;
+    int signal;
+
+    (void)getitimer(ITIMER_REAL, &timer);
+#if (OS_CFG_HOST_TICK_TIMER == 0u)
+    if (Os_CurrentTask != NULL)
+    {
+        (void)raise(SIGALRM);
+    }
+    else
+#endif
+    if ((timer.it_value.tv_sec != 0) || (timer.it_value.tv_usec != 0))
+    {
+        sigemptyset(&set);
+        if ((Os_PortMasked != 0) || (Os_PortInIsr != 0))
+        {
+            sigaddset(&set, SIGALRM);
+            (void)sigwait(&set, &signal);
+            (void)raise(signal);
+        }
+        else
+        {
+            (void)sigsuspend(&set);
+        }
+    }
+}
+
+/*
+ * Block SIGALRM. Returns 1 when it was already masked (or called from the tick handler), else 0.
+ */
+u32bit Os_PortDisableInterrupts(void)
+{
+    u32bit state = 1u;
+
+    if ((Os_PortMasked == 0) && (Os_PortInIsr == 0))
+    {
+        Os_PortSignalMask(SIG_BLOCK);
+        Os_PortMasked = 1;
+        state = 0u;
+    }
+    return state;
+}
+
+/*
+ * Restore the state returned by Os_PortDisableInterrupts, take a pending PendSV and run a pending switch.
+ */
+void Os_PortRestoreInterrupts(u32bit state)
+{
+    if ((state == 0u) && (Os_PortInIsr == 0))
+    {
+        Os_PortPendSV();
+        /* Interrupted code always runs unmasked, whichever task is resumed by the switch */
+        Os_PortMasked = 0;
+        if ((Os_PortSwitchPending != 0) && (Os_CurrentTask != NULL))
+        {
+            Os_PortSwitch();
+        }
+        Os_PortSignalMask(SIG_UNBLOCK);
+    }
+}
+
+#endif /* HOST_BUILD */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | First version of Os_Port_Host.c                                              |
+ *| CMARTI  |  user-004   | 17-Oct-2026 | Add Os_PortTaskUsesFpu                                                       |
+ *| CMARTI  |  user-015   | 17-Oct-2026 | Tickless idle on the interval timer, simulated time without it               |
+ *| CMARTI  |  user-025   | 17-Oct-2026 | Trace points in the tick handler and the task switch                         |
+ *| CMARTI  |  user-013   | 17-Oct-2026 | Add Os_PortStandby, interrupt macros of Core_CM4.h mapped on the port        |
+ *| CMARTI  |  user-015   | 17-Oct-2026 | Standby raises the next tick in simulated time                               |
+ *| CMARTI  |  user-014   | 17-Oct-2026 | Take the PendSV pended by Irq_Defer, bottom halves on the host               |
+***********************************************************************************************************************/
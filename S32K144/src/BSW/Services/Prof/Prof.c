@@ -0,0 +1,174 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Prof.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Prof.c
+    Latency profiling probes, DWT cycle counter on target and monotonic clock on host builds.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Prof.h"
+#if (PROF_CFG_ENABLED == 1u)
+#if defined (HOST_BUILD)
+#include <time.h>
+#endif
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define PROF_NAME(name)                     #name,
+#define PROF_HIST_MAX                       (0xFFFFu)
+#define PROF_CALIBRATION_RUNS               (8u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+Prof_EntryType Prof_Table[PROF_NUM_PROBES];
+const char * const Prof_ProbeNames[PROF_NUM_PROBES] = { PROF_CFG_PROBES(PROF_NAME) };
+u32bit Prof_Overhead;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Histogram bin of a latency: its number of significant bits, 0 for 0.
+ */
+static inline u32bit Prof_Bin(u32bit cycles)
+{
+    u32bit bin = 0u;
+
+    if (cycles != 0u)
+    {
+        bin = 32u - (u32bit)__builtin_clz((unsigned int)cycles);
+    }
+    return (bin < PROF_CFG_HIST_BINS) ? bin : (PROF_CFG_HIST_BINS - 1u);
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+#if defined (HOST_BUILD)
+u32bit Prof_Now(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u32bit)(((u64bit)now.tv_sec * 1000000000uLL) + (u64bit)now.tv_nsec);
+}
+#endif
+
+/*
+ * Enable the DWT cycle counter and keep the smallest of a few empty measurements as overhead.
+ */
+void Prof_Init(void)
+{
+    u32bit run;
+    u32bit start;
+    u32bit cycles;
+
+#if !defined (HOST_BUILD)
+    S32_CoreDebug->DEMCR |= S32_CoreDebug_DEMCR_TRCENA_MASK;
+    S32_DWT->CYCCNT = 0u;
+    S32_DWT->CTRL |= S32_DWT_CTRL_CYCCNTENA_MASK;
+#endif
+
+    Prof_Overhead = 0xFFFFFFFFuL;
+    for (run = 0u; run < PROF_CALIBRATION_RUNS; run++)
+    {
+        start = Prof_Now();
+        cycles = Prof_Now() - start;
+        Prof_Overhead = (cycles < Prof_Overhead) ? cycles : Prof_Overhead;
+    }
+    Prof_Reset();
+}
+
+void Prof_Reset(void)
+{
+    u32bit probe;
+    u32bit bin;
+    u32bit state;
+
+    PROF_CFG_LOCK(state);
+    for (probe = 0u; probe < PROF_NUM_PROBES; probe++)
+    {
+        Prof_Table[probe].count = 0u;
+        Prof_Table[probe].min = 0u;
+        Prof_Table[probe].max = 0u;
+        Prof_Table[probe].sum = 0u;
+        for (bin = 0u; bin < PROF_CFG_HIST_BINS; bin++)
+        {
+            Prof_Table[probe].hist[bin] = 0u;
+        }
+    }
+    PROF_CFG_UNLOCK(state);
+}
+
+void Prof_Record(Prof_ProbeType probe, u32bit cycles)
+{
+    Prof_EntryType * entry = &Prof_Table[probe];
+    u32bit bin;
+    u32bit state;
+
+    cycles = (cycles > Prof_Overhead) ? (cycles - Prof_Overhead) : 0u;
+    bin = Prof_Bin(cycles);
+
+    PROF_CFG_LOCK(state);
+    if ((entry->count == 0u) || (cycles < entry->min))
+    {
+        entry->min = cycles;
+    }
+    if (cycles > entry->max)
+    {
+        entry->max = cycles;
+    }
+    entry->count++;
+    entry->sum += cycles;
+    if (entry->hist[bin] != PROF_HIST_MAX)
+    {
+        entry->hist[bin]++;
+    }
+    PROF_CFG_UNLOCK(state);
+}
+
+u32bit Prof_Mean(Prof_ProbeType probe)
+{
+    u64bit sum;
+    u32bit count;
+    u32bit state;
+
+    PROF_CFG_LOCK(state);
+    sum = Prof_Table[probe].sum;
+    count = Prof_Table[probe].count;
+    PROF_CFG_UNLOCK(state);
+    return (count != 0u) ? (u32bit)(sum / count) : 0u;
+}
+
+#endif /* PROF_CFG_ENABLED */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | First version of Prof.c                                                      |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | Table locked with PROF_CFG_LOCK (Os) instead of a private PRIMASK copy       |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | PROF_CFG_LOCK/UNLOCK keep the previous interrupt state                       |
+***********************************************************************************************************************/
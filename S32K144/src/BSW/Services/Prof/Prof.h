@@ -0,0 +1,113 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Prof.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Prof.h
+    Latency profiling probes.
+    A probe measures the time between PROF_BEGIN(name) and PROF_END(name) in the same scope, in core cycles
+    (DWT CYCCNT) on target and in nanoseconds (monotonic clock) on host builds. Every probe keeps count,
+    min, max, sum (mean) and a log2 histogram in Prof_Table, read it with the debugger or print it from a
+    host test. Probes may be used in functions, tasks and ISRs. A preempted probe includes the time of the
+    preemption, as any latency does.
+    With PROF_CFG_ENABLED 0 the probes expand to nothing and Prof.c is empty.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef PROF_H_
+#define PROF_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Prof_Cfg.h"
+#if (PROF_CFG_ENABLED == 1u) && !defined (HOST_BUILD)
+#include "S32K144.h"
+#endif
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define PROF_PROBE_ID(name)                 PROF_PROBE_##name,
+
+typedef enum
+{
+    PROF_CFG_PROBES(PROF_PROBE_ID)
+    PROF_NUM_PROBES
+} Prof_ProbeType;
+
+typedef struct
+{
+    u32bit count;
+    u32bit min;
+    u32bit max;
+    u64bit sum;
+    u16bit hist[PROF_CFG_HIST_BINS];    /*Saturating counters*/
+} Prof_EntryType;
+
+#if (PROF_CFG_ENABLED == 1u)
+/*Start a measurement, declares the start time in the current scope*/
+#define PROF_BEGIN(probe)                   u32bit Prof_Start_##probe = Prof_Now()
+
+/*End the measurement started in the same scope*/
+#define PROF_END(probe)                     Prof_Record(PROF_PROBE_##probe, Prof_Now() - Prof_Start_##probe)
+#else
+#define PROF_BEGIN(probe)
+#define PROF_END(probe)
+#define Prof_Init()
+#define Prof_Reset()
+#endif
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+#if (PROF_CFG_ENABLED == 1u)
+extern Prof_EntryType Prof_Table[PROF_NUM_PROBES];
+extern const char * const Prof_ProbeNames[PROF_NUM_PROBES];
+
+/*Cost of one empty measurement, already removed from every recorded latency*/
+extern u32bit Prof_Overhead;
+#endif
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+#if (PROF_CFG_ENABLED == 1u)
+/*Start the cycle counter, measure the probe overhead and clear the table*/
+extern void   Prof_Init(void);
+
+/*Clear every probe*/
+extern void   Prof_Reset(void);
+
+/*Add one latency to probe, PROF_END calls it*/
+extern void   Prof_Record(Prof_ProbeType probe, u32bit cycles);
+
+/*Mean latency of probe, 0 before the first measurement*/
+extern u32bit Prof_Mean(Prof_ProbeType probe);
+
+#if defined (HOST_BUILD)
+extern u32bit Prof_Now(void);
+#else
+/*Current cycle count, a single load*/
+static inline u32bit Prof_Now(void)
+{
+    return S32_DWT->CYCCNT;
+}
+#endif
+#endif
+
+#endif /* PROF_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | First version of Prof.h                                                      |
+***********************************************************************************************************************/
@@ -0,0 +1,63 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Prof_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Prof_Cfg.h
+    Configuration of the profiling probes.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef PROF_CFG_H_
+#define PROF_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Core_CM4.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*1: probes compiled in (make PROF=1), 0: every probe and the service itself compile to nothing*/
+#ifndef PROF_CFG_ENABLED
+#define PROF_CFG_ENABLED                    (0u)
+#endif
+
+/*Probes, PROBE(name). Measure with PROF_BEGIN(name)/PROF_END(name)*/
+#define PROF_CFG_PROBES(PROBE)              \
+    PROBE(OsTick)                           \
+    PROBE(NeuralNetInvoke)
+
+/*Protects the table against probes recorded from ISRs or other tasks, nestable, state is a u32bit*/
+#define PROF_CFG_LOCK(state)                SUSPEND_INTERRUPTS(state)
+#define PROF_CFG_UNLOCK(state)              RESUME_INTERRUPTS(state)
+
+/*Histogram bins per probe, bin n counts latencies of n significant bits, the last one everything above*/
+#define PROF_CFG_HIST_BINS                  (20u)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* PROF_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | First version of Prof_Cfg.h                                                  |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | Lock the table with Os_SuspendAllInterrupts like the other services          |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | Lock the table with the Core_CM4.h masking, no Os dependency                 |
+***********************************************************************************************************************/
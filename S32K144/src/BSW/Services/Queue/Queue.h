@@ -0,0 +1,399 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Queue.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Queue.h
+    Lock-free ring buffers, header only.
+    Queue_Spsc: one producer and one consumer (e.g. ISR to task). Both sides are wait-free, each index is
+    written by one side only and published with a release store.
+    Queue_Mpsc: any number of producers (tasks and ISRs of any priority) and one consumer. Producers
+    reserve positions with compare and swap (LDREX/STREX) and publish every slot through its sequence
+    word, so a preempted producer never blocks the others, the consumer just stops at its slot until
+    it is committed.
+    Capacity is a power of two, positions are free running counters masked on access.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef QUEUE_H_
+#define QUEUE_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Core_CM4.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*TRUE when capacity is a non zero power of two*/
+#define QUEUE_IS_POW2(capacity)      (((capacity) != 0u) && (((capacity) & ((capacity) - 1u)) == 0u))
+
+/*Single producer single consumer queue*/
+typedef struct
+{
+    u8bit *         buffer;
+    u32bit          elemSize;           /*Bytes per element*/
+    u32bit          mask;               /*Capacity - 1*/
+    volatile u32bit head;               /*Elements written, producer only*/
+    volatile u32bit tail;               /*Elements read, consumer only*/
+} Queue_SpscType;
+
+/*Multiple producer single consumer queue*/
+typedef struct
+{
+    u8bit *           buffer;
+    volatile u32bit * seq;              /*Per slot, position + 1 once the element at position is committed*/
+    u32bit            elemSize;
+    u32bit            mask;
+    volatile u32bit   head;             /*Positions reserved by producers*/
+    volatile u32bit   tail;             /*Elements read, consumer only*/
+} Queue_MpscType;
+
+/*Static queue of capacity elements of type, capacity must be a power of two.
+ *Usage: QUEUE_SPSC_DEFINE(Can_RxQueue, Can_FrameType, 16u);*/
+#define QUEUE_SPSC_DEFINE(name, type, capacity)                                                     \
+    typedef u8bit name##_CapacityCheck[QUEUE_IS_POW2(capacity) ? 1 : -1];                          \
+    static type name##_Buffer[(capacity)] ALIGNED(8);                                               \
+    static Queue_SpscType name = { (u8bit *)name##_Buffer, (u32bit)sizeof(type), (capacity) - 1u, 0u, 0u }
+
+/*Static multiple producer queue. Sequence words start at 0, which no position of the first lap can match*/
+#define QUEUE_MPSC_DEFINE(name, type, capacity)                                                     \
+    typedef u8bit name##_CapacityCheck[QUEUE_IS_POW2(capacity) ? 1 : -1];                          \
+    static type name##_Buffer[(capacity)] ALIGNED(8);                                               \
+    static volatile u32bit name##_Seq[(capacity)];                                                  \
+    static Queue_MpscType name = { (u8bit *)name##_Buffer, name##_Seq, (u32bit)sizeof(type), (capacity) - 1u, 0u, 0u }
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Element copy, whole words when both sides and the size allow it.
+ */
+static inline void Queue_Copy(u8bit * dst, const u8bit * src, u32bit size)
+{
+    u32bit i;
+
+    if (((((uaddr)dst) | ((uaddr)src) | size) & (sizeof(u32bit) - 1u)) == 0u)
+    {
+        for (i = 0u; i < size; i += (u32bit)sizeof(u32bit))
+        {
+            *(u32bit *)&dst[i] = *(const u32bit *)&src[i];
+        }
+    }
+    else
+    {
+        for (i = 0u; i < size; i++)
+        {
+            dst[i] = src[i];
+        }
+    }
+}
+
+/*
+ * Runtime initialisation of a queue over buffer, FALSE when capacity is not a power of two.
+ */
+static inline boolean Queue_SpscInit(Queue_SpscType * queue, void * buffer, u32bit elemSize, u32bit capacity)
+{
+    boolean valid = FALSE;
+
+    if (QUEUE_IS_POW2(capacity))
+    {
+        queue->buffer = (u8bit *)buffer;
+        queue->elemSize = elemSize;
+        queue->mask = capacity - 1u;
+        queue->head = 0u;
+        queue->tail = 0u;
+        valid = TRUE;
+    }
+    return valid;
+}
+
+/*
+ * Elements waiting, exact for the consumer and an upper bound for the producer.
+ */
+static inline u32bit Queue_SpscCount(const Queue_SpscType * queue)
+{
+    u32bit tail = queue->tail;
+
+    return Core_LoadAcquire(&queue->head) - tail;
+}
+
+/*
+ * Producer: reserve up to *count contiguous free slots without copying. Returns the first slot and
+ * the number granted in *count, NULL when the queue is full. Fill them and call Queue_SpscCommit.
+ */
+static inline void * Queue_SpscReserve(Queue_SpscType * queue, u32bit * count)
+{
+    u32bit head = queue->head;
+    u32bit free = (queue->mask + 1u) - (head - Core_LoadAcquire(&queue->tail));
+    u32bit toEnd = (queue->mask + 1u) - (head & queue->mask);
+    void * slot = NULL;
+
+    if (free < *count)
+    {
+        *count = free;
+    }
+    if (toEnd < *count)
+    {
+        *count = toEnd;
+    }
+    if (*count != 0u)
+    {
+        slot = &queue->buffer[(head & queue->mask) * queue->elemSize];
+    }
+    return slot;
+}
+
+/*
+ * Producer: publish count slots filled after Queue_SpscReserve.
+ */
+static inline void Queue_SpscCommit(Queue_SpscType * queue, u32bit count)
+{
+    Core_StoreRelease(&queue->head, queue->head + count);
+}
+
+/*
+ * Consumer: up to *count contiguous elements in place, NULL when empty. Call Queue_SpscRelease after use.
+ */
+static inline void * Queue_SpscPeek(Queue_SpscType * queue, u32bit * count)
+{
+    u32bit tail = queue->tail;
+    u32bit used = Core_LoadAcquire(&queue->head) - tail;
+    u32bit toEnd = (queue->mask + 1u) - (tail & queue->mask);
+    void * slot = NULL;
+
+    if (used < *count)
+    {
+        *count = used;
+    }
+    if (toEnd < *count)
+    {
+        *count = toEnd;
+    }
+    if (*count != 0u)
+    {
+        slot = &queue->buffer[(tail & queue->mask) * queue->elemSize];
+    }
+    return slot;
+}
+
+/*
+ * Consumer: give back count elements obtained with Queue_SpscPeek.
+ */
+static inline void Queue_SpscRelease(Queue_SpscType * queue, u32bit count)
+{
+    Core_StoreRelease(&queue->tail, queue->tail + count);
+}
+
+/*
+ * Producer: copy up to count elements, returns the number queued (the two segments around the wrap).
+ */
+static inline u32bit Queue_SpscPushBatch(Queue_SpscType * queue, const void * elems, u32bit count)
+{
+    const u8bit * src = (const u8bit *)elems;
+    u32bit done = 0u;
+    u32bit part;
+    u8bit * slot;
+
+    while (done < count)
+    {
+        part = count - done;
+        slot = (u8bit *)Queue_SpscReserve(queue, &part);
+        if (slot == NULL)
+        {
+            break;
+        }
+        Queue_Copy(slot, &src[done * queue->elemSize], part * queue->elemSize);
+        done += part;
+        Queue_SpscCommit(queue, part);
+    }
+    return done;
+}
+
+/*
+ * Consumer: copy out up to count elements, returns the number read.
+ */
+static inline u32bit Queue_SpscPopBatch(Queue_SpscType * queue, void * elems, u32bit count)
+{
+    u8bit * dst = (u8bit *)elems;
+    u32bit done = 0u;
+    u32bit part;
+    const u8bit * slot;
+
+    while (done < count)
+    {
+        part = count - done;
+        slot = (const u8bit *)Queue_SpscPeek(queue, &part);
+        if (slot == NULL)
+        {
+            break;
+        }
+        Queue_Copy(&dst[done * queue->elemSize], slot, part * queue->elemSize);
+        done += part;
+        Queue_SpscRelease(queue, part);
+    }
+    return done;
+}
+
+static inline boolean Queue_SpscPush(Queue_SpscType * queue, const void * elem)
+{
+    return (Queue_SpscPushBatch(queue, elem, 1u) == 1u) ? TRUE : FALSE;
+}
+
+static inline boolean Queue_SpscPop(Queue_SpscType * queue, void * elem)
+{
+    return (Queue_SpscPopBatch(queue, elem, 1u) == 1u) ? TRUE : FALSE;
+}
+
+/*
+ * Runtime initialisation, seq must hold capacity words.
+ */
+static inline boolean Queue_MpscInit(Queue_MpscType * queue, void * buffer, volatile u32bit * seq,
+                                     u32bit elemSize, u32bit capacity)
+{
+    u32bit i;
+    boolean valid = FALSE;
+
+    if (QUEUE_IS_POW2(capacity))
+    {
+        for (i = 0u; i < capacity; i++)
+        {
+            seq[i] = 0u;
+        }
+        queue->buffer = (u8bit *)buffer;
+        queue->seq = seq;
+        queue->elemSize = elemSize;
+        queue->mask = capacity - 1u;
+        queue->head = 0u;
+        queue->tail = 0u;
+        valid = TRUE;
+    }
+    return valid;
+}
+
+/*
+ * Producer: claim up to count consecutive positions, returns the number claimed (0 when full) and the
+ * first position in *pos. Tail is read before head so head - tail never wraps, it may exceed the capacity
+ * when the consumer moved in between.
+ */
+static inline u32bit Queue_MpscClaim(Queue_MpscType * queue, u32bit count, u32bit * pos)
+{
+    u32bit head;
+    u32bit used;
+    u32bit free;
+    u32bit claimed;
+
+    do
+    {
+        /* Clamped again from the requested count on every retry, space may have been freed meanwhile */
+        used = Core_LoadAcquire(&queue->tail);
+        head = queue->head;
+        used = head - used;
+        free = (used < (queue->mask + 1u)) ? ((queue->mask + 1u) - used) : 0u;
+        claimed = (free < count) ? free : count;
+        if (claimed == 0u)
+        {
+            break;
+        }
+    } while (Core_CompareAndSwap(&queue->head, head, head + claimed) == FALSE);
+
+    *pos = head;
+    return claimed;
+}
+
+/*
+ * Producer: reserve one slot for in place filling, NULL when full. Publish it with Queue_MpscCommit(pos).
+ */
+static inline void * Queue_MpscReserve(Queue_MpscType * queue, u32bit * pos)
+{
+    void * slot = NULL;
+
+    if (Queue_MpscClaim(queue, 1u, pos) == 1u)
+    {
+        slot = &queue->buffer[(*pos & queue->mask) * queue->elemSize];
+    }
+    return slot;
+}
+
+static inline void Queue_MpscCommit(Queue_MpscType * queue, u32bit pos)
+{
+    Core_StoreRelease(&queue->seq[pos & queue->mask], pos + 1u);
+}
+
+/*
+ * Producer: copy up to count elements with a single reservation, returns the number queued.
+ */
+static inline u32bit Queue_MpscPushBatch(Queue_MpscType * queue, const void * elems, u32bit count)
+{
+    const u8bit * src = (const u8bit *)elems;
+    u32bit pos;
+    u32bit i;
+
+    count = Queue_MpscClaim(queue, count, &pos);
+    for (i = 0u; i < count; i++)
+    {
+        Queue_Copy(&queue->buffer[((pos + i) & queue->mask) * queue->elemSize], &src[i * queue->elemSize],
+                   queue->elemSize);
+        Queue_MpscCommit(queue, pos + i);
+    }
+    return count;
+}
+
+/*
+ * Consumer: copy out up to count committed elements in order, returns the number read.
+ */
+static inline u32bit Queue_MpscPopBatch(Queue_MpscType * queue, void * elems, u32bit count)
+{
+    u8bit * dst = (u8bit *)elems;
+    u32bit tail = queue->tail;
+    u32bit done;
+
+    for (done = 0u; done < count; done++)
+    {
+        if (Core_LoadAcquire(&queue->seq[tail & queue->mask]) != (tail + 1u))
+        {
+            break;
+        }
+        Queue_Copy(&dst[done * queue->elemSize], &queue->buffer[(tail & queue->mask) * queue->elemSize],
+                   queue->elemSize);
+        tail++;
+    }
+    Core_StoreRelease(&queue->tail, tail);
+    return done;
+}
+
+static inline boolean Queue_MpscPush(Queue_MpscType * queue, const void * elem)
+{
+    return (Queue_MpscPushBatch(queue, elem, 1u) == 1u) ? TRUE : FALSE;
+}
+
+static inline boolean Queue_MpscPop(Queue_MpscType * queue, void * elem)
+{
+    return (Queue_MpscPopBatch(queue, elem, 1u) == 1u) ? TRUE : FALSE;
+}
+
+#endif /* QUEUE_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-006   | 17-Oct-2026 | First version of Queue.h                                                     |
+ *| CMARTI  |  user-006   | 17-Oct-2026 | Queue_MpscClaim clamps the requested count again on every CAS retry          |
+***********************************************************************************************************************/
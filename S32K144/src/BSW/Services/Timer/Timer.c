@@ -0,0 +1,312 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Timer.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Timer.c
+    Hierarchical timing wheel. Level l slot s holds the timers due within 2^(SLOT_BITS * (l + 1)) ticks
+    whose expiry bits [SLOT_BITS * l, SLOT_BITS * (l + 1)) equal s. Every time the level 0 index wraps the
+    current slot of the next level is cascaded: its timers are placed again, now in a lower level. Each
+    timer is cascaded at most LEVELS - 1 times, so the cost per tick does not depend on how many run.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Timer.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define TIMER_SLOTS                 (1uL << TIMER_CFG_SLOT_BITS)
+#define TIMER_SLOT_MASK             (TIMER_SLOTS - 1uL)
+
+/*Longest timeout placed directly*/
+#define TIMER_RANGE                 (1uL << (TIMER_CFG_SLOT_BITS * TIMER_CFG_LEVELS))
+
+/*Timer owning a pending link, pending directly follows node*/
+#define TIMER_FROM_PENDING(link)    ((Timer_Type *)(void *)((u8bit *)(link) - sizeof(Timer_NodeType)))
+
+typedef u8bit Timer_RangeCheck[((TIMER_CFG_SLOT_BITS * TIMER_CFG_LEVELS) < 32u) ? 1 : -1];
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static Timer_NodeType Timer_Wheel[TIMER_CFG_LEVELS][TIMER_SLOTS];
+
+/*TIMER_MODE_DEFERRED callbacks waiting for Timer_RunDeferred*/
+static Timer_NodeType Timer_Deferred;
+
+/*Next tick to process*/
+static u32bit Timer_Now;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+static void Timer_Place(Timer_Type * timer);
+static void Timer_Cascade(u32bit level, u32bit index);
+static void Timer_RunList(Timer_NodeType * list);
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+static inline void Timer_ListInit(Timer_NodeType * list)
+{
+    list->next = list;
+    list->prev = list;
+}
+
+/*
+ * Append link at the tail of list.
+ */
+static inline void Timer_Link(Timer_NodeType * list, Timer_NodeType * link)
+{
+    link->next = list;
+    link->prev = list->prev;
+    list->prev->next = link;
+    list->prev = link;
+}
+
+/*
+ * Unlink from whatever list link is in, no effect when unlinked.
+ */
+static inline void Timer_Unlink(Timer_NodeType * link)
+{
+    if (link->next != NULL)
+    {
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+        link->next = NULL;
+        link->prev = NULL;
+    }
+}
+
+/*
+ * Move every link of from to the empty list to.
+ */
+static inline void Timer_Splice(Timer_NodeType * from, Timer_NodeType * to)
+{
+    if (from->next == from)
+    {
+        Timer_ListInit(to);
+    }
+    else
+    {
+        to->next = from->next;
+        to->prev = from->prev;
+        to->next->prev = to;
+        to->prev->next = to;
+        Timer_ListInit(from);
+    }
+}
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Link timer in the wheel slot of its expiry. Overdue timers expire on the next tick, timers beyond
+ * TIMER_RANGE go to the last top level slot and are placed again when it is cascaded. Lock held.
+ */
+static void Timer_Place(Timer_Type * timer)
+{
+    u32bit expiry = timer->expiry;
+    u32bit delta = expiry - Timer_Now;
+    u32bit level = 0u;
+
+    if ((s32bit)delta < 0)
+    {
+        expiry = Timer_Now;
+        delta = 0u;
+    }
+    else if (delta >= TIMER_RANGE)
+    {
+        expiry = Timer_Now + TIMER_RANGE - 1u;
+        delta = TIMER_RANGE - 1u;
+    }
+    else
+    {
+    }
+
+    while (delta >= TIMER_SLOTS)
+    {
+        delta >>= TIMER_CFG_SLOT_BITS;
+        level++;
+    }
+    Timer_Link(&Timer_Wheel[level][(expiry >> (level * TIMER_CFG_SLOT_BITS)) & TIMER_SLOT_MASK], &timer->node);
+}
+
+/*
+ * Place again every timer of a slot, they land in lower levels. Lock held.
+ */
+static void Timer_Cascade(u32bit level, u32bit index)
+{
+    Timer_NodeType list;
+    Timer_Type * timer;
+
+    Timer_Splice(&Timer_Wheel[level][index], &list);
+    while (list.next != &list)
+    {
+        timer = (Timer_Type *)(void *)list.next;
+        Timer_Unlink(&timer->node);
+        Timer_Place(timer);
+    }
+}
+
+/*
+ * Run the callbacks of list in order, without the lock so they can start and stop timers.
+ */
+static void Timer_RunList(Timer_NodeType * list)
+{
+    Timer_Type * timer;
+
+    TIMER_CFG_LOCK();
+    while (list->next != list)
+    {
+        timer = TIMER_FROM_PENDING(list->next);
+        Timer_Unlink(&timer->pending);
+        TIMER_CFG_UNLOCK();
+        timer->callback(timer->arg);
+        TIMER_CFG_LOCK();
+    }
+    TIMER_CFG_UNLOCK();
+}
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+void Timer_Init(void)
+{
+    u32bit level;
+    u32bit slot;
+
+    for (level = 0u; level < TIMER_CFG_LEVELS; level++)
+    {
+        for (slot = 0u; slot < TIMER_SLOTS; slot++)
+        {
+            Timer_ListInit(&Timer_Wheel[level][slot]);
+        }
+    }
+    Timer_ListInit(&Timer_Deferred);
+    Timer_Now = 0u;
+}
+
+void Timer_Setup(Timer_Type * timer, Timer_CallbackType callback, void * arg, u8bit mode)
+{
+    timer->node.next = NULL;
+    timer->node.prev = NULL;
+    timer->pending.next = NULL;
+    timer->pending.prev = NULL;
+    timer->expiry = 0u;
+    timer->period = 0u;
+    timer->callback = callback;
+    timer->arg = arg;
+    timer->mode = mode;
+}
+
+void Timer_Start(Timer_Type * timer, u32bit ticks, u32bit period)
+{
+    TIMER_CFG_LOCK();
+    Timer_Unlink(&timer->node);
+    Timer_Unlink(&timer->pending);
+    timer->expiry = Timer_Now + ((ticks == 0u) ? 0u : (ticks - 1u));
+    timer->period = period;
+    Timer_Place(timer);
+    TIMER_CFG_UNLOCK();
+}
+
+void Timer_Stop(Timer_Type * timer)
+{
+    TIMER_CFG_LOCK();
+    Timer_Unlink(&timer->node);
+    Timer_Unlink(&timer->pending);
+    TIMER_CFG_UNLOCK();
+}
+
+boolean Timer_IsActive(const Timer_Type * timer)
+{
+    return ((timer->node.next != NULL) || (timer->pending.next != NULL)) ? TRUE : FALSE;
+}
+
+/*
+ * Cascade the upper levels when the level 0 index wraps, then expire the current level 0 slot. Periodic
+ * timers are placed again from their expiry before any callback runs.
+ */
+void Timer_Tick(void)
+{
+    Timer_NodeType expired;
+    Timer_NodeType due;
+    Timer_Type * timer;
+    u32bit index;
+    u32bit level = 1u;
+    boolean defer = FALSE;
+
+    TIMER_CFG_LOCK();
+    index = Timer_Now & TIMER_SLOT_MASK;
+    while ((index == 0u) && (level < TIMER_CFG_LEVELS))
+    {
+        index = (Timer_Now >> (level * TIMER_CFG_SLOT_BITS)) & TIMER_SLOT_MASK;
+        Timer_Cascade(level, index);
+        level++;
+    }
+
+    Timer_Splice(&Timer_Wheel[0][Timer_Now & TIMER_SLOT_MASK], &expired);
+    Timer_Now++;
+
+    Timer_ListInit(&due);
+    while (expired.next != &expired)
+    {
+        timer = (Timer_Type *)(void *)expired.next;
+        Timer_Unlink(&timer->node);
+        if (timer->period != 0u)
+        {
+            timer->expiry += timer->period;
+            Timer_Place(timer);
+        }
+        if (timer->pending.next == NULL)
+        {
+            if (timer->mode == TIMER_MODE_DEFERRED)
+            {
+                Timer_Link(&Timer_Deferred, &timer->pending);
+                defer = TRUE;
+            }
+            else
+            {
+                Timer_Link(&due, &timer->pending);
+            }
+        }
+    }
+    TIMER_CFG_UNLOCK();
+
+    if (defer == TRUE)
+    {
+        TIMER_CFG_DEFER();
+    }
+    Timer_RunList(&due);
+}
+
+void Timer_RunDeferred(u32bit data)
+{
+    (void)data;
+    Timer_RunList(&Timer_Deferred);
+}
+
+u32bit Timer_GetTickCount(void)
+{
+    return Timer_Now;
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-016   | 17-Oct-2026 | First version of Timer.c                                                     |
+***********************************************************************************************************************/
@@ -0,0 +1,105 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Timer.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Timer.h
+    Software timers on a hierarchical timing wheel: start, stop and expiry in constant time whatever the
+    number of running timers. Timer_Tick advances the wheel by one tick, call it once per time base tick,
+    e.g. from a 1 ms task. Callbacks run from Timer_Tick (TIMER_MODE_TICK) or later from Timer_RunDeferred
+    (TIMER_MODE_DEFERRED), periodic timers are reloaded from their expiry tick so they do not drift:
+
+        static void Dcm_S3Timeout(void * arg) { ...back to the default session... }
+        TIMER_DEFINE(Dcm_S3Timer, Dcm_S3Timeout, NULL, TIMER_MODE_DEFERRED);
+
+        Timer_Start(&Dcm_S3Timer, 5000u, 0u);
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef TIMER_H_
+#define TIMER_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Timer_Cfg.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Callback context*/
+#define TIMER_MODE_TICK         (0u)
+#define TIMER_MODE_DEFERRED     (1u)
+
+/*Circular list link, unlinked when next is NULL*/
+typedef struct Timer_Node
+{
+    struct Timer_Node * next;
+    struct Timer_Node * prev;
+} Timer_NodeType;
+
+typedef void (*Timer_CallbackType)(void * arg);
+
+/*Timer object, owned by the caller. node and pending must stay the first two members*/
+typedef struct
+{
+    Timer_NodeType     node;            /*Wheel slot while running*/
+    Timer_NodeType     pending;         /*Expired, callback not run yet*/
+    u32bit             expiry;          /*Tick of the next expiry*/
+    u32bit             period;          /*Reload in ticks, 0 = one shot*/
+    Timer_CallbackType callback;
+    void *             arg;
+    u8bit              mode;
+} Timer_Type;
+
+/*Static timer, stopped*/
+#define TIMER_DEFINE(name, callback, arg, mode)                                                     \
+    static Timer_Type name = { { NULL, NULL }, { NULL, NULL }, 0u, 0u, (callback), (arg), (mode) }
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Empty the wheel, call once before any other service*/
+extern void Timer_Init(void);
+
+/*Runtime initialisation of a timer, same as TIMER_DEFINE*/
+extern void Timer_Setup(Timer_Type * timer, Timer_CallbackType callback, void * arg, u8bit mode);
+
+/*(Re)start timer to expire after ticks Timer_Tick calls (0 behaves like 1), then every period ticks when not 0.
+  A callback of the previous run that did not run yet is dropped*/
+extern void Timer_Start(Timer_Type * timer, u32bit ticks, u32bit period);
+
+/*Stop timer and drop its pending callback*/
+extern void Timer_Stop(Timer_Type * timer);
+
+/*TRUE while running or with a callback pending*/
+extern boolean Timer_IsActive(const Timer_Type * timer);
+
+/*Advance the wheel by one tick and run the TIMER_MODE_TICK callbacks due*/
+extern void Timer_Tick(void);
+
+/*Run the pending TIMER_MODE_DEFERRED callbacks, data is unused (Irq bottom half signature)*/
+extern void Timer_RunDeferred(u32bit data);
+
+/*Ticks processed since Timer_Init*/
+extern u32bit Timer_GetTickCount(void);
+
+#endif /* TIMER_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-016   | 17-Oct-2026 | First version of Timer.h                                                     |
+***********************************************************************************************************************/
@@ -0,0 +1,57 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Timer_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Timer_Cfg.h
+    Configuration of the software timer service.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef TIMER_CFG_H_
+#define TIMER_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Os.h"
+#include "Irq.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Wheel geometry: TIMER_CFG_LEVELS wheels of 2^TIMER_CFG_SLOT_BITS slots each. Timeouts up to
+  2^(SLOT_BITS * LEVELS) ticks are placed directly, longer ones are placed again on every top level
+  cascade. RAM: (LEVELS << SLOT_BITS) list heads of two pointers*/
+#define TIMER_CFG_SLOT_BITS           (6u)
+#define TIMER_CFG_LEVELS              (4u)
+
+/*Protects the wheel against Timer_Tick, nestable*/
+#define TIMER_CFG_LOCK()              Os_SuspendAllInterrupts()
+#define TIMER_CFG_UNLOCK()            Os_ResumeAllInterrupts()
+
+/*Request a call of Timer_RunDeferred(0u) outside the tick, e.g. as an Irq bottom half from PendSV*/
+#define TIMER_CFG_DEFER()             ((void)Irq_Defer(Timer_RunDeferred, 0u))
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* TIMER_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-016   | 17-Oct-2026 | First version of Timer_Cfg.h                                                 |
+***********************************************************************************************************************/
@@ -0,0 +1,107 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Trace.c $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Trace.c
+    Event trace recorder, DWT cycle counter on target and monotonic clock on host builds.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Trace.h"
+#if (TRACE_CFG_ENABLED == 1u)
+#if defined (HOST_BUILD)
+#include <time.h>
+#endif
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#if defined (HOST_BUILD)
+#define TRACE_CLOCK_HZ                      (1000000000uL)
+#else
+#define TRACE_CLOCK_HZ                      TRACE_CFG_CLOCK_HZ
+#endif
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+Trace_BufferType Trace_Buffer;
+
+/*                                           Private functions prototypes                                            */
+/*********************************************************************************************************************/
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                                Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+#if defined (HOST_BUILD)
+u32bit Trace_Now(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u32bit)(((u64bit)now.tv_sec * 1000000000uLL) + (u64bit)now.tv_nsec);
+}
+#endif
+
+/*
+ * Enable the DWT cycle counter (shared with Prof) and start an empty trace.
+ */
+void Trace_Init(void)
+{
+    u32bit slot;
+
+#if !defined (HOST_BUILD)
+    S32_CoreDebug->DEMCR |= S32_CoreDebug_DEMCR_TRCENA_MASK;
+    S32_DWT->CTRL |= S32_DWT_CTRL_CYCCNTENA_MASK;
+#endif
+
+    Trace_Buffer.stopped = 1u;
+    for (slot = 0u; slot < TRACE_EVENTS; slot++)
+    {
+        Trace_Buffer.event[slot].time = 0u;
+        Trace_Buffer.event[slot].info = TRACE_EVENT_NONE;
+    }
+    Trace_Buffer.magic = TRACE_MAGIC;
+    Trace_Buffer.events = TRACE_EVENTS;
+    Trace_Buffer.clockHz = TRACE_CLOCK_HZ;
+    Trace_Buffer.index = 0u;
+    Core_StoreRelease(&Trace_Buffer.stopped, 0u);
+}
+
+void Trace_Start(void)
+{
+    Core_StoreRelease(&Trace_Buffer.stopped, 0u);
+}
+
+void Trace_Stop(void)
+{
+    Core_StoreRelease(&Trace_Buffer.stopped, 1u);
+}
+
+#endif /* TRACE_CFG_ENABLED */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-025   | 17-Oct-2026 | First version of Trace.c                                                     |
+***********************************************************************************************************************/
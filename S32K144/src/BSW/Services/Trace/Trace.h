@@ -0,0 +1,176 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Trace.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Trace.h
+    Event trace recorder.
+    Trace points write 8 byte timestamped events (ISR enter/exit, task switch, user markers) into
+    Trace_Buffer, a circular buffer that keeps the last TRACE_EVENTS events. A writer claims its slot with
+    a compare and swap on the free running index and reads the timestamp inside the loop: an interrupt
+    between both retries, so tasks and ISRs of any priority write without masking interrupts and index
+    order is time order.
+    Timestamps are core cycles (DWT CYCCNT) on target and nanoseconds on host builds, 32 bit: events more
+    than 2^31 clocks apart (44 s at 48 MHz) can not be put in order.
+    Dump Trace_Buffer with the debugger (gdb: dump binary value trace.bin Trace_Buffer) and convert it with
+    tools/TraceView for chrome://tracing or Perfetto.
+    With TRACE_CFG_ENABLED 0 the trace points expand to nothing and Trace.c is empty.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef TRACE_H_
+#define TRACE_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Std_Types.h"
+#include "Trace_Cfg.h"
+#if (TRACE_CFG_ENABLED == 1u)
+#include "Core_CM4.h"
+#if !defined (HOST_BUILD)
+#include "S32K144.h"
+#endif
+#endif
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define TRACE_MAGIC                         (0x45435254uL) /*"TRCE"*/
+#define TRACE_EVENTS                        (1uL << TRACE_CFG_EVENTS_LOG2)
+
+/*Event types*/
+#define TRACE_EVENT_NONE                    (0u)    /*Slot never written*/
+#define TRACE_EVENT_ISR_ENTER               (1u)    /*id: exception number*/
+#define TRACE_EVENT_ISR_EXIT                (2u)    /*id: exception number*/
+#define TRACE_EVENT_TASK                    (3u)    /*id: priority, data: low half of the control block address*/
+#define TRACE_EVENT_MARK                    (4u)    /*id: Trace_MarkType, data: value*/
+
+/*Exception numbers (IPSR) of the kernel handlers, device interrupt n is TRACE_EXC_IRQ(n)*/
+#define TRACE_EXC_PENDSV                    (14u)
+#define TRACE_EXC_SYSTICK                   (15u)
+#define TRACE_EXC_IRQ(irq)                  ((u32bit)(irq) + 16u)
+
+/*
+ * Event word: type [31:28], lap [27:24], id [23:16], data [15:0]. The lap (bits of the index above the
+ * slot) tells the decoder a slot still holding an event of an older lap: claimed, not written yet.
+ */
+#define TRACE_INFO(type, index, id, data)   (((u32bit)(type) << 28) |                                   \
+                                             ((((u32bit)(index) >> TRACE_CFG_EVENTS_LOG2) & 0xFu) << 24) | \
+                                             (((u32bit)(id) & 0xFFu) << 16) | ((u32bit)(data) & 0xFFFFu))
+
+#define TRACE_MARK_ID(name)                 TRACE_MARK_##name,
+
+typedef enum
+{
+    TRACE_CFG_MARKS(TRACE_MARK_ID)
+    TRACE_NUM_MARKS
+} Trace_MarkType;
+
+typedef struct
+{
+    u32bit time;
+    u32bit info;                        /*TRACE_INFO*/
+} Trace_EventType;
+
+/*Layout read by tools/TraceView, every field a little endian word*/
+typedef struct
+{
+    u32bit          magic;              /*TRACE_MAGIC once Trace_Init ran*/
+    u32bit          events;             /*TRACE_EVENTS*/
+    u32bit          clockHz;            /*Timestamp clock*/
+    volatile u32bit index;              /*Events written since Trace_Init, free running*/
+    volatile u32bit stopped;            /*1 = trace points do nothing (Trace_Stop)*/
+    Trace_EventType event[TRACE_EVENTS];
+} Trace_BufferType;
+
+#if (TRACE_CFG_ENABLED == 1u)
+/*ISR entry and exit, first and last statement of the handler. exception: TRACE_EXC_* */
+#define TRACE_ISR_ENTER(exception)          Trace_Record(TRACE_EVENT_ISR_ENTER, (exception), 0u)
+#define TRACE_ISR_EXIT(exception)           Trace_Record(TRACE_EVENT_ISR_EXIT, (exception), 0u)
+
+/*task (control block) starts running, called by the Os ports*/
+#define TRACE_TASK_SWITCH(priority, task)   Trace_Record(TRACE_EVENT_TASK, (priority), (u32bit)(uaddr)(task))
+
+/*User marker of TRACE_CFG_MARKS with a 16 bit value*/
+#define TRACE_MARK(name, value)             Trace_Record(TRACE_EVENT_MARK, TRACE_MARK_##name, (value))
+#else
+#define TRACE_ISR_ENTER(exception)
+#define TRACE_ISR_EXIT(exception)
+#define TRACE_TASK_SWITCH(priority, task)
+#define TRACE_MARK(name, value)
+#define Trace_Init()
+#define Trace_Start()
+#define Trace_Stop()
+#endif
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+#if (TRACE_CFG_ENABLED == 1u)
+extern Trace_BufferType Trace_Buffer;
+#endif
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+#if (TRACE_CFG_ENABLED == 1u)
+/*Start the cycle counter, clear the buffer and start recording*/
+extern void Trace_Init(void);
+
+/*Resume recording after Trace_Stop, the buffer is kept*/
+extern void Trace_Start(void);
+
+/*Freeze the buffer, e.g. when the condition of interest was seen, before dumping it*/
+extern void Trace_Stop(void);
+
+#if defined (HOST_BUILD)
+extern u32bit Trace_Now(void);
+#else
+/*Current cycle count, a single load*/
+static inline u32bit Trace_Now(void)
+{
+    return S32_DWT->CYCCNT;
+}
+#endif
+
+/*
+ * Write one event, lock-free. A claim interrupted before its compare and swap is retried with a new
+ * timestamp. An interrupt between the claim and the two stores leaves the slot of the older lap in
+ * place for that time, TRACE_INFO carries the lap so the decoder skips it.
+ */
+static inline void Trace_Record(u32bit type, u32bit id, u32bit data)
+{
+    u32bit index;
+    u32bit time;
+    Trace_EventType * event;
+
+    if (Trace_Buffer.stopped == 0u)
+    {
+        do
+        {
+            index = Trace_Buffer.index;
+            time = Trace_Now();
+        } while (Core_CompareAndSwap(&Trace_Buffer.index, index, index + 1u) == FALSE);
+
+        event = &Trace_Buffer.event[index & (TRACE_EVENTS - 1u)];
+        event->time = time;
+        event->info = TRACE_INFO(type, index, id, data);
+    }
+}
+#endif
+
+#endif /* TRACE_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-025   | 17-Oct-2026 | First version of Trace.h                                                     |
+***********************************************************************************************************************/
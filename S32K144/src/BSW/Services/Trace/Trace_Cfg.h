@@ -0,0 +1,59 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Trace_Cfg.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Trace_Cfg.h
+    Configuration of the event trace recorder.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef TRACE_CFG_H_
+#define TRACE_CFG_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*1: recorder compiled in (make TRACE=1), 0: every trace point and the service itself compile to nothing*/
+#ifndef TRACE_CFG_ENABLED
+#define TRACE_CFG_ENABLED                   (0u)
+#endif
+
+/*Events kept, 1 << TRACE_CFG_EVENTS_LOG2, 8 bytes each*/
+#ifndef TRACE_CFG_EVENTS_LOG2
+#define TRACE_CFG_EVENTS_LOG2               (9u)
+#endif
+
+/*Timestamp clock, core clock (OS_CFG_CORE_CLOCK_HZ) on target, nanoseconds on host builds*/
+#define TRACE_CFG_CLOCK_HZ                  (48000000uL)
+
+/*User markers, MARK(name). Record with TRACE_MARK(name, value), tools/TraceView reads the names here*/
+#define TRACE_CFG_MARKS(MARK)               \
+    MARK(DcmRequest)
+
+/*                                                    Exported Variables                                              */
+/**********************************************************************************************************************/
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+
+#endif /* TRACE_CFG_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-025   | 17-Oct-2026 | First version of Trace_Cfg.h                                                 |
+***********************************************************************************************************************/
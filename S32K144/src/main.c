@@ -13,7 +13,7 @@
 /* DESCRIPTION :                                                                                                     */
 /** \main.c
     Main function of the program.
-    Here we call all functionalities
+    Here we call all functionalities: service initialization, then the Os runs the periodic tasks.
  */
 /*********************************************************************************************************************/
 /* ALL RIGHTS RESERVED                                                                                               */
@@ -26,15 +26,39 @@
 /*                                                       Includes                                                    */
 /*********************************************************************************************************************/
 #include "Std_Types.h"
+#include "Os.h"
+#include "Irq.h"
+#include "MemPool.h"
+#include "Prof.h"
+#include "Trace.h"
+#include "Timer.h"
+#include "CanTp.h"
+#include "Dcm.h"
+#include "Crc.h"
+#include "Startup_Warm.h"
+#if defined (HOST_BUILD)
+#include "Can_Host.h"
+#else
+#include "Can.h"
+#endif
 
 /*                                                Constants and types                                                */
 /*********************************************************************************************************************/
+/*Communication task: timer wheel and diagnostic stack every tick*/
+#define MAIN_COM_STACK_WORDS      (256u)
+#define MAIN_COM_PRIORITY         (4u)
+#define MAIN_COM_PERIOD_TICKS     (1u)
+
+/*Ticks of normal operation before the warm start count of the bootloader is cleared*/
+#define MAIN_HEALTHY_TICKS        (1000u)
 
 /*                                                      Variables                                                    */
 /*********************************************************************************************************************/
+OS_TASK_DEFINE(Main_ComTask, MAIN_COM_STACK_WORDS);
 
 /*                                           Private functions prototypes                                            */
 /*********************************************************************************************************************/
+static void Main_ComEntry(void * arg);
 
 /*                                                 Inline functions                                                  */
 /*********************************************************************************************************************/
@@ -42,12 +66,60 @@
 /*                                                Private functions                                                  */
 /*********************************************************************************************************************/
 
+/*
+ * Communication task body.
+ */
+static void Main_ComEntry(void * arg)
+{
+    u32bit healthy = MAIN_HEALTHY_TICKS;
+
+    (void)arg;
+    for (;;)
+    {
+#if defined (HOST_BUILD)
+        (void)Can_HostProcess();
+#else
+        Can_MainFunction();
+#endif
+        CanTp_MainFunction();
+        Dcm_MainFunction();
+        Timer_Tick();
+        if (healthy != 0u)
+        {
+            healthy--;
+            if (healthy == 0u)
+            {
+                StartupWarm_Healthy();
+            }
+        }
+        Os_Delay(MAIN_COM_PERIOD_TICKS);
+    }
+}
+
 int main (void)
 {
+    Trace_Init();
+    Prof_Init();
+    (void)MemPool_Init();
+    Crc_Init();
+    Timer_Init();
+#if !defined (HOST_BUILD)
+    Can_Init();
+#endif
+    CanTp_Init();
+    Dcm_Init();
+    (void)Irq_Init();
+
+    Os_Init();
+    Os_TaskCreate(&Main_ComTask, Main_ComEntry, NULL, MAIN_COM_PRIORITY, OS_TASK_STACK(Main_ComTask));
+    Os_Start();
 	return EXIT_PROGRAM;
 }
 
 /***************************************************Log Projects********************************************************
  *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
  *| CMARTI  |     NA      | 28-Apr-2021 | First version of main.c                                                      |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | Start the services and the Os, communication task                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | FlexCAN driver on target                                                     |
+ *| CMARTI  |  user-014   | 17-Oct-2026 | Irq_Init ahead of Os_Start, PendSV runs the bottom halves                    |
 ***********************************************************************************************************************/
@@ -0,0 +1,135 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Bench.cpp
+    Micro-benchmark harness: case registry, clocks, report and main.
+    usage: Project_bench [kernel]    runs the cases whose kernel name contains the argument, all by default
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h>
+#endif
+#include "Bench.h"
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define BENCH_MAX_CASES                     (64u)
+
+typedef struct
+{
+    const char *   kernel;
+    Bench_CaseType run;
+} Bench_EntryType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static Bench_EntryType Bench_Cases[BENCH_MAX_CASES];
+static u32bit Bench_NumCases;
+
+/*                                           External functions implementation                                       */
+/*********************************************************************************************************************/
+
+Bench_Register::Bench_Register(const char * kernel, Bench_CaseType run)
+{
+    if (Bench_NumCases < BENCH_MAX_CASES)
+    {
+        Bench_Cases[Bench_NumCases].kernel = kernel;
+        Bench_Cases[Bench_NumCases].run = run;
+        Bench_NumCases++;
+    }
+}
+
+u64bit Bench_Nanoseconds(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((u64bit)now.tv_sec * 1000000000uLL) + (u64bit)now.tv_nsec;
+}
+
+u64bit Bench_Cycles(void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+    return (u64bit)__rdtsc();
+#else
+    return Bench_Nanoseconds();
+#endif
+}
+
+void Bench_Report(const char * variant, u64bit ops, u64bit bytes, u64bit ns, u64bit cycles)
+{
+    double seconds = (double)ns * 1e-9;
+
+    if ((ops == 0u) || (ns == 0u))
+    {
+        printf("  %-44s %12s\n", variant, "no time");
+    }
+    else if (bytes != 0u)
+    {
+        printf("  %-44s %12.2f %12.1f %12.3f %12.1f\n", variant, (double)ns / (double)ops,
+               (double)cycles / (double)ops, (double)ops / seconds * 1e-6, (double)bytes / seconds * 1e-6);
+    }
+    else
+    {
+        printf("  %-44s %12.2f %12.1f %12.3f %12s\n", variant, (double)ns / (double)ops,
+               (double)cycles / (double)ops, (double)ops / seconds * 1e-6, "-");
+    }
+    (void)fflush(stdout);
+}
+
+void Bench_Note(const char * format, ...)
+{
+    va_list args;
+
+    printf("  ");
+    va_start(args, format);
+    (void)vprintf(format, args);
+    va_end(args);
+    printf("\n");
+    (void)fflush(stdout);
+}
+
+int main(int argc, char ** argv)
+{
+    const char * filter = (argc > 1) ? argv[1] : "";
+    u32bit i;
+
+    printf("  %-44s %12s %12s %12s %12s\n", "variant", "ns/op", "cycles/op", "Mops/s", "MB/s");
+    for (i = 0u; i < Bench_NumCases; i++)
+    {
+        if (strstr(Bench_Cases[i].kernel, filter) != NULL)
+        {
+            printf("%s\n", Bench_Cases[i].kernel);
+            Bench_Cases[i].run();
+        }
+    }
+    return 0;
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-013   | 17-Oct-2026 | First version of Bench.cpp                                                   |
+***********************************************************************************************************************/
@@ -0,0 +1,135 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Bench.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Bench.h
+    Micro-benchmark harness of the host build (make HOST=1 bench).
+    A kernel registers one case with BENCH(kernel), the case measures its variants with Bench_Run:
+
+        BENCH(Crc)
+        {
+            Bench_Run("crc32 slice8 4 KB", 1u, sizeof(buffer), [&]() { crc = Crc_CalculateCRC32(...); });
+        }
+
+    Bench_Run grows the batch until it lasts BENCH_BATCH_NS, then keeps the fastest of BENCH_REPEAT batches
+    and prints latency (ns and TSC cycles per operation) and throughput (operations/s, MB/s). Host cycles
+    are time stamp counter ticks at the nominal clock, for comparisons between variants, not target cycles.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef BENCH_H_
+#define BENCH_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+extern "C" {
+#include "Std_Types.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define BENCH_BATCH_NS                      (20000000uLL)   /*20 ms per batch*/
+#define BENCH_REPEAT                        (5u)
+#define BENCH_MAX_CALLS                     (1uLL << 30)
+
+/*Case of a kernel, BENCH(kernel) registers it, cases run in link order*/
+typedef void (*Bench_CaseType)(void);
+
+struct Bench_Register
+{
+    Bench_Register(const char * kernel, Bench_CaseType run);
+};
+
+#define BENCH(kernel)                                                                               \
+    static void Bench_##kernel(void);                                                               \
+    static Bench_Register Bench_Register_##kernel(#kernel, Bench_##kernel);                         \
+    static void Bench_##kernel(void)
+
+/*                                              Exported functions prototypes                                         */
+/**********************************************************************************************************************/
+/*Monotonic nanoseconds and time stamp counter*/
+extern u64bit Bench_Nanoseconds(void);
+extern u64bit Bench_Cycles(void);
+
+/*One result row: calls * ops operations and calls * bytes bytes in ns nanoseconds and cycles TSC ticks*/
+extern void Bench_Report(const char * variant, u64bit ops, u64bit bytes, u64bit ns, u64bit cycles);
+
+/*Free text row under the current kernel, e.g. a ratio or a size*/
+extern void Bench_Note(const char * format, ...) __attribute__((format(printf, 1, 2)));
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Keep a result alive, the compiler may not drop the computation behind it.
+ */
+template <typename Type>
+static inline void Bench_Keep(const Type & value)
+{
+    __asm volatile ("" : : "g" (&value) : "memory");
+}
+
+/*
+ * Measure body, ops operations and bytes bytes per call (bytes 0: no MB/s column).
+ */
+template <typename Body>
+static inline void Bench_Run(const char * variant, u32bit ops, u32bit bytes, Body body)
+{
+    u64bit calls = 1u;
+    u64bit start;
+    u64bit ns;
+    u64bit cycles;
+    u64bit bestNs = ~0uLL;
+    u64bit bestCycles = 0u;
+    u64bit i;
+    u32bit run;
+
+    do
+    {
+        calls *= 2u;
+        start = Bench_Nanoseconds();
+        for (i = 0u; i < calls; i++)
+        {
+            body();
+        }
+        ns = Bench_Nanoseconds() - start;
+    } while ((ns < BENCH_BATCH_NS) && (calls < BENCH_MAX_CALLS));
+
+    for (run = 0u; run < BENCH_REPEAT; run++)
+    {
+        start = Bench_Nanoseconds();
+        cycles = Bench_Cycles();
+        for (i = 0u; i < calls; i++)
+        {
+            body();
+        }
+        cycles = Bench_Cycles() - cycles;
+        ns = Bench_Nanoseconds() - start;
+        if (ns < bestNs)
+        {
+            bestNs = ns;
+            bestCycles = cycles;
+        }
+    }
+    Bench_Report(variant, calls * ops, calls * bytes, bestNs, bestCycles);
+}
+
+#endif /* BENCH_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                Description                                   |
+ *| CMARTI  |  user-013   | 17-Oct-2026 | First version of Bench.h                                                     |
+***********************************************************************************************************************/
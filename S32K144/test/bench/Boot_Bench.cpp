@@ -0,0 +1,275 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Boot_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Boot_Bench.cpp
+    Bootloader reprogramming time (make HOST=1 BOOT=1 bench), in the simulated time of the FTFC model:
+    FTFC erase and phrase programming throughput, and a 510 KB image downloaded by the tester over UDS
+    (0x10 0x02, 0x34, 0x36 blocks, 0x37) through the bootloader loop, with an unlimited bus and with the
+    frame rate of a 500 kbit/s bus.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <algorithm>
+#include <vector>
+#include "Bench.h"
+extern "C" {
+#include "Boot.h"
+#include "Fls.h"
+#include "Ftfc_Host.h"
+#include "Can_Host.h"
+#include "CanTp.h"
+#include "Dcm.h"
+#include "MemPool.h"
+#include "Timer.h"
+#include "Crc.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define BOOT_BENCH_IMAGE_SIZE               (510u * 1024u)
+
+/*8 byte frame on a 500 kbit/s bus, about 125 bits with stuffing and IFS*/
+#define BOOT_BENCH_FRAME_US                 (250u)
+
+/*Simulated time a download may take*/
+#define BOOT_BENCH_LIMIT_US                 (300000000u)
+
+/*Time and activity of a download*/
+typedef struct
+{
+    u32bit timeUs;
+    u32bit busyUs;                                  /*FTFC running a command*/
+    u32bit frames;
+    u32bit pending;                                 /*Response pending (0x78) answers*/
+    boolean ok;
+} Boot_BenchResultType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static u32bit Boot_BenchFrameUs;                    /*0 = unlimited bus*/
+static u32bit Boot_BenchBusCreditUs;
+static u32bit Boot_BenchPending;
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * One pass of the bootloader loop (Boot_Main.c): FTFC steps on every pass, CAN stack on the 1 ms tick. The bus
+ * delivers one frame per Boot_BenchFrameUs of simulated time.
+ */
+static void Boot_BenchLoop(void)
+{
+    u32bit before = Ftfc_HostTimeUs / 1000u;
+
+    Boot_MainFunction();
+    Ftfc_HostAdvance(BOOT_CFG_HOST_LOOP_US);
+    if (Boot_BenchFrameUs == 0u)
+    {
+        (void)Can_HostProcess();
+    }
+    else
+    {
+        Boot_BenchBusCreditUs += BOOT_CFG_HOST_LOOP_US;
+        while ((Boot_BenchBusCreditUs >= Boot_BenchFrameUs) && (Can_HostDeliver(1u) == 1u))
+        {
+            Boot_BenchBusCreditUs -= Boot_BenchFrameUs;
+        }
+        /* An idle bus does not save time for later frames */
+        Boot_BenchBusCreditUs = (Boot_BenchBusCreditUs > Boot_BenchFrameUs) ? Boot_BenchFrameUs : Boot_BenchBusCreditUs;
+    }
+    if ((Ftfc_HostTimeUs / 1000u) != before)
+    {
+        CanTp_MainFunction();
+        Dcm_MainFunction();
+        Timer_Tick();
+    }
+}
+
+/*
+ * Tester request and its final response (response pending answers skipped), TRUE when it is positive.
+ */
+static boolean Boot_BenchRequest(const u8bit * request, u16bit length)
+{
+    const u8bit * response;
+    u16bit received = 0u;
+    u32bit start = Ftfc_HostTimeUs;
+    boolean done = FALSE;
+    boolean positive = FALSE;
+
+    while (Can_HostTesterRequest(request, length) == FALSE)
+    {
+        Boot_BenchLoop();
+    }
+    while ((done == FALSE) && ((Ftfc_HostTimeUs - start) < BOOT_BENCH_LIMIT_US))
+    {
+        Boot_BenchLoop();
+        response = Can_HostTesterResponse(&received);
+        if (response != NULL)
+        {
+            if ((received == 3u) && (response[0] == 0x7Fu) && (response[2] == 0x78u))
+            {
+                Boot_BenchPending++;
+            }
+            else
+            {
+                positive = ((received != 0u) && (response[0] == (u8bit)(request[0] + 0x40u))) ? TRUE : FALSE;
+                done = TRUE;
+            }
+            Can_HostTesterRelease();
+        }
+    }
+    return positive;
+}
+
+/*
+ * Plain download of image to the start of the application region, as a tester would do it.
+ */
+static Boot_BenchResultType Boot_BenchDownload(const std::vector<u8bit> & image, u32bit frameUs)
+{
+    static const u8bit session[2] = { 0x10u, DCM_SESSION_PROGRAMMING };
+    u8bit download[11] = { 0x34u, 0x00u, 0x44u };
+    u8bit exit[5] = { 0x37u };
+    std::vector<u8bit> transfer(BOOT_CFG_BLOCK_SIZE + 2u);
+    Boot_BenchResultType result = {};
+    u32bit size = (u32bit)image.size();
+    u32bit crc = Crc_CalculateCRC32(image.data(), size, 0u, TRUE);
+    u32bit offset;
+    u32bit count;
+    u32bit startUs;
+    u32bit startBusyUs;
+    u32bit startFrames;
+    u8bit counter = 1u;
+    u32bit i;
+
+    (void)MemPool_Init();
+    Timer_Init();
+    CanTp_Init();
+    Dcm_Init();
+    Boot_Init();
+    Can_HostTesterRelease();
+    Boot_BenchFrameUs = frameUs;
+    Boot_BenchBusCreditUs = 0u;
+    Boot_BenchPending = 0u;
+    for (i = 0u; i < 4u; i++)
+    {
+        download[3u + i] = (u8bit)(BOOT_CFG_APP_START >> (24u - (8u * i)));
+        download[7u + i] = (u8bit)(size >> (24u - (8u * i)));
+        exit[1u + i] = (u8bit)(crc >> (24u - (8u * i)));
+    }
+
+    startUs = Ftfc_HostTimeUs;
+    startBusyUs = Ftfc_HostBusyUs;
+    startFrames = Can_HostFrameCount;
+    result.ok = Boot_BenchRequest(session, sizeof(session));
+    result.ok = (result.ok == TRUE) ? Boot_BenchRequest(download, sizeof(download)) : FALSE;
+    for (offset = 0u; (result.ok == TRUE) && (offset < size); offset += count)
+    {
+        count = ((size - offset) > BOOT_CFG_BLOCK_SIZE) ? BOOT_CFG_BLOCK_SIZE : (size - offset);
+        transfer[0] = 0x36u;
+        transfer[1] = counter++;
+        std::copy(&image[offset], &image[offset] + count, &transfer[2]);
+        result.ok = Boot_BenchRequest(transfer.data(), (u16bit)(count + 2u));
+    }
+    result.ok = (result.ok == TRUE) ? Boot_BenchRequest(exit, sizeof(exit)) : FALSE;
+    result.timeUs = Ftfc_HostTimeUs - startUs;
+    result.busyUs = Ftfc_HostBusyUs - startBusyUs;
+    result.frames = Can_HostFrameCount - startFrames;
+    result.pending = Boot_BenchPending;
+    result.ok = ((result.ok == TRUE) && (Boot_AppValid() == TRUE)) ? TRUE : FALSE;
+    return result;
+}
+
+/*
+ * Application image with a plausible vector table: initial stack at the end of RAM, reset handler inside.
+ */
+static std::vector<u8bit> Boot_BenchImage(u32bit size)
+{
+    std::vector<u8bit> image(size);
+    u32bit seed = 0x2545F491u;
+    u32bit i;
+
+    for (i = 0u; i < size; i++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        image[i] = (u8bit)(seed >> 16);
+    }
+    for (i = 0u; i < 4u; i++)
+    {
+        image[i] = (u8bit)(BOOT_CFG_RAM_END >> (8u * i));
+        image[4u + i] = (u8bit)((BOOT_CFG_APP_START + 0x401u) >> (8u * i));
+    }
+    return image;
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(Boot)
+{
+    static const u8bit pattern[FLS_PHRASE_SIZE] = { 0x00u, 0x11u, 0x22u, 0x33u, 0x44u, 0x55u, 0x66u, 0x77u };
+    std::vector<u8bit> image = Boot_BenchImage(BOOT_BENCH_IMAGE_SIZE);
+    Boot_BenchResultType result;
+    u32bit sectors = (BOOT_BENCH_IMAGE_SIZE + FLS_SECTOR_SIZE - 1u) / FLS_SECTOR_SIZE;
+    u32bit start;
+    u32bit eraseUs;
+    u32bit programUs;
+    u32bit address;
+
+    /* FTFC alone: one sector erased then programmed phrase by phrase, polled every BOOT_CFG_HOST_LOOP_US */
+    Fls_Init();
+    start = Ftfc_HostTimeUs;
+    (void)Fls_Erase(BOOT_CFG_APP_START);
+    while (Fls_GetStatus() == FLS_BUSY)
+    {
+        Ftfc_HostAdvance(BOOT_CFG_HOST_LOOP_US);
+    }
+    eraseUs = Ftfc_HostTimeUs - start;
+    start = Ftfc_HostTimeUs;
+    for (address = BOOT_CFG_APP_START; address < (BOOT_CFG_APP_START + FLS_SECTOR_SIZE); address += FLS_PHRASE_SIZE)
+    {
+        (void)Fls_Write(address, pattern);
+        while (Fls_GetStatus() == FLS_BUSY)
+        {
+            Ftfc_HostAdvance(BOOT_CFG_HOST_LOOP_US);
+        }
+    }
+    programUs = Ftfc_HostTimeUs - start;
+    Bench_Note("FTFC sector erase %u us, sector program %u us: %.1f KB/s", eraseUs, programUs,
+               (double)FLS_SECTOR_SIZE * 1e6 / 1024.0 / (double)(eraseUs + programUs));
+    Bench_Note("FTFC only, %u KB in %u sectors: %.2f s", BOOT_BENCH_IMAGE_SIZE / 1024u, sectors,
+               (double)sectors * (double)(eraseUs + programUs) * 1e-6);
+
+    /* Whole reprogramming through the tester, CanTp, Dcm and Boot */
+    result = Boot_BenchDownload(image, 0u);
+    Bench_Note("UDS %u KB, unlimited bus: %s %.2f s, FTFC busy %.0f %%, %u frames, %u pending",
+               BOOT_BENCH_IMAGE_SIZE / 1024u, (result.ok == TRUE) ? "ok" : "FAILED", (double)result.timeUs * 1e-6,
+               100.0 * (double)result.busyUs / (double)result.timeUs, result.frames, result.pending);
+    result = Boot_BenchDownload(image, BOOT_BENCH_FRAME_US);
+    Bench_Note("UDS %u KB, 500 kbit/s bus: %s %.2f s, FTFC busy %.0f %%, bus busy %.0f %%",
+               BOOT_BENCH_IMAGE_SIZE / 1024u, (result.ok == TRUE) ? "ok" : "FAILED", (double)result.timeUs * 1e-6,
+               100.0 * (double)result.busyUs / (double)result.timeUs,
+               100.0 * (double)result.frames * BOOT_BENCH_FRAME_US / (double)result.timeUs);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Boot_Bench.cpp                                              |
+***********************************************************************************************************************/
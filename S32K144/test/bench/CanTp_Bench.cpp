@@ -0,0 +1,99 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: CanTp_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \CanTp_Bench.cpp
+    CanTp loopback throughput: whole messages from the Dcm channel to the tester channel through the host
+    CAN loopback, CPU bytes/s of segmentation and reassembly and the bytes/s a 500 kbit/s bus would allow
+    for the same frames.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstdio>
+#include <vector>
+#include "Bench.h"
+extern "C" {
+#include "CanTp.h"
+#include "Can_Host.h"
+#include "Dcm.h"
+#include "MemPool.h"
+#include "Timer.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*8 byte classic frames a 500 kbit/s bus carries per second, about 125 bits each with stuffing and IFS*/
+#define CANTP_BENCH_BUS_FRAMES_S            (4000u)
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * One message of length bytes sent, reassembled by the tester and released.
+ */
+static void CanTp_BenchMessage(const u8bit * data, u16bit length)
+{
+    const u8bit * response = NULL;
+    u16bit received;
+
+    (void)CanTp_Transmit(CANTP_CHANNEL_Dcm, NULL, 0u, data, length);
+    while (response == NULL)
+    {
+        (void)Can_HostProcess();
+        CanTp_MainFunction();
+        response = Can_HostTesterResponse(&received);
+    }
+    Bench_Keep(received);
+    Can_HostTesterRelease();
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(CanTp)
+{
+    static const u16bit lengths[] = { 7u, 62u, 500u, CANTP_MAX_LENGTH };
+    std::vector<u8bit> data(CANTP_MAX_LENGTH, 0x5Au);
+    char variant[48];
+    u32bit frames;
+
+    (void)MemPool_Init();
+    Timer_Init();
+    CanTp_Init();
+    Dcm_Init();
+    for (u16bit length : lengths)
+    {
+        (void)snprintf(variant, sizeof(variant), "loopback message of %u bytes", length);
+        Bench_Run(variant, 1u, length, [&]() { CanTp_BenchMessage(data.data(), length); });
+    }
+    for (u16bit length : lengths)
+    {
+        frames = Can_HostFrameCount;
+        CanTp_BenchMessage(data.data(), length);
+        frames = Can_HostFrameCount - frames;
+        Bench_Note("%4u bytes: %3u frames with flow control, %5u bytes/s on a 500 kbit/s bus", length, frames,
+                   (u32bit)(((u64bit)length * CANTP_BENCH_BUS_FRAMES_S) / frames));
+    }
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of CanTp_Bench.cpp                                             |
+***********************************************************************************************************************/
@@ -0,0 +1,99 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Com_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Com_Bench.cpp
+    Generated Com codecs (make HOST=1 bench BENCH=Com): pack and unpack of every frame, one frame per
+    operation, Mops/s is millions of frames per second. The notes compare them with the 4000 frames/s of a
+    fully loaded 500 kbit/s bus.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Bench.h"
+extern "C" {
+#include "Com.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*8 byte frames per second of a 500 kbit/s bus, about 125 bits each with stuffing and IFS*/
+#define COM_BENCH_BUS_FRAMES                (4000u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static Com_EngineStatusType Com_BenchEngine = { 3000u, -20, 512u, 3u, -1234, 5u, 9u };
+static Com_WheelSpeedType   Com_BenchWheel  = { 1000u, 1001u, 999u, 1002u, 0xFu, 7u };
+static Com_MotorCmdType     Com_BenchMotor  = { 2048u, 1u, 1u, -300 };
+static Com_PayloadType      Com_BenchPayload;
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Nanoseconds of one pack and one unpack of every frame: the cost of a bus fully loaded with them.
+ */
+static double Com_BenchCycleNs(void)
+{
+    const u32bit calls = 100000u;
+    u64bit start = Bench_Nanoseconds();
+    u32bit i;
+
+    for (i = 0u; i < calls; i++)
+    {
+        Com_Pack_EngineStatus(&Com_BenchEngine, &Com_BenchPayload);
+        Com_Unpack_EngineStatus(&Com_BenchPayload, &Com_BenchEngine);
+        Com_Pack_WheelSpeed(&Com_BenchWheel, &Com_BenchPayload);
+        Com_Unpack_WheelSpeed(&Com_BenchPayload, &Com_BenchWheel);
+        Com_Pack_MotorCmd(&Com_BenchMotor, &Com_BenchPayload);
+        Com_Unpack_MotorCmd(&Com_BenchPayload, &Com_BenchMotor);
+        Bench_Keep(Com_BenchPayload);
+    }
+    return (double)(Bench_Nanoseconds() - start) / (double)calls;
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(Com)
+{
+    double ns;
+
+    Bench_Run("pack   EngineStatus", 1u, COM_DLC_EngineStatus,
+              [&]() { Com_Pack_EngineStatus(&Com_BenchEngine, &Com_BenchPayload); Bench_Keep(Com_BenchPayload); });
+    Bench_Run("unpack EngineStatus", 1u, COM_DLC_EngineStatus,
+              [&]() { Com_Unpack_EngineStatus(&Com_BenchPayload, &Com_BenchEngine); Bench_Keep(Com_BenchEngine); });
+    Bench_Run("pack   WheelSpeed", 1u, COM_DLC_WheelSpeed,
+              [&]() { Com_Pack_WheelSpeed(&Com_BenchWheel, &Com_BenchPayload); Bench_Keep(Com_BenchPayload); });
+    Bench_Run("unpack WheelSpeed", 1u, COM_DLC_WheelSpeed,
+              [&]() { Com_Unpack_WheelSpeed(&Com_BenchPayload, &Com_BenchWheel); Bench_Keep(Com_BenchWheel); });
+    Bench_Run("pack   MotorCmd", 1u, COM_DLC_MotorCmd,
+              [&]() { Com_Pack_MotorCmd(&Com_BenchMotor, &Com_BenchPayload); Bench_Keep(Com_BenchPayload); });
+    Bench_Run("unpack MotorCmd", 1u, COM_DLC_MotorCmd,
+              [&]() { Com_Unpack_MotorCmd(&Com_BenchPayload, &Com_BenchMotor); Bench_Keep(Com_BenchMotor); });
+
+    ns = Com_BenchCycleNs();
+    Bench_Note("3 frames packed and unpacked in %.1f ns: %.1f M frames/s", ns, 3e3 / ns);
+    Bench_Note("500 kbit/s bus at %u frames/s: %.4f %% of this CPU", COM_BENCH_BUS_FRAMES,
+               100.0 * (double)COM_BENCH_BUS_FRAMES * (ns / 3.0) * 1e-9);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-021   | 17-Oct-2026 | First version of Com_Bench.cpp                                               |
+***********************************************************************************************************************/
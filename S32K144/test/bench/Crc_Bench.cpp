@@ -0,0 +1,132 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Crc_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Crc_Bench.cpp
+    Crc engines (make HOST=1 bench): CRC-32 and CRC-16 of every engine on a CAN frame, a UDS block and a
+    flash sector, with the bytes per cycle of each. The hw engine runs the host simulation of the CRC
+    peripheral, its figures measure that model, not the peripheral.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstdio>
+#include "Bench.h"
+extern "C" {
+#include "Crc.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define CRC_BENCH_MAX_SIZE                  (4096u)
+
+/*Calls timed for the bytes per cycle, best of BENCH_REPEAT*/
+#define CRC_BENCH_CYCLE_CALLS               (64u)
+
+typedef u32bit (*Crc_BenchEngine32Type)(u32bit crc, const u8bit * data, u32bit length);
+typedef u16bit (*Crc_BenchEngine16Type)(u16bit crc, const u8bit * data, u32bit length);
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+alignas(8) static u8bit Crc_BenchData[CRC_BENCH_MAX_SIZE];
+
+static const u32bit Crc_BenchSizes[] = { 8u, 64u, 1024u, CRC_BENCH_MAX_SIZE };
+static const Crc_BenchEngine32Type Crc_BenchEngines32[] =
+    { Crc_Update32Bitwise, Crc_Update32Slice4, Crc_Update32Slice8, Crc_Update32Hw };
+static const Crc_BenchEngine16Type Crc_BenchEngines16[] =
+    { Crc_Update16Bitwise, Crc_Update16Slice4, Crc_Update16Slice8, Crc_Update16Hw };
+static const char * const Crc_BenchEngineNames[] = { "bitwise", "slice4", "slice8", "hw" };
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Bytes per time stamp counter cycle of body on size bytes, best of BENCH_REPEAT runs.
+ */
+template <typename Body>
+static double Crc_BenchBytesPerCycle(u32bit size, Body body)
+{
+    u64bit best = ~0uLL;
+    u64bit cycles;
+    u32bit run;
+    u32bit i;
+
+    for (run = 0u; run < BENCH_REPEAT; run++)
+    {
+        cycles = Bench_Cycles();
+        for (i = 0u; i < CRC_BENCH_CYCLE_CALLS; i++)
+        {
+            body();
+        }
+        cycles = Bench_Cycles() - cycles;
+        best = (cycles < best) ? cycles : best;
+    }
+    return ((double)size * CRC_BENCH_CYCLE_CALLS) / (double)((best != 0u) ? best : 1u);
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(Crc)
+{
+    char name[64];
+    u32bit crc32 = 0u;
+    u16bit crc16 = 0u;
+    u32bit engine;
+    u32bit i;
+
+    Crc_Init();
+    for (i = 0u; i < CRC_BENCH_MAX_SIZE; i++)
+    {
+        Crc_BenchData[i] = (u8bit)((i * 131u) ^ (i >> 5));
+    }
+    for (engine = 0u; engine < (sizeof(Crc_BenchEngines32) / sizeof(Crc_BenchEngines32[0])); engine++)
+    {
+        const Crc_BenchEngine32Type update32 = Crc_BenchEngines32[engine];
+        const Crc_BenchEngine16Type update16 = Crc_BenchEngines16[engine];
+
+        for (i = 0u; i < (sizeof(Crc_BenchSizes) / sizeof(Crc_BenchSizes[0])); i++)
+        {
+            const u32bit size = Crc_BenchSizes[i];
+
+            (void)snprintf(name, sizeof(name), "crc32 %-7s %4u B", Crc_BenchEngineNames[engine], size);
+            Bench_Run(name, 1u, size, [&]() { crc32 = update32(crc32, Crc_BenchData, size); });
+            (void)snprintf(name, sizeof(name), "crc16 %-7s %4u B", Crc_BenchEngineNames[engine], size);
+            Bench_Run(name, 1u, size, [&]() { crc16 = update16(crc16, Crc_BenchData, size); });
+        }
+    }
+    for (engine = 0u; engine < (sizeof(Crc_BenchEngines32) / sizeof(Crc_BenchEngines32[0])); engine++)
+    {
+        const Crc_BenchEngine32Type update32 = Crc_BenchEngines32[engine];
+        const Crc_BenchEngine16Type update16 = Crc_BenchEngines16[engine];
+
+        Bench_Note("%-7s %4u B: crc32 %.3f bytes/cycle, crc16 %.3f bytes/cycle", Crc_BenchEngineNames[engine],
+                   CRC_BENCH_MAX_SIZE,
+                   Crc_BenchBytesPerCycle(CRC_BENCH_MAX_SIZE,
+                                          [&]() { crc32 = update32(crc32, Crc_BenchData, CRC_BENCH_MAX_SIZE); }),
+                   Crc_BenchBytesPerCycle(CRC_BENCH_MAX_SIZE,
+                                          [&]() { crc16 = update16(crc16, Crc_BenchData, CRC_BENCH_MAX_SIZE); }));
+    }
+    Bench_Keep(crc32);
+    Bench_Keep(crc16);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | First version of Crc_Bench.cpp                                               |
+***********************************************************************************************************************/
@@ -0,0 +1,166 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Fuzzy_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Fuzzy_Bench.cpp
+    Fuzzy: cycles per inference of the table driven Fuzzy_Infer on Fuzzy_SpeedCtrl against the naive run time
+    evaluation of the same system (membership functions, min over every rule, sampled centroid), as in Fuzzy_Cfg.json.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cmath>
+#include "Bench.h"
+extern "C" {
+#include "Fuzzy.h"
+#include "Fuzzy_Cfg.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define FUZZY_BENCH_POINTS                  (256u)
+#define FUZZY_BENCH_SAMPLES                 (200u)      /*Output samples of the naive centroid*/
+
+/*Triangle a b b d or trapezoid a b c d*/
+typedef struct
+{
+    float a;
+    float b;
+    float c;
+    float d;
+} Fuzzy_BenchTermType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+/*SpeedCtrl of Fuzzy_Cfg.json*/
+static const Fuzzy_BenchTermType Fuzzy_BenchError[5] =
+{
+    { -1000.0f, -1000.0f, -600.0f, -300.0f }, { -600.0f, -300.0f, -300.0f, 0.0f }, { -300.0f, 0.0f, 0.0f, 300.0f },
+    { 0.0f, 300.0f, 300.0f, 600.0f }, { 300.0f, 600.0f, 1000.0f, 1000.0f }
+};
+static const Fuzzy_BenchTermType Fuzzy_BenchRate[3] =
+{
+    { -200.0f, -200.0f, -100.0f, 0.0f }, { -100.0f, 0.0f, 0.0f, 100.0f }, { 0.0f, 100.0f, 200.0f, 200.0f }
+};
+static const Fuzzy_BenchTermType Fuzzy_BenchTorque[5] =
+{
+    { -1000.0f, -750.0f, -750.0f, -500.0f }, { -750.0f, -375.0f, -375.0f, 0.0f }, { -250.0f, 0.0f, 0.0f, 250.0f },
+    { 0.0f, 375.0f, 375.0f, 750.0f }, { 500.0f, 750.0f, 750.0f, 1000.0f }
+};
+/*Output term of error term x rate term*/
+static const u8bit Fuzzy_BenchRules[5][3] =
+{
+    { 0u, 0u, 0u }, { 0u, 1u, 2u }, { 1u, 2u, 3u }, { 2u, 3u, 4u }, { 4u, 4u, 4u }
+};
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static float Fuzzy_BenchMembership(const Fuzzy_BenchTermType * term, float x)
+{
+    float mu;
+
+    if ((x < term->a) || (x > term->d))
+    {
+        mu = 0.0f;
+    }
+    else if ((x >= term->b) && (x <= term->c))
+    {
+        mu = 1.0f;
+    }
+    else if (x < term->b)
+    {
+        mu = (x - term->a) / (term->b - term->a);
+    }
+    else
+    {
+        mu = (term->d - x) / (term->d - term->c);
+    }
+    return mu;
+}
+
+/*
+ * Naive Mamdani: every rule evaluated, product implication and sum aggregation sampled over the output range.
+ */
+__attribute__((noinline)) static s32bit Fuzzy_BenchNaive(const s32bit * inputs)
+{
+    float weight[5] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    float num = 0.0f;
+    float den = 0.0f;
+    float y;
+    float mu;
+    u32bit e;
+    u32bit r;
+    u32bit k;
+
+    for (e = 0u; e < 5u; e++)
+    {
+        for (r = 0u; r < 3u; r++)
+        {
+            mu = Fuzzy_BenchMembership(&Fuzzy_BenchError[e], (float)inputs[0]);
+            mu = std::fmin(mu, Fuzzy_BenchMembership(&Fuzzy_BenchRate[r], (float)inputs[1]));
+            weight[Fuzzy_BenchRules[e][r]] += mu;
+        }
+    }
+    for (k = 0u; k < FUZZY_BENCH_SAMPLES; k++)
+    {
+        y = -1000.0f + ((2000.0f * ((float)k + 0.5f)) / (float)FUZZY_BENCH_SAMPLES);
+        mu = 0.0f;
+        for (r = 0u; r < 5u; r++)
+        {
+            mu += weight[r] * Fuzzy_BenchMembership(&Fuzzy_BenchTorque[r], y);
+        }
+        num += mu * y;
+        den += mu;
+    }
+    return (den > 0.0f) ? (s32bit)(num / den) : 0;
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(Fuzzy)
+{
+    static s32bit inputs[FUZZY_BENCH_POINTS][2];
+    u32bit point = 0u;
+    u32bit i;
+    s32bit output;
+
+    for (i = 0u; i < FUZZY_BENCH_POINTS; i++)
+    {
+        inputs[i][0] = -1000 + (s32bit)((i * 7919u) % 2001u);
+        inputs[i][1] = -200 + (s32bit)((i * 104729u) % 401u);
+    }
+
+    Bench_Run("table driven Fuzzy_Infer, 2 inputs", 1u, 0u, [&]() {
+        point = (point + 1u) & (FUZZY_BENCH_POINTS - 1u);
+        output = Fuzzy_Infer(&Fuzzy_SpeedCtrl, inputs[point]);
+        Bench_Keep(output);
+    });
+    Bench_Run("naive float Mamdani, 200 output samples", 1u, 0u, [&]() {
+        point = (point + 1u) & (FUZZY_BENCH_POINTS - 1u);
+        output = Fuzzy_BenchNaive(inputs[point]);
+        Bench_Keep(output);
+    });
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-009   | 17-Oct-2026 | First version of Fuzzy_Bench.cpp                                             |
+***********************************************************************************************************************/
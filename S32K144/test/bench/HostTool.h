@@ -0,0 +1,125 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: HostTool.h $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \HostTool.h
+    Host tools of tools/ called from tests and benchmarks: python3 runs a snippet with the tool folders on its
+    path, input bytes in the file named by sys.argv[1], output bytes expected in the file named by sys.argv[2]:
+    
+        std::vector<u8bit> packed = HostTool_Python("InitPack", "from init_pack import pack\n"
+                                                    "open(sys.argv[2], 'wb').write(pack(open(sys.argv[1], 'rb').read()))", raw);
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+#ifndef HOST_TOOL_H_
+#define HOST_TOOL_H_
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <unistd.h>
+extern "C" {
+#include "Std_Types.h"
+}
+
+/*                                                 Inline functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Run code with tools/<tool> on the python path, returns the output file, empty when the snippet failed.
+ */
+static inline std::vector<u8bit> HostTool_Python(const char * tool, const std::string & code,
+                                                 const std::vector<u8bit> & input)
+{
+    char inPath[] = "/tmp/HostToolInXXXXXX";
+    char outPath[] = "/tmp/HostToolOutXXXXXX";
+    char codePath[] = "/tmp/HostToolPyXXXXXX";
+    std::vector<u8bit> output;
+    std::string command;
+    FILE * file;
+    int in = mkstemp(inPath);
+    int out = mkstemp(outPath);
+    int script = mkstemp(codePath);
+    long size;
+
+    if ((in >= 0) && (out >= 0) && (script >= 0))
+    {
+        std::string prologue = std::string("import sys\nsys.path.insert(0, '") + TEST_TOPDIR + "/tools/" + tool + "')\n";
+
+        (void)!write(script, prologue.data(), prologue.size());
+        (void)!write(script, code.data(), code.size());
+        (void)!write(in, input.data(), input.size());
+        command = std::string("python3 ") + codePath + " " + inPath + " " + outPath;
+        if (system(command.c_str()) == 0)
+        {
+            file = fopen(outPath, "rb");
+            if (file != NULL)
+            {
+                (void)fseek(file, 0, SEEK_END);
+                size = ftell(file);
+                (void)fseek(file, 0, SEEK_SET);
+                output.resize((size_t)size);
+                if ((size > 0) && (fread(output.data(), 1u, (size_t)size, file) != (size_t)size))
+                {
+                    output.clear();
+                }
+                (void)fclose(file);
+            }
+        }
+    }
+    if (in >= 0) { (void)close(in); (void)unlink(inPath); }
+    if (out >= 0) { (void)close(out); (void)unlink(outPath); }
+    if (script >= 0) { (void)close(script); (void)unlink(codePath); }
+    return output;
+}
+
+/*
+ * Pack one init image section with the packer of tools/InitPack.
+ */
+static inline std::vector<u8bit> HostTool_InitPack(const std::vector<u8bit> & raw)
+{
+    return HostTool_Python("InitPack", "from init_pack import pack\n"
+                           "open(sys.argv[2], 'wb').write(pack(open(sys.argv[1], 'rb').read()))\n", raw);
+}
+
+/*
+ * size bytes of the running executable from offset, machine code and constants as a representative payload.
+ */
+static inline std::vector<u8bit> HostTool_ImageSample(long offset, u32bit size)
+{
+    std::vector<u8bit> sample(size);
+    FILE * file = fopen("/proc/self/exe", "rb");
+
+    if ((file == NULL) || (fseek(file, offset, SEEK_SET) != 0) || (fread(sample.data(), 1u, size, file) != size))
+    {
+        sample.clear();
+    }
+    if (file != NULL)
+    {
+        (void)fclose(file);
+    }
+    return sample;
+}
+
+#endif /* HOST_TOOL_H_ */
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-002   | 17-Oct-2026 | First version of HostTool.h                                                  |
+***********************************************************************************************************************/
@@ -0,0 +1,49 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: MemPool_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \MemPool_Bench.cpp
+    MemPool: cost of an alloc/free pair from the tagged free lists, size class search included, against the
+    host malloc/free.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstdlib>
+#include "Bench.h"
+extern "C" {
+#include "MemPool.h"
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(MemPool)
+{
+    (void)MemPool_Init();
+    Bench_Run("MemPool_AllocFromPool + Free", 1u, 0u, []() { MemPool_Free(MemPool_AllocFromPool(0u)); });
+    Bench_Run("MemPool_Alloc(16) + Free", 1u, 0u, []() { MemPool_Free(MemPool_Alloc(16u)); });
+    Bench_Run("MemPool_Alloc(4096) + Free", 1u, 0u, []() { MemPool_Free(MemPool_Alloc(4096u)); });
+    Bench_Run("host malloc(16) + free", 1u, 0u, []() { void * volatile block = malloc(16u); free(block); });
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-005   | 17-Oct-2026 | First version of MemPool_Bench.cpp                                           |
+***********************************************************************************************************************/
@@ -0,0 +1,107 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: NeuralNet_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \NeuralNet_Bench.cpp
+    NeuralNet: peak tensor arena bytes of every model and, per layer of NeuralNet_Vibration, the cost per MAC of the
+    SMLAD kernels (each layer run alone as a one layer model) with the resulting MACs per cycle.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include "Bench.h"
+extern "C" {
+#include "NeuralNet.h"
+#include "NeuralNet_Models.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define NEURALNET_BENCH_CALLS               (100000u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+/*
+ * Best TSC cycles of one invoke of model over a few rounds.
+ */
+static u64bit NeuralNet_BenchCycles(const NeuralNet_ModelType * model)
+{
+    u64bit best = ~0uLL;
+    u64bit cycles;
+    u32bit round;
+    u32bit i;
+
+    for (round = 0u; round < BENCH_REPEAT; round++)
+    {
+        cycles = Bench_Cycles();
+        for (i = 0u; i < NEURALNET_BENCH_CALLS; i++)
+        {
+            (void)NeuralNet_Invoke(model);
+        }
+        cycles = Bench_Cycles() - cycles;
+        best = (cycles < best) ? cycles : best;
+    }
+    return best / NEURALNET_BENCH_CALLS;
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(NeuralNet)
+{
+    const NeuralNet_ModelType * model = &NeuralNet_Vibration;
+    NeuralNet_ModelType single;
+    u32bit layer;
+    u32bit inBytes = (u32bit)model->inSize * model->elemBytes;
+    u32bit macs = 0u;
+    u32bit naive = inBytes;
+    u64bit cycles;
+
+    for (layer = 0u; layer < model->layerCount; layer++)
+    {
+        macs += model->layers[layer].macs;
+        naive += (u32bit)model->layers[layer].outLength * model->layers[layer].filters * model->elemBytes;
+    }
+    Bench_Note("Vibration: peak arena %u B of %u B (%u B without reuse), %u MACs",
+               (unsigned)model->arenaBytes, (unsigned)NEURALNET_CFG_ARENA_SIZE, (unsigned)naive, (unsigned)macs);
+
+    for (layer = 0u; layer < model->layerCount; layer++)
+    {
+        single = *model;
+        single.layers = &model->layers[layer];
+        single.layerCount = 1u;
+        cycles = NeuralNet_BenchCycles(&single);
+        Bench_Note("layer %u: %u x %u outputs, window %u, %u MACs, %llu cycles, %.2f MACs/cycle", (unsigned)layer,
+                   (unsigned)model->layers[layer].outLength, (unsigned)model->layers[layer].filters,
+                   (unsigned)model->layers[layer].window, (unsigned)model->layers[layer].macs,
+                   (unsigned long long)cycles, (double)model->layers[layer].macs / (double)cycles);
+    }
+    Bench_Run("Vibration, whole model (ops = MACs)", macs, 0u, [&]() {
+        (void)NeuralNet_Invoke(model);
+    });
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-010   | 17-Oct-2026 | First version of NeuralNet_Bench.cpp                                         |
+***********************************************************************************************************************/
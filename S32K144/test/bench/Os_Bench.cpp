@@ -0,0 +1,124 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Os_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Os_Bench.cpp
+    Os kernel on the ucontext host port: context switch cost of Os_Yield and of a preempting Os_TaskResume,
+    critical section cost, and wake up latency of a delayed task against the SIGALRM tick. The measurements run
+    inside a task, the kernel is shut down at the end of the case.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <ctime>
+#include "Bench.h"
+extern "C" {
+#include "Os.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define OS_BENCH_STACK_WORDS                (16384u)
+#define OS_BENCH_WAKES                      (500u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+OS_TASK_DEFINE(Os_BenchMain, OS_BENCH_STACK_WORDS);
+OS_TASK_DEFINE(Os_BenchPeer, OS_BENCH_STACK_WORDS);
+OS_TASK_DEFINE(Os_BenchHigh, OS_BENCH_STACK_WORDS);
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+/*
+ * Yields back at once, every Os_Yield of the main task costs two switches.
+ */
+static void Os_BenchPeerEntry(void * arg)
+{
+    (void)arg;
+    for (;;)
+    {
+        Os_Yield();
+    }
+}
+
+/*
+ * Suspends itself at once, every Os_TaskResume of the main task costs two switches.
+ */
+static void Os_BenchHighEntry(void * arg)
+{
+    (void)arg;
+    for (;;)
+    {
+        Os_TaskSuspend(NULL);
+    }
+}
+
+static void Os_BenchMainEntry(void * arg)
+{
+    struct timespec now;
+    u64bit last;
+    u64bit current;
+    u64bit sum = 0u;
+    u64bit worst = 0u;
+    u64bit late;
+    u32bit i;
+
+    (void)arg;
+    Bench_Run("Os_Yield ping-pong, per switch", 2u, 0u, []() { Os_Yield(); });
+    Os_TaskSuspend(&Os_BenchPeer);
+    Bench_Run("Os_TaskResume preempt + suspend, per switch", 2u, 0u, []() { Os_TaskResume(&Os_BenchHigh); });
+    Bench_Run("Os_SuspendAll/ResumeAllInterrupts", 1u, 0u, []() { Os_SuspendAllInterrupts(); Os_ResumeAllInterrupts(); });
+
+    /*Period of a task delayed by one tick: lateness against the 1 ms period*/
+    Os_Delay(1u);
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    last = ((u64bit)now.tv_sec * 1000000000uLL) + (u64bit)now.tv_nsec;
+    for (i = 0u; i < OS_BENCH_WAKES; i++)
+    {
+        Os_Delay(1u);
+        (void)clock_gettime(CLOCK_MONOTONIC, &now);
+        current = ((u64bit)now.tv_sec * 1000000000uLL) + (u64bit)now.tv_nsec;
+        late = ((current - last) > (1000000000uLL / OS_CFG_TICK_HZ)) ?
+               ((current - last) - (1000000000uLL / OS_CFG_TICK_HZ)) : ((1000000000uLL / OS_CFG_TICK_HZ) - (current - last));
+        sum += late;
+        worst = (late > worst) ? late : worst;
+        last = current;
+    }
+    Bench_Note("Os_Delay(1) wake up jitter over %u periods: mean %.1f us, max %.1f us", OS_BENCH_WAKES,
+               (double)sum / OS_BENCH_WAKES / 1000.0, (double)worst / 1000.0);
+    Os_Shutdown();
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(Os)
+{
+    Os_Init();
+    Os_TaskCreate(&Os_BenchMain, Os_BenchMainEntry, NULL, 2u, OS_TASK_STACK(Os_BenchMain));
+    Os_TaskCreate(&Os_BenchPeer, Os_BenchPeerEntry, NULL, 2u, OS_TASK_STACK(Os_BenchPeer));
+    Os_TaskCreate(&Os_BenchHigh, Os_BenchHighEntry, NULL, 3u, OS_TASK_STACK(Os_BenchHigh));
+    Os_Start();
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | First version of Os_Bench.cpp                                                |
+***********************************************************************************************************************/
@@ -0,0 +1,176 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Pid_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Pid_Bench.cpp
+    Pid: cycles per control loop of the Q15 structure of arrays batch (QSUB16/SMUAD/SMLALD) for 1 to 64 loops,
+    against the same Q15 algorithm written per loop in plain C and against the Q31 and float controllers.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstdint>
+#include "Bench.h"
+extern "C" {
+#include "Pid.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define PID_BENCH_LOOPS                     (64u)
+
+/*Per loop Q15 controller, array of structures*/
+typedef struct
+{
+    Pid_Q15ParamType param;
+    s32bit           integ;
+    s32bit           dFilt;
+    s32bit           prevMeas;
+} Pid_BenchScalarType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+PID_Q15_BATCH_DEFINE(Pid_BenchBatch1, 1u);
+PID_Q15_BATCH_DEFINE(Pid_BenchBatch4, 4u);
+PID_Q15_BATCH_DEFINE(Pid_BenchBatch16, 16u);
+PID_Q15_BATCH_DEFINE(Pid_BenchBatch64, PID_BENCH_LOOPS);
+
+static const Pid_Q15ParamType Pid_BenchQ15Param = { 16384, 512, 8192, 8192, 2u, -30000, 30000 };
+static const Pid_Q31ParamType Pid_BenchQ31Param = { 0x40000000, 0x02000000, 0x20000000, 0x20000000, 2u,
+                                                    INT32_MIN + 1, INT32_MAX };
+static const Pid_FloatParamType Pid_BenchFloatParam = { 2.0f, 0.06f, 1.0f, 0.25f, -1.0f, 1.0f };
+
+static s16bit Pid_BenchSetpoint[PID_BENCH_LOOPS];
+static s16bit Pid_BenchMeasurement[PID_BENCH_LOOPS];
+static s16bit Pid_BenchOutput[PID_BENCH_LOOPS];
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static inline s32bit Pid_BenchSat(s64bit value, s64bit min, s64bit max)
+{
+    return (s32bit)((value > max) ? max : ((value < min) ? min : value));
+}
+
+__attribute__((noinline)) static s16bit Pid_BenchScalarUpdate(Pid_BenchScalarType * pid, s16bit setpoint,
+                                                              s16bit measurement)
+{
+    const Pid_Q15ParamType * p = &pid->param;
+    s32bit error = Pid_BenchSat((s32bit)setpoint - measurement, -32768, 32767);
+    s32bit delta = Pid_BenchSat(pid->prevMeas - measurement, -32768, 32767);
+    s32bit dFilt = (s16bit)(((p->alpha * delta) + ((32767 - p->alpha) * pid->dFilt)) >> 15);
+    s32bit integ = Pid_BenchSat((s64bit)pid->integ + ((s64bit)p->ki * error), INT32_MIN, INT32_MAX);
+    s64bit output;
+
+    integ = Pid_BenchSat(integ, (s64bit)p->outMin << (15u - p->shift), (s64bit)p->outMax << (15u - p->shift));
+    output = ((s64bit)integ + ((s64bit)p->kp * error) + ((s64bit)p->kd * dFilt)) >> (15u - p->shift);
+    if (output > p->outMax)
+    {
+        output = p->outMax;
+        integ = (error > 0) ? pid->integ : integ;
+    }
+    else if (output < p->outMin)
+    {
+        output = p->outMin;
+        integ = (error < 0) ? pid->integ : integ;
+    }
+    else
+    {
+    }
+    pid->integ = integ;
+    pid->dFilt = dFilt;
+    pid->prevMeas = measurement;
+    return (s16bit)output;
+}
+
+static void Pid_BenchBatch(const char * variant, Pid_Q15BatchType * batch)
+{
+    u32bit loop;
+
+    for (loop = 0u; loop < batch->count; loop++)
+    {
+        Pid_Q15Init(batch, loop, &Pid_BenchQ15Param, 0);
+    }
+    Bench_Run(variant, batch->count, 0u, [&]() {
+        Pid_BenchMeasurement[0] ^= 0x0101;
+        Pid_Q15Update(batch, Pid_BenchSetpoint, Pid_BenchMeasurement, Pid_BenchOutput);
+        Bench_Keep(Pid_BenchOutput);
+    });
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(Pid)
+{
+    static Pid_BenchScalarType scalar[PID_BENCH_LOOPS];
+    static Pid_Q31Type q31[PID_BENCH_LOOPS];
+    static Pid_FloatType flt[PID_BENCH_LOOPS];
+    static s32bit q31Output[PID_BENCH_LOOPS];
+    static float floatOutput[PID_BENCH_LOOPS];
+    u32bit loop;
+
+    for (loop = 0u; loop < PID_BENCH_LOOPS; loop++)
+    {
+        Pid_BenchSetpoint[loop] = (s16bit)(1000 * loop);
+        Pid_BenchMeasurement[loop] = (s16bit)(900 * loop);
+        scalar[loop].param = Pid_BenchQ15Param;
+        scalar[loop].integ = 0;
+        scalar[loop].dFilt = 0;
+        scalar[loop].prevMeas = 0;
+        Pid_Q31Init(&q31[loop], &Pid_BenchQ31Param, 0);
+        Pid_FloatInit(&flt[loop], &Pid_BenchFloatParam, 0.0f);
+    }
+
+    Pid_BenchBatch("Q15 batch, 1 loop", &Pid_BenchBatch1);
+    Pid_BenchBatch("Q15 batch, 4 loops", &Pid_BenchBatch4);
+    Pid_BenchBatch("Q15 batch, 16 loops", &Pid_BenchBatch16);
+    Pid_BenchBatch("Q15 batch, 64 loops", &Pid_BenchBatch64);
+    Bench_Run("Q15 scalar C reference, 64 loops", PID_BENCH_LOOPS, 0u, [&]() {
+        Pid_BenchMeasurement[0] ^= 0x0101;
+        for (u32bit i = 0u; i < PID_BENCH_LOOPS; i++)
+        {
+            Pid_BenchOutput[i] = Pid_BenchScalarUpdate(&scalar[i], Pid_BenchSetpoint[i], Pid_BenchMeasurement[i]);
+        }
+        Bench_Keep(Pid_BenchOutput);
+    });
+    Bench_Run("Q31 controller, 64 loops", PID_BENCH_LOOPS, 0u, [&]() {
+        Pid_BenchMeasurement[0] ^= 0x0101;
+        for (u32bit i = 0u; i < PID_BENCH_LOOPS; i++)
+        {
+            q31Output[i] = Pid_Q31Update(&q31[i], (s32bit)Pid_BenchSetpoint[i] << 16,
+                                         (s32bit)Pid_BenchMeasurement[i] << 16);
+        }
+        Bench_Keep(q31Output);
+    });
+    Bench_Run("float controller, 64 loops", PID_BENCH_LOOPS, 0u, [&]() {
+        Pid_BenchMeasurement[0] ^= 0x0101;
+        for (u32bit i = 0u; i < PID_BENCH_LOOPS; i++)
+        {
+            floatOutput[i] = Pid_FloatUpdate(&flt[i], (float)Pid_BenchSetpoint[i] / 32768.0f,
+                                             (float)Pid_BenchMeasurement[i] / 32768.0f);
+        }
+        Bench_Keep(floatOutput);
+    });
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-008   | 17-Oct-2026 | First version of Pid_Bench.cpp                                               |
+***********************************************************************************************************************/
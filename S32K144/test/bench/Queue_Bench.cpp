@@ -0,0 +1,155 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Queue_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Queue_Bench.cpp
+    Queue: cost per message of SPSC and MPSC push/pop, single and batched, and the messages/s of a producer
+    thread feeding a consumer thread (four producers for the MPSC queue).
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include "Bench.h"
+extern "C" {
+#include "S32K144.h"
+#include "Queue.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define QUEUE_BENCH_BATCH                   (16u)
+#define QUEUE_BENCH_PRODUCERS               (4u)
+#define QUEUE_BENCH_MESSAGES                (100000u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+QUEUE_SPSC_DEFINE(Queue_BenchSpsc, u32bit, 256u);
+QUEUE_MPSC_DEFINE(Queue_BenchMpsc, u32bit, 256u);
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static void * Queue_BenchSpscProducer(void * arg)
+{
+    u32bit message = 0u;
+
+    (void)arg;
+    while (message < QUEUE_BENCH_MESSAGES)
+    {
+        if (Queue_SpscPush(&Queue_BenchSpsc, &message) == TRUE)
+        {
+            message++;
+        }
+        else
+        {
+            (void)sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * Queue_BenchMpscProducer(void * arg)
+{
+    u32bit message = 0u;
+
+    (void)arg;
+    while (message < (QUEUE_BENCH_MESSAGES / QUEUE_BENCH_PRODUCERS))
+    {
+        if (Queue_MpscPush(&Queue_BenchMpsc, &message) == TRUE)
+        {
+            message++;
+        }
+        else
+        {
+            (void)sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/*
+ * One producer (SPSC) or QUEUE_BENCH_PRODUCERS (MPSC) against the calling thread as consumer.
+ */
+static void Queue_BenchThreads(boolean mpsc)
+{
+    pthread_t producers[QUEUE_BENCH_PRODUCERS];
+    u32bit threads = (mpsc == TRUE) ? QUEUE_BENCH_PRODUCERS : 1u;
+    u32bit received = 0u;
+    u32bit batch[QUEUE_BENCH_BATCH];
+    u32bit count;
+    u32bit i;
+
+    for (i = 0u; i < threads; i++)
+    {
+        (void)pthread_create(&producers[i], NULL, (mpsc == TRUE) ? Queue_BenchMpscProducer : Queue_BenchSpscProducer,
+                             NULL);
+    }
+    while (received < QUEUE_BENCH_MESSAGES)
+    {
+        count = (mpsc == TRUE) ? Queue_MpscPopBatch(&Queue_BenchMpsc, batch, QUEUE_BENCH_BATCH) :
+                                 Queue_SpscPopBatch(&Queue_BenchSpsc, batch, QUEUE_BENCH_BATCH);
+        received += count;
+        if (count == 0u)
+        {
+            (void)sched_yield();
+        }
+    }
+    for (i = 0u; i < threads; i++)
+    {
+        (void)pthread_join(producers[i], NULL);
+    }
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(Queue)
+{
+    u32bit batch[QUEUE_BENCH_BATCH] = { 0u };
+    u32bit value = 0u;
+
+    Bench_Run("spsc push + pop", 1u, sizeof(u32bit), [&]() {
+        (void)Queue_SpscPush(&Queue_BenchSpsc, &value);
+        (void)Queue_SpscPop(&Queue_BenchSpsc, &value);
+    });
+    Bench_Run("spsc push + pop batch of 16", QUEUE_BENCH_BATCH, QUEUE_BENCH_BATCH * sizeof(u32bit), [&]() {
+        (void)Queue_SpscPushBatch(&Queue_BenchSpsc, batch, QUEUE_BENCH_BATCH);
+        (void)Queue_SpscPopBatch(&Queue_BenchSpsc, batch, QUEUE_BENCH_BATCH);
+    });
+    Bench_Run("mpsc push + pop", 1u, sizeof(u32bit), [&]() {
+        (void)Queue_MpscPush(&Queue_BenchMpsc, &value);
+        (void)Queue_MpscPop(&Queue_BenchMpsc, &value);
+    });
+    Bench_Run("mpsc push + pop batch of 16", QUEUE_BENCH_BATCH, QUEUE_BENCH_BATCH * sizeof(u32bit), [&]() {
+        (void)Queue_MpscPushBatch(&Queue_BenchMpsc, batch, QUEUE_BENCH_BATCH);
+        (void)Queue_MpscPopBatch(&Queue_BenchMpsc, batch, QUEUE_BENCH_BATCH);
+    });
+    Bench_Run("spsc 1 producer thread -> consumer", QUEUE_BENCH_MESSAGES, QUEUE_BENCH_MESSAGES * sizeof(u32bit),
+              []() { Queue_BenchThreads(FALSE); });
+    Bench_Run("mpsc 4 producer threads -> consumer", QUEUE_BENCH_MESSAGES, QUEUE_BENCH_MESSAGES * sizeof(u32bit),
+              []() { Queue_BenchThreads(TRUE); });
+    Bench_Keep(value);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-006   | 17-Oct-2026 | First version of Queue_Bench.cpp                                             |
+***********************************************************************************************************************/
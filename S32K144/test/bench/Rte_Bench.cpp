@@ -0,0 +1,167 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Rte_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Rte_Bench.cpp
+    RTE: per signal write + read cost of the generated static inline accessors against a table driven RTE, a
+    connection table walked at run time with its size, buffer and consistency mode, as a generic RTE does.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstring>
+#include "Bench.h"
+extern "C" {
+#include "S32K144.h"
+#include "Rte.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define RTE_BENCH_SINGLE                    (0u)
+#define RTE_BENCH_DOUBLE                    (1u)
+
+#define RTE_BENCH_ENGINE_SPEED              (0u)
+#define RTE_BENCH_WHEEL_SPEED               (1u)
+#define RTE_BENCH_MOTOR_DUTY                (2u)
+
+/*One connection of the table driven RTE*/
+typedef struct
+{
+    u8bit *           buffer;           /*Two copies for RTE_BENCH_DOUBLE*/
+    volatile u32bit * seq;
+    u16bit            size;
+    u8bit             consistency;
+} Rte_BenchConnectionType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static u16bit Rte_BenchEngineSpeed;
+static Rte_WheelSpeedType Rte_BenchWheelSpeed[2];
+static volatile u32bit Rte_BenchWheelSeq;
+static u16bit Rte_BenchMotorDuty;
+
+static const Rte_BenchConnectionType Rte_BenchTable[] =
+{
+    { (u8bit *)&Rte_BenchEngineSpeed, NULL, sizeof(u16bit), RTE_BENCH_SINGLE },
+    { (u8bit *)Rte_BenchWheelSpeed, &Rte_BenchWheelSeq, sizeof(Rte_WheelSpeedType), RTE_BENCH_DOUBLE },
+    { (u8bit *)&Rte_BenchMotorDuty, NULL, sizeof(u16bit), RTE_BENCH_SINGLE },
+};
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+__attribute__((noinline)) static void Rte_BenchWrite(u32bit id, const void * data)
+{
+    const Rte_BenchConnectionType * connection = &Rte_BenchTable[id];
+    u32bit seq;
+
+    if (connection->consistency == RTE_BENCH_DOUBLE)
+    {
+        seq = *connection->seq;
+        memcpy(&connection->buffer[((seq + 1u) & 1u) * connection->size], data, connection->size);
+        Core_StoreRelease(connection->seq, seq + 1u);
+    }
+    else
+    {
+        memcpy(connection->buffer, data, connection->size);
+    }
+}
+
+__attribute__((noinline)) static void Rte_BenchRead(u32bit id, void * data)
+{
+    const Rte_BenchConnectionType * connection = &Rte_BenchTable[id];
+    u32bit seq;
+
+    if (connection->consistency == RTE_BENCH_DOUBLE)
+    {
+        do
+        {
+            seq = Core_LoadAcquire(connection->seq);
+            memcpy(data, &connection->buffer[(seq & 1u) * connection->size], connection->size);
+            Core_ReadFence();
+        } while ((*connection->seq - seq) > 1u);
+    }
+    else
+    {
+        memcpy(data, connection->buffer, connection->size);
+    }
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(Rte)
+{
+    volatile u16bit input = 1234u;
+    Rte_WheelSpeedType wheels = { 1u, 2u, 3u, 4u };
+    u16bit value;
+
+    Bench_Run("u16 generated write + read", 1u, 0u, [&]() {
+        Rte_Write_CanAdapter_PpEngineSpeed(input);
+        Rte_Read_SpeedCtrl_RpEngineSpeed(&value);
+        Bench_Keep(value);
+    });
+    Bench_Run("u16 table driven write + read", 1u, 0u, [&]() {
+        value = input;
+        Rte_BenchWrite(RTE_BENCH_ENGINE_SPEED, &value);
+        Rte_BenchRead(RTE_BENCH_ENGINE_SPEED, &value);
+        Bench_Keep(value);
+    });
+    Bench_Run("8 B dbl buffer generated write + 2 reads", 1u, 0u, [&]() {
+        wheels.frontLeft = input;
+        Rte_Write_CanAdapter_PpWheelSpeed(&wheels);
+        Rte_Read_SpeedCtrl_RpWheelSpeed(&wheels);
+        Rte_Read_Diag_RpWheelSpeed(&wheels);
+        Bench_Keep(wheels);
+    });
+    Bench_Run("8 B dbl buffer table driven write + 2 reads", 1u, 0u, [&]() {
+        wheels.frontLeft = input;
+        Rte_BenchWrite(RTE_BENCH_WHEEL_SPEED, &wheels);
+        Rte_BenchRead(RTE_BENCH_WHEEL_SPEED, &wheels);
+        Rte_BenchRead(RTE_BENCH_WHEEL_SPEED, &wheels);
+        Bench_Keep(wheels);
+    });
+    Bench_Run("all 3 connections generated", 3u, 0u, [&]() {
+        Rte_Write_CanAdapter_PpEngineSpeed(input);
+        Rte_Write_CanAdapter_PpWheelSpeed(&wheels);
+        Rte_Write_SpeedCtrl_PpMotorDuty(input);
+        Rte_Read_SpeedCtrl_RpEngineSpeed(&value);
+        Rte_Read_SpeedCtrl_RpWheelSpeed(&wheels);
+        Rte_Read_PwmAdapter_RpMotorDuty(&value);
+        Bench_Keep(value);
+        Bench_Keep(wheels);
+    });
+    Bench_Run("all 3 connections table driven", 3u, 0u, [&]() {
+        value = input;
+        Rte_BenchWrite(RTE_BENCH_ENGINE_SPEED, &value);
+        Rte_BenchWrite(RTE_BENCH_WHEEL_SPEED, &wheels);
+        Rte_BenchWrite(RTE_BENCH_MOTOR_DUTY, &value);
+        Rte_BenchRead(RTE_BENCH_ENGINE_SPEED, &value);
+        Rte_BenchRead(RTE_BENCH_WHEEL_SPEED, &wheels);
+        Rte_BenchRead(RTE_BENCH_MOTOR_DUTY, &value);
+        Bench_Keep(value);
+        Bench_Keep(wheels);
+    });
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-007   | 17-Oct-2026 | First version of Rte_Bench.cpp                                               |
+***********************************************************************************************************************/
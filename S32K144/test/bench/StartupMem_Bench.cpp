@@ -0,0 +1,168 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: StartupMem_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \StartupMem_Bench.cpp
+    Startup memory engine: StartupMem_Copy/Zero against the byte loops they replace in Reset_Handler, for
+    .data/.bss sizes from 0 to 32 KB. Host rows run the C burst loops, the LDM/STM version is Thumb-2 only.
+    Compressed init image: compression ratio of tools/InitPack per representative section and the cost of
+    StartupMem_Unpack against copying the raw section.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "Bench.h"
+#include "HostTool.h"
+extern "C" {
+#include "Startup_Mem.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define STARTUP_MEM_BENCH_MAX_SIZE          (32u * 1024u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+alignas(4) static u8bit StartupMem_BenchSrc[STARTUP_MEM_BENCH_MAX_SIZE];
+alignas(4) static u8bit StartupMem_BenchDst[STARTUP_MEM_BENCH_MAX_SIZE];
+
+static const u32bit StartupMem_BenchSizes[] = { 0u, 64u, 256u, 1024u, 4096u, 16384u, STARTUP_MEM_BENCH_MAX_SIZE };
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+/*
+ * Byte loops of the former Reset_Handler, kept as loops: no memcpy/memset pattern, no vectorization.
+ */
+__attribute__((noinline, optimize("no-tree-loop-distribute-patterns", "no-tree-vectorize")))
+static void StartupMem_BenchByteCopy(u8bit * dst, const u8bit * src, u32bit size)
+{
+    while (size != 0u)
+    {
+        *dst = *src;
+        dst++;
+        src++;
+        size--;
+    }
+}
+
+__attribute__((noinline, optimize("no-tree-loop-distribute-patterns", "no-tree-vectorize")))
+static void StartupMem_BenchByteZero(u8bit * dst, u32bit size)
+{
+    while (size != 0u)
+    {
+        *dst = 0u;
+        dst++;
+        size--;
+    }
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(StartupMem)
+{
+    char name[64];
+    u32bit i;
+
+    for (i = 0u; i < (sizeof(StartupMem_BenchSizes) / sizeof(StartupMem_BenchSizes[0])); i++)
+    {
+        const u32bit size = StartupMem_BenchSizes[i];
+
+        (void)snprintf(name, sizeof(name), "copy %5u B byte loop", size);
+        Bench_Run(name, 1u, size, [&]() { StartupMem_BenchByteCopy(StartupMem_BenchDst, StartupMem_BenchSrc, size); });
+        (void)snprintf(name, sizeof(name), "copy %5u B StartupMem_Copy", size);
+        Bench_Run(name, 1u, size, [&]() { StartupMem_Copy(StartupMem_BenchDst, StartupMem_BenchSrc, size); });
+        (void)snprintf(name, sizeof(name), "copy %5u B byte loop unaligned", size);
+        Bench_Run(name, 1u, size,
+                  [&]() { StartupMem_BenchByteCopy(&StartupMem_BenchDst[1], StartupMem_BenchSrc, size - (size != 0u)); });
+        (void)snprintf(name, sizeof(name), "copy %5u B StartupMem_Copy unaligned", size);
+        Bench_Run(name, 1u, size,
+                  [&]() { StartupMem_Copy(&StartupMem_BenchDst[1], StartupMem_BenchSrc, size - (size != 0u)); });
+        (void)snprintf(name, sizeof(name), "zero %5u B byte loop", size);
+        Bench_Run(name, 1u, size, [&]() { StartupMem_BenchByteZero(StartupMem_BenchDst, size); });
+        (void)snprintf(name, sizeof(name), "zero %5u B StartupMem_Zero", size);
+        Bench_Run(name, 1u, size, [&]() { StartupMem_Zero(StartupMem_BenchDst, size); });
+    }
+    Bench_Keep(StartupMem_BenchDst);
+}
+
+/*
+ * Pack a section, print its ratio and time the decoder against a plain copy of the raw bytes.
+ */
+static void StartupMem_BenchSection(const char * section, const std::vector<u8bit> & raw)
+{
+    std::vector<u8bit> packed = HostTool_InitPack(raw);
+    char name[64];
+
+    if (packed.empty())
+    {
+        Bench_Note("%s: init_pack.py failed", section);
+    }
+    else
+    {
+        Bench_Note("%-24s raw %6u B packed %6u B (%5.1f %%)", section, (u32bit)raw.size(), (u32bit)packed.size(),
+                   (100.0 * (double)packed.size()) / (double)raw.size());
+        (void)snprintf(name, sizeof(name), "%s StartupMem_Copy raw", section);
+        Bench_Run(name, 1u, (u32bit)raw.size(),
+                  [&]() { StartupMem_Copy(StartupMem_BenchDst, raw.data(), (u32bit)raw.size()); });
+        (void)snprintf(name, sizeof(name), "%s StartupMem_Unpack", section);
+        Bench_Run(name, 1u, (u32bit)raw.size(),
+                  [&]() { (void)StartupMem_Unpack(StartupMem_BenchDst, packed.data(), (u32bit)raw.size()); });
+    }
+}
+
+BENCH(StartupMem_Unpack)
+{
+    std::vector<u8bit> data;
+    std::vector<u8bit> calibration(8192u, 0u);
+    u32bit i;
+
+    /*.data: small integers, addresses and zero padding of initialized structs*/
+    for (i = 0u; i < 2048u; i += 4u)
+    {
+        const u32bit word = ((i % 32u) < 16u) ? (i / 32u) : (((i % 64u) == 16u) ? (0x20000000u + i) : 0u);
+
+        data.push_back((u8bit)word);
+        data.push_back((u8bit)(word >> 8u));
+        data.push_back((u8bit)(word >> 16u));
+        data.push_back((u8bit)(word >> 24u));
+    }
+    /*Calibration tables: sparse maps, mostly zero with a few breakpoints per row*/
+    for (i = 0u; i < calibration.size(); i += 64u)
+    {
+        calibration[i] = (u8bit)(i >> 6u);
+        calibration[i + 2u] = 0x7Fu;
+    }
+    StartupMem_BenchSection(".data 2 KB", data);
+    StartupMem_BenchSection("calibration 8 KB", calibration);
+    StartupMem_BenchSection(".code_ram 4 KB", HostTool_ImageSample(8192, 4096u));
+    StartupMem_BenchSection(".code_ram 16 KB", HostTool_ImageSample(8192, 16384u));
+    Bench_Keep(StartupMem_BenchDst);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-001   | 17-Oct-2026 | First version of StartupMem_Bench.cpp                                        |
+ *| CMARTI  |  user-002   | 17-Oct-2026 | Init image ratio and StartupMem_Unpack per section                           |
+ *| CMARTI  |  user-001   | 17-Oct-2026 | Byte loop reference for the unaligned copy                                   |
+***********************************************************************************************************************/
@@ -0,0 +1,143 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Timer_Bench.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Timer_Bench.cpp
+    Timer: cost of one Timer_Tick with 10 to 10,000 running periodic timers against a per tick scan of every timer.
+    Periods grow with the timer count so that the expiries per tick, and the callbacks they run, stay the same
+    at every size: what is left is the wheel bookkeeping, constant per tick.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstdio>
+#include <vector>
+#include "Bench.h"
+extern "C" {
+#include "Timer.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define TIMER_BENCH_TICKS_PER_EXPIRY        (100u)      /*Mean ticks between two expiries of one timer per timer*/
+
+/*Timer of the scanned baseline*/
+typedef struct
+{
+    u32bit expiry;
+    u32bit period;
+} Timer_BenchScanType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static u32bit Timer_BenchExpired;
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static void Timer_BenchCallback(void * arg)
+{
+    (void)arg;
+    Timer_BenchExpired++;
+}
+
+/*
+ * Period of timer i of count: between 1 and 2 times count * TIMER_BENCH_TICKS_PER_EXPIRY ticks.
+ */
+static u32bit Timer_BenchPeriod(u32bit i, u32bit count)
+{
+    u32bit base = count * TIMER_BENCH_TICKS_PER_EXPIRY;
+
+    return base + (u32bit)(((u64bit)i * 2654435761u) % base);
+}
+
+/*
+ * First expiry of timer i of count, spread over its whole period.
+ */
+static u32bit Timer_BenchFirst(u32bit i, u32bit count)
+{
+    return 1u + (u32bit)(((u64bit)i * 40503u) % Timer_BenchPeriod(i, count));
+}
+
+/*
+ * Baseline: every timer compared with the current tick, as a plain array of software counters does.
+ */
+__attribute__((noinline)) static void Timer_BenchScanTick(std::vector<Timer_BenchScanType> & timers, u32bit now)
+{
+    for (Timer_BenchScanType & timer : timers)
+    {
+        if (timer.expiry == now)
+        {
+            timer.expiry += timer.period;
+            Timer_BenchCallback(NULL);
+        }
+    }
+}
+
+/*                                                      Benchmarks                                                   */
+/*********************************************************************************************************************/
+
+BENCH(Timer)
+{
+    static const u32bit counts[] = { 10u, 100u, 1000u, 10000u };
+    std::vector<Timer_Type> timers;
+    std::vector<Timer_BenchScanType> scan;
+    char variant[48];
+    u32bit now = 0u;
+    u32bit i;
+
+    /*Part of every Timer_Tick, two sigprocmask calls on the host port*/
+    Bench_Run("TIMER_CFG_LOCK + UNLOCK", 1u, 0u, []() {
+        TIMER_CFG_LOCK();
+        TIMER_CFG_UNLOCK();
+    });
+    for (u32bit count : counts)
+    {
+        timers.assign(count, Timer_Type());
+        Timer_Init();
+        for (i = 0u; i < count; i++)
+        {
+            Timer_Setup(&timers[i], Timer_BenchCallback, NULL, TIMER_MODE_TICK);
+            Timer_Start(&timers[i], Timer_BenchFirst(i, count), Timer_BenchPeriod(i, count));
+        }
+        Timer_BenchExpired = 0u;
+        snprintf(variant, sizeof(variant), "Timer_Tick, %u timers", (unsigned)count);
+        Bench_Run(variant, 1u, 0u, []() { Timer_Tick(); });
+        Bench_Note("%u timers: %.4f expiries per tick", (unsigned)count,
+                   (double)Timer_BenchExpired / (double)Timer_GetTickCount());
+        for (i = 0u; i < count; i++)
+        {
+            Timer_Stop(&timers[i]);
+        }
+
+        scan.resize(count);
+        for (i = 0u; i < count; i++)
+        {
+            scan[i].period = Timer_BenchPeriod(i, count);
+            scan[i].expiry = now + Timer_BenchFirst(i, count);
+        }
+        snprintf(variant, sizeof(variant), "scan of every timer, %u timers", (unsigned)count);
+        Bench_Run(variant, 1u, 0u, [&]() { Timer_BenchScanTick(scan, ++now); });
+    }
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-016   | 17-Oct-2026 | First version of Timer_Bench.cpp                                             |
+***********************************************************************************************************************/
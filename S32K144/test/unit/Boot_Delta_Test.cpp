@@ -0,0 +1,336 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Boot_Delta_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Boot_Delta_Test.cpp
+    Delta downloads of the bootloader (make HOST=1 BOOT=1 test) on representative image pairs: constants
+    tuned, code inserted with the branches and pointers after it moved, a function added, an unrelated image.
+    tools/DeltaGen encodes each pair, Boot patches the image in the simulated flash. Reports the size
+    reduction and the apply time against the full download of the new image.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstring>
+#include <ctime>
+#include <vector>
+#include <gtest/gtest.h>
+#include "HostTool.h"
+extern "C" {
+#include "Boot.h"
+#include "Boot_Delta.h"
+#include "Fls.h"
+#include "Ftfc_Host.h"
+#include "MemPool.h"
+#include "Crc.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define BOOT_DELTA_TEST_IMAGE_SIZE          (96u * 1024u)
+
+/*8 byte frame on a 500 kbit/s bus, about 125 bits with stuffing and IFS*/
+#define BOOT_DELTA_TEST_FRAME_US            (250u)
+
+/*Simulated time a download may take*/
+#define BOOT_DELTA_TEST_LIMIT_US            (60000000u)
+
+/*Time of one download through Boot*/
+typedef struct
+{
+    u32bit flashUs;                                 /*Simulated time, FTFC bound*/
+    u32bit busUs;                                   /*Transfer of the blocks on a 500 kbit/s bus*/
+    double cpuMs;                                   /*Host CPU time of Boot, decoding included*/
+    boolean ok;
+} Boot_DeltaTestResultType;
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Delta from old to new with tools/DeltaGen, raw images at the host application start. Empty when the tool failed.
+ */
+static std::vector<u8bit> Boot_DeltaTestGen(const std::vector<u8bit> & oldImage, const std::vector<u8bit> & newImage)
+{
+    std::vector<u8bit> input(4u);
+    u32bit i;
+
+    for (i = 0u; i < 4u; i++)
+    {
+        input[i] = (u8bit)(oldImage.size() >> (8u * i));
+    }
+    input.insert(input.end(), oldImage.begin(), oldImage.end());
+    input.insert(input.end(), newImage.begin(), newImage.end());
+    return HostTool_Python("DeltaGen",
+                           "import struct, delta_gen\n"
+                           "raw = open(sys.argv[1], 'rb').read()\n"
+                           "size = struct.unpack_from('<I', raw)[0]\n"
+                           "open(sys.argv[2] + '.old', 'wb').write(raw[4:4 + size])\n"
+                           "open(sys.argv[2] + '.new', 'wb').write(raw[4 + size:])\n"
+                           "sys.stdout = open('/dev/null', 'w')\n"
+                           "code = delta_gen.main(['', sys.argv[2] + '.old', sys.argv[2] + '.new', sys.argv[2], '"
+                           + std::to_string(BOOT_CFG_APP_START) + "'])\n"
+                           "import os\n"
+                           "os.unlink(sys.argv[2] + '.old')\n"
+                           "os.unlink(sys.argv[2] + '.new')\n"
+                           "sys.exit(code)\n", input);
+}
+
+/*
+ * One pass of the bootloader loop as Boot_Main.c runs it, FTFC time advanced.
+ */
+static void Boot_DeltaTestStep(void)
+{
+    Boot_MainFunction();
+    Ftfc_HostAdvance(BOOT_CFG_HOST_LOOP_US);
+}
+
+/*
+ * Download of data as Dcm hands it over: Boot_Start, BOOT_CFG_BLOCK_SIZE blocks in MemPool blocks, Boot_Finish with
+ * the CRC-32 of the image programmed. size is the image size, data the delta with delta.
+ */
+static Boot_DeltaTestResultType Boot_DeltaTestDownload(const std::vector<u8bit> & data, u32bit size, u32bit crc,
+                                                       boolean delta)
+{
+    Boot_DeltaTestResultType result = {};
+    u32bit startUs = Ftfc_HostTimeUs;
+    clock_t startCpu = clock();
+    u32bit offset;
+    u32bit count;
+    u8bit * block;
+    u8bit status = BOOT_OK;
+
+    result.ok = Boot_Start(BOOT_CFG_APP_START, size, delta);
+    for (offset = 0u; (result.ok == TRUE) && (offset < data.size()); offset += count)
+    {
+        count = ((data.size() - offset) > BOOT_CFG_BLOCK_SIZE) ? BOOT_CFG_BLOCK_SIZE : (u32bit)(data.size() - offset);
+        block = (u8bit *)MemPool_Alloc(count);
+        memcpy(block, &data[offset], count);
+        while ((status = Boot_Write(block, block, (u16bit)count)) == BOOT_PENDING)
+        {
+            Boot_DeltaTestStep();
+        }
+        result.ok = (status == BOOT_OK) ? TRUE : FALSE;
+        if (result.ok == FALSE)
+        {
+            MemPool_Free(block);
+        }
+        result.busUs += (1u + (((count + 2u) - 6u + 6u) / 7u)) * BOOT_DELTA_TEST_FRAME_US;
+    }
+    while ((result.ok == TRUE) && ((status = Boot_Finish(crc)) == BOOT_PENDING) &&
+           ((Ftfc_HostTimeUs - startUs) < BOOT_DELTA_TEST_LIMIT_US))
+    {
+        Boot_DeltaTestStep();
+    }
+    result.ok = ((result.ok == TRUE) && (status == BOOT_OK) && (Boot_AppValid() == TRUE)) ? TRUE : FALSE;
+    result.flashUs = Ftfc_HostTimeUs - startUs;
+    result.cpuMs = 1000.0 * (double)(clock() - startCpu) / CLOCKS_PER_SEC;
+    return result;
+}
+
+/*
+ * Full download of image, then the flash must hold it.
+ */
+static Boot_DeltaTestResultType Boot_DeltaTestFull(const std::vector<u8bit> & image)
+{
+    u32bit crc = Crc_CalculateCRC32(image.data(), (u32bit)image.size(), 0u, TRUE);
+    Boot_DeltaTestResultType result = Boot_DeltaTestDownload(image, (u32bit)image.size(), crc, FALSE);
+
+    EXPECT_EQ(0, memcmp(image.data(), Fls_Memory(BOOT_CFG_APP_START), image.size()));
+    return result;
+}
+
+/*
+ * oldImage programmed, then newImage by delta: the flash holds newImage and the delta is reported against the full
+ * download of newImage.
+ */
+static std::vector<u8bit> Boot_DeltaTestPair(const char * name, const std::vector<u8bit> & oldImage,
+                                             const std::vector<u8bit> & newImage)
+{
+    std::vector<u8bit> delta = Boot_DeltaTestGen(oldImage, newImage);
+    u32bit crc = Crc_CalculateCRC32(newImage.data(), (u32bit)newImage.size(), 0u, TRUE);
+    Boot_DeltaTestResultType full;
+    Boot_DeltaTestResultType patch;
+
+    EXPECT_FALSE(delta.empty()) << name << ": delta_gen.py failed";
+    if (!delta.empty())
+    {
+        full = Boot_DeltaTestFull(newImage);
+        EXPECT_TRUE(full.ok) << name;
+        EXPECT_TRUE(Boot_DeltaTestFull(oldImage).ok) << name;
+        patch = Boot_DeltaTestDownload(delta, (u32bit)newImage.size(), crc, TRUE);
+        EXPECT_TRUE(patch.ok) << name;
+        EXPECT_EQ(0, memcmp(newImage.data(), Fls_Memory(BOOT_CFG_APP_START), newImage.size())) << name;
+        printf("%-18s delta %6u B of %6u B (%5.1f %% smaller), apply %5.2f s flash + %5.2f s bus = %5.2f s, "
+               "full %5.2f s, host CPU %.1f ms\n", name, (u32bit)delta.size(), (u32bit)newImage.size(),
+               100.0 - (100.0 * (double)delta.size() / (double)newImage.size()),
+               (double)patch.flashUs * 1e-6, (double)patch.busUs * 1e-6,
+               (double)(patch.flashUs + patch.busUs) * 1e-6, (double)(full.flashUs + full.busUs) * 1e-6,
+               patch.cpuMs);
+    }
+    return delta;
+}
+
+/*
+ * Machine code of the test executable with a plausible vector table: initial stack at the end of RAM, reset
+ * handler inside.
+ */
+static std::vector<u8bit> Boot_DeltaTestImage(u32bit size)
+{
+    std::vector<u8bit> image = HostTool_ImageSample(8192, size);
+    u32bit i;
+
+    for (i = 0u; (i < 4u) && (image.size() == size); i++)
+    {
+        image[i] = (u8bit)(BOOT_CFG_RAM_END >> (8u * i));
+        image[4u + i] = (u8bit)((BOOT_CFG_APP_START + 0x401u) >> (8u * i));
+    }
+    return image;
+}
+
+/*
+ * Little endian word at offset changed by add.
+ */
+static void Boot_DeltaTestAdd32(std::vector<u8bit> & image, u32bit offset, u32bit add)
+{
+    u32bit value = (u32bit)image[offset] | ((u32bit)image[offset + 1u] << 8) | ((u32bit)image[offset + 2u] << 16) |
+                   ((u32bit)image[offset + 3u] << 24);
+    u32bit i;
+
+    value += add;
+    for (i = 0u; i < 4u; i++)
+    {
+        image[offset + i] = (u8bit)(value >> (8u * i));
+    }
+}
+
+static void Boot_DeltaTestReset(void)
+{
+    ASSERT_TRUE(MemPool_Init());
+    Boot_Init();
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Boot_Delta, TunedConstants)
+{
+    std::vector<u8bit> oldImage = Boot_DeltaTestImage(BOOT_DELTA_TEST_IMAGE_SIZE);
+    std::vector<u8bit> newImage = oldImage;
+    std::vector<u8bit> delta;
+    u32bit i;
+
+    ASSERT_EQ(BOOT_DELTA_TEST_IMAGE_SIZE, oldImage.size());
+    Boot_DeltaTestReset();
+    for (i = 0u; i < 16u; i++)
+    {
+        Boot_DeltaTestAdd32(newImage, 0x9000u + (i * 0x400u), 0x00010000u + i);
+    }
+    delta = Boot_DeltaTestPair("tuned constants", oldImage, newImage);
+    EXPECT_LT(delta.size(), newImage.size() / 50u);
+}
+
+TEST(Boot_Delta, InsertedCode)
+{
+    std::vector<u8bit> oldImage = Boot_DeltaTestImage(BOOT_DELTA_TEST_IMAGE_SIZE);
+    std::vector<u8bit> newImage = oldImage;
+    std::vector<u8bit> code = HostTool_ImageSample(8192 + BOOT_DELTA_TEST_IMAGE_SIZE, 200u);
+    std::vector<u8bit> delta;
+    u32bit offset;
+
+    ASSERT_EQ(BOOT_DELTA_TEST_IMAGE_SIZE, oldImage.size());
+    ASSERT_EQ(200u, code.size());
+    Boot_DeltaTestReset();
+
+    /* 200 bytes inserted at 30 %, the image keeps its size. Branches and literal pool pointers across the
+       insertion move: one word in 64 of the code after it */
+    newImage.insert(newImage.begin() + (BOOT_DELTA_TEST_IMAGE_SIZE * 3u / 10u), code.begin(), code.end());
+    newImage.resize(BOOT_DELTA_TEST_IMAGE_SIZE);
+    for (offset = (BOOT_DELTA_TEST_IMAGE_SIZE * 3u / 10u) + 256u; offset < newImage.size(); offset += 256u)
+    {
+        Boot_DeltaTestAdd32(newImage, offset, 200u);
+    }
+    delta = Boot_DeltaTestPair("inserted code", oldImage, newImage);
+    EXPECT_LT(delta.size(), newImage.size() / 4u);
+}
+
+TEST(Boot_Delta, AddedFunction)
+{
+    std::vector<u8bit> oldImage = Boot_DeltaTestImage(BOOT_DELTA_TEST_IMAGE_SIZE - 4096u);
+    std::vector<u8bit> newImage = oldImage;
+    std::vector<u8bit> function = HostTool_ImageSample(8192 + BOOT_DELTA_TEST_IMAGE_SIZE, 4096u);
+    std::vector<u8bit> delta;
+
+    ASSERT_EQ(4096u, function.size());
+    Boot_DeltaTestReset();
+
+    /* New function linked at the end, the reset handler now calls it first */
+    newImage.insert(newImage.end(), function.begin(), function.end());
+    Boot_DeltaTestAdd32(newImage, 0x400u, 0x1000u);
+    delta = Boot_DeltaTestPair("added function", oldImage, newImage);
+    EXPECT_LT(delta.size(), newImage.size() / 10u);
+}
+
+TEST(Boot_Delta, UnrelatedImage)
+{
+    std::vector<u8bit> oldImage = Boot_DeltaTestImage(BOOT_DELTA_TEST_IMAGE_SIZE);
+    std::vector<u8bit> newImage(BOOT_DELTA_TEST_IMAGE_SIZE);
+    std::vector<u8bit> delta;
+    u32bit seed = 0x2545F491u;
+    u32bit i;
+
+    ASSERT_EQ(BOOT_DELTA_TEST_IMAGE_SIZE, oldImage.size());
+    Boot_DeltaTestReset();
+    for (i = 0u; i < newImage.size(); i++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        newImage[i] = (u8bit)(seed >> 16);
+    }
+    memcpy(newImage.data(), oldImage.data(), 8u);
+
+    /* Nothing to copy: the delta is the image plus its literal tokens and still applies */
+    delta = Boot_DeltaTestPair("unrelated image", oldImage, newImage);
+    EXPECT_LT(delta.size(), newImage.size() + (newImage.size() / 100u));
+}
+
+TEST(Boot_Delta, DeltaForAnotherImageIsRejected)
+{
+    std::vector<u8bit> oldImage = Boot_DeltaTestImage(BOOT_DELTA_TEST_IMAGE_SIZE);
+    std::vector<u8bit> otherImage = oldImage;
+    std::vector<u8bit> newImage = oldImage;
+    std::vector<u8bit> delta;
+    u32bit crc;
+
+    ASSERT_EQ(BOOT_DELTA_TEST_IMAGE_SIZE, oldImage.size());
+    Boot_DeltaTestReset();
+    Boot_DeltaTestAdd32(otherImage, 0x2000u, 1u);
+    Boot_DeltaTestAdd32(newImage, 0x3000u, 1u);
+    delta = Boot_DeltaTestGen(otherImage, newImage);
+    ASSERT_FALSE(delta.empty());
+    crc = Crc_CalculateCRC32(newImage.data(), (u32bit)newImage.size(), 0u, TRUE);
+
+    /* The flash holds oldImage, the delta was made against otherImage */
+    ASSERT_TRUE(Boot_DeltaTestFull(oldImage).ok);
+    EXPECT_FALSE(Boot_DeltaTestDownload(delta, (u32bit)newImage.size(), crc, TRUE).ok);
+    EXPECT_FALSE(Boot_AppValid());
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-019   | 17-Oct-2026 | First version of Boot_Delta_Test.cpp                                         |
+***********************************************************************************************************************/
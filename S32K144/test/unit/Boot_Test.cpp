@@ -0,0 +1,254 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Boot_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Boot_Test.cpp
+    Downloads through the tester of the host CAN loopback (make HOST=1 BOOT=1 test): the block
+    sequence counter of transfer data, images only from the application start and no block past the
+    end of the image.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+extern "C" {
+#include "Boot.h"
+#include "Fls.h"
+#include "Ftfc_Host.h"
+#include "Can_Host.h"
+#include "CanTp.h"
+#include "Dcm.h"
+#include "MemPool.h"
+#include "Timer.h"
+#include "Crc.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Simulated time a request may take*/
+#define BOOT_TEST_LIMIT_US                  (10000000u)
+
+typedef std::vector<u8bit> Boot_TestMessageType;
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * One pass of the bootloader loop (Boot_Main.c): FTFC steps on every pass, CAN stack on the 1 ms tick.
+ */
+static void Boot_TestLoop(void)
+{
+    u32bit before = Ftfc_HostTimeUs / 1000u;
+
+    Boot_MainFunction();
+    Ftfc_HostAdvance(BOOT_CFG_HOST_LOOP_US);
+    (void)Can_HostProcess();
+    if ((Ftfc_HostTimeUs / 1000u) != before)
+    {
+        CanTp_MainFunction();
+        Dcm_MainFunction();
+        Timer_Tick();
+    }
+}
+
+/*
+ * Tester request and its final response, response pending answers skipped. Empty when there is none.
+ */
+static Boot_TestMessageType Boot_TestRequest(const Boot_TestMessageType & request)
+{
+    Boot_TestMessageType result;
+    const u8bit * response;
+    u16bit length;
+    u32bit start = Ftfc_HostTimeUs;
+
+    while (Can_HostTesterRequest(request.data(), (u16bit)request.size()) == FALSE)
+    {
+        Boot_TestLoop();
+    }
+    while (result.empty() && ((Ftfc_HostTimeUs - start) < BOOT_TEST_LIMIT_US))
+    {
+        Boot_TestLoop();
+        response = Can_HostTesterResponse(&length);
+        if (response != NULL)
+        {
+            if ((length != 3u) || (response[0] != 0x7Fu) || (response[2] != 0x78u))
+            {
+                result.assign(response, response + length);
+            }
+            Can_HostTesterRelease();
+        }
+    }
+    return result;
+}
+
+/*
+ * Stack, idle bus and the programming session.
+ */
+static void Boot_TestReset(void)
+{
+    (void)Can_HostProcess();
+    Can_HostTesterRelease();
+    ASSERT_TRUE(MemPool_Init());
+    Timer_Init();
+    CanTp_Init();
+    Dcm_Init();
+    Boot_Init();
+    ASSERT_EQ(6u, Boot_TestRequest({ 0x10u, DCM_SESSION_PROGRAMMING }).size());
+}
+
+/*
+ * Plausible application of size bytes: stack at the end of RAM, reset handler inside, then a pattern.
+ */
+static Boot_TestMessageType Boot_TestImage(u32bit size)
+{
+    Boot_TestMessageType image(size);
+    u32bit pc = BOOT_CFG_APP_START + 0x101u;
+    u32bit i;
+
+    for (i = 8u; i < size; i++)
+    {
+        image[i] = (u8bit)((i * 7u) ^ (i >> 9));
+    }
+    for (i = 0u; i < 4u; i++)
+    {
+        image[i] = (u8bit)(BOOT_CFG_RAM_END >> (8u * i));
+        image[4u + i] = (u8bit)(pc >> (8u * i));
+    }
+    return image;
+}
+
+/*
+ * Request download of a plain image of size bytes at address.
+ */
+static Boot_TestMessageType Boot_TestDownload(u32bit address, u32bit size)
+{
+    Boot_TestMessageType request({ 0x34u, 0x00u, 0x44u });
+    u32bit i;
+
+    for (i = 0u; i < 4u; i++)
+    {
+        request.push_back((u8bit)(address >> (24u - (8u * i))));
+    }
+    for (i = 0u; i < 4u; i++)
+    {
+        request.push_back((u8bit)(size >> (24u - (8u * i))));
+    }
+    return Boot_TestRequest(request);
+}
+
+/*
+ * Transfer data of the count image bytes at offset with block sequence counter.
+ */
+static Boot_TestMessageType Boot_TestTransfer(u8bit counter, const Boot_TestMessageType & image, u32bit offset,
+                                              u32bit count)
+{
+    Boot_TestMessageType request({ 0x36u, counter });
+
+    request.insert(request.end(), image.begin() + offset, image.begin() + offset + count);
+    return Boot_TestRequest(request);
+}
+
+/*
+ * Request transfer exit with the CRC-32 of data.
+ */
+static Boot_TestMessageType Boot_TestExit(const Boot_TestMessageType & data)
+{
+    u32bit crc = Crc_CalculateCRC32(data.data(), (u32bit)data.size(), 0u, TRUE);
+
+    return Boot_TestRequest({ 0x37u, (u8bit)(crc >> 24), (u8bit)(crc >> 16), (u8bit)(crc >> 8), (u8bit)crc });
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Boot, CounterZeroBeforeTheFirstBlockIsAWrongSequence)
+{
+    const u32bit size = 2u * BOOT_CFG_BLOCK_SIZE;
+    Boot_TestMessageType image = Boot_TestImage(size);
+    Boot_TestMessageType other(image);
+    const Boot_TestMessageType wrong({ 0x7Fu, 0x36u, 0x73u });
+
+    other[100] ^= 0xFFu;
+    Boot_TestReset();
+    ASSERT_EQ(Boot_TestMessageType({ 0x74u, 0x20u, 0x0Fu, 0xFAu }), Boot_TestDownload(BOOT_CFG_APP_START, size));
+    EXPECT_EQ(wrong, Boot_TestTransfer(0x00u, image, 0u, BOOT_CFG_BLOCK_SIZE));
+    EXPECT_EQ(Boot_TestMessageType({ 0x76u, 0x01u }), Boot_TestTransfer(0x01u, image, 0u, BOOT_CFG_BLOCK_SIZE));
+
+    /* Response lost: the tester repeats block 1, confirmed again but not programmed */
+    EXPECT_EQ(Boot_TestMessageType({ 0x76u, 0x01u }), Boot_TestTransfer(0x01u, other, 0u, BOOT_CFG_BLOCK_SIZE));
+    EXPECT_EQ(wrong, Boot_TestTransfer(0x00u, image, 0u, BOOT_CFG_BLOCK_SIZE));
+    EXPECT_EQ(Boot_TestMessageType({ 0x76u, 0x02u }),
+              Boot_TestTransfer(0x02u, image, BOOT_CFG_BLOCK_SIZE, BOOT_CFG_BLOCK_SIZE));
+    EXPECT_EQ(Boot_TestMessageType({ 0x77u }), Boot_TestExit(image));
+    EXPECT_EQ(0, memcmp(image.data(), Fls_Memory(BOOT_CFG_APP_START), size));
+    EXPECT_TRUE(Boot_AppValid());
+}
+
+TEST(Boot, DownloadNotAtTheApplicationStartIsRefused)
+{
+    Boot_TestMessageType image = Boot_TestImage(BOOT_CFG_BLOCK_SIZE);
+
+    Boot_TestReset();
+    ASSERT_EQ(4u, Boot_TestDownload(BOOT_CFG_APP_START, BOOT_CFG_BLOCK_SIZE).size());
+    ASSERT_EQ(Boot_TestMessageType({ 0x76u, 0x01u }), Boot_TestTransfer(0x01u, image, 0u, BOOT_CFG_BLOCK_SIZE));
+    ASSERT_EQ(Boot_TestMessageType({ 0x77u }), Boot_TestExit(image));
+    ASSERT_TRUE(Boot_AppValid());
+
+    /* A sector further on: its trailer could never match, the application in flash stays valid */
+    EXPECT_EQ(Boot_TestMessageType({ 0x7Fu, 0x34u, 0x70u }),
+              Boot_TestDownload(BOOT_CFG_APP_START + FLS_SECTOR_SIZE, BOOT_CFG_BLOCK_SIZE));
+    EXPECT_EQ(Boot_TestMessageType({ 0x7Fu, 0x36u, 0x24u }), Boot_TestTransfer(0x01u, image, 0u, 8u));
+    EXPECT_EQ(Boot_TestMessageType({ 0x7Eu, 0x00u }), Boot_TestRequest({ 0x3Eu, 0x00u }));
+    EXPECT_TRUE(Boot_AppValid());
+}
+
+TEST(Boot, BlockAfterTheLastOneIsRefused)
+{
+    const u32bit size = BOOT_CFG_BLOCK_SIZE + 4u;
+    Boot_TestMessageType image = Boot_TestImage(size);
+    const Boot_TestMessageType extra(FLS_PHRASE_SIZE, 0x00u);
+    const u8bit * flash = Fls_Memory(BOOT_CFG_APP_START);
+    Boot_TestMessageType after;
+    u32bit i;
+
+    Boot_TestReset();
+    after.assign(flash + size + 4u, flash + size + 4u + FLS_PHRASE_SIZE);
+    ASSERT_EQ(4u, Boot_TestDownload(BOOT_CFG_APP_START, size).size());
+    EXPECT_EQ(Boot_TestMessageType({ 0x76u, 0x01u }), Boot_TestTransfer(0x01u, image, 0u, BOOT_CFG_BLOCK_SIZE));
+    EXPECT_EQ(Boot_TestMessageType({ 0x76u, 0x02u }), Boot_TestTransfer(0x02u, image, BOOT_CFG_BLOCK_SIZE, 4u));
+
+    /* The last phrase was padded past the end of the image, nothing is left for one more block */
+    EXPECT_EQ(Boot_TestMessageType({ 0x7Fu, 0x36u, 0x72u }), Boot_TestTransfer(0x03u, extra, 0u, FLS_PHRASE_SIZE));
+    EXPECT_EQ(Boot_TestMessageType({ 0x77u }), Boot_TestExit(image));
+    EXPECT_EQ(0, memcmp(image.data(), flash, size));
+    for (i = size; i < (size + 4u); i++)
+    {
+        EXPECT_EQ(0xFFu, flash[i]) << i;
+    }
+    EXPECT_EQ(after, Boot_TestMessageType(flash + size + 4u, flash + size + 4u + FLS_PHRASE_SIZE));
+    EXPECT_TRUE(Boot_AppValid());
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of Boot_Test.cpp                                               |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | Download start and block past the end of the image                           |
+***********************************************************************************************************************/
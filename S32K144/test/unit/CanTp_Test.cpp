@@ -0,0 +1,328 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: CanTp_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \CanTp_Test.cpp
+    CanTp over the host CAN loopback: segmentation of every frame type between the Dcm and tester
+    channels, single frame confirmation deferred to CanTp_MainFunction, block size and STmin of the flow
+    control, N_Bs timeout and upper layer callbacks made with the lock released.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+extern "C" {
+#include "CanTp.h"
+#include "Can_Host.h"
+#include "Dcm.h"
+#include "MemPool.h"
+#include "Timer.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*CanTp_MainFunction calls allowed for one message, far below the N_Bs timeout*/
+#define CANTP_TEST_MAX_CALLS                (100u)
+
+/*Identifiers of the Tester channel, the test answers its transmissions in place of the Dcm channel*/
+#define CANTP_TEST_TESTER_TX_ID             (0x7E0uL)
+#define CANTP_TEST_TESTER_RX_ID             (0x7E8uL)
+
+/*Frames one test may take off the bus*/
+#define CANTP_TEST_MAX_FRAMES               (64u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+/*Frames of the Tester channel taken off the bus, and the CanTp_MainFunction call that sent each one*/
+static u8bit  CanTp_TestFrames[CANTP_TEST_MAX_FRAMES][8];
+static u32bit CanTp_TestFrameCall[CANTP_TEST_MAX_FRAMES];
+static u32bit CanTp_TestFrameCount;
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Empty bus, idle channels and a fresh heap for every test.
+ */
+static void CanTp_TestReset(void)
+{
+    (void)Can_HostProcess();
+    Can_HostTesterRelease();
+    ASSERT_TRUE(MemPool_Init());
+    Timer_Init();
+    CanTp_Init();
+    Dcm_Init();
+    Can_HostTesterTxFailures = 0u;
+    Can_HostTesterTxConfirmations = 0u;
+    Can_HostTesterLockedCalls = 0u;
+}
+
+/*
+ * Bus and CanTp until the tester holds a response, returns the CanTp_MainFunction calls it took.
+ */
+static u32bit CanTp_TestPump(bool serveDcm)
+{
+    const u8bit * response;
+    u16bit length;
+    u32bit calls = 0u;
+
+    do
+    {
+        (void)Can_HostProcess();
+        CanTp_MainFunction();
+        if (serveDcm)
+        {
+            Dcm_MainFunction();
+        }
+        calls++;
+        response = Can_HostTesterResponse(&length);
+    } while ((response == NULL) && (calls < CANTP_TEST_MAX_CALLS));
+    return calls;
+}
+
+/*
+ * Frames on the bus, taken off it before the Dcm channel sees them and stamped with call.
+ */
+static void CanTp_TestTake(u32bit call)
+{
+    u32bit id;
+
+    while ((CanTp_TestFrameCount < CANTP_TEST_MAX_FRAMES) &&
+           (Can_HostRead(&id, CanTp_TestFrames[CanTp_TestFrameCount]) == TRUE))
+    {
+        EXPECT_EQ(CANTP_TEST_TESTER_TX_ID, id);
+        CanTp_TestFrameCall[CanTp_TestFrameCount] = call;
+        CanTp_TestFrameCount++;
+    }
+}
+
+/*
+ * Flow control of the receiver, clear to send blockSize frames stMin apart.
+ */
+static void CanTp_TestFlowControl(u8bit blockSize, u8bit stMin)
+{
+    const u8bit frame[8] = { 0x30u, blockSize, stMin, 0xCCu, 0xCCu, 0xCCu, 0xCCu, 0xCCu };
+
+    CanTp_RxIndication(CANTP_TEST_TESTER_RX_ID, frame, 8u);
+}
+
+/*
+ * calls CanTp_MainFunction calls numbered from first, the frames they send taken.
+ */
+static void CanTp_TestCalls(u32bit first, u32bit calls)
+{
+    u32bit call;
+
+    for (call = first; call < (first + calls); call++)
+    {
+        CanTp_MainFunction();
+        CanTp_TestTake(call);
+    }
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(CanTp, EveryLengthArrivesIntactThroughTheLoopback)
+{
+    static const u16bit lengths[] = { 1u, 4u, 5u, 6u, 7u, 13u, 62u, 63u, 64u, 500u, 4000u, CANTP_MAX_LENGTH - 3u };
+    const u8bit head[3] = { 0x62u, 0xF1u, 0x90u };
+    std::vector<u8bit> data(CANTP_MAX_LENGTH);
+    const u8bit * response;
+    u16bit length;
+    u32bit i;
+
+    for (i = 0u; i < data.size(); i++)
+    {
+        data[i] = (u8bit)((i * 31u) ^ (i >> 8));
+    }
+    for (u16bit size : lengths)
+    {
+        CanTp_TestReset();
+        ASSERT_TRUE(CanTp_Transmit(CANTP_CHANNEL_Dcm, head, 3u, data.data(), size)) << size;
+        EXPECT_LT(CanTp_TestPump(false), CANTP_TEST_MAX_CALLS) << size;
+        response = Can_HostTesterResponse(&length);
+        ASSERT_NE((const u8bit *)NULL, response) << size;
+        ASSERT_EQ(size + 3u, length);
+        EXPECT_EQ(0, memcmp(head, response, 3u)) << size;
+        EXPECT_EQ(0, memcmp(data.data(), &response[3], size)) << size;
+        EXPECT_EQ(0u, Can_HostTesterLockedCalls) << size;
+    }
+}
+
+TEST(CanTp, OutOfRangeTransmissionsAreRefused)
+{
+    u8bit data[8] = {};
+    u32bit frames;
+
+    CanTp_TestReset();
+    frames = Can_HostFrameCount;
+    EXPECT_FALSE(CanTp_Transmit(CANTP_CHANNEL_Tester, NULL, 0u, data, 0u));
+    EXPECT_FALSE(CanTp_Transmit(CANTP_CHANNEL_Tester, data, 1u, data, CANTP_MAX_LENGTH));
+    EXPECT_FALSE(CanTp_Transmit(CANTP_CHANNEL_Tester, data, CANTP_MAX_HEAD + 1u, data, 1u));
+    EXPECT_EQ(frames, Can_HostFrameCount);
+}
+
+TEST(CanTp, SingleFrameIsConfirmedByTheMainFunction)
+{
+    const u8bit request[2] = { 0x3Eu, 0x00u };
+    const u8bit * response;
+    u16bit length;
+
+    CanTp_TestReset();
+    ASSERT_TRUE(Can_HostTesterRequest(request, 2u));
+    EXPECT_EQ(0u, Can_HostTesterTxConfirmations);
+    EXPECT_FALSE(Can_HostTesterRequest(request, 2u));
+    CanTp_MainFunction();
+    EXPECT_EQ(1u, Can_HostTesterTxConfirmations);
+    EXPECT_EQ(0u, Can_HostTesterTxFailures);
+
+    /* The Dcm response is confirmed the same way, the channel is free again for the next request */
+    EXPECT_LT(CanTp_TestPump(true), CANTP_TEST_MAX_CALLS);
+    response = Can_HostTesterResponse(&length);
+    ASSERT_NE((const u8bit *)NULL, response);
+    ASSERT_EQ(2u, length);
+    EXPECT_EQ(0x7Eu, response[0]);
+    EXPECT_EQ(0x00u, response[1]);
+    Can_HostTesterRelease();
+    CanTp_MainFunction();
+    Dcm_MainFunction();
+    EXPECT_TRUE(Can_HostTesterRequest(request, 2u));
+    EXPECT_LT(CanTp_TestPump(true), CANTP_TEST_MAX_CALLS);
+    EXPECT_NE((const u8bit *)NULL, Can_HostTesterResponse(&length));
+    EXPECT_EQ(2u, Can_HostTesterTxConfirmations);
+    EXPECT_EQ(0u, Can_HostTesterLockedCalls);
+}
+
+TEST(CanTp, RequestBeforeTheLastConfirmationIsServed)
+{
+    const u8bit request[2] = { 0x3Eu, 0x00u };
+    const u8bit * response;
+    u16bit length;
+
+    CanTp_TestReset();
+    ASSERT_TRUE(Can_HostTesterRequest(request, 2u));
+    (void)Can_HostProcess();
+    CanTp_MainFunction();
+    Dcm_MainFunction();
+    (void)Can_HostProcess();
+    ASSERT_NE((const u8bit *)NULL, Can_HostTesterResponse(&length));
+    Can_HostTesterRelease();
+
+    /* The response is on the bus but Dcm has not been confirmed yet, the tester asks again at once */
+    ASSERT_TRUE(Can_HostTesterRequest(request, 2u));
+    (void)Can_HostProcess();
+    EXPECT_LT(CanTp_TestPump(true), CANTP_TEST_MAX_CALLS);
+    response = Can_HostTesterResponse(&length);
+    ASSERT_NE((const u8bit *)NULL, response);
+    ASSERT_EQ(2u, length);
+    EXPECT_EQ(0x7Eu, response[0]);
+    EXPECT_EQ(0u, Can_HostTesterLockedCalls);
+}
+
+TEST(CanTp, MissingFlowControlTimesOut)
+{
+    u8bit request[100] = { 0x22u };
+    u32bit calls = 0u;
+
+    CanTp_TestReset();
+    ASSERT_TRUE(Can_HostTesterRequest(request, sizeof(request)));
+    while ((Can_HostTesterTxConfirmations == 0u) && (calls < 2u * CANTP_CFG_TIMEOUT_MS))
+    {
+        CanTp_MainFunction();
+        calls++;
+    }
+    EXPECT_EQ(CANTP_CFG_TIMEOUT_MS * 1000u / CANTP_CFG_MAIN_PERIOD_US, calls);
+    EXPECT_EQ(1u, Can_HostTesterTxFailures);
+    EXPECT_EQ(0u, Can_HostTesterLockedCalls);
+    EXPECT_TRUE(Can_HostTesterRequest(request, 2u));
+}
+
+TEST(CanTp, BlockSizeAndStMinOfTheFlowControlPaceTheFrames)
+{
+    static const u32bit sent[] = { 1u, 3u, 5u, 31u, 32u, 33u, 51u, 51u };
+    u8bit request[60];
+    u32bit i;
+
+    for (i = 0u; i < sizeof(request); i++)
+    {
+        request[i] = (u8bit)(0x40u + i);
+    }
+    CanTp_TestReset();
+    CanTp_TestFrameCount = 0u;
+    ASSERT_TRUE(Can_HostTesterRequest(request, sizeof(request)));
+    CanTp_TestTake(0u);
+    ASSERT_EQ(1u, CanTp_TestFrameCount);
+    EXPECT_EQ(0x10u, CanTp_TestFrames[0][0]);
+    EXPECT_EQ(sizeof(request), CanTp_TestFrames[0][1]);
+
+    /* BS 3, STmin 2 ms: a frame every second call, then nothing until the next flow control */
+    CanTp_TestFlowControl(3u, 2u);
+    CanTp_TestCalls(1u, 30u);
+    /* BS 3, STmin 500 us: rounded up to one call */
+    CanTp_TestFlowControl(3u, 0xF5u);
+    CanTp_TestCalls(31u, 20u);
+    EXPECT_EQ(0u, Can_HostTesterTxConfirmations);
+    /* BS 0, STmin 0: the rest at once */
+    CanTp_TestFlowControl(0u, 0u);
+    CanTp_TestCalls(51u, 1u);
+
+    ASSERT_EQ(1u + (sizeof(sent) / sizeof(sent[0])), CanTp_TestFrameCount);
+    for (i = 0u; i < (sizeof(sent) / sizeof(sent[0])); i++)
+    {
+        EXPECT_EQ(sent[i], CanTp_TestFrameCall[1u + i]) << i;
+        EXPECT_EQ(0x21u + i, CanTp_TestFrames[1u + i][0]) << i;
+        EXPECT_EQ(0, memcmp(&request[6u + (7u * i)], &CanTp_TestFrames[1u + i][1],
+                            (i < 7u) ? 7u : (sizeof(request) - 55u))) << i;
+    }
+    EXPECT_EQ(1u, Can_HostTesterTxConfirmations);
+    EXPECT_EQ(0u, Can_HostTesterTxFailures);
+    EXPECT_EQ(0u, Can_HostTesterLockedCalls);
+}
+
+TEST(CanTp, BlockWithoutItsFlowControlTimesOut)
+{
+    u8bit request[100] = { 0x22u };
+    u32bit calls = 0u;
+
+    CanTp_TestReset();
+    CanTp_TestFrameCount = 0u;
+    ASSERT_TRUE(Can_HostTesterRequest(request, sizeof(request)));
+    CanTp_TestFlowControl(2u, 0u);
+    CanTp_TestCalls(0u, 1u);
+    EXPECT_EQ(3u, CanTp_TestFrameCount);
+    while ((Can_HostTesterTxConfirmations == 0u) && (calls < 2u * CANTP_CFG_TIMEOUT_MS))
+    {
+        CanTp_TestCalls(1u + calls, 1u);
+        calls++;
+    }
+    EXPECT_EQ(CANTP_CFG_TIMEOUT_MS * 1000u / CANTP_CFG_MAIN_PERIOD_US, calls);
+    EXPECT_EQ(3u, CanTp_TestFrameCount);
+    EXPECT_EQ(1u, Can_HostTesterTxFailures);
+    EXPECT_TRUE(Can_HostTesterRequest(request, 2u));
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of CanTp_Test.cpp                                              |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | Request before the confirmation of the last response                         |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | Flow control block size and STmin                                            |
+***********************************************************************************************************************/
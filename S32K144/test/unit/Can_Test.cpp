@@ -0,0 +1,168 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Can_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Can_Test.cpp
+    FlexCAN driver on the CAN0 register stub: initialization sequence, Rx FIFO filters, ordered transmit
+    mailbox batches and Rx FIFO frames delivered to CanTp.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstring>
+#include <gtest/gtest.h>
+extern "C" {
+#include "S32K144.h"
+#include "Can.h"
+#include "Can_Cfg.h"
+#include "Can_Host.h"
+#include "CanTp.h"
+#include "MemPool.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define CAN_TEST_TX_FLAGS                   (((1u << CAN_CFG_TX_MBS) - 1u) << CAN_CFG_TX_FIRST_MB)
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Register stub back to its reset state, then Can_Init.
+ */
+static void Can_TestInit(void)
+{
+    memset((void *)CAN0, 0, sizeof(*CAN0));
+    CAN0->MCR = 0xD890000Fu;
+    Can_Init();
+}
+
+static volatile u32bit * Can_TestMb(u32bit mb)
+{
+    return &CAN0->RAMn[mb * CAN_MB_WORDS];
+}
+
+/*
+ * Frame at the Rx FIFO output, as the controller presents it.
+ */
+static void Can_TestReceive(u32bit id, const u8bit * data, u8bit dlc)
+{
+    volatile u32bit * mb = Can_TestMb(0u);
+
+    mb[0] = CAN_CS_DLC_SET(dlc);
+    mb[1] = CAN_ID_STD(id);
+    mb[2] = ((u32bit)data[0] << 24) | ((u32bit)data[1] << 16) | ((u32bit)data[2] << 8) | data[3];
+    mb[3] = ((u32bit)data[4] << 24) | ((u32bit)data[5] << 16) | ((u32bit)data[6] << 8) | data[7];
+    CAN0->IFLAG1 |= CAN_IFLAG1_BUF5I_MASK;
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Can, InitJoinsTheBusWithFifoFiltersAndTransmitMailboxes)
+{
+    u32bit i;
+
+    Can_TestInit();
+    EXPECT_NE(0u, PCC->PCCn[PCC_FlexCAN0_INDEX] & PCC_PCCn_CGC_MASK);
+    EXPECT_NE(0u, PCC->PCCn[PCC_PORTE_INDEX] & PCC_PCCn_CGC_MASK);
+    EXPECT_EQ(PORT_PCR_MUX(5u), PORTE->PCR[4]);
+    EXPECT_EQ(PORT_PCR_MUX(5u), PORTE->PCR[5]);
+    EXPECT_EQ(CAN_CFG_CTRL1_TIMING | CAN_CTRL1_CLKSRC_MASK | CAN_CTRL1_LBUF_MASK, CAN0->CTRL1);
+    EXPECT_EQ(CAN_MCR_RFEN_MASK | CAN_MCR_SRXDIS_MASK | CAN_MCR_MAXMB(15u), CAN0->MCR);
+    EXPECT_EQ(CAN_FIFO_FILTER_STD_MASK, CAN0->RXFGMASK);
+    EXPECT_EQ(CAN_FIFO_FILTER_STD(0x7E0u), CAN0->RAMn[CAN_FIFO_FILTER_WORD]);
+    EXPECT_EQ(CAN_FIFO_FILTER_STD(0x7E8u), CAN0->RAMn[CAN_FIFO_FILTER_WORD + 1u]);
+    for (i = 2u; i < CAN_FIFO_FILTERS; i++)
+    {
+        EXPECT_EQ(CAN_FIFO_FILTER_STD(0x7E8u), CAN0->RAMn[CAN_FIFO_FILTER_WORD + i]);
+    }
+    for (i = 0u; i < CAN_CFG_TX_MBS; i++)
+    {
+        EXPECT_EQ(CAN_CS_CODE(CAN_CODE_TX_INACTIVE), Can_TestMb(CAN_CFG_TX_FIRST_MB + i)[0]);
+    }
+    EXPECT_EQ(0u, CAN0->IFLAG1);
+}
+
+TEST(Can, WritesFillTheBatchInOrderAndRestartOnceItIsSent)
+{
+    u8bit data[8] = { 0x10u, 0x21u, 0x32u, 0x43u, 0x54u, 0x65u, 0x76u, 0x87u };
+    volatile u32bit * mb;
+    u32bit i;
+
+    Can_TestInit();
+    for (i = 0u; i < CAN_CFG_TX_MBS; i++)
+    {
+        data[7] = (u8bit)i;
+        ASSERT_TRUE(Can_Write(0x7E8u, data));
+        mb = Can_TestMb(CAN_CFG_TX_FIRST_MB + i);
+        EXPECT_EQ(CAN_CS_CODE(CAN_CODE_TX_DATA) | CAN_CS_DLC_SET(8u), mb[0]);
+        EXPECT_EQ(0x7E8u, CAN_ID_STD_GET(mb[1]));
+        EXPECT_EQ(0x10213243u, mb[2]);
+        EXPECT_EQ(0x54657600u | i, mb[3]);
+    }
+    EXPECT_FALSE(Can_Write(0x7E8u, data));
+
+    /* Not every mailbox sent yet: the next frame could overtake the pending ones */
+    CAN0->IFLAG1 = CAN_TEST_TX_FLAGS & ~(1u << (CAN_CFG_TX_FIRST_MB + CAN_CFG_TX_MBS - 1u));
+    EXPECT_FALSE(Can_Write(0x7E8u, data));
+    CAN0->IFLAG1 = CAN_TEST_TX_FLAGS;
+    ASSERT_TRUE(Can_Write(0x7E8u, data));
+    EXPECT_EQ(0u, CAN0->IFLAG1);
+    EXPECT_EQ(0x54657607u, Can_TestMb(CAN_CFG_TX_FIRST_MB)[3]);
+
+    /* A partial batch restarts as soon as it is sent */
+    CAN0->IFLAG1 = 1u << CAN_CFG_TX_FIRST_MB;
+    data[7] = 0xA5u;
+    ASSERT_TRUE(Can_Write(0x7E8u, data));
+    EXPECT_EQ(0x546576A5u, Can_TestMb(CAN_CFG_TX_FIRST_MB)[3]);
+}
+
+TEST(Can, FifoFramesReachCanTpAndOverflowsAreCounted)
+{
+    const u8bit frame[8] = { 0x03u, 0x62u, 0xF1u, 0x90u, 0xCCu, 0xCCu, 0xCCu, 0xCCu };
+    const u8bit * response;
+    u16bit length;
+    u32bit overflows;
+
+    ASSERT_TRUE(MemPool_Init());
+    CanTp_Init();
+    Can_HostTesterRelease();
+    Can_TestInit();
+
+    Can_MainFunction();
+    EXPECT_EQ((const u8bit *)NULL, Can_HostTesterResponse(&length));
+
+    overflows = Can_RxOverflows;
+    Can_TestReceive(0x7E8u, frame, 8u);
+    CAN0->IFLAG1 |= CAN_IFLAG1_BUF7I_MASK | CAN_IFLAG1_BUF6I_MASK;
+    Can_MainFunction();
+    EXPECT_EQ(0u, CAN0->IFLAG1);
+    EXPECT_EQ(overflows + 1u, Can_RxOverflows);
+    response = Can_HostTesterResponse(&length);
+    ASSERT_NE((const u8bit *)NULL, response);
+    ASSERT_EQ(3u, length);
+    EXPECT_EQ(0, memcmp(&frame[1], response, 3u));
+    Can_HostTesterRelease();
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-018   | 17-Oct-2026 | First version of Can_Test.cpp                                                |
+***********************************************************************************************************************/
@@ -0,0 +1,330 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Com_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Com_Test.cpp
+    Generated Com codecs against a generic DBC bit packer: Intel and Motorola signals at odd offsets and
+    widths, signed ones sign extended. Every bit of every signal alone, random values packed and random
+    payloads unpacked, unused bits of the payload 0.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstddef>
+#include <cstring>
+#include <gtest/gtest.h>
+extern "C" {
+#include "Com.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define COM_TEST_RANDOM_FRAMES              (20000u)
+
+/*Signal of Com_Cfg.json, field of the signal struct of its frame*/
+typedef struct
+{
+    const char * name;
+    u32bit start;                                   /*DBC start bit: LSB for Intel, MSB for Motorola*/
+    u32bit length;
+    boolean motorola;
+    boolean isSigned;
+    size_t offset;
+    size_t size;
+} Com_TestSignalType;
+
+#define COM_TEST_SIGNAL(frame, field, start, length, motorola, isSigned) \
+    { #field, (start), (length), (motorola), (isSigned), offsetof(Com_##frame##Type, field), \
+      sizeof(((Com_##frame##Type *)0)->field) }
+
+/*Frame codecs behind one signature, struct as bytes*/
+typedef struct
+{
+    const char * name;
+    u32bit dlc;
+    size_t size;
+    const Com_TestSignalType * signals;
+    u32bit count;
+    void (*pack)(const void * signals, Com_PayloadType * payload);
+    void (*unpack)(const Com_PayloadType * payload, void * signals);
+} Com_TestFrameType;
+
+#define COM_TEST_FRAME(frame, table) \
+    { #frame, COM_DLC_##frame, sizeof(Com_##frame##Type), (table), sizeof(table) / sizeof((table)[0]), \
+      [](const void * s, Com_PayloadType * p) { Com_Pack_##frame((const Com_##frame##Type *)s, p); }, \
+      [](const Com_PayloadType * p, void * s) { Com_Unpack_##frame(p, (Com_##frame##Type *)s); } }
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static const Com_TestSignalType Com_TestEngineStatus[] =
+{
+    COM_TEST_SIGNAL(EngineStatus, EngineSpeed,  7u,  16u, TRUE, FALSE),
+    COM_TEST_SIGNAL(EngineStatus, CoolantTemp,  23u, 8u,  TRUE, TRUE),
+    COM_TEST_SIGNAL(EngineStatus, ThrottlePos,  31u, 10u, TRUE, FALSE),
+    COM_TEST_SIGNAL(EngineStatus, EngineState,  37u, 3u,  TRUE, FALSE),
+    COM_TEST_SIGNAL(EngineStatus, EngineTorque, 47u, 16u, TRUE, TRUE),
+    COM_TEST_SIGNAL(EngineStatus, AliveCounter, 63u, 4u,  TRUE, FALSE),
+    COM_TEST_SIGNAL(EngineStatus, Checksum,     59u, 4u,  TRUE, FALSE),
+};
+
+static const Com_TestSignalType Com_TestWheelSpeed[] =
+{
+    COM_TEST_SIGNAL(WheelSpeed, FrontLeft,    0u,  14u, FALSE, FALSE),
+    COM_TEST_SIGNAL(WheelSpeed, FrontRight,   14u, 14u, FALSE, FALSE),
+    COM_TEST_SIGNAL(WheelSpeed, RearLeft,     28u, 14u, FALSE, FALSE),
+    COM_TEST_SIGNAL(WheelSpeed, RearRight,    42u, 14u, FALSE, FALSE),
+    COM_TEST_SIGNAL(WheelSpeed, Valid,        56u, 4u,  FALSE, FALSE),
+    COM_TEST_SIGNAL(WheelSpeed, AliveCounter, 60u, 4u,  FALSE, FALSE),
+};
+
+static const Com_TestSignalType Com_TestMotorCmd[] =
+{
+    COM_TEST_SIGNAL(MotorCmd, MotorDuty,     7u,  12u, TRUE, FALSE),
+    COM_TEST_SIGNAL(MotorCmd, Direction,     11u, 2u,  TRUE, FALSE),
+    COM_TEST_SIGNAL(MotorCmd, Enable,        9u,  1u,  TRUE, FALSE),
+    COM_TEST_SIGNAL(MotorCmd, TargetCurrent, 23u, 16u, TRUE, TRUE),
+};
+
+static const Com_TestFrameType Com_TestFrames[] =
+{
+    COM_TEST_FRAME(EngineStatus, Com_TestEngineStatus),
+    COM_TEST_FRAME(WheelSpeed, Com_TestWheelSpeed),
+    COM_TEST_FRAME(MotorCmd, Com_TestMotorCmd),
+};
+
+static u32bit Com_TestSeed = 0x9E3779B9u;
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+static u32bit Com_TestRandom(void)
+{
+    Com_TestSeed ^= Com_TestSeed << 13;
+    Com_TestSeed ^= Com_TestSeed >> 17;
+    Com_TestSeed ^= Com_TestSeed << 5;
+    return Com_TestSeed;
+}
+
+/*
+ * Payload bit of bit i (0 = LSB) of a signal, DBC numbering: byte * 8 + bit in the byte. Intel signals grow
+ * upwards from their LSB, Motorola ones run from their MSB down the byte and on to bit 7 of the next byte.
+ */
+static u32bit Com_TestBitPosition(const Com_TestSignalType * signal, u32bit i)
+{
+    u32bit position = signal->start;
+    u32bit step;
+
+    if (signal->motorola == FALSE)
+    {
+        position += i;
+    }
+    else
+    {
+        for (step = 0u; step < (signal->length - 1u - i); step++)
+        {
+            position = ((position % 8u) == 0u) ? (position + 15u) : (position - 1u);
+        }
+    }
+    return position;
+}
+
+static void Com_TestPutBits(const Com_TestSignalType * signal, u32bit raw, u8bit * payload)
+{
+    u32bit position;
+    u32bit i;
+
+    for (i = 0u; i < signal->length; i++)
+    {
+        position = Com_TestBitPosition(signal, i);
+        if (((raw >> i) & 1u) != 0u)
+        {
+            payload[position / 8u] |= (u8bit)(1u << (position % 8u));
+        }
+    }
+}
+
+static u32bit Com_TestGetBits(const Com_TestSignalType * signal, const u8bit * payload)
+{
+    u32bit position;
+    u32bit raw = 0u;
+    u32bit i;
+
+    for (i = 0u; i < signal->length; i++)
+    {
+        position = Com_TestBitPosition(signal, i);
+        raw |= (u32bit)((payload[position / 8u] >> (position % 8u)) & 1u) << i;
+    }
+    return raw;
+}
+
+/*
+ * Struct field as a 32 bit value, sign extended when signed, and back.
+ */
+static s64bit Com_TestGetField(const Com_TestSignalType * signal, const u8bit * signals)
+{
+    s64bit value = 0;
+
+    switch (signal->size)
+    {
+        case 1u: value = (signal->isSigned == TRUE) ? (s64bit)*(const s8bit *)&signals[signal->offset] :
+                                                      (s64bit)signals[signal->offset]; break;
+        case 2u: value = (signal->isSigned == TRUE) ? (s64bit)*(const s16bit *)&signals[signal->offset] :
+                                                      (s64bit)*(const u16bit *)&signals[signal->offset]; break;
+        default: value = (signal->isSigned == TRUE) ? (s64bit)*(const s32bit *)&signals[signal->offset] :
+                                                      (s64bit)*(const u32bit *)&signals[signal->offset]; break;
+    }
+    return value;
+}
+
+static void Com_TestSetField(const Com_TestSignalType * signal, u8bit * signals, u32bit raw)
+{
+    memcpy(&signals[signal->offset], &raw, signal->size);
+}
+
+/*
+ * Reference packing of the signal struct, raw values truncated to their width.
+ */
+static void Com_TestPack(const Com_TestFrameType * frame, const u8bit * signals, u8bit * payload)
+{
+    u32bit mask;
+    u32bit i;
+
+    memset(payload, 0, 8u);
+    for (i = 0u; i < frame->count; i++)
+    {
+        mask = (frame->signals[i].length == 32u) ? 0xFFFFFFFFu : ((1uL << frame->signals[i].length) - 1u);
+        Com_TestPutBits(&frame->signals[i], (u32bit)Com_TestGetField(&frame->signals[i], signals) & mask, payload);
+    }
+}
+
+/*
+ * Reference value of a signal in payload, sign extended when signed.
+ */
+static s64bit Com_TestUnpack(const Com_TestSignalType * signal, const u8bit * payload)
+{
+    s64bit value = (s64bit)Com_TestGetBits(signal, payload);
+
+    if ((signal->isSigned == TRUE) && ((value >> (signal->length - 1u)) != 0))
+    {
+        value -= (s64bit)1 << signal->length;
+    }
+    return value;
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Com, ReferencePackerFollowsTheDbcBitNumbering)
+{
+    /* Motorola 31|10: bits 31..24 then 39..38, Intel 14|14: bits 14..27 */
+    u8bit payload[8] = {};
+
+    Com_TestPutBits(&Com_TestEngineStatus[2], 0x3FFu, payload);
+    EXPECT_EQ(0xFFu, payload[3]);
+    EXPECT_EQ(0xC0u, payload[4]);
+    memset(payload, 0, sizeof(payload));
+    Com_TestPutBits(&Com_TestWheelSpeed[1], 0x3FFFu, payload);
+    EXPECT_EQ(0xC0u, payload[1]);
+    EXPECT_EQ(0xFFu, payload[2]);
+    EXPECT_EQ(0x0Fu, payload[3]);
+}
+
+TEST(Com, EveryBitOfEverySignalLandsWhereTheReferencePutsIt)
+{
+    for (const Com_TestFrameType & frame : Com_TestFrames)
+    {
+        for (u32bit s = 0u; s < frame.count; s++)
+        {
+            const Com_TestSignalType * signal = &frame.signals[s];
+
+            for (u32bit bit = 0u; bit < signal->length; bit++)
+            {
+                u8bit signals[32] = {};
+                u8bit unpacked[32] = {};
+                u8bit expected[8];
+                Com_PayloadType payload;
+
+                memset(&payload, 0xA5, sizeof(payload));
+                Com_TestSetField(signal, signals, 1uL << bit);
+                Com_TestPack(&frame, signals, expected);
+                frame.pack(signals, &payload);
+                ASSERT_EQ(0, memcmp(expected, payload.bytes, frame.dlc))
+                    << frame.name << "." << signal->name << " bit " << bit;
+                frame.unpack(&payload, unpacked);
+                EXPECT_EQ(Com_TestUnpack(signal, expected), Com_TestGetField(signal, unpacked))
+                    << frame.name << "." << signal->name << " bit " << bit;
+            }
+        }
+    }
+}
+
+TEST(Com, RandomSignalsPackLikeTheReference)
+{
+    for (const Com_TestFrameType & frame : Com_TestFrames)
+    {
+        for (u32bit n = 0u; n < COM_TEST_RANDOM_FRAMES; n++)
+        {
+            u8bit signals[32] = {};
+            u8bit unpacked[32] = {};
+            u8bit expected[8];
+            Com_PayloadType payload;
+
+            /* Full field values, the codecs must drop the bits above the signal width */
+            for (u32bit s = 0u; s < frame.count; s++)
+            {
+                Com_TestSetField(&frame.signals[s], signals, Com_TestRandom());
+            }
+            Com_TestPack(&frame, signals, expected);
+            frame.pack(signals, &payload);
+            ASSERT_EQ(0, memcmp(expected, payload.bytes, frame.dlc)) << frame.name << " frame " << n;
+            frame.unpack(&payload, unpacked);
+            for (u32bit s = 0u; s < frame.count; s++)
+            {
+                ASSERT_EQ(Com_TestUnpack(&frame.signals[s], expected), Com_TestGetField(&frame.signals[s], unpacked))
+                    << frame.name << "." << frame.signals[s].name << " frame " << n;
+            }
+        }
+    }
+}
+
+TEST(Com, RandomPayloadsUnpackLikeTheReference)
+{
+    for (const Com_TestFrameType & frame : Com_TestFrames)
+    {
+        for (u32bit n = 0u; n < COM_TEST_RANDOM_FRAMES; n++)
+        {
+            u8bit unpacked[32] = {};
+            Com_PayloadType payload;
+
+            payload.words[0] = Com_TestRandom();
+            payload.words[1] = Com_TestRandom();
+            frame.unpack(&payload, unpacked);
+            for (u32bit s = 0u; s < frame.count; s++)
+            {
+                ASSERT_EQ(Com_TestUnpack(&frame.signals[s], payload.bytes),
+                          Com_TestGetField(&frame.signals[s], unpacked))
+                    << frame.name << "." << frame.signals[s].name << " frame " << n;
+            }
+        }
+    }
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-021   | 17-Oct-2026 | First version of Com_Test.cpp                                                |
+***********************************************************************************************************************/
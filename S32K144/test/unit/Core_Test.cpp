@@ -0,0 +1,117 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Core_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Core_Test.cpp
+    Host build basics: interrupt macros of Core_CM4.h against the SIGALRM tick, portable REV macros and the
+    reset values of the register stubs.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <csignal>
+#include <sys/time.h>
+#include <gtest/gtest.h>
+extern "C" {
+#include "S32K144.h"
+#include "Core_CM4.h"
+}
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static volatile sig_atomic_t Core_TestTicks;
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static void Core_TestTick(int signal)
+{
+    (void)signal;
+    Core_TestTicks++;
+}
+
+/*
+ * One shot SIGALRM after 1 ms, counted by Core_TestTick.
+ */
+static void Core_TestArmTick(void)
+{
+    struct itimerval timer = {};
+
+    timer.it_value.tv_usec = 1000;
+    (void)signal(SIGALRM, Core_TestTick);
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Core, DisabledInterruptsHoldTheTickUntilEnabled)
+{
+    Core_TestTicks = 0;
+    DISABLE_INTERRUPTS();
+    Core_TestArmTick();
+    STANDBY();
+    EXPECT_EQ(0, Core_TestTicks);
+    ENABLE_INTERRUPTS();
+    EXPECT_EQ(1, Core_TestTicks);
+}
+
+TEST(Core, StandbyWakesOnTheTick)
+{
+    Core_TestTicks = 0;
+    Core_TestArmTick();
+    STANDBY();
+    EXPECT_EQ(1, Core_TestTicks);
+}
+
+TEST(Core, StandbyWithoutTimerReturns)
+{
+    Core_TestTicks = 0;
+    STANDBY();
+    EXPECT_EQ(0, Core_TestTicks);
+}
+
+TEST(Core, ReverseBytesAndBits)
+{
+    u32bit value = 0x12345678u;
+    u32bit result = 0u;
+
+    REV_BYTES_32(value, result);
+    EXPECT_EQ(0x78563412u, result);
+    REV_BYTES_16(value, result);
+    EXPECT_EQ(0x34127856u, result);
+    REV_BITS_32(value, result);
+    EXPECT_EQ(0x1E6A2C48u, result);
+    value = 0x80000001u;
+    REV_BITS_32(value, result);
+    EXPECT_EQ(0x80000001u, result);
+}
+
+TEST(Core, RegisterStubsResetValues)
+{
+    EXPECT_EQ(0x410FC241u, S32_SCB->CPUID);
+    EXPECT_EQ(0x2980u, WDOG->CS);
+    EXPECT_EQ(0x400u, WDOG->TOVAL);
+    EXPECT_EQ(0x80u, FTFC->FSTAT);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-013   | 17-Oct-2026 | First version of Core_Test.cpp                                               |
+***********************************************************************************************************************/
@@ -0,0 +1,201 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Crc_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Crc_Test.cpp
+    Crc service against a generic reference CRC model (width, polynomial, initial value, reflections, final
+    XOR): every engine of CRC-32 and CRC-16/CCITT-FALSE, the CRC peripheral through the host simulation
+    included, on every length up to 300 bytes at every alignment, check values and chained calls.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <vector>
+#include <gtest/gtest.h>
+extern "C" {
+#include "Crc.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define CRC_TEST_MAX_LENGTH                 (300u)
+#define CRC_TEST_ALIGNMENTS                 (8u)
+
+typedef u32bit (*Crc_TestEngine32Type)(u32bit crc, const u8bit * data, u32bit length);
+typedef u16bit (*Crc_TestEngine16Type)(u16bit crc, const u8bit * data, u32bit length);
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static const Crc_TestEngine32Type Crc_TestEngines32[] =
+    { Crc_Update32Bitwise, Crc_Update32Slice4, Crc_Update32Slice8, Crc_Update32Hw };
+static const Crc_TestEngine16Type Crc_TestEngines16[] =
+    { Crc_Update16Bitwise, Crc_Update16Slice4, Crc_Update16Slice8, Crc_Update16Hw };
+static const char * const Crc_TestEngineNames[] = { "bitwise", "slice4", "slice8", "hw" };
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+static u32bit Crc_TestReflect(u32bit value, u32bit width)
+{
+    u32bit result = 0u;
+    u32bit i;
+
+    for (i = 0u; i < width; i++)
+    {
+        result = (result << 1) | ((value >> i) & 1u);
+    }
+    return result;
+}
+
+/*
+ * Textbook CRC model, MSB first shift register of width bits. Reflected algorithms reflect every input byte and
+ * the result instead of shifting the other way, so it shares no code path with the engines.
+ */
+static u32bit Crc_TestModel(u32bit width, u32bit poly, u32bit init, boolean reflected, u32bit xorOut,
+                            const u8bit * data, u32bit length)
+{
+    u32bit top = 1uL << (width - 1u);
+    u32bit mask = (top << 1) - 1u;
+    u32bit crc = init;
+    u32bit i;
+    u32bit bit;
+
+    for (i = 0u; i < length; i++)
+    {
+        u32bit byte = (reflected == TRUE) ? Crc_TestReflect(data[i], 8u) : data[i];
+
+        crc ^= byte << (width - 8u);
+        for (bit = 0u; bit < 8u; bit++)
+        {
+            crc = ((crc & top) != 0u) ? ((crc << 1) ^ poly) : (crc << 1);
+        }
+        crc &= mask;
+    }
+    if (reflected == TRUE)
+    {
+        crc = Crc_TestReflect(crc, width);
+    }
+    return (crc ^ xorOut) & mask;
+}
+
+static u32bit Crc_TestModel32(const u8bit * data, u32bit length)
+{
+    return Crc_TestModel(32u, CRC_POLY32, CRC_INIT32, TRUE, CRC_XOR32, data, length);
+}
+
+static u16bit Crc_TestModel16(const u8bit * data, u32bit length)
+{
+    return (u16bit)Crc_TestModel(16u, CRC_POLY16, CRC_INIT16, FALSE, 0u, data, length);
+}
+
+/*
+ * Pseudo random bytes, with runs of 0x00 and 0xFF the table engines index as well.
+ */
+static std::vector<u8bit> Crc_TestData(u32bit size)
+{
+    std::vector<u8bit> data(size);
+    u32bit seed = 0x1234567u;
+    u32bit i;
+
+    for (i = 0u; i < size; i++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        data[i] = (u8bit)(seed >> 16);
+        if ((i % 97u) < 9u)
+        {
+            data[i] = ((i % 194u) < 97u) ? 0x00u : 0xFFu;
+        }
+    }
+    return data;
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Crc, CheckValues)
+{
+    static const u8bit check[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    u32bit engine;
+
+    Crc_Init();
+    EXPECT_EQ(0xCBF43926u, Crc_TestModel32(check, 9u));
+    EXPECT_EQ(0x29B1u, Crc_TestModel16(check, 9u));
+    EXPECT_EQ(0xCBF43926u, Crc_CalculateCRC32(check, 9u, 0u, TRUE));
+    EXPECT_EQ(0x29B1u, Crc_CalculateCRC16(check, 9u, 0u, TRUE));
+    for (engine = 0u; engine < (sizeof(Crc_TestEngines32) / sizeof(Crc_TestEngines32[0])); engine++)
+    {
+        EXPECT_EQ(0xCBF43926u, Crc_TestEngines32[engine](CRC_INIT32, check, 9u) ^ CRC_XOR32)
+            << Crc_TestEngineNames[engine];
+        EXPECT_EQ(0x29B1u, Crc_TestEngines16[engine](CRC_INIT16, check, 9u)) << Crc_TestEngineNames[engine];
+    }
+}
+
+TEST(Crc, EveryEngineMatchesTheModelAtEveryLengthAndAlignment)
+{
+    std::vector<u8bit> data = Crc_TestData(CRC_TEST_MAX_LENGTH + CRC_TEST_ALIGNMENTS);
+    u32bit engine;
+    u32bit offset;
+    u32bit length;
+
+    Crc_Init();
+    for (offset = 0u; offset < CRC_TEST_ALIGNMENTS; offset++)
+    {
+        for (length = 0u; length <= CRC_TEST_MAX_LENGTH; length++)
+        {
+            const u8bit * bytes = &data[offset];
+            const u32bit expected32 = Crc_TestModel32(bytes, length);
+            const u16bit expected16 = Crc_TestModel16(bytes, length);
+
+            for (engine = 0u; engine < (sizeof(Crc_TestEngines32) / sizeof(Crc_TestEngines32[0])); engine++)
+            {
+                ASSERT_EQ(expected32, Crc_TestEngines32[engine](CRC_INIT32, bytes, length) ^ CRC_XOR32)
+                    << Crc_TestEngineNames[engine] << " offset " << offset << " length " << length;
+                ASSERT_EQ(expected16, Crc_TestEngines16[engine](CRC_INIT16, bytes, length))
+                    << Crc_TestEngineNames[engine] << " offset " << offset << " length " << length;
+            }
+            ASSERT_EQ(expected32, Crc_CalculateCRC32(bytes, length, 0u, TRUE)) << offset << " " << length;
+            ASSERT_EQ(expected16, Crc_CalculateCRC16(bytes, length, 0u, TRUE)) << offset << " " << length;
+        }
+    }
+}
+
+TEST(Crc, ChainedCallsMatchOneCall)
+{
+    std::vector<u8bit> data = Crc_TestData(4096u);
+    const u32bit expected32 = Crc_TestModel32(data.data(), (u32bit)data.size());
+    const u16bit expected16 = Crc_TestModel16(data.data(), (u32bit)data.size());
+    u32bit crc32;
+    u16bit crc16;
+    u32bit split;
+
+    Crc_Init();
+    for (split = 0u; split <= data.size(); split += 253u)
+    {
+        crc32 = Crc_CalculateCRC32(data.data(), split, 0u, TRUE);
+        crc32 = Crc_CalculateCRC32(&data[split], (u32bit)data.size() - split, crc32, FALSE);
+        EXPECT_EQ(expected32, crc32) << split;
+        crc16 = Crc_CalculateCRC16(data.data(), split, 0u, TRUE);
+        crc16 = Crc_CalculateCRC16(&data[split], (u32bit)data.size() - split, crc16, FALSE);
+        EXPECT_EQ(expected16, crc16) << split;
+    }
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-020   | 17-Oct-2026 | First version of Crc_Test.cpp                                                |
+***********************************************************************************************************************/
@@ -0,0 +1,279 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Dcm_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Dcm_Test.cpp
+    Dcm services over the host CAN loopback: session control, data identifiers, routine control and
+    memory reads with their negative response codes, session gating and the S3 timeout.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+extern "C" {
+#include "Core_CM4.h"
+#include "CanTp.h"
+#include "Can_Host.h"
+#include "Dcm.h"
+#include "MemPool.h"
+#include "Timer.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Dcm_MainFunction calls allowed for one request*/
+#define DCM_TEST_MAX_CALLS                  (100u)
+
+/*Start of the readable host memory*/
+#define DCM_TEST_MEMORY                     (0x1FFF8000uL)
+
+typedef std::vector<u8bit> Dcm_TestMessageType;
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Empty bus, idle channels, a fresh heap and the default session.
+ */
+static void Dcm_TestReset(void)
+{
+    (void)Can_HostProcess();
+    Can_HostTesterRelease();
+    ASSERT_TRUE(MemPool_Init());
+    Timer_Init();
+    CanTp_Init();
+    Dcm_Init();
+}
+
+/*
+ * Request from the tester and the response it receives, empty when there is none.
+ */
+static Dcm_TestMessageType Dcm_TestRequest(const Dcm_TestMessageType & request)
+{
+    Dcm_TestMessageType result;
+    const u8bit * response = NULL;
+    u16bit length = 0u;
+    u32bit calls = 0u;
+
+    if (Can_HostTesterRequest(request.data(), (u16bit)request.size()) == TRUE)
+    {
+        while ((response == NULL) && (calls < DCM_TEST_MAX_CALLS))
+        {
+            (void)Can_HostProcess();
+            CanTp_MainFunction();
+            Dcm_MainFunction();
+            calls++;
+            response = Can_HostTesterResponse(&length);
+        }
+    }
+    if (response != NULL)
+    {
+        result.assign(response, response + length);
+        Can_HostTesterRelease();
+    }
+    return result;
+}
+
+/*
+ * ticks calls of Timer_Tick, masked as in the tick ISR.
+ */
+static void Dcm_TestTicks(u32bit ticks)
+{
+    DISABLE_INTERRUPTS();
+    while (ticks != 0u)
+    {
+        Timer_Tick();
+        ticks--;
+    }
+    ENABLE_INTERRUPTS();
+}
+
+/*
+ * Negative response of the tester request to service sid with nrc.
+ */
+static Dcm_TestMessageType Dcm_TestNegative(u8bit sid, u8bit nrc)
+{
+    return Dcm_TestMessageType({ 0x7Fu, sid, nrc });
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Dcm, SessionControlAnswersTheTimings)
+{
+    Dcm_TestReset();
+    EXPECT_EQ(Dcm_TestMessageType({ 0x50u, 0x03u, 0x00u, 0x32u, 0x01u, 0xF4u }), Dcm_TestRequest({ 0x10u, 0x03u }));
+    EXPECT_EQ(DCM_SESSION_EXTENDED, Dcm_GetSession());
+    EXPECT_EQ(Dcm_TestNegative(0x10u, 0x12u), Dcm_TestRequest({ 0x10u, 0x05u }));
+    EXPECT_EQ(Dcm_TestNegative(0x10u, 0x12u), Dcm_TestRequest({ 0x10u, 0x00u }));
+    EXPECT_EQ(Dcm_TestNegative(0x10u, 0x13u), Dcm_TestRequest({ 0x10u }));
+    EXPECT_EQ(Dcm_TestNegative(0x10u, 0x13u), Dcm_TestRequest({ 0x10u, 0x01u, 0x00u }));
+    EXPECT_EQ(DCM_SESSION_EXTENDED, Dcm_GetSession());
+
+    /* Positive response suppressed, the session changes all the same */
+    EXPECT_TRUE(Dcm_TestRequest({ 0x10u, 0x81u }).empty());
+    EXPECT_EQ(DCM_SESSION_DEFAULT, Dcm_GetSession());
+    EXPECT_EQ(Dcm_TestNegative(0x19u, 0x11u), Dcm_TestRequest({ 0x19u, 0x02u }));
+}
+
+TEST(Dcm, ReadDataByIdentifierSkipsUnknownIdentifiers)
+{
+    Dcm_TestMessageType response;
+    void * blocks[16];
+    u32bit count = 0u;
+    u8bit pool;
+
+    Dcm_TestReset();
+    EXPECT_EQ(Dcm_TestMessageType({ 0x62u, 0xF1u, 0x86u, 0x01u }), Dcm_TestRequest({ 0x22u, 0xF1u, 0x86u }));
+    EXPECT_EQ(Dcm_TestMessageType({ 0x62u, 0xF1u, 0x86u, 0x01u }),
+              Dcm_TestRequest({ 0x22u, 0x12u, 0x34u, 0xF1u, 0x86u }));
+
+    /* Two records in one response, sent in consecutive frames */
+    response = Dcm_TestRequest({ 0x22u, 0xF1u, 0x90u, 0xF1u, 0x86u });
+    ASSERT_EQ(1u + 2u + 17u + 3u, response.size());
+    EXPECT_EQ(0x62u, response[0]);
+    EXPECT_EQ(0xF1u, response[1]);
+    EXPECT_EQ(0x90u, response[2]);
+    EXPECT_EQ(Dcm_TestMessageType({ 0xF1u, 0x86u, 0x01u }), Dcm_TestMessageType(response.end() - 3, response.end()));
+
+    EXPECT_EQ(Dcm_TestNegative(0x22u, 0x31u), Dcm_TestRequest({ 0x22u, 0x12u, 0x34u }));
+    EXPECT_EQ(Dcm_TestNegative(0x22u, 0x13u), Dcm_TestRequest({ 0x22u, 0xF1u }));
+    EXPECT_EQ(Dcm_TestNegative(0x22u, 0x13u), Dcm_TestRequest({ 0x22u, 0xF1u, 0x86u, 0xF1u }));
+
+    /* No block left for the response: the request itself fits the smallest pool, the record does not */
+    for (pool = 1u; pool < MEMPOOL_NUM_POOLS; pool++)
+    {
+        while ((count < 16u) && ((blocks[count] = MemPool_AllocFromPool(pool)) != NULL))
+        {
+            count++;
+        }
+    }
+    EXPECT_EQ(Dcm_TestNegative(0x22u, 0x22u), Dcm_TestRequest({ 0x22u, 0xF1u, 0x90u }));
+    while (count != 0u)
+    {
+        count--;
+        MemPool_Free(blocks[count]);
+    }
+    EXPECT_EQ(1u + 2u + 17u, Dcm_TestRequest({ 0x22u, 0xF1u, 0x90u }).size());
+}
+
+TEST(Dcm, WriteDataByIdentifierOnlyInItsSessions)
+{
+    Dcm_TestMessageType write({ 0x2Eu, 0xF1u, 0x90u });
+    Dcm_TestMessageType vin;
+    Dcm_TestMessageType read;
+    u8bit i;
+
+    Dcm_TestReset();
+    vin = Dcm_TestRequest({ 0x22u, 0xF1u, 0x90u });
+    ASSERT_EQ(20u, vin.size());
+    for (i = 0u; i < 17u; i++)
+    {
+        write.push_back((u8bit)('A' + i));
+    }
+
+    EXPECT_EQ(Dcm_TestNegative(0x2Eu, 0x31u), Dcm_TestRequest(write));
+    EXPECT_EQ(vin, Dcm_TestRequest({ 0x22u, 0xF1u, 0x90u }));
+
+    ASSERT_EQ(6u, Dcm_TestRequest({ 0x10u, 0x03u }).size());
+    EXPECT_EQ(Dcm_TestMessageType({ 0x6Eu, 0xF1u, 0x90u }), Dcm_TestRequest(write));
+    read = Dcm_TestRequest({ 0x22u, 0xF1u, 0x90u });
+    ASSERT_EQ(20u, read.size());
+    EXPECT_EQ(0, memcmp(&write[3], &read[3], 17u));
+
+    EXPECT_EQ(Dcm_TestNegative(0x2Eu, 0x13u), Dcm_TestRequest(Dcm_TestMessageType(write.begin(), write.end() - 1)));
+    EXPECT_EQ(Dcm_TestNegative(0x2Eu, 0x13u), Dcm_TestRequest({ 0x2Eu, 0xF1u }));
+    EXPECT_EQ(Dcm_TestNegative(0x2Eu, 0x31u), Dcm_TestRequest({ 0x2Eu, 0xF1u, 0x86u, 0x02u }));
+    EXPECT_EQ(Dcm_TestNegative(0x2Eu, 0x31u), Dcm_TestRequest({ 0x2Eu, 0x12u, 0x34u, 0x00u }));
+
+    /* Back to the original identification number */
+    std::copy(vin.begin() + 3, vin.end(), write.begin() + 3);
+    EXPECT_EQ(Dcm_TestMessageType({ 0x6Eu, 0xF1u, 0x90u }), Dcm_TestRequest(write));
+}
+
+TEST(Dcm, RoutineControlStartsAndReportsThePoolCheck)
+{
+    Dcm_TestReset();
+    EXPECT_EQ(Dcm_TestMessageType({ 0x71u, 0x01u, 0x02u, 0x00u }), Dcm_TestRequest({ 0x31u, 0x01u, 0x02u, 0x00u }));
+    EXPECT_EQ(Dcm_TestMessageType({ 0x71u, 0x03u, 0x02u, 0x00u, 0x00u }),
+              Dcm_TestRequest({ 0x31u, 0x03u, 0x02u, 0x00u }));
+    EXPECT_TRUE(Dcm_TestRequest({ 0x31u, 0x81u, 0x02u, 0x00u }).empty());
+
+    EXPECT_EQ(Dcm_TestNegative(0x31u, 0x31u), Dcm_TestRequest({ 0x31u, 0x01u, 0x02u, 0x00u, 0x05u }));
+    EXPECT_EQ(Dcm_TestNegative(0x31u, 0x31u), Dcm_TestRequest({ 0x31u, 0x01u, 0x12u, 0x34u }));
+    EXPECT_EQ(Dcm_TestNegative(0x31u, 0x12u), Dcm_TestRequest({ 0x31u, 0x02u, 0x02u, 0x00u }));
+    EXPECT_EQ(Dcm_TestNegative(0x31u, 0x13u), Dcm_TestRequest({ 0x31u, 0x01u, 0x02u }));
+    EXPECT_EQ(Dcm_TestNegative(0x31u, 0x13u), Dcm_TestRequest({ 0x31u, 0x03u, 0x02u, 0x00u, 0x00u }));
+}
+
+TEST(Dcm, ReadMemoryByAddressInTheExtendedSessionOnly)
+{
+    Dcm_TestMessageType response;
+    u32bit i;
+
+    for (i = 0u; i < 16u; i++)
+    {
+        Dcm_HostMemory[0x100u + i] = (u8bit)(0xA0u + i);
+    }
+    Dcm_TestReset();
+    EXPECT_EQ(Dcm_TestNegative(0x23u, 0x7Fu), Dcm_TestRequest({ 0x23u, 0x14u, 0x1Fu, 0xFFu, 0x81u, 0x00u, 0x10u }));
+
+    ASSERT_EQ(6u, Dcm_TestRequest({ 0x10u, 0x03u }).size());
+    response = Dcm_TestRequest({ 0x23u, 0x14u, 0x1Fu, 0xFFu, 0x81u, 0x00u, 0x10u });
+    ASSERT_EQ(17u, response.size());
+    EXPECT_EQ(0x63u, response[0]);
+    EXPECT_EQ(0, memcmp(&Dcm_HostMemory[0x100u], &response[1], 16u));
+
+    /* Last bytes of the area, then one byte past its ends */
+    EXPECT_EQ(2u, Dcm_TestRequest({ 0x23u, 0x14u, 0x20u, 0x00u, 0x6Fu, 0xFFu, 0x01u }).size());
+    EXPECT_EQ(Dcm_TestNegative(0x23u, 0x31u), Dcm_TestRequest({ 0x23u, 0x14u, 0x20u, 0x00u, 0x6Fu, 0xFFu, 0x02u }));
+    EXPECT_EQ(Dcm_TestNegative(0x23u, 0x31u), Dcm_TestRequest({ 0x23u, 0x14u, 0x1Fu, 0xFFu, 0x7Fu, 0xFFu, 0x01u }));
+    EXPECT_EQ(Dcm_TestNegative(0x23u, 0x31u), Dcm_TestRequest({ 0x23u, 0x14u, 0x1Fu, 0xFFu, 0x80u, 0x00u, 0x00u }));
+    EXPECT_EQ(Dcm_TestNegative(0x23u, 0x31u), Dcm_TestRequest({ 0x23u, 0x04u, 0x1Fu, 0xFFu, 0x80u, 0x00u }));
+    EXPECT_EQ(Dcm_TestNegative(0x23u, 0x13u), Dcm_TestRequest({ 0x23u, 0x14u, 0x1Fu, 0xFFu, 0x80u, 0x00u }));
+    EXPECT_EQ(Dcm_TestNegative(0x23u, 0x14u),
+              Dcm_TestRequest({ 0x23u, 0x24u, 0x1Fu, 0xFFu, 0x80u, 0x00u, 0x10u, 0x00u }));
+}
+
+TEST(Dcm, S3TimeoutFallsBackToTheDefaultSession)
+{
+    Dcm_TestReset();
+    ASSERT_EQ(6u, Dcm_TestRequest({ 0x10u, 0x03u }).size());
+    Dcm_TestTicks(DCM_CFG_S3_TICKS - 1u);
+    EXPECT_EQ(DCM_SESSION_EXTENDED, Dcm_GetSession());
+
+    /* Any request restarts S3 */
+    EXPECT_TRUE(Dcm_TestRequest({ 0x3Eu, 0x80u }).empty());
+    Dcm_TestTicks(DCM_CFG_S3_TICKS - 1u);
+    EXPECT_EQ(DCM_SESSION_EXTENDED, Dcm_GetSession());
+    Dcm_TestTicks(1u);
+    EXPECT_EQ(DCM_SESSION_DEFAULT, Dcm_GetSession());
+    EXPECT_EQ(Dcm_TestNegative(0x23u, 0x7Fu), Dcm_TestRequest({ 0x23u, 0x14u, 0x1Fu, 0xFFu, 0x81u, 0x00u, 0x10u }));
+
+    /* The default session has no S3 */
+    Dcm_TestTicks(2u * DCM_CFG_S3_TICKS);
+    EXPECT_EQ(DCM_SESSION_DEFAULT, Dcm_GetSession());
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-017   | 17-Oct-2026 | First version of Dcm_Test.cpp                                                |
+***********************************************************************************************************************/
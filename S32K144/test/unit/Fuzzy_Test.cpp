@@ -0,0 +1,185 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Fuzzy_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Fuzzy_Test.cpp
+    Fuzzy: Fuzzy_Infer on the generated Fuzzy_SpeedCtrl tables against tools/FuzzyGen, bit for bit against its
+    fixed point emulation and within the generator tolerance of its floating point Mamdani reference, on a grid
+    and random inputs of the whole input range and beyond it. A hand made system covers the missing rules.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cmath>
+#include <cstring>
+#include <gtest/gtest.h>
+#include "HostTool.h"
+extern "C" {
+#include "Fuzzy.h"
+#include "Fuzzy_Cfg.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define FUZZY_TEST_GRID                     (17)
+#define FUZZY_TEST_RANDOM                   (128)
+#define FUZZY_TEST_TOLERANCE                (0.02)      /*Of the output range, the fuzzy_gen.py default*/
+#define FUZZY_TEST_OUTPUT_SPAN              (2000.0)    /*torque terms of Fuzzy_Cfg.json, -1000..1000*/
+
+/*One input pair and the two references of fuzzy_gen.py*/
+typedef struct
+{
+    s32bit inputs[2];
+    s32bit fixed;
+    double reference;
+} Fuzzy_TestPointType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+/*Two terms per input, rule (1, 1) missing*/
+static const Fuzzy_LutEntryType Fuzzy_TestLut[2] =
+{
+    { { 0u, 0u }, { 32767u, 0u } },
+    { { 0u, 1u }, { 16384u, 16384u } }
+};
+
+static const Fuzzy_InputType Fuzzy_TestInputs[2] =
+{
+    { Fuzzy_TestLut, 0, 0x10000u, 2u, 1u },
+    { Fuzzy_TestLut, 0, 0x10000u, 2u, 2u }
+};
+
+static const u8bit Fuzzy_TestRules[4] = { 0u, 1u, 1u, FUZZY_NO_RULE };
+static const u16bit Fuzzy_TestArea[2] = { 32767u, 16384u };
+static const s32bit Fuzzy_TestCentroid[2] = { -300, 600 };
+static const Fuzzy_SystemType Fuzzy_TestSystem =
+{
+    Fuzzy_TestInputs, Fuzzy_TestRules, Fuzzy_TestArea, Fuzzy_TestCentroid, 77, 2u
+};
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+/*
+ * Fixed point emulation and floating point reference of fuzzy_gen.py for every input pair.
+ */
+static std::vector<Fuzzy_TestPointType> Fuzzy_TestReference(const std::vector<s32bit> & inputs)
+{
+    std::vector<u8bit> raw(inputs.size() * sizeof(s32bit));
+    std::vector<u8bit> result;
+    std::vector<Fuzzy_TestPointType> points(inputs.size() / 2u);
+    size_t i;
+
+    memcpy(raw.data(), inputs.data(), raw.size());
+    result = HostTool_Python("FuzzyGen",
+        std::string("import json, struct\n"
+                    "from fuzzy_gen import System\n"
+                    "system = System(json.load(open('") + TEST_TOPDIR +
+                    "/src/BSW/ComplexDrivers/Fuzzy/Fuzzy_Cfg.json'))['systems'][0])\n"
+                    "raw = open(sys.argv[1], 'rb').read()\n"
+                    "out = bytearray()\n"
+                    "for i in range(0, len(raw), 8):\n"
+                    "    values = struct.unpack_from('<ii', raw, i)\n"
+                    "    out += struct.pack('<id', system.infer_fixed(values), system.infer_float(values))\n"
+                    "open(sys.argv[2], 'wb').write(out)\n", raw);
+    if (result.size() != (points.size() * 12u))
+    {
+        points.clear();
+    }
+    for (i = 0u; i < points.size(); i++)
+    {
+        points[i].inputs[0] = inputs[2u * i];
+        points[i].inputs[1] = inputs[(2u * i) + 1u];
+        memcpy(&points[i].fixed, &result[12u * i], sizeof(s32bit));
+        memcpy(&points[i].reference, &result[(12u * i) + 4u], sizeof(double));
+    }
+    return points;
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Fuzzy, SpeedCtrlMatchesGeneratorReferences)
+{
+    std::vector<s32bit> inputs;
+    std::vector<Fuzzy_TestPointType> points;
+    u32bit seed = 9u;
+    double worst = 0.0;
+    s32bit output;
+    int i;
+    int j;
+
+    for (i = 0; i < FUZZY_TEST_GRID; i++)
+    {
+        for (j = 0; j < FUZZY_TEST_GRID; j++)
+        {
+            inputs.push_back(-1000 + ((2000 * i) / (FUZZY_TEST_GRID - 1)));
+            inputs.push_back(-200 + ((400 * j) / (FUZZY_TEST_GRID - 1)));
+        }
+    }
+    for (i = 0; i < FUZZY_TEST_RANDOM; i++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        inputs.push_back((s32bit)((seed >> 8) % 2001u) - 1000);
+        seed = (seed * 1103515245u) + 12345u;
+        inputs.push_back((s32bit)((seed >> 8) % 401u) - 200);
+    }
+    points = Fuzzy_TestReference(inputs);
+    ASSERT_EQ(inputs.size() / 2u, points.size()) << "fuzzy_gen.py failed";
+
+    for (const Fuzzy_TestPointType & point : points)
+    {
+        output = Fuzzy_Infer(&Fuzzy_SpeedCtrl, point.inputs);
+        ASSERT_EQ(point.fixed, output) << "at " << point.inputs[0] << ", " << point.inputs[1];
+        worst = std::fmax(worst, std::fabs((double)output - point.reference));
+    }
+    EXPECT_LE(worst, FUZZY_TEST_TOLERANCE * FUZZY_TEST_OUTPUT_SPAN);
+}
+
+TEST(Fuzzy, InputsOutOfRangeClampToTheTableEnds)
+{
+    const s32bit low[2] = { -1000, -200 };
+    const s32bit high[2] = { 999, 199 };
+    const s32bit belowLow[2] = { -100000, -5000 };
+    const s32bit aboveHigh[2] = { INT32_MAX, 100000 };
+
+    EXPECT_EQ(Fuzzy_Infer(&Fuzzy_SpeedCtrl, low), Fuzzy_Infer(&Fuzzy_SpeedCtrl, belowLow));
+    EXPECT_EQ(Fuzzy_Infer(&Fuzzy_SpeedCtrl, high), Fuzzy_Infer(&Fuzzy_SpeedCtrl, aboveHigh));
+    EXPECT_LT(Fuzzy_Infer(&Fuzzy_SpeedCtrl, low), -500);
+    EXPECT_GT(Fuzzy_Infer(&Fuzzy_SpeedCtrl, high), 500);
+}
+
+TEST(Fuzzy, MissingRulesAndZeroDegreesDoNotFire)
+{
+    const s32bit single[2] = { 0, 0 };
+    const s32bit mixed[2] = { 0, 1 };
+    const s32bit none[2] = { 1, 1 };
+
+    /*Rule (0, 0) only*/
+    EXPECT_EQ(-300, Fuzzy_Infer(&Fuzzy_TestSystem, single));
+    /*Rules (0, 0) and (0, 1) at 16384: (8191 * -300 + 4096 * 600) / 12287*/
+    EXPECT_EQ(((8191 * -300) + (4096 * 600)) / 12287, Fuzzy_Infer(&Fuzzy_TestSystem, mixed));
+    /*Rules (0, 0), (1, 0), (0, 1) and the missing (1, 1)*/
+    EXPECT_EQ(((8191 * -300) + (2 * 4096 * 600)) / (8191 + (2 * 4096)), Fuzzy_Infer(&Fuzzy_TestSystem, none));
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-009   | 17-Oct-2026 | First version of Fuzzy_Test.cpp                                              |
+***********************************************************************************************************************/
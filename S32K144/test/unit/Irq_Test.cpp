@@ -0,0 +1,263 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Irq_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Irq_Test.cpp
+    Irq: priority grouping and PendSV hook of Irq_Init, handlers installed in the (host) vector table, NVIC
+    and system handler priorities, bottom halves run in FIFO order from PendSV, through Irq_HostTake and through
+    the Os host port, and Irq_DeferLost when the queue is full.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <gtest/gtest.h>
+extern "C" {
+#include "S32K144.h"
+#include "Core_CM4.h"
+#include "Irq.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define IRQ_TEST_CAN0_ORED_0_15             ((Irq_NumberType)81)
+#define IRQ_TEST_NMI                        ((Irq_NumberType)-14)
+#define IRQ_TEST_HARDFAULT                  ((Irq_NumberType)-13)
+#define IRQ_TEST_MAX_CALLS                  (64u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+extern "C" Irq_HandlerType Irq_PendSVNext;
+
+static u32bit Irq_TestCalls[IRQ_TEST_MAX_CALLS];
+static u32bit Irq_TestCallCount;
+static u32bit Irq_TestHandlerCount;
+static u32bit Irq_TestChainedAt;
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static void Irq_TestBottomHalf(u32bit data)
+{
+    if (Irq_TestCallCount < IRQ_TEST_MAX_CALLS)
+    {
+        Irq_TestCalls[Irq_TestCallCount] = data;
+    }
+    Irq_TestCallCount++;
+}
+
+static void Irq_TestHandler(void)
+{
+    Irq_TestHandlerCount++;
+}
+
+/*
+ * Stands in for the Os PendSV handler, records how many bottom halves ran before it.
+ */
+static void Irq_TestChained(void)
+{
+    Irq_TestChainedAt = Irq_TestCallCount;
+    Irq_TestHandlerCount++;
+}
+
+/*
+ * Initialized manager with an empty queue, whatever earlier tests deferred.
+ */
+static void Irq_TestStart(void)
+{
+    ASSERT_EQ(TRUE, Irq_Init());
+    Irq_RunBottomHalves();
+    S32_SCB->ICSR = 0u;
+    Irq_TestCallCount = 0u;
+    Irq_TestHandlerCount = 0u;
+    Irq_TestChainedAt = 0u;
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Irq, InitSetsPriorityGroupingAndKeepsThePendSVChain)
+{
+    Irq_HandlerType next;
+
+    S32_SCB->AIRCR = 0u;
+    EXPECT_EQ(TRUE, Irq_Init());
+    EXPECT_EQ((u32bit)IRQ_CFG_PRIORITY_GROUPING,
+              (S32_SCB->AIRCR & S32_SCB_AIRCR_PRIGROUP_MASK) >> S32_SCB_AIRCR_PRIGROUP_SHIFT);
+    EXPECT_EQ(S32_SCB_AIRCR_VECTKEY, S32_SCB->AIRCR & S32_SCB_AIRCR_VECTKEY_MASK);
+
+    /* A second call must not chain PendSV into itself */
+    next = Irq_PendSVNext;
+    EXPECT_EQ(TRUE, Irq_Init());
+    EXPECT_EQ(next, Irq_PendSVNext);
+}
+
+TEST(Irq, InstalledHandlerRunsWhenTaken)
+{
+    Irq_TestStart();
+    EXPECT_EQ(TRUE, Irq_InstallHandler(IRQ_TEST_CAN0_ORED_0_15, Irq_TestHandler));
+    Irq_HostTake(IRQ_TEST_CAN0_ORED_0_15);
+    Irq_HostTake(IRQ_TEST_CAN0_ORED_0_15);
+    EXPECT_EQ(2u, Irq_TestHandlerCount);
+
+    EXPECT_EQ(TRUE, Irq_InstallHandler(IRQ_SYSTICK, Irq_TestHandler));
+    Irq_HostTake(IRQ_SYSTICK);
+    EXPECT_EQ(3u, Irq_TestHandlerCount);
+
+    EXPECT_EQ(TRUE, Irq_InstallHandler(IRQ_TEST_CAN0_ORED_0_15, NULL));
+    EXPECT_EQ(TRUE, Irq_InstallHandler(IRQ_SYSTICK, NULL));
+    Irq_HostTake(IRQ_TEST_CAN0_ORED_0_15);
+    EXPECT_EQ(3u, Irq_TestHandlerCount);
+}
+
+TEST(Irq, InstallRefusesNmiHardFaultAndUnknownNumbers)
+{
+    Irq_TestStart();
+    EXPECT_EQ(FALSE, Irq_InstallHandler(IRQ_TEST_NMI, Irq_TestHandler));
+    EXPECT_EQ(FALSE, Irq_InstallHandler(IRQ_TEST_HARDFAULT, Irq_TestHandler));
+    EXPECT_EQ(FALSE, Irq_InstallHandler((Irq_NumberType)FEATURE_INTERRUPT_IRQ_COUNT, Irq_TestHandler));
+    Irq_HostTake(IRQ_TEST_NMI);
+    EXPECT_EQ(0u, Irq_TestHandlerCount);
+}
+
+TEST(Irq, PriorityOfDeviceInterruptsAndCoreExceptions)
+{
+    const u32bit shift = 8u - FEATURE_NVIC_PRIO_BITS;
+
+    S32_SCB->SHPR1 = 0u;
+    S32_SCB->SHPR2 = 0u;
+    S32_SCB->SHPR3 = 0u;
+    EXPECT_EQ(TRUE, Irq_SetPriority(IRQ_TEST_CAN0_ORED_0_15, 5u));
+    EXPECT_EQ((u8bit)(5u << shift), S32_NVIC->IP[IRQ_TEST_CAN0_ORED_0_15]);
+    EXPECT_EQ(TRUE, Irq_SetPriority(0, 0u));
+    EXPECT_EQ(0u, S32_NVIC->IP[0]);
+
+    EXPECT_EQ(TRUE, Irq_SetPriority(IRQ_MEMMANAGE, 1u));
+    EXPECT_EQ(TRUE, Irq_SetPriority(IRQ_USAGEFAULT, 2u));
+    EXPECT_EQ(TRUE, Irq_SetPriority(IRQ_SVCALL, 3u));
+    EXPECT_EQ(TRUE, Irq_SetPriority(IRQ_PENDSV, IRQ_PRIORITY_LOWEST));
+    EXPECT_EQ(TRUE, Irq_SetPriority(IRQ_SYSTICK, 14u));
+    EXPECT_EQ((1u << shift) | ((2u << shift) << 16u), S32_SCB->SHPR1);
+    EXPECT_EQ((3u << shift) << 24u, S32_SCB->SHPR2);
+    EXPECT_EQ(((u32bit)IRQ_PRIORITY_LOWEST << (shift + S32_SCB_SHPR3_PRI_14_SHIFT)) |
+              (14u << (shift + S32_SCB_SHPR3_PRI_15_SHIFT)), S32_SCB->SHPR3);
+
+    EXPECT_EQ(FALSE, Irq_SetPriority(IRQ_TEST_CAN0_ORED_0_15, (u8bit)(IRQ_PRIORITY_LOWEST + 1u)));
+    EXPECT_EQ(FALSE, Irq_SetPriority(IRQ_TEST_NMI, 0u));
+    EXPECT_EQ(FALSE, Irq_SetPriority(IRQ_TEST_HARDFAULT, 0u));
+    EXPECT_EQ(FALSE, Irq_SetPriority((Irq_NumberType)FEATURE_INTERRUPT_IRQ_COUNT, 0u));
+    EXPECT_EQ((u8bit)(5u << shift), S32_NVIC->IP[IRQ_TEST_CAN0_ORED_0_15]);
+}
+
+TEST(Irq, EnableDisableAndClearPendingBits)
+{
+    Irq_Enable(IRQ_TEST_CAN0_ORED_0_15);
+    EXPECT_EQ(1uL << 17, S32_NVIC->ISER[2]);
+    Irq_Disable(IRQ_TEST_CAN0_ORED_0_15);
+    EXPECT_EQ(1uL << 17, S32_NVIC->ICER[2]);
+    Irq_ClearPending(IRQ_TEST_CAN0_ORED_0_15);
+    EXPECT_EQ(1uL << 17, S32_NVIC->ICPR[2]);
+
+    /* Core exceptions are not NVIC interrupts */
+    S32_NVIC->ISER[0] = 0u;
+    Irq_Enable(IRQ_SYSTICK);
+    EXPECT_EQ(0u, S32_NVIC->ISER[0]);
+}
+
+TEST(Irq, DeferredCallsRunInOrderFromPendSVBeforeTheChainedHandler)
+{
+    Irq_HandlerType next;
+    u32bit i;
+
+    Irq_TestStart();
+    next = Irq_PendSVNext;
+    EXPECT_EQ(TRUE, Irq_InstallHandler(IRQ_PENDSV, Irq_TestChained));
+    for (i = 0u; i < 10u; i++)
+    {
+        EXPECT_EQ(TRUE, Irq_Defer(Irq_TestBottomHalf, 100u + i));
+    }
+    EXPECT_NE(0u, S32_SCB->ICSR & S32_SCB_ICSR_PENDSVSET_MASK);
+    EXPECT_EQ(0u, Irq_TestCallCount);
+
+    Irq_HostTake(IRQ_PENDSV);
+    EXPECT_EQ(0u, S32_SCB->ICSR & S32_SCB_ICSR_PENDSVSET_MASK);
+    ASSERT_EQ(10u, Irq_TestCallCount);
+    for (i = 0u; i < 10u; i++)
+    {
+        EXPECT_EQ(100u + i, Irq_TestCalls[i]);
+    }
+    EXPECT_EQ(1u, Irq_TestHandlerCount);
+    EXPECT_EQ(10u, Irq_TestChainedAt);
+    Irq_PendSVNext = next;
+}
+
+TEST(Irq, FullQueueCountsLostCalls)
+{
+    const u32bit lost = Irq_DeferLost;
+    u32bit i;
+
+    Irq_TestStart();
+    for (i = 0u; i < IRQ_CFG_BH_QUEUE_SIZE; i++)
+    {
+        EXPECT_EQ(TRUE, Irq_Defer(Irq_TestBottomHalf, i));
+    }
+    EXPECT_EQ(FALSE, Irq_Defer(Irq_TestBottomHalf, 1000u));
+    EXPECT_EQ(FALSE, Irq_Defer(Irq_TestBottomHalf, 1001u));
+    EXPECT_EQ(lost + 2u, Irq_DeferLost);
+
+    Irq_HostTake(IRQ_PENDSV);
+    ASSERT_EQ(IRQ_CFG_BH_QUEUE_SIZE, Irq_TestCallCount);
+    for (i = 0u; i < IRQ_CFG_BH_QUEUE_SIZE; i++)
+    {
+        EXPECT_EQ(i, Irq_TestCalls[i]);
+    }
+    EXPECT_EQ(TRUE, Irq_Defer(Irq_TestBottomHalf, 2000u));
+    Irq_HostTake(IRQ_PENDSV);
+    EXPECT_EQ(2000u, Irq_TestCalls[IRQ_CFG_BH_QUEUE_SIZE]);
+}
+
+TEST(Irq, NothingRunsWithoutAPendingPendSV)
+{
+    Irq_TestStart();
+    EXPECT_EQ(TRUE, Irq_Defer(Irq_TestBottomHalf, 1u));
+    S32_SCB->ICSR = 0u;
+    DISABLE_INTERRUPTS();
+    ENABLE_INTERRUPTS();
+    EXPECT_EQ(0u, Irq_TestCallCount);
+    Irq_RunBottomHalves();
+    EXPECT_EQ(1u, Irq_TestCallCount);
+}
+
+TEST(Irq, OsHostPortTakesPendSVWhenInterruptsAreRestored)
+{
+    Irq_TestStart();
+    DISABLE_INTERRUPTS();
+    EXPECT_EQ(TRUE, Irq_Defer(Irq_TestBottomHalf, 7u));
+    EXPECT_EQ(TRUE, Irq_Defer(Irq_TestBottomHalf, 8u));
+    EXPECT_EQ(0u, Irq_TestCallCount);
+    ENABLE_INTERRUPTS();
+    ASSERT_EQ(2u, Irq_TestCallCount);
+    EXPECT_EQ(7u, Irq_TestCalls[0]);
+    EXPECT_EQ(8u, Irq_TestCalls[1]);
+    EXPECT_EQ(0u, S32_SCB->ICSR & S32_SCB_ICSR_PENDSVSET_MASK);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-014   | 17-Oct-2026 | First version of Irq_Test.cpp                                                |
+***********************************************************************************************************************/
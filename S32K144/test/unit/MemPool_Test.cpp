@@ -0,0 +1,215 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: MemPool_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \MemPool_Test.cpp
+    MemPool: block layout, exhaustion of a pool and fall back to the next bigger one, statistics, and alloc/free
+    from concurrent threads on the tagged lock-free free lists (real atomics on the host, sched_yield forces the
+    interleavings on a single CPU).
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include <set>
+#include <gtest/gtest.h>
+extern "C" {
+#include "S32K144.h"
+#include "Core_CM4.h"
+#include "MemPool.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define MEMPOOL_TEST_THREADS                (4u)
+#define MEMPOOL_TEST_ROUNDS                 (200000u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static volatile u32bit MemPool_TestErrors;
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+/*
+ * Hold up to 3 blocks of pool 0 at a time, each stamped with the thread and round, the stamp must survive
+ * until the block is freed: a block handed out twice is overwritten by the other owner.
+ */
+static void * MemPool_TestWorker(void * arg)
+{
+    const u32bit id = (u32bit)(uaddr)arg;
+    volatile u32bit * held[3] = { NULL, NULL, NULL };
+    u32bit stamp[3] = { 0u, 0u, 0u };
+    u32bit seed = id + 1u;
+    u32bit round;
+    u32bit slot;
+    u32bit word;
+
+    for (round = 0u; round < MEMPOOL_TEST_ROUNDS; round++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        slot = (seed >> 16u) % 3u;
+        if (held[slot] == NULL)
+        {
+            held[slot] = (volatile u32bit *)MemPool_AllocFromPool(0u);
+            stamp[slot] = (id << 24u) | round;
+            for (word = 0u; (held[slot] != NULL) && (word < 4u); word++)
+            {
+                held[slot][word] = stamp[slot];
+            }
+        }
+        else
+        {
+            for (word = 0u; word < 4u; word++)
+            {
+                if (held[slot][word] != stamp[slot])
+                {
+                    (void)Core_AtomicAdd(&MemPool_TestErrors, 1u);
+                }
+            }
+            MemPool_Free((void *)held[slot]);
+            held[slot] = NULL;
+        }
+        if (((seed >> 8u) & 7u) == 0u)
+        {
+            (void)sched_yield();
+        }
+    }
+    for (slot = 0u; slot < 3u; slot++)
+    {
+        MemPool_Free((void *)held[slot]);
+    }
+    return NULL;
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(MemPool, PoolsMatchTheConfiguration)
+{
+    MemPool_StatsType stats;
+
+    ASSERT_TRUE(MemPool_Init());
+    ASSERT_EQ(4u, MEMPOOL_NUM_POOLS);
+    ASSERT_TRUE(MemPool_GetStats(3u, &stats));
+    EXPECT_EQ(4096u, stats.blockSize);
+    EXPECT_EQ(2u, stats.blockCount);
+    EXPECT_FALSE(MemPool_GetStats(MEMPOOL_NUM_POOLS, &stats));
+    EXPECT_EQ(NULL, MemPool_AllocFromPool(MEMPOOL_NUM_POOLS));
+}
+
+TEST(MemPool, ExhaustedPoolRefusesAndCountsFailures)
+{
+    std::set<uaddr> blocks;
+    MemPool_StatsType stats;
+    void * block;
+    void * again;
+    u32bit i;
+
+    ASSERT_TRUE(MemPool_Init());
+    for (i = 0u; i < 16u; i++)
+    {
+        block = MemPool_AllocFromPool(0u);
+        ASSERT_NE((void *)NULL, block);
+        EXPECT_EQ(0u, (uaddr)block % 8u);
+        blocks.insert((uaddr)block);
+    }
+    EXPECT_EQ(16u, blocks.size());
+    EXPECT_EQ(NULL, MemPool_AllocFromPool(0u));
+    EXPECT_EQ(NULL, MemPool_AllocFromPool(0u));
+    ASSERT_TRUE(MemPool_GetStats(0u, &stats));
+    EXPECT_EQ(16u, stats.used);
+    EXPECT_EQ(16u, stats.highWater);
+    EXPECT_EQ(2u, stats.failures);
+
+    /*Last freed block is the next one handed out*/
+    block = (void *)*blocks.begin();
+    MemPool_Free(block);
+    again = MemPool_AllocFromPool(0u);
+    EXPECT_EQ(block, again);
+    for (uaddr address : blocks)
+    {
+        MemPool_Free((void *)address);
+    }
+    ASSERT_TRUE(MemPool_GetStats(0u, &stats));
+    EXPECT_EQ(0u, stats.used);
+    EXPECT_EQ(16u, stats.highWater);
+}
+
+TEST(MemPool, AllocFallsBackToBiggerPools)
+{
+    void * small[16];
+    MemPool_StatsType stats;
+    u32bit i;
+
+    ASSERT_TRUE(MemPool_Init());
+    for (i = 0u; i < 16u; i++)
+    {
+        small[i] = MemPool_Alloc(10u);
+    }
+    /*Pool 0 empty: the 64 byte pool serves 16 byte requests*/
+    ASSERT_NE((void *)NULL, MemPool_Alloc(16u));
+    ASSERT_TRUE(MemPool_GetStats(1u, &stats));
+    EXPECT_EQ(1u, stats.used);
+
+    EXPECT_NE((void *)NULL, MemPool_Alloc(4096u));
+    EXPECT_NE((void *)NULL, MemPool_Alloc(4096u));
+    EXPECT_EQ(NULL, MemPool_Alloc(4096u));
+    EXPECT_EQ(NULL, MemPool_Alloc(4097u));
+    MemPool_Free(NULL);
+    MemPool_Free(small[3]);
+    EXPECT_EQ(small[3], MemPool_Alloc(1u));
+}
+
+TEST(MemPool, ConcurrentAllocFreeNeverSharesABlock)
+{
+    pthread_t threads[MEMPOOL_TEST_THREADS];
+    MemPool_StatsType stats;
+    std::set<uaddr> blocks;
+    void * block;
+    u32bit i;
+
+    ASSERT_TRUE(MemPool_Init());
+    MemPool_TestErrors = 0u;
+    for (i = 0u; i < MEMPOOL_TEST_THREADS; i++)
+    {
+        ASSERT_EQ(0, pthread_create(&threads[i], NULL, MemPool_TestWorker, (void *)(uaddr)i));
+    }
+    for (i = 0u; i < MEMPOOL_TEST_THREADS; i++)
+    {
+        (void)pthread_join(threads[i], NULL);
+    }
+    EXPECT_EQ(0u, MemPool_TestErrors);
+
+    /*Every block is back on the free list exactly once*/
+    ASSERT_TRUE(MemPool_GetStats(0u, &stats));
+    EXPECT_EQ(0u, stats.used);
+    EXPECT_LE(stats.highWater, 12u);
+    while ((block = MemPool_AllocFromPool(0u)) != NULL)
+    {
+        EXPECT_TRUE(blocks.insert((uaddr)block).second);
+    }
+    EXPECT_EQ(16u, blocks.size());
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-005   | 17-Oct-2026 | First version of MemPool_Test.cpp                                            |
+***********************************************************************************************************************/
@@ -0,0 +1,234 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: NeuralNet_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \NeuralNet_Test.cpp
+    NeuralNet: NeuralNet_Invoke must give the outputs of the tools/NnConvert integer reference bit for bit: the
+    generated NeuralNet_Vibration tables on the quantized calibration and random inputs, and the same model
+    converted with int16 activations, its layers rebuilt here from the converter output.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include "HostTool.h"
+extern "C" {
+#include "NeuralNet.h"
+#include "NeuralNet_Models.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define NEURALNET_TEST_RANDOM               (64)
+
+/*Model and test vectors read back from the converter*/
+typedef struct
+{
+    NeuralNet_ModelType                model;
+    std::vector<NeuralNet_LayerType>   layers;
+    std::vector<std::vector<s8bit>>    weights;
+    std::vector<std::vector<s32bit>>   bias;
+    std::vector<std::vector<s32bit>>   inputs;
+    std::vector<std::vector<s32bit>>   outputs;
+} NeuralNet_TestModelType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+/*
+ * Converts the Vibration model of NeuralNet_Models.json with activation sys.argv[1] and writes, as int32:
+ * the model and layer fields in NeuralNet_LayerType order with weights and biases, then the quantized
+ * calibration and random inputs with the outputs of Model.run_fixed.
+ */
+static const char NeuralNet_TestScript[] =
+    "import json, random, struct\n"
+    "from nn_convert import Model\n"
+    "cfg = json.load(open(PATH))['models'][0]\n"
+    "cfg['activation'] = open(sys.argv[1]).read()\n"
+    "m = Model(cfg)\n"
+    "out = [m.elem_bytes, m.offsets[0], m.offsets[-1], m.arena, m.in_size, m.out_size, len(m.layers)]\n"
+    "for (i, l) in enumerate(m.layers):\n"
+    "    out += [m.offsets[i], m.offsets[i + 1], l.out_length, l.filters, l.window, l.step, l.mult, l.shift,\n"
+    "            l.out_zero, l.act_min, l.act_max, l.macs] + l.wq + l.bq\n"
+    "rnd = random.Random(10)\n"
+    "vectors = [m.quantize_input(x) for x in m.calibration]\n"
+    "vectors += [[rnd.randint(m.qmin, m.qmax) for _ in range(m.in_size)] for _ in range(RANDOM)]\n"
+    "out.append(len(vectors))\n"
+    "for q in vectors:\n"
+    "    x = q\n"
+    "    for l in m.layers:\n"
+    "        x = l.run_fixed(x)\n"
+    "    out += q + x\n"
+    "open(sys.argv[2], 'wb').write(struct.pack('<%di' % len(out), *out))\n";
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static boolean NeuralNet_TestConvert(const char * activation, NeuralNet_TestModelType * converted)
+{
+    std::string code = std::string("PATH = '") + TEST_TOPDIR + "/src/BSW/ComplexDrivers/NeuralNet/NeuralNet_Models.json'\n"
+                       "RANDOM = " + std::to_string(NEURALNET_TEST_RANDOM) + "\n" + NeuralNet_TestScript;
+    std::vector<u8bit> raw = HostTool_Python("NnConvert", code,
+                                             std::vector<u8bit>(activation, activation + strlen(activation)));
+    std::vector<s32bit> v(raw.size() / sizeof(s32bit));
+    size_t at = 7u;
+    s32bit i;
+    s32bit n;
+
+    if (v.size() < at)
+    {
+        return FALSE;
+    }
+    memcpy(v.data(), raw.data(), v.size() * sizeof(s32bit));
+    converted->model.elemBytes = (u8bit)v[0];
+    converted->model.inOffset = (u32bit)v[1];
+    converted->model.outOffset = (u32bit)v[2];
+    converted->model.arenaBytes = (u32bit)v[3];
+    converted->model.inSize = (u16bit)v[4];
+    converted->model.outSize = (u16bit)v[5];
+    converted->model.layerCount = (u8bit)v[6];
+    converted->layers.resize(v[6]);
+    converted->weights.resize(v[6]);
+    converted->bias.resize(v[6]);
+    for (i = 0; i < v[6]; i++)
+    {
+        NeuralNet_LayerType & layer = converted->layers[i];
+
+        layer.inOffset = (u32bit)v[at++];
+        layer.outOffset = (u32bit)v[at++];
+        layer.outLength = (u16bit)v[at++];
+        layer.filters = (u16bit)v[at++];
+        layer.window = (u16bit)v[at++];
+        layer.step = (u16bit)v[at++];
+        layer.mult = v[at++];
+        layer.shift = (u8bit)v[at++];
+        layer.outZero = (s16bit)v[at++];
+        layer.actMin = (s16bit)v[at++];
+        layer.actMax = (s16bit)v[at++];
+        layer.macs = (u32bit)v[at++];
+        converted->weights[i].assign(&v[at], &v[at] + (layer.filters * layer.window));
+        at += layer.filters * layer.window;
+        converted->bias[i].assign(&v[at], &v[at] + layer.filters);
+        at += layer.filters;
+        layer.weights = converted->weights[i].data();
+        layer.bias = converted->bias[i].data();
+    }
+    converted->model.layers = converted->layers.data();
+    for (n = v[at++]; n > 0; n--)
+    {
+        converted->inputs.emplace_back(&v[at], &v[at] + converted->model.inSize);
+        at += converted->model.inSize;
+        converted->outputs.emplace_back(&v[at], &v[at] + converted->model.outSize);
+        at += converted->model.outSize;
+    }
+    return (boolean)(at == v.size());
+}
+
+/*
+ * Run model on every test vector of converted, every output must equal the reference.
+ */
+static void NeuralNet_TestRun(const NeuralNet_ModelType * model, const NeuralNet_TestModelType & converted)
+{
+    size_t vector;
+    u32bit i;
+
+    ASSERT_FALSE(converted.inputs.empty());
+    for (vector = 0u; vector < converted.inputs.size(); vector++)
+    {
+        for (i = 0u; i < model->inSize; i++)
+        {
+            if (model->elemBytes == 1u)
+            {
+                ((s8bit *)NeuralNet_Input(model))[i] = (s8bit)converted.inputs[vector][i];
+            }
+            else
+            {
+                ((s16bit *)NeuralNet_Input(model))[i] = (s16bit)converted.inputs[vector][i];
+            }
+        }
+        ASSERT_TRUE(NeuralNet_Invoke(model));
+        for (i = 0u; i < model->outSize; i++)
+        {
+            s32bit output = (model->elemBytes == 1u) ? ((const s8bit *)NeuralNet_Output(model))[i] :
+                                                       ((const s16bit *)NeuralNet_Output(model))[i];
+
+            ASSERT_EQ(converted.outputs[vector][i], output) << "vector " << vector << " output " << i;
+        }
+    }
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(NeuralNet, GeneratedTablesMatchTheConverter)
+{
+    NeuralNet_TestModelType converted;
+    u32bit i;
+
+    ASSERT_TRUE(NeuralNet_TestConvert("s8", &converted)) << "nn_convert.py failed";
+    ASSERT_EQ(NeuralNet_Vibration.layerCount, converted.model.layerCount);
+    EXPECT_EQ((u32bit)NEURALNET_VIBRATION_ARENA_BYTES, converted.model.arenaBytes);
+    EXPECT_EQ(NeuralNet_Vibration.arenaBytes, converted.model.arenaBytes);
+    EXPECT_EQ(NeuralNet_Vibration.inOffset, converted.model.inOffset);
+    EXPECT_EQ(NeuralNet_Vibration.outOffset, converted.model.outOffset);
+    for (i = 0u; i < NeuralNet_Vibration.layerCount; i++)
+    {
+        const NeuralNet_LayerType & layer = NeuralNet_Vibration.layers[i];
+
+        EXPECT_TRUE(std::equal(converted.weights[i].begin(), converted.weights[i].end(), layer.weights));
+        EXPECT_TRUE(std::equal(converted.bias[i].begin(), converted.bias[i].end(), layer.bias));
+        EXPECT_EQ(converted.layers[i].mult, layer.mult);
+        EXPECT_EQ(converted.layers[i].shift, layer.shift);
+        EXPECT_EQ(converted.layers[i].outOffset, layer.outOffset);
+    }
+}
+
+TEST(NeuralNet, Int8InferenceMatchesReferenceBitForBit)
+{
+    NeuralNet_TestModelType converted;
+
+    ASSERT_TRUE(NeuralNet_TestConvert("s8", &converted)) << "nn_convert.py failed";
+    NeuralNet_TestRun(&NeuralNet_Vibration, converted);
+}
+
+TEST(NeuralNet, Int16InferenceMatchesReferenceBitForBit)
+{
+    NeuralNet_TestModelType converted;
+
+    ASSERT_TRUE(NeuralNet_TestConvert("s16", &converted)) << "nn_convert.py failed";
+    ASSERT_LE(converted.model.arenaBytes, (u32bit)NEURALNET_CFG_ARENA_SIZE);
+    NeuralNet_TestRun(&converted.model, converted);
+}
+
+TEST(NeuralNet, ModelLargerThanTheArenaIsRefused)
+{
+    NeuralNet_ModelType model = NeuralNet_Vibration;
+
+    model.arenaBytes = NEURALNET_CFG_ARENA_SIZE + 1u;
+    EXPECT_FALSE(NeuralNet_Invoke(&model));
+    model = NeuralNet_Vibration;
+    model.layerCount = NEURALNET_CFG_MAX_LAYERS + 1u;
+    EXPECT_FALSE(NeuralNet_Invoke(&model));
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-010   | 17-Oct-2026 | First version of NeuralNet_Test.cpp                                          |
+***********************************************************************************************************************/
@@ -0,0 +1,368 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Os_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Os_Test.cpp
+    Os kernel on the ucontext host port: priority preemption, FIFO round robin, delays against the SIGALRM tick,
+    suspend/resume, nested critical sections holding the tick and stack painting. Each test starts the kernel and
+    the last task it creates shuts it down, Os_Start then returns to the test.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <gtest/gtest.h>
+extern "C" {
+#include "Os.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define OS_TEST_STACK_WORDS                 (1024u)
+#define OS_TEST_TASKS                       (3u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+OS_TASK_DEFINE(Os_TestTask0, OS_TEST_STACK_WORDS);
+OS_TASK_DEFINE(Os_TestTask1, OS_TEST_STACK_WORDS);
+OS_TASK_DEFINE(Os_TestTask2, OS_TEST_STACK_WORDS);
+
+/*Periodic task of the simulated time tests: work ticks of load every period ticks from tick 0*/
+typedef struct
+{
+    Os_TickType period;
+    Os_TickType work;
+    u32bit      cycles;
+    u32bit      wakeups;
+    Os_TickType jitterMax;              /*Ticks between a deadline and the start of its cycle*/
+    Os_TickType jitterSum;
+} Os_TestPeriodicType;
+
+static std::string Os_TestLog;
+static u32bit Os_TestRunning;
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static u64bit Os_TestMicroseconds(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((u64bit)now.tv_sec * 1000000uLL) + ((u64bit)now.tv_nsec / 1000u);
+}
+
+/*
+ * End of a task body, the last task to finish stops the kernel.
+ */
+static void Os_TestExit(void)
+{
+    Os_TestRunning--;
+    if (Os_TestRunning == 0u)
+    {
+        Os_Shutdown();
+    }
+}
+
+/*
+ * Create tasks entries[i] with priorities[i] (0: not created) and run the kernel until they all ended.
+ */
+static void Os_TestRun(Os_TaskEntryType entry0, u8bit prio0, Os_TaskEntryType entry1, u8bit prio1,
+                       Os_TaskEntryType entry2, u8bit prio2)
+{
+    Os_TestLog.clear();
+    Os_TestRunning = 0u;
+    Os_Init();
+    if (prio0 != 0u)
+    {
+        Os_TaskCreate(&Os_TestTask0, entry0, (void *)"0", prio0, OS_TASK_STACK(Os_TestTask0));
+        Os_TestRunning++;
+    }
+    if (prio1 != 0u)
+    {
+        Os_TaskCreate(&Os_TestTask1, entry1, (void *)"1", prio1, OS_TASK_STACK(Os_TestTask1));
+        Os_TestRunning++;
+    }
+    if (prio2 != 0u)
+    {
+        Os_TaskCreate(&Os_TestTask2, entry2, (void *)"2", prio2, OS_TASK_STACK(Os_TestTask2));
+        Os_TestRunning++;
+    }
+    Os_Start();
+}
+
+static void Os_TestYieldThrice(void * arg)
+{
+    u32bit i;
+
+    for (i = 0u; i < 3u; i++)
+    {
+        Os_TestLog += (const char *)arg;
+        Os_Yield();
+    }
+    Os_TestExit();
+}
+
+static void Os_TestLowResumes(void * arg)
+{
+    (void)arg;
+    Os_TestLog += "L";
+    Os_TaskResume(&Os_TestTask1);
+    Os_TestLog += "l";
+    Os_TestExit();
+}
+
+static void Os_TestHighSuspends(void * arg)
+{
+    (void)arg;
+    Os_TestLog += "H";
+    Os_TaskSuspend(NULL);
+    Os_TestLog += "h";
+    Os_TestExit();
+}
+
+static void Os_TestDelayByArg(void * arg)
+{
+    const char * name = (const char *)arg;
+
+    /*Task 0 sleeps 3 ticks, task 1 one tick, task 2 two ticks*/
+    Os_Delay((name[0] == '0') ? 3u : ((name[0] == '1') ? 1u : 2u));
+    Os_TestLog += name;
+    Os_TestExit();
+}
+
+static Os_TickType Os_TestTicks;
+static u64bit Os_TestElapsedUs;
+
+static void Os_TestDelayFive(void * arg)
+{
+    Os_TickType start = Os_GetTickCount();
+    u64bit startUs = Os_TestMicroseconds();
+
+    (void)arg;
+    Os_Delay(5u);
+    Os_TestTicks = Os_GetTickCount() - start;
+    Os_TestElapsedUs = Os_TestMicroseconds() - startUs;
+    Os_TestExit();
+}
+
+static Os_TickType Os_TestTicksInside;
+static Os_TickType Os_TestTicksAfter;
+
+static void Os_TestCriticalSection(void * arg)
+{
+    Os_TickType start;
+    u64bit until;
+
+    (void)arg;
+    Os_Delay(1u);
+    Os_SuspendAllInterrupts();
+    Os_SuspendAllInterrupts();
+    start = Os_GetTickCount();
+    until = Os_TestMicroseconds() + 3000u;
+    while (Os_TestMicroseconds() < until)
+    {
+    }
+    Os_ResumeAllInterrupts();
+    Os_TestTicksInside = Os_GetTickCount() - start;
+    Os_ResumeAllInterrupts();
+    Os_TestTicksAfter = Os_GetTickCount() - start;
+    Os_TestExit();
+}
+
+static void Os_TestStackDepth(void * arg)
+{
+    volatile u8bit used[1024];
+
+    (void)arg;
+    used[0] = 1u;
+    used[sizeof(used) - 1u] = used[0];
+    Os_TestExit();
+}
+
+#if (OS_CFG_HOST_TICK_TIMER == 0u)
+/*
+ * Simulated time only advances on Os_Tick: the load of a task is the number of ticks it calls, each one can
+ * preempt it like the tick interrupt on the target.
+ */
+static void Os_TestWork(Os_TickType ticks)
+{
+    Os_TickType tick;
+
+    for (tick = 0u; tick < ticks; tick++)
+    {
+        Os_Tick();
+    }
+}
+
+static void Os_TestPeriodic(void * arg)
+{
+    Os_TestPeriodicType * periodic = (Os_TestPeriodicType *)arg;
+    Os_TickType deadline = 0u;
+    Os_TickType jitter;
+    u32bit cycle;
+
+    for (cycle = 0u; cycle < periodic->cycles; cycle++)
+    {
+        jitter = Os_GetTickCount() - deadline;
+        periodic->wakeups++;
+        periodic->jitterSum += jitter;
+        periodic->jitterMax = (jitter > periodic->jitterMax) ? jitter : periodic->jitterMax;
+        Os_TestWork(periodic->work);
+        deadline += periodic->period;
+        if ((s32bit)(deadline - Os_GetTickCount()) > 0)
+        {
+            Os_Delay(deadline - Os_GetTickCount());
+        }
+    }
+    Os_TestExit();
+}
+#endif
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Os, SamePriorityTasksRoundRobinOnYield)
+{
+    Os_TestRun(Os_TestYieldThrice, 2u, Os_TestYieldThrice, 2u, Os_TestYieldThrice, 2u);
+    EXPECT_EQ("012012012", Os_TestLog);
+}
+
+TEST(Os, ResumedHigherPriorityTaskPreempts)
+{
+    Os_TestRun(Os_TestLowResumes, 2u, Os_TestHighSuspends, 3u, NULL, 0u);
+    EXPECT_EQ("HLhl", Os_TestLog);
+}
+
+TEST(Os, DelayedTasksWakeInDeadlineOrder)
+{
+    Os_TestRun(Os_TestDelayByArg, 2u, Os_TestDelayByArg, 2u, Os_TestDelayByArg, 2u);
+    EXPECT_EQ("120", Os_TestLog);
+}
+
+TEST(Os, DelayFollowsTheTick)
+{
+#if (OS_CFG_HOST_TICK_TIMER == 0u)
+    GTEST_SKIP() << "real time tick only";
+#endif
+    Os_TestRun(Os_TestDelayFive, 2u, NULL, 0u, NULL, 0u);
+    /*Never early, a descheduled host process may see later ticks*/
+    EXPECT_GE(Os_TestTicks, 5u);
+    EXPECT_GE(Os_TestElapsedUs, 4000u);
+    EXPECT_LT(Os_TestElapsedUs, 50000u);
+}
+
+TEST(Os, NestedCriticalSectionHoldsTheTick)
+{
+#if (OS_CFG_HOST_TICK_TIMER == 0u)
+    GTEST_SKIP() << "real time tick only";
+#endif
+    Os_TestRun(Os_TestCriticalSection, 2u, NULL, 0u, NULL, 0u);
+    EXPECT_EQ(0u, Os_TestTicksInside);
+    EXPECT_GE(Os_TestTicksAfter, 1u);
+}
+
+TEST(Os, StackHighWaterMark)
+{
+    Os_TestRun(Os_TestStackDepth, 2u, NULL, 0u, NULL, 0u);
+    EXPECT_LT(Os_TaskStackUnused(&Os_TestTask0),
+              (OS_TEST_STACK_WORDS + OS_PORT_STACK_EXTRA_WORDS) * sizeof(u32bit) - 1024u);
+    EXPECT_GT(Os_TaskStackUnused(&Os_TestTask0), 0u);
+}
+
+TEST(Os, TicklessIdleSleepsOncePerPeriod)
+{
+#if (OS_CFG_HOST_TICK_TIMER == 0u)
+    Os_TestPeriodicType periodic = { 10u, 3u, 100u, 0u, 0u, 0u };
+    Os_IdleStatsType stats;
+
+    Os_TestRunning = 1u;
+    Os_Init();
+    Os_TaskCreate(&Os_TestTask0, Os_TestPeriodic, &periodic, 2u, OS_TASK_STACK(Os_TestTask0));
+    Os_Start();
+    Os_GetIdleStats(&stats);
+    /*One wake up per period instead of one per tick, 7 of every 10 ticks idle*/
+    EXPECT_EQ(1000u, Os_GetTickCount());
+    EXPECT_EQ(100u, periodic.wakeups);
+    EXPECT_EQ(100u, stats.sleeps);
+    EXPECT_EQ(700u, stats.idleTicks);
+    EXPECT_EQ(0u, periodic.jitterMax);
+#else
+    GTEST_SKIP() << "make HOST=1 SIM_TIME=1 test";
+#endif
+}
+
+TEST(Os, TicklessIdleKeepsDeadlinesUnderLoad)
+{
+#if (OS_CFG_HOST_TICK_TIMER == 0u)
+    Os_TestPeriodicType fast = { 10u, 2u, 100u, 0u, 0u, 0u };
+    Os_TestPeriodicType slow = { 25u, 6u, 40u, 0u, 0u, 0u };
+    Os_IdleStatsType stats;
+
+    Os_TestRunning = 2u;
+    Os_Init();
+    Os_TaskCreate(&Os_TestTask0, Os_TestPeriodic, &fast, 3u, OS_TASK_STACK(Os_TestTask0));
+    Os_TaskCreate(&Os_TestTask1, Os_TestPeriodic, &slow, 2u, OS_TASK_STACK(Os_TestTask1));
+    Os_Start();
+    Os_GetIdleStats(&stats);
+    printf("idle %u of %u ticks in %u sleeps, jitter max %u / %u, mean %.2f / %.2f ticks\n",
+           (unsigned)stats.idleTicks, (unsigned)Os_GetTickCount(), (unsigned)stats.sleeps,
+           (unsigned)fast.jitterMax, (unsigned)slow.jitterMax, (double)fast.jitterSum / fast.wakeups,
+           (double)slow.jitterSum / slow.wakeups);
+    EXPECT_EQ(1000u, Os_GetTickCount());
+    EXPECT_EQ(100u, fast.wakeups);
+    EXPECT_EQ(40u, slow.wakeups);
+    /*The fast task preempts the slow one at its deadline, the slow one waits at most one fast cycle of work*/
+    EXPECT_EQ(0u, fast.jitterMax);
+    EXPECT_LE(slow.jitterMax, fast.work);
+    /*1000 - 100 * 2 - 40 * 6 ticks without work, single idle ticks are not suppressed*/
+    EXPECT_LE(stats.idleTicks, 560u);
+    EXPECT_GE(stats.idleTicks, 560u - stats.sleeps);
+    EXPECT_LT(stats.sleeps, fast.wakeups + slow.wakeups);
+#else
+    GTEST_SKIP() << "make HOST=1 SIM_TIME=1 test";
+#endif
+}
+
+TEST(Os, OneTickDelaysAdvanceWithoutSleeping)
+{
+#if (OS_CFG_HOST_TICK_TIMER == 0u)
+    Os_TestPeriodicType periodic = { 1u, 0u, 50u, 0u, 0u, 0u };
+    Os_IdleStatsType stats;
+
+    Os_TestRunning = 1u;
+    Os_Init();
+    Os_TaskCreate(&Os_TestTask0, Os_TestPeriodic, &periodic, 2u, OS_TASK_STACK(Os_TestTask0));
+    Os_Start();
+    Os_GetIdleStats(&stats);
+    EXPECT_EQ(50u, Os_GetTickCount());
+    EXPECT_EQ(0u, stats.sleeps);
+    EXPECT_EQ(0u, periodic.jitterMax);
+#else
+    GTEST_SKIP() << "make HOST=1 SIM_TIME=1 test";
+#endif
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-003   | 17-Oct-2026 | First version of Os_Test.cpp                                                 |
+ *| CMARTI  |  user-015   | 17-Oct-2026 | Tickless idle tests in simulated time: wake ups, idle ratio, jitter          |
+***********************************************************************************************************************/
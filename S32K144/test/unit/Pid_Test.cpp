@@ -0,0 +1,209 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Pid_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Pid_Test.cpp
+    Pid: the Q15 structure of arrays batch (QSUB16/SMUAD/SMLALD) must match bit for bit a plain scalar C
+    reference of the same Q15 algorithm, over random gains, filters, shifts and limits and inputs up to the
+    16 bit extremes. The DSP helpers of Core_CM4.h are checked against their definitions, and the Q31 and float
+    controllers against each other on a step response.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+extern "C" {
+#include "S32K144.h"
+#include "Core_CM4.h"
+#include "Pid.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define PID_TEST_LOOPS                      (16u)
+#define PID_TEST_STEPS                      (4000u)
+
+/*Scalar Q15 controller, the reference of Pid_Q15Update*/
+typedef struct
+{
+    Pid_Q15ParamType param;
+    s32bit           integ;
+    s32bit           dFilt;
+    s32bit           prevMeas;
+} Pid_TestRefType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+PID_Q15_BATCH_DEFINE(Pid_TestBatch, PID_TEST_LOOPS);
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static s32bit Pid_TestSat(s64bit value, s64bit min, s64bit max)
+{
+    return (s32bit)((value > max) ? max : ((value < min) ? min : value));
+}
+
+/*
+ * Q15 PID in plain C: saturated 16 bit differences, first order filter alpha * delta + (1 - alpha) * dFilt,
+ * Q30 integrator clamped to the output range, output scaled by 2^shift and saturated with anti-windup.
+ */
+static s16bit Pid_TestRefUpdate(Pid_TestRefType * pid, s16bit setpoint, s16bit measurement)
+{
+    const Pid_Q15ParamType * p = &pid->param;
+    s32bit alpha = (p->alpha < 1) ? 1 : p->alpha;
+    s32bit error = Pid_TestSat((s32bit)setpoint - measurement, -32768, 32767);
+    s32bit delta = Pid_TestSat(pid->prevMeas - measurement, -32768, 32767);
+    s32bit dFilt = (s16bit)(((alpha * delta) + ((32767 - alpha) * pid->dFilt)) >> 15);
+    s32bit integ = Pid_TestSat((s64bit)pid->integ + ((s64bit)p->ki * error), INT32_MIN, INT32_MAX);
+    s64bit output;
+
+    integ = Pid_TestSat(integ, (s64bit)p->outMin << (15u - p->shift), (s64bit)p->outMax << (15u - p->shift));
+    output = ((s64bit)integ + ((s64bit)p->kp * error) + ((s64bit)p->kd * dFilt)) >> (15u - p->shift);
+    if (output > p->outMax)
+    {
+        output = p->outMax;
+        integ = (error > 0) ? pid->integ : integ;
+    }
+    else if (output < p->outMin)
+    {
+        output = p->outMin;
+        integ = (error < 0) ? pid->integ : integ;
+    }
+    else
+    {
+    }
+    pid->integ = integ;
+    pid->dFilt = dFilt;
+    pid->prevMeas = measurement;
+    return (s16bit)output;
+}
+
+static u32bit Pid_TestRandom(u32bit * seed)
+{
+    *seed = (*seed * 1103515245u) + 12345u;
+    return *seed >> 8u;
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Pid, DspHelpersMatchTheirDefinition)
+{
+    EXPECT_EQ(Core_Pack16(32767, -32768), Core_Qsub16(Core_Pack16(32767, -32768), Core_Pack16(-1, 1)));
+    EXPECT_EQ(Core_Pack16(-3, 7), Core_Qsub16(Core_Pack16(2, 10), Core_Pack16(5, 3)));
+    EXPECT_EQ((3 * -4) + (-5 * 6), Core_Smuad(Core_Pack16(3, -5), Core_Pack16(-4, 6)));
+    EXPECT_EQ((s64bit)1 << 40, Core_Smlald(Core_Pack16(-32768, -32768), Core_Pack16(-32768, -32768),
+                                          ((s64bit)1 << 40) - ((s64bit)1 << 31)));
+    EXPECT_EQ(INT32_MAX, Core_Qadd(INT32_MAX - 1, 5));
+    EXPECT_EQ(INT32_MIN, Core_Qadd(INT32_MIN + 1, -5));
+}
+
+TEST(Pid, Q15BatchMatchesScalarReferenceBitForBit)
+{
+    Pid_TestRefType reference[PID_TEST_LOOPS];
+    s16bit setpoint[PID_TEST_LOOPS];
+    s16bit measurement[PID_TEST_LOOPS];
+    s16bit output[PID_TEST_LOOPS];
+    u32bit seed = 2026u;
+    u32bit loop;
+    u32bit step;
+    s16bit expected;
+
+    for (loop = 0u; loop < PID_TEST_LOOPS; loop++)
+    {
+        Pid_Q15ParamType param;
+
+        param.kp = (s16bit)Pid_TestRandom(&seed);
+        param.ki = (s16bit)(Pid_TestRandom(&seed) & 0x0FFFu);
+        param.kd = (s16bit)Pid_TestRandom(&seed);
+        param.alpha = (s16bit)(Pid_TestRandom(&seed) & 0x7FFFu);
+        param.shift = (u8bit)(Pid_TestRandom(&seed) % 16u);
+        param.outMax = (s16bit)(1 + (Pid_TestRandom(&seed) & 0x7FFEu));
+        param.outMin = (s16bit)(-(s32bit)param.outMax - (s32bit)(loop & 1u));
+        /*Extremes on the first loops: full gains, no filter, no scaling*/
+        if (loop == 0u)
+        {
+            param.kp = 32767;
+            param.kd = -32768;
+            param.alpha = 32767;
+            param.shift = 0u;
+        }
+        else if (loop == 1u)
+        {
+            param.alpha = 0;
+            param.shift = 15u;
+        }
+        reference[loop].param = param;
+        reference[loop].integ = 0;
+        reference[loop].dFilt = 0;
+        reference[loop].prevMeas = (s16bit)loop;
+        Pid_Q15Init(&Pid_TestBatch, loop, &param, (s16bit)loop);
+    }
+
+    for (step = 0u; step < PID_TEST_STEPS; step++)
+    {
+        for (loop = 0u; loop < PID_TEST_LOOPS; loop++)
+        {
+            /*Steps between the extremes, then noise around a set point*/
+            setpoint[loop] = ((step % 500u) < 250u) ? (s16bit)32767 : (s16bit)-32768;
+            measurement[loop] = (step < 2000u) ? (s16bit)Pid_TestRandom(&seed) :
+                                (s16bit)((s32bit)output[loop] / 2 + (s32bit)(Pid_TestRandom(&seed) & 0xFFu));
+        }
+        Pid_Q15Update(&Pid_TestBatch, setpoint, measurement, output);
+        for (loop = 0u; loop < PID_TEST_LOOPS; loop++)
+        {
+            expected = Pid_TestRefUpdate(&reference[loop], setpoint[loop], measurement[loop]);
+            ASSERT_EQ(expected, output[loop]) << "loop " << loop << " step " << step;
+            ASSERT_EQ(reference[loop].integ, Pid_TestBatch_Integ[loop]) << "loop " << loop << " step " << step;
+        }
+    }
+}
+
+TEST(Pid, Q31AndFloatStepResponsesAgree)
+{
+    const Pid_FloatParamType floatParam = { 0.5f, 0.05f, 0.1f, 0.25f, -1.0f, 1.0f };
+    const Pid_Q31ParamType q31Param = { 0x40000000, 0x06666666, 0x0CCCCCCD, 0x20000000, 0u, INT32_MIN + 1, INT32_MAX };
+    Pid_FloatType floatPid;
+    Pid_Q31Type q31Pid;
+    float plantF = 0.0f;
+    float plantQ = 0.0f;
+    float outF;
+    s32bit outQ;
+    u32bit step;
+
+    Pid_FloatInit(&floatPid, &floatParam, 0.0f);
+    Pid_Q31Init(&q31Pid, &q31Param, 0);
+    for (step = 0u; step < 300u; step++)
+    {
+        outF = Pid_FloatUpdate(&floatPid, 0.5f, plantF);
+        outQ = Pid_Q31Update(&q31Pid, 0x40000000, (s32bit)(plantQ * 2147483648.0f));
+        plantF += 0.1f * (outF - plantF);
+        plantQ += 0.1f * (((float)outQ / 2147483648.0f) - plantQ);
+        ASSERT_NEAR(outF, (float)outQ / 2147483648.0f, 1e-4f) << "step " << step;
+    }
+    EXPECT_NEAR(0.5f, plantF, 1e-2f);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-008   | 17-Oct-2026 | First version of Pid_Test.cpp                                                |
+***********************************************************************************************************************/
@@ -0,0 +1,143 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Prof_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Prof_Test.cpp
+    Prof: probe statistics, and the table lock taken through SUSPEND_INTERRUPTS of Core_CM4.h: nestable inside an Os
+    critical section and protecting the table against probes recorded from the SIGALRM tick. Built with make HOST=1 PROF=1
+    test, skipped otherwise.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <csignal>
+#include <sys/time.h>
+#include <gtest/gtest.h>
+extern "C" {
+#include "S32K144.h"
+#include "Core_CM4.h"
+#include "Os.h"
+#include "Prof.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define PROF_TEST_RECORDS                   (200000u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static volatile sig_atomic_t Prof_TestTicks;
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+#if (PROF_CFG_ENABLED == 1u)
+/*
+ * Tick ISR recording a probe, as the Os tick does on target.
+ */
+static void Prof_TestTick(int signal)
+{
+    (void)signal;
+    Prof_TestTicks++;
+    Prof_Record(PROF_PROBE_OsTick, 100000u);
+}
+
+static void Prof_TestArmTick(suseconds_t period)
+{
+    struct itimerval timer = {};
+
+    timer.it_value.tv_usec = 100;
+    timer.it_interval.tv_usec = period;
+    (void)signal(SIGALRM, Prof_TestTick);
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+}
+#endif
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Prof, RecordKeepsCountMinMaxMeanAndHistogram)
+{
+#if (PROF_CFG_ENABLED == 1u)
+    Prof_Init();
+    Prof_Record(PROF_PROBE_NeuralNetInvoke, 100u + Prof_Overhead);
+    Prof_Record(PROF_PROBE_NeuralNetInvoke, 300u + Prof_Overhead);
+    Prof_Record(PROF_PROBE_NeuralNetInvoke, 0u);
+    EXPECT_EQ(3u, Prof_Table[PROF_PROBE_NeuralNetInvoke].count);
+    EXPECT_EQ(0u, Prof_Table[PROF_PROBE_NeuralNetInvoke].min);
+    EXPECT_EQ(300u, Prof_Table[PROF_PROBE_NeuralNetInvoke].max);
+    EXPECT_EQ(133u, Prof_Mean(PROF_PROBE_NeuralNetInvoke));
+    EXPECT_EQ(1u, Prof_Table[PROF_PROBE_NeuralNetInvoke].hist[0]);
+    EXPECT_EQ(1u, Prof_Table[PROF_PROBE_NeuralNetInvoke].hist[7]);
+    EXPECT_EQ(1u, Prof_Table[PROF_PROBE_NeuralNetInvoke].hist[9]);
+    EXPECT_EQ(0u, Prof_Mean(PROF_PROBE_OsTick));
+    Prof_Reset();
+    EXPECT_EQ(0u, Prof_Table[PROF_PROBE_NeuralNetInvoke].count);
+#else
+    GTEST_SKIP() << "make HOST=1 PROF=1 test";
+#endif
+}
+
+TEST(Prof, RecordInsideAnOsCriticalSectionKeepsTheTickMasked)
+{
+#if (PROF_CFG_ENABLED == 1u)
+    Prof_Init();
+    Prof_TestTicks = 0;
+    Os_SuspendAllInterrupts();
+    Prof_TestArmTick(0);
+    Prof_Record(PROF_PROBE_NeuralNetInvoke, 10u);
+    STANDBY();
+    EXPECT_EQ(0, Prof_TestTicks);
+    Os_ResumeAllInterrupts();
+    EXPECT_EQ(1, Prof_TestTicks);
+    EXPECT_EQ(1u, Prof_Table[PROF_PROBE_OsTick].count);
+#else
+    GTEST_SKIP() << "make HOST=1 PROF=1 test";
+#endif
+}
+
+TEST(Prof, ProbesFromTheTickAreNotLost)
+{
+#if (PROF_CFG_ENABLED == 1u)
+    struct itimerval stop = {};
+    u32bit i;
+
+    Prof_Init();
+    Prof_TestTicks = 0;
+    Prof_TestArmTick(50);
+    for (i = 0u; i < PROF_TEST_RECORDS; i++)
+    {
+        Prof_Record(PROF_PROBE_OsTick, 10000u);
+    }
+    (void)setitimer(ITIMER_REAL, &stop, NULL);
+    (void)signal(SIGALRM, SIG_DFL);
+    EXPECT_GT(Prof_TestTicks, 0);
+    EXPECT_EQ(PROF_TEST_RECORDS + (u32bit)Prof_TestTicks, Prof_Table[PROF_PROBE_OsTick].count);
+    EXPECT_EQ(((u64bit)PROF_TEST_RECORDS * (10000u - Prof_Overhead)) + ((u64bit)Prof_TestTicks * (100000u - Prof_Overhead)),
+              Prof_Table[PROF_PROBE_OsTick].sum);
+#else
+    GTEST_SKIP() << "make HOST=1 PROF=1 test";
+#endif
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | First version of Prof_Test.cpp                                               |
+ *| CMARTI  |  user-012   | 17-Oct-2026 | Lock taken through SUSPEND_INTERRUPTS                                        |
+***********************************************************************************************************************/
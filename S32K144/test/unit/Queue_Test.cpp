@@ -0,0 +1,303 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Queue_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Queue_Test.cpp
+    Queue: SPSC and MPSC ring buffers, FIFO order, full/empty limits, zero copy reserve/peek around the wrap,
+    partial batch claims, and threaded stress tests: one producer and one consumer on the SPSC queue, four
+    producers and one consumer on the MPSC queue checking every producer's sequence arrives complete and in order.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include <gtest/gtest.h>
+extern "C" {
+#include "S32K144.h"
+#include "Queue.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define QUEUE_TEST_CAPACITY                 (8u)
+#define QUEUE_TEST_PRODUCERS                (4u)
+#define QUEUE_TEST_MESSAGES                 (200000u)
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+QUEUE_SPSC_DEFINE(Queue_TestSpsc, u32bit, QUEUE_TEST_CAPACITY);
+QUEUE_MPSC_DEFINE(Queue_TestMpsc, u32bit, QUEUE_TEST_CAPACITY);
+
+static u32bit Queue_TestSpscBuffer[64];
+static Queue_SpscType Queue_TestSpscStress;
+static u32bit Queue_TestMpscBuffer[64];
+static volatile u32bit Queue_TestMpscSeq[64];
+static Queue_MpscType Queue_TestMpscStress;
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static u32bit Queue_TestRandom(u32bit * seed)
+{
+    *seed = (*seed * 1103515245u) + 12345u;
+    return *seed >> 16u;
+}
+
+/*
+ * Pushes 1..QUEUE_TEST_MESSAGES in batches of 1 to 5.
+ */
+static void * Queue_TestSpscProducer(void * arg)
+{
+    u32bit batch[5];
+    u32bit next = 1u;
+    u32bit seed = 7u;
+    u32bit count;
+    u32bit done;
+    u32bit i;
+
+    (void)arg;
+    while (next <= QUEUE_TEST_MESSAGES)
+    {
+        count = 1u + (Queue_TestRandom(&seed) % 5u);
+        count = ((QUEUE_TEST_MESSAGES + 1u - next) < count) ? (QUEUE_TEST_MESSAGES + 1u - next) : count;
+        for (i = 0u; i < count; i++)
+        {
+            batch[i] = next + i;
+        }
+        done = Queue_SpscPushBatch(&Queue_TestSpscStress, batch, count);
+        next += done;
+        if (done < count)
+        {
+            (void)sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Pushes (id << 24) | 1..QUEUE_TEST_MESSAGES / QUEUE_TEST_PRODUCERS in batches of 1 to 4.
+ */
+static void * Queue_TestMpscProducer(void * arg)
+{
+    const u32bit id = (u32bit)(uaddr)arg;
+    const u32bit last = QUEUE_TEST_MESSAGES / QUEUE_TEST_PRODUCERS;
+    u32bit batch[4];
+    u32bit next = 1u;
+    u32bit seed = id + 11u;
+    u32bit count;
+    u32bit done;
+    u32bit i;
+
+    while (next <= last)
+    {
+        count = 1u + (Queue_TestRandom(&seed) % 4u);
+        count = ((last + 1u - next) < count) ? (last + 1u - next) : count;
+        for (i = 0u; i < count; i++)
+        {
+            batch[i] = (id << 24u) | (next + i);
+        }
+        done = Queue_MpscPushBatch(&Queue_TestMpscStress, batch, count);
+        next += done;
+        if ((done < count) || ((seed & 0x700u) == 0u))
+        {
+            (void)sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Queue, SpscFifoUntilFull)
+{
+    u32bit value;
+    u32bit i;
+
+    ASSERT_TRUE(Queue_SpscInit(&Queue_TestSpsc, Queue_TestSpsc_Buffer, sizeof(u32bit), QUEUE_TEST_CAPACITY));
+    EXPECT_FALSE(Queue_SpscInit(&Queue_TestSpscStress, Queue_TestSpscBuffer, sizeof(u32bit), 6u));
+    EXPECT_FALSE(Queue_SpscPop(&Queue_TestSpsc, &value));
+    for (i = 0u; i < QUEUE_TEST_CAPACITY; i++)
+    {
+        EXPECT_TRUE(Queue_SpscPush(&Queue_TestSpsc, &i));
+    }
+    EXPECT_FALSE(Queue_SpscPush(&Queue_TestSpsc, &i));
+    EXPECT_EQ(QUEUE_TEST_CAPACITY, Queue_SpscCount(&Queue_TestSpsc));
+    for (i = 0u; i < QUEUE_TEST_CAPACITY; i++)
+    {
+        ASSERT_TRUE(Queue_SpscPop(&Queue_TestSpsc, &value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(Queue_SpscPop(&Queue_TestSpsc, &value));
+}
+
+TEST(Queue, SpscReserveAndPeekStopAtTheWrap)
+{
+    u32bit values[QUEUE_TEST_CAPACITY] = { 1u, 2u, 3u, 4u, 5u, 6u };
+    u32bit out[QUEUE_TEST_CAPACITY];
+    u32bit count;
+    u32bit * slot;
+
+    ASSERT_TRUE(Queue_SpscInit(&Queue_TestSpsc, Queue_TestSpsc_Buffer, sizeof(u32bit), QUEUE_TEST_CAPACITY));
+    EXPECT_EQ(6u, Queue_SpscPushBatch(&Queue_TestSpsc, values, 6u));
+    EXPECT_EQ(5u, Queue_SpscPopBatch(&Queue_TestSpsc, out, 5u));
+
+    /*Head at 6: two contiguous slots to the end of the buffer, then the wrap*/
+    count = 4u;
+    slot = (u32bit *)Queue_SpscReserve(&Queue_TestSpsc, &count);
+    ASSERT_NE((u32bit *)NULL, slot);
+    EXPECT_EQ(2u, count);
+    slot[0] = 7u;
+    slot[1] = 8u;
+    Queue_SpscCommit(&Queue_TestSpsc, 2u);
+    EXPECT_EQ(5u, Queue_SpscPushBatch(&Queue_TestSpsc, values, 6u));
+
+    count = 8u;
+    slot = (u32bit *)Queue_SpscPeek(&Queue_TestSpsc, &count);
+    ASSERT_NE((u32bit *)NULL, slot);
+    EXPECT_EQ(3u, count);
+    EXPECT_EQ(6u, slot[0]);
+    EXPECT_EQ(8u, slot[2]);
+    Queue_SpscRelease(&Queue_TestSpsc, 3u);
+    EXPECT_EQ(5u, Queue_SpscPopBatch(&Queue_TestSpsc, out, 8u));
+    EXPECT_EQ(1u, out[0]);
+    EXPECT_EQ(5u, out[4]);
+}
+
+TEST(Queue, MpscClaimIsClampedToTheFreeSlots)
+{
+    u32bit values[QUEUE_TEST_CAPACITY + 4u];
+    u32bit out[QUEUE_TEST_CAPACITY];
+    u32bit pos;
+    u32bit i;
+
+    for (i = 0u; i < (QUEUE_TEST_CAPACITY + 4u); i++)
+    {
+        values[i] = 100u + i;
+    }
+    ASSERT_TRUE(Queue_MpscInit(&Queue_TestMpsc, Queue_TestMpsc_Buffer, Queue_TestMpsc_Seq, sizeof(u32bit),
+                               QUEUE_TEST_CAPACITY));
+    EXPECT_EQ(5u, Queue_MpscPushBatch(&Queue_TestMpsc, values, 5u));
+    EXPECT_EQ(3u, Queue_MpscPushBatch(&Queue_TestMpsc, &values[5], 5u));
+    EXPECT_EQ(0u, Queue_MpscClaim(&Queue_TestMpsc, 1u, &pos));
+    EXPECT_EQ(NULL, Queue_MpscReserve(&Queue_TestMpsc, &pos));
+
+    /*After the consumer made room the full request is granted again*/
+    EXPECT_EQ(4u, Queue_MpscPopBatch(&Queue_TestMpsc, out, 4u));
+    EXPECT_EQ(100u, out[0]);
+    EXPECT_EQ(4u, Queue_MpscPushBatch(&Queue_TestMpsc, &values[8], 4u));
+    EXPECT_EQ(QUEUE_TEST_CAPACITY, Queue_MpscPopBatch(&Queue_TestMpsc, out, QUEUE_TEST_CAPACITY));
+    EXPECT_EQ(104u, out[0]);
+    EXPECT_EQ(107u, out[3]);
+    EXPECT_EQ(108u, out[4]);
+    EXPECT_EQ(111u, out[7]);
+}
+
+TEST(Queue, MpscUncommittedSlotBlocksTheConsumer)
+{
+    u32bit value = 1u;
+    u32bit out;
+    u32bit pos;
+    u32bit * slot;
+
+    ASSERT_TRUE(Queue_MpscInit(&Queue_TestMpsc, Queue_TestMpsc_Buffer, Queue_TestMpsc_Seq, sizeof(u32bit),
+                               QUEUE_TEST_CAPACITY));
+    slot = (u32bit *)Queue_MpscReserve(&Queue_TestMpsc, &pos);
+    ASSERT_NE((u32bit *)NULL, slot);
+    EXPECT_TRUE(Queue_MpscPush(&Queue_TestMpsc, &value));
+    EXPECT_FALSE(Queue_MpscPop(&Queue_TestMpsc, &out));
+    *slot = 42u;
+    Queue_MpscCommit(&Queue_TestMpsc, pos);
+    ASSERT_TRUE(Queue_MpscPop(&Queue_TestMpsc, &out));
+    EXPECT_EQ(42u, out);
+    ASSERT_TRUE(Queue_MpscPop(&Queue_TestMpsc, &out));
+    EXPECT_EQ(1u, out);
+}
+
+TEST(Queue, SpscThreadedStressKeepsOrder)
+{
+    pthread_t producer;
+    u32bit expected = 1u;
+    u32bit out[7];
+    u32bit count;
+    u32bit i;
+
+    ASSERT_TRUE(Queue_SpscInit(&Queue_TestSpscStress, Queue_TestSpscBuffer, sizeof(u32bit), 64u));
+    ASSERT_EQ(0, pthread_create(&producer, NULL, Queue_TestSpscProducer, NULL));
+    while (expected <= QUEUE_TEST_MESSAGES)
+    {
+        count = Queue_SpscPopBatch(&Queue_TestSpscStress, out, 1u + (expected % 7u));
+        for (i = 0u; i < count; i++)
+        {
+            ASSERT_EQ(expected, out[i]);
+            expected++;
+        }
+        if (count == 0u)
+        {
+            (void)sched_yield();
+        }
+    }
+    (void)pthread_join(producer, NULL);
+    EXPECT_EQ(0u, Queue_SpscCount(&Queue_TestSpscStress));
+}
+
+TEST(Queue, MpscThreadedStressDeliversEveryProducerInOrder)
+{
+    pthread_t producers[QUEUE_TEST_PRODUCERS];
+    u32bit expected[QUEUE_TEST_PRODUCERS];
+    u32bit received = 0u;
+    u32bit out[5];
+    u32bit count;
+    u32bit id;
+    u32bit i;
+
+    ASSERT_TRUE(Queue_MpscInit(&Queue_TestMpscStress, Queue_TestMpscBuffer, Queue_TestMpscSeq, sizeof(u32bit), 64u));
+    for (id = 0u; id < QUEUE_TEST_PRODUCERS; id++)
+    {
+        expected[id] = 1u;
+        ASSERT_EQ(0, pthread_create(&producers[id], NULL, Queue_TestMpscProducer, (void *)(uaddr)id));
+    }
+    while (received < QUEUE_TEST_MESSAGES)
+    {
+        count = Queue_MpscPopBatch(&Queue_TestMpscStress, out, 5u);
+        for (i = 0u; i < count; i++)
+        {
+            id = out[i] >> 24u;
+            ASSERT_LT(id, QUEUE_TEST_PRODUCERS);
+            ASSERT_EQ(expected[id], out[i] & 0x00FFFFFFu) << "producer " << id;
+            expected[id]++;
+        }
+        received += count;
+        if (count == 0u)
+        {
+            (void)sched_yield();
+        }
+    }
+    for (id = 0u; id < QUEUE_TEST_PRODUCERS; id++)
+    {
+        (void)pthread_join(producers[id], NULL);
+    }
+    EXPECT_FALSE(Queue_MpscPop(&Queue_TestMpscStress, out));
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-006   | 17-Oct-2026 | First version of Queue_Test.cpp                                              |
+***********************************************************************************************************************/
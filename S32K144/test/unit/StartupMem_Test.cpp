@@ -0,0 +1,285 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: StartupMem_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \StartupMem_Test.cpp
+    Startup memory engine: word/burst copy and clear against memcpy/memset for every size up to 3 bursts and
+    every source/destination alignment, bytes around the area untouched, stack painting and its high-water scan.
+    Compressed init image: hand made LIT/ZERO/MATCH streams, round trip of representative sections through the
+    packer of tools/InitPack and whole images through StartupMem_UnpackImage.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+#include "HostTool.h"
+extern "C" {
+#include "Startup_Mem.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define STARTUP_MEM_TEST_GUARD              (16u)
+#define STARTUP_MEM_TEST_MAX_SIZE           (3u * STARTUP_MEM_BURST_WORDS * 4u + 7u)
+#define STARTUP_MEM_TEST_AREA               (STARTUP_MEM_TEST_MAX_SIZE + (2u * STARTUP_MEM_TEST_GUARD))
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+/*
+ * Fill an area with a pattern that differs for every byte and every seed.
+ */
+static void StartupMem_TestFill(u8bit * area, u32bit size, u8bit seed)
+{
+    u32bit i;
+
+    for (i = 0u; i < size; i++)
+    {
+        area[i] = (u8bit)((i * 7u) + seed);
+    }
+}
+
+/*
+ * .data like section: records of small integers, pointers, flags and zero padding, a string table.
+ */
+static std::vector<u8bit> StartupMem_TestDataSection(u32bit records)
+{
+    std::vector<u8bit> data;
+    u32bit i;
+    u32bit field;
+
+    for (i = 0u; i < records; i++)
+    {
+        const u32bit words[8] = { i, 0u, 0x20000000u + (i * 32u), (i % 3u) * 100u, 0u, 0u, 0x3F800000u, i & 1u };
+
+        for (field = 0u; field < 8u; field++)
+        {
+            data.push_back((u8bit)words[field]);
+            data.push_back((u8bit)(words[field] >> 8u));
+            data.push_back((u8bit)(words[field] >> 16u));
+            data.push_back((u8bit)(words[field] >> 24u));
+        }
+    }
+    for (i = 0u; i < records; i++)
+    {
+        const char * name = ((i % 2u) == 0u) ? "Task_10ms" : "Rte_Signal";
+
+        data.insert(data.end(), name, name + strlen(name) + 1u);
+    }
+    return data;
+}
+
+/*
+ * Pack raw with the tool, unpack with the target decoder, the whole stream must be consumed.
+ */
+static void StartupMem_TestRoundTrip(const std::vector<u8bit> & raw)
+{
+    std::vector<u8bit> packed = HostTool_InitPack(raw);
+    std::vector<u8bit> unpacked(raw.size() + STARTUP_MEM_TEST_GUARD, 0xEEu);
+    const u8bit * end;
+
+    ASSERT_FALSE(packed.empty()) << "init_pack.py failed";
+    end = StartupMem_Unpack(unpacked.data(), packed.data(), (u32bit)raw.size());
+    EXPECT_EQ(packed.data() + packed.size(), end);
+    EXPECT_EQ(0, memcmp(raw.data(), unpacked.data(), raw.size()));
+    EXPECT_EQ(0xEEu, unpacked[raw.size()]);
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(StartupMem, CopyMatchesMemcpyForEverySizeAndAlignment)
+{
+    alignas(4) u8bit src[STARTUP_MEM_TEST_AREA];
+    alignas(4) u8bit dst[STARTUP_MEM_TEST_AREA];
+    alignas(4) u8bit expected[STARTUP_MEM_TEST_AREA];
+    u32bit size;
+    u32bit srcOffset;
+    u32bit dstOffset;
+
+    StartupMem_TestFill(src, sizeof(src), 1u);
+    for (size = 0u; size <= STARTUP_MEM_TEST_MAX_SIZE; size++)
+    {
+        for (srcOffset = 0u; srcOffset < 4u; srcOffset++)
+        {
+            for (dstOffset = 0u; dstOffset < 4u; dstOffset++)
+            {
+                StartupMem_TestFill(dst, sizeof(dst), 0x55u);
+                StartupMem_TestFill(expected, sizeof(expected), 0x55u);
+                memcpy(&expected[STARTUP_MEM_TEST_GUARD + dstOffset], &src[srcOffset], size);
+                StartupMem_Copy(&dst[STARTUP_MEM_TEST_GUARD + dstOffset], &src[srcOffset], size);
+                ASSERT_EQ(0, memcmp(expected, dst, sizeof(dst)))
+                    << "size " << size << " src +" << srcOffset << " dst +" << dstOffset;
+            }
+        }
+    }
+}
+
+TEST(StartupMem, ZeroMatchesMemsetForEverySizeAndAlignment)
+{
+    alignas(4) u8bit dst[STARTUP_MEM_TEST_AREA];
+    alignas(4) u8bit expected[STARTUP_MEM_TEST_AREA];
+    u32bit size;
+    u32bit offset;
+
+    for (size = 0u; size <= STARTUP_MEM_TEST_MAX_SIZE; size++)
+    {
+        for (offset = 0u; offset < 4u; offset++)
+        {
+            StartupMem_TestFill(dst, sizeof(dst), 0xA5u);
+            StartupMem_TestFill(expected, sizeof(expected), 0xA5u);
+            memset(&expected[STARTUP_MEM_TEST_GUARD + offset], 0, size);
+            StartupMem_Zero(&dst[STARTUP_MEM_TEST_GUARD + offset], size);
+            ASSERT_EQ(0, memcmp(expected, dst, sizeof(dst))) << "size " << size << " dst +" << offset;
+        }
+    }
+}
+
+TEST(StartupMem, PaintedWordsAreUnusedUntilOverwritten)
+{
+    u32bit stack[64];
+
+    StartupMem_Paint(stack, 64u);
+    EXPECT_EQ(64u, StartupMem_Unused(stack, 64u));
+    stack[63] = 0u;
+    EXPECT_EQ(63u, StartupMem_Unused(stack, 64u));
+    stack[20] = STARTUP_MEM_STACK_PATTERN + 1u;
+    EXPECT_EQ(20u, StartupMem_Unused(stack, 64u));
+    stack[0] = 0u;
+    EXPECT_EQ(0u, StartupMem_Unused(stack, 64u));
+}
+
+TEST(StartupMem, UnpackLiteralZeroAndMatchTokens)
+{
+    /*"abc", 5 zeros, 4 bytes from 8 back*/
+    const u8bit stream[] = { 0x02u, 'a', 'b', 'c', 0x44u, 0x81u, 0x08u, 0x00u };
+    const u8bit expected[] = { 'a', 'b', 'c', 0u, 0u, 0u, 0u, 0u, 'a', 'b', 'c', 0u };
+    u8bit out[sizeof(expected) + 1u];
+
+    memset(out, 0xEE, sizeof(out));
+    EXPECT_EQ(&stream[sizeof(stream)], StartupMem_Unpack(out, stream, sizeof(expected)));
+    EXPECT_EQ(0, memcmp(expected, out, sizeof(expected)));
+    EXPECT_EQ(0xEEu, out[sizeof(expected)]);
+}
+
+TEST(StartupMem, UnpackOverlappingMatchRepeatsPattern)
+{
+    /*"xy" then 7 bytes from 2 back: overlapping copy extends the pattern*/
+    const u8bit stream[] = { 0x01u, 'x', 'y', 0x84u, 0x02u, 0x00u };
+    u8bit out[9];
+
+    StartupMem_Unpack(out, stream, sizeof(out));
+    EXPECT_EQ(0, memcmp("xyxyxyxyx", out, sizeof(out)));
+}
+
+TEST(StartupMem, UnpackExtendedLength)
+{
+    /*200 zeros: 63 in the control byte + LEB128 136, then a 70 byte literal: 63 + 6*/
+    std::vector<u8bit> stream = { 0x7Fu, 0x88u, 0x01u, 0x3Fu, 0x06u };
+    std::vector<u8bit> out(270u + 1u, 0xEEu);
+    u32bit i;
+
+    for (i = 0u; i < 70u; i++)
+    {
+        stream.push_back((u8bit)(i + 1u));
+    }
+    EXPECT_EQ(stream.data() + stream.size(), StartupMem_Unpack(out.data(), stream.data(), 270u));
+    for (i = 0u; i < 200u; i++)
+    {
+        ASSERT_EQ(0u, out[i]) << i;
+    }
+    for (i = 0u; i < 70u; i++)
+    {
+        ASSERT_EQ(i + 1u, out[200u + i]) << i;
+    }
+    EXPECT_EQ(0xEEu, out[270]);
+}
+
+TEST(StartupMem, UnpackStopsAtReservedToken)
+{
+    const u8bit stream[] = { 0x00u, 'a', 0xC5u, 0x00u };
+    u8bit out[8];
+
+    memset(out, 0xEE, sizeof(out));
+    (void)StartupMem_Unpack(out, stream, 4u);
+    EXPECT_EQ('a', out[0]);
+    EXPECT_EQ(0xEEu, out[4]);
+}
+
+TEST(StartupMem, PackerRoundTripOfRepresentativeSections)
+{
+    std::vector<u8bit> random(4096u);
+    std::vector<u8bit> zeros(8192u, 0u);
+    u32bit seed = 12345u;
+
+    for (u8bit & byte : random)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        byte = (u8bit)(seed >> 16u);
+    }
+    StartupMem_TestRoundTrip(StartupMem_TestDataSection(64u));
+    StartupMem_TestRoundTrip(HostTool_ImageSample(8192, 8192u));
+    StartupMem_TestRoundTrip(random);
+    StartupMem_TestRoundTrip(zeros);
+    StartupMem_TestRoundTrip(std::vector<u8bit>(1u, 0x5Au));
+}
+
+TEST(StartupMem, UnpackImageFillsBothSections)
+{
+    std::vector<u8bit> data = StartupMem_TestDataSection(16u);
+    std::vector<u8bit> code = HostTool_ImageSample(8192, 1000u);
+    std::vector<u8bit> dataPacked = HostTool_InitPack(data);
+    std::vector<u8bit> codePacked = HostTool_InitPack(code);
+    std::vector<u32bit> image;
+    std::vector<u8bit> dataRam(data.size());
+    std::vector<u8bit> codeRam(code.size(), 0xEEu);
+
+    /*magic, then per section raw size, packed size and the stream padded to a word*/
+    image.push_back(STARTUP_MEM_IMAGE_MAGIC);
+    image.push_back((u32bit)data.size());
+    image.push_back((u32bit)dataPacked.size());
+    image.resize(image.size() + ((dataPacked.size() + 3u) / 4u));
+    memcpy(&image[3], dataPacked.data(), dataPacked.size());
+    image.push_back((u32bit)code.size());
+    image.push_back((u32bit)codePacked.size());
+    image.resize(image.size() + ((codePacked.size() + 3u) / 4u));
+    memcpy(&image[image.size() - ((codePacked.size() + 3u) / 4u)], codePacked.data(), codePacked.size());
+
+    EXPECT_FALSE(StartupMem_UnpackImage((const u8bit *)image.data(), dataRam.data(), (u32bit)data.size(),
+                                        codeRam.data(), (u32bit)code.size() + 4u));
+    EXPECT_EQ(0xEEu, codeRam[0]);
+    ASSERT_TRUE(StartupMem_UnpackImage((const u8bit *)image.data(), dataRam.data(), (u32bit)data.size(),
+                                       codeRam.data(), (u32bit)code.size()));
+    EXPECT_EQ(data, dataRam);
+    EXPECT_EQ(code, codeRam);
+}
+
+TEST(StartupMem, HostBuildHasNoMainStack)
+{
+    EXPECT_EQ(0u, StartupMem_MainStackSize());
+    EXPECT_EQ(0u, StartupMem_MainStackUnused());
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-001   | 17-Oct-2026 | First version of StartupMem_Test.cpp                                         |
+ *| CMARTI  |  user-002   | 17-Oct-2026 | Compressed init image decoder and packer round trip                          |
+***********************************************************************************************************************/
@@ -0,0 +1,208 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: StartupWarm_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \StartupWarm_Test.cpp
+    Warm-boot record of the host build, where the NO_INIT block is the record alone: sealing and
+    validation, the warm start counter, the crash context of StartupWarm_SaveFault and the image CRC the
+    bootloader hands over to the application.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstring>
+#include <gtest/gtest.h>
+extern "C" {
+#include "Startup_Warm.h"
+#include "Crc.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Image CRC the bootloader checked, any non zero value*/
+#define STARTUP_WARM_TEST_APP_CRC           (0x5EA1ED01uL)
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+/*
+ * Power on: the block holds whatever the SRAM powered up with, then the cold start of StartupWarm_Init.
+ */
+static void StartupWarm_TestPowerOn(void)
+{
+    memset(&StartupWarm_Record, 0x5A, sizeof(StartupWarm_Record));
+    ASSERT_FALSE(StartupWarm_Init(RCM_SRS_POR_MASK));
+}
+
+/*
+ * CRC-32 of the record the way StartupWarm_Seal computes it, with the Crc service.
+ */
+static u32bit StartupWarm_TestCrc(void)
+{
+    return Crc_CalculateCRC32((const u8bit *)&StartupWarm_Record + sizeof(u32bit),
+                              (u32bit)sizeof(StartupWarm_Record) - (u32bit)sizeof(u32bit), 0u, TRUE);
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(StartupWarm, ColdStartSealsANewRecord)
+{
+    StartupWarm_TestPowerOn();
+    EXPECT_FALSE(StartupWarm_IsWarm());
+    EXPECT_EQ(STARTUP_WARM_MAGIC, StartupWarm_Record.magic);
+    EXPECT_EQ(sizeof(StartupWarm_Record), StartupWarm_Record.size);
+    EXPECT_EQ(STARTUP_WARM_LAYOUT, StartupWarm_Record.layout);
+    EXPECT_EQ(RCM_SRS_POR_MASK, StartupWarm_Record.resetCause);
+    EXPECT_EQ(0u, StartupWarm_Record.warmResets);
+    EXPECT_EQ(0u, StartupWarm_Record.appCrc);
+    EXPECT_EQ(0u, StartupWarm_Record.requested);
+    EXPECT_EQ(0u, StartupWarm_Record.crash.valid);
+    EXPECT_EQ(StartupWarm_TestCrc(), StartupWarm_Record.crc);
+}
+
+TEST(StartupWarm, OnlyASealedRecordOfThisLayoutSurvivesAWarmReset)
+{
+    static const u32bit warmCauses[] = { RCM_SRS_SW_MASK, RCM_SRS_WDOG_MASK, RCM_SRS_LOCKUP_MASK };
+
+    for (u32bit cause : warmCauses)
+    {
+        StartupWarm_TestPowerOn();
+        StartupWarm_Record.crash.bfar = 0x20001000uL;
+        StartupWarm_Seal();
+        EXPECT_TRUE(StartupWarm_Init(cause)) << cause;
+        EXPECT_TRUE(StartupWarm_IsWarm()) << cause;
+        EXPECT_EQ(0x20001000uL, StartupWarm_Record.crash.bfar) << cause;
+        EXPECT_EQ(cause, StartupWarm_Record.resetCause);
+        EXPECT_EQ(StartupWarm_TestCrc(), StartupWarm_Record.crc) << cause;
+    }
+
+    /* Written after the last seal */
+    StartupWarm_Record.crash.bfar = 0x20002000uL;
+    EXPECT_FALSE(StartupWarm_Init(RCM_SRS_SW_MASK));
+    EXPECT_EQ(0u, StartupWarm_Record.crash.bfar);
+
+    /* Another application version, or a broken magic */
+    StartupWarm_Record.layout = STARTUP_WARM_LAYOUT + 1u;
+    StartupWarm_Seal();
+    EXPECT_FALSE(StartupWarm_Init(RCM_SRS_SW_MASK));
+    EXPECT_EQ(STARTUP_WARM_LAYOUT, StartupWarm_Record.layout);
+    StartupWarm_Record.magic = 0u;
+    StartupWarm_Seal();
+    EXPECT_FALSE(StartupWarm_Init(RCM_SRS_SW_MASK));
+    EXPECT_EQ(STARTUP_WARM_MAGIC, StartupWarm_Record.magic);
+
+    /* A size outside the block is not sealed at all */
+    StartupWarm_Record.size = (u32bit)sizeof(StartupWarm_Record) + 4u;
+    StartupWarm_Seal();
+    EXPECT_FALSE(StartupWarm_Init(RCM_SRS_SW_MASK));
+    EXPECT_EQ(sizeof(StartupWarm_Record), StartupWarm_Record.size);
+
+    /* Valid record, cold reset cause */
+    StartupWarm_Record.crash.bfar = 0x20001000uL;
+    StartupWarm_Seal();
+    EXPECT_FALSE(StartupWarm_Init(RCM_SRS_PIN_MASK));
+    EXPECT_FALSE(StartupWarm_IsWarm());
+    EXPECT_EQ(0u, StartupWarm_Record.crash.bfar);
+}
+
+TEST(StartupWarm, WarmResetsCountUntilHealthy)
+{
+    StartupWarm_TestPowerOn();
+    EXPECT_TRUE(StartupWarm_Init(RCM_SRS_WDOG_MASK));
+    EXPECT_EQ(1u, StartupWarm_Record.warmResets);
+
+    /* ECU reset: the request is for the bootloader, the application start clears it */
+    StartupWarm_Record.requested = 1u;
+    StartupWarm_Seal();
+    EXPECT_TRUE(StartupWarm_Init(RCM_SRS_SW_MASK));
+    EXPECT_EQ(2u, StartupWarm_Record.warmResets);
+    EXPECT_EQ(0u, StartupWarm_Record.requested);
+    EXPECT_TRUE(StartupWarm_Init(RCM_SRS_LOCKUP_MASK));
+    EXPECT_EQ(3u, StartupWarm_Record.warmResets);
+
+    StartupWarm_Healthy();
+    EXPECT_EQ(0u, StartupWarm_Record.warmResets);
+    EXPECT_TRUE(StartupWarm_Init(RCM_SRS_SW_MASK));
+    EXPECT_EQ(1u, StartupWarm_Record.warmResets);
+
+    EXPECT_FALSE(StartupWarm_Init(RCM_SRS_POR_MASK));
+    EXPECT_EQ(0u, StartupWarm_Record.warmResets);
+}
+
+TEST(StartupWarm, SaveFaultKeepsTheCrashContextAcrossTheReset)
+{
+    const u32bit frame[STARTUP_WARM_FRAME_WORDS] = { 1u, 2u, 3u, 4u, 12u, 0x00000411uL, 0x00000500uL, 0x01000000uL };
+    u32bit i;
+
+    StartupWarm_TestPowerOn();
+    S32_SCB->CFSR = 0x00008200uL;
+    S32_SCB->HFSR = 0x40000000uL;
+    S32_SCB->MMFAR = 0xE000EDF8uL;
+    S32_SCB->BFAR = 0x3FFFFFF0uL;
+    StartupWarm_SaveFault(frame, 0xFFFFFFFDuL);
+    S32_SCB->CFSR = 0u;
+    S32_SCB->HFSR = 0u;
+    S32_SCB->MMFAR = 0u;
+    S32_SCB->BFAR = 0u;
+
+    EXPECT_TRUE(StartupWarm_Init(RCM_SRS_SW_MASK));
+    EXPECT_EQ(STARTUP_WARM_MAGIC, StartupWarm_Record.crash.valid);
+    EXPECT_EQ((u32bit)(uaddr)frame, StartupWarm_Record.crash.sp);
+    EXPECT_EQ(0xFFFFFFFDuL, StartupWarm_Record.crash.excReturn);
+    EXPECT_EQ(0x00008200uL, StartupWarm_Record.crash.cfsr);
+    EXPECT_EQ(0x40000000uL, StartupWarm_Record.crash.hfsr);
+    EXPECT_EQ(0xE000EDF8uL, StartupWarm_Record.crash.mmfar);
+    EXPECT_EQ(0x3FFFFFF0uL, StartupWarm_Record.crash.bfar);
+
+    /* The host stack is not in the SRAM of the device, as after a stack overflow the frame is not read */
+    for (i = 0u; i < STARTUP_WARM_FRAME_WORDS; i++)
+    {
+        EXPECT_EQ(0u, StartupWarm_Record.crash.frame[i]) << i;
+    }
+}
+
+TEST(StartupWarm, ColdStartOfTheApplicationKeepsTheImageCrcOfTheBootloader)
+{
+    /* Bootloader after power on: cold start, then Boot_AppValid records the image CRC */
+    StartupWarm_TestPowerOn();
+    StartupWarm_Record.appCrc = STARTUP_WARM_TEST_APP_CRC;
+    StartupWarm_Seal();
+
+    /* Application of the same start: RCM SRS still reads power on */
+    EXPECT_FALSE(StartupWarm_Init(RCM_SRS_POR_MASK));
+    EXPECT_EQ(STARTUP_WARM_TEST_APP_CRC, StartupWarm_Record.appCrc);
+    EXPECT_EQ(0u, StartupWarm_Record.warmResets);
+    EXPECT_EQ(StartupWarm_TestCrc(), StartupWarm_Record.crc);
+
+    /* First fault reset: the bootloader finds the CRC for its fast path, the application counts the start */
+    EXPECT_TRUE(StartupWarm_Init(RCM_SRS_LOCKUP_MASK));
+    EXPECT_EQ(STARTUP_WARM_TEST_APP_CRC, StartupWarm_Record.appCrc);
+    EXPECT_EQ(1u, StartupWarm_Record.warmResets);
+
+    /* A record that is not sealed hands nothing over */
+    StartupWarm_Record.appCrc = STARTUP_WARM_TEST_APP_CRC + 1u;
+    EXPECT_FALSE(StartupWarm_Init(RCM_SRS_POR_MASK));
+    EXPECT_EQ(0u, StartupWarm_Record.appCrc);
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-024   | 17-Oct-2026 | First version of StartupWarm_Test.cpp                                        |
+***********************************************************************************************************************/
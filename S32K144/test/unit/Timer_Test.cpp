@@ -0,0 +1,315 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Timer_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Timer_Test.cpp
+    Timer: start/stop, expiry order within one tick, cascading across the wheel levels, periodic reload,
+    timeouts beyond the wheel range and TIMER_MODE_DEFERRED callbacks delivered from PendSV (Irq bottom half)
+    after the tick that expired them.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <gtest/gtest.h>
+extern "C" {
+#include "Core_CM4.h"
+#include "Irq.h"
+#include "Timer.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+/*Ticks covered by each wheel level and longest timeout placed directly*/
+#define TIMER_TEST_LEVEL_TICKS(level)       (1uL << (TIMER_CFG_SLOT_BITS * (level)))
+#define TIMER_TEST_RANGE                    TIMER_TEST_LEVEL_TICKS(TIMER_CFG_LEVELS)
+#define TIMER_TEST_MAX_ORDER                (32u)
+
+/*Expiries seen by one timer*/
+typedef struct
+{
+    u32bit id;
+    u32bit fired;
+    u32bit lastTick;
+} Timer_TestRecordType;
+
+/*                                                      Variables                                                    */
+/*********************************************************************************************************************/
+static u32bit Timer_TestOrder[TIMER_TEST_MAX_ORDER];
+static u32bit Timer_TestOrderCount;
+
+/*                                                  Private functions                                                */
+/*********************************************************************************************************************/
+
+static void Timer_TestCallback(void * arg)
+{
+    Timer_TestRecordType * record = (Timer_TestRecordType *)arg;
+
+    record->fired++;
+    record->lastTick = Timer_GetTickCount();
+    if (Timer_TestOrderCount < TIMER_TEST_MAX_ORDER)
+    {
+        Timer_TestOrder[Timer_TestOrderCount] = record->id;
+    }
+    Timer_TestOrderCount++;
+}
+
+/*
+ * Periodic timer that stops itself at its third expiry.
+ */
+static void Timer_TestStopThird(void * arg)
+{
+    Timer_Type * timer = (Timer_Type *)arg;
+    static u32bit count;
+
+    count++;
+    if (count == 3u)
+    {
+        Timer_Stop(timer);
+        count = 0u;
+    }
+}
+
+/*
+ * ticks calls of Timer_Tick, with the tick masked as in an ISR so the wheel lock costs no system call.
+ */
+static void Timer_TestTicks(u32bit ticks)
+{
+    DISABLE_INTERRUPTS();
+    while (ticks != 0u)
+    {
+        Timer_Tick();
+        ticks--;
+    }
+    ENABLE_INTERRUPTS();
+}
+
+static void Timer_TestStart(void)
+{
+    Timer_Init();
+    Timer_TestOrderCount = 0u;
+}
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Timer, StartStopAndRestart)
+{
+    Timer_Type timer;
+    Timer_TestRecordType record = { 1u, 0u, 0u };
+
+    Timer_TestStart();
+    Timer_Setup(&timer, Timer_TestCallback, &record, TIMER_MODE_TICK);
+    EXPECT_EQ(FALSE, Timer_IsActive(&timer));
+
+    Timer_Start(&timer, 3u, 0u);
+    EXPECT_EQ(TRUE, Timer_IsActive(&timer));
+    Timer_TestTicks(2u);
+    EXPECT_EQ(0u, record.fired);
+    Timer_TestTicks(1u);
+    EXPECT_EQ(1u, record.fired);
+    EXPECT_EQ(3u, record.lastTick);
+    EXPECT_EQ(FALSE, Timer_IsActive(&timer));
+
+    Timer_Start(&timer, 5u, 0u);
+    Timer_TestTicks(4u);
+    Timer_Stop(&timer);
+    EXPECT_EQ(FALSE, Timer_IsActive(&timer));
+    Timer_TestTicks(10u);
+    EXPECT_EQ(1u, record.fired);
+
+    /* A restart replaces the running timeout, 0 behaves like 1 */
+    Timer_Start(&timer, 10u, 0u);
+    Timer_TestTicks(5u);
+    Timer_Start(&timer, 0u, 0u);
+    Timer_TestTicks(1u);
+    EXPECT_EQ(2u, record.fired);
+    Timer_TestTicks(20u);
+    EXPECT_EQ(2u, record.fired);
+}
+
+TEST(Timer, SameTickExpiriesRunInTheOrderTheyReachedLevel0)
+{
+    Timer_Type timers[4];
+    Timer_TestRecordType records[4] = { { 0u, 0u, 0u }, { 1u, 0u, 0u }, { 2u, 0u, 0u }, { 3u, 0u, 0u } };
+    u32bit i;
+
+    Timer_TestStart();
+    for (i = 0u; i < 4u; i++)
+    {
+        Timer_Setup(&timers[i], Timer_TestCallback, &records[i], TIMER_MODE_TICK);
+    }
+    /* Started together in one slot: start order */
+    Timer_Start(&timers[2], 10u, 0u);
+    Timer_Start(&timers[0], 10u, 0u);
+    Timer_Start(&timers[3], 10u, 0u);
+    Timer_TestTicks(10u);
+    ASSERT_EQ(3u, Timer_TestOrderCount);
+    EXPECT_EQ(2u, Timer_TestOrder[0]);
+    EXPECT_EQ(0u, Timer_TestOrder[1]);
+    EXPECT_EQ(3u, Timer_TestOrder[2]);
+
+    /* 0 and 2 start in level 1, 1 and 3 later in level 0 on the same tick: the cascade appends 0 and 2 */
+    Timer_TestStart();
+    Timer_Start(&timers[0], 200u, 0u);
+    Timer_Start(&timers[2], 200u, 0u);
+    Timer_TestTicks(150u);
+    Timer_Start(&timers[1], 50u, 0u);
+    Timer_Start(&timers[3], 50u, 0u);
+    Timer_TestTicks(49u);
+    EXPECT_EQ(0u, Timer_TestOrderCount);
+    Timer_TestTicks(1u);
+    ASSERT_EQ(4u, Timer_TestOrderCount);
+    EXPECT_EQ(1u, Timer_TestOrder[0]);
+    EXPECT_EQ(3u, Timer_TestOrder[1]);
+    EXPECT_EQ(0u, Timer_TestOrder[2]);
+    EXPECT_EQ(2u, Timer_TestOrder[3]);
+    for (i = 0u; i < 4u; i++)
+    {
+        EXPECT_EQ(200u, records[i].lastTick);
+    }
+}
+
+TEST(Timer, CascadedTimersExpireOnTheirTickAtEveryLevelBoundary)
+{
+    Timer_Type timers[3u * (TIMER_CFG_LEVELS - 1u)];
+    Timer_TestRecordType records[3u * (TIMER_CFG_LEVELS - 1u)];
+    u32bit ticks[3u * (TIMER_CFG_LEVELS - 1u)];
+    u32bit level;
+    u32bit i;
+
+    Timer_TestStart();
+    /* One tick before, on and after the first tick of every upper level */
+    for (level = 1u; level < TIMER_CFG_LEVELS; level++)
+    {
+        for (i = 0u; i < 3u; i++)
+        {
+            const u32bit n = (3u * (level - 1u)) + i;
+
+            ticks[n] = TIMER_TEST_LEVEL_TICKS(level) + i - 1u;
+            records[n] = { n, 0u, 0u };
+            Timer_Setup(&timers[n], Timer_TestCallback, &records[n], TIMER_MODE_TICK);
+            Timer_Start(&timers[n], ticks[n], 0u);
+        }
+    }
+    Timer_TestTicks(TIMER_TEST_LEVEL_TICKS(TIMER_CFG_LEVELS - 1u) + 2u);
+    for (i = 0u; i < (3u * (TIMER_CFG_LEVELS - 1u)); i++)
+    {
+        EXPECT_EQ(1u, records[i].fired) << ticks[i];
+        EXPECT_EQ(ticks[i], records[i].lastTick) << ticks[i];
+    }
+    EXPECT_EQ(3u * (TIMER_CFG_LEVELS - 1u), Timer_TestOrderCount);
+}
+
+TEST(Timer, PeriodicTimerReloadsFromItsExpiryTick)
+{
+    Timer_Type timer;
+    Timer_Type self;
+    Timer_TestRecordType record = { 1u, 0u, 0u };
+    u32bit i;
+
+    Timer_TestStart();
+    Timer_Setup(&timer, Timer_TestCallback, &record, TIMER_MODE_TICK);
+    Timer_Start(&timer, 3u, 7u);
+    for (i = 0u; i < 100u; i++)
+    {
+        Timer_TestTicks(7u);
+        EXPECT_EQ(i + 1u, record.fired);
+        EXPECT_EQ(3u + (7u * i), record.lastTick);
+    }
+    Timer_Stop(&timer);
+
+    /* Stopped from its own callback: no reload */
+    Timer_Setup(&self, Timer_TestStopThird, &self, TIMER_MODE_TICK);
+    Timer_Start(&self, 1u, 1u);
+    Timer_TestTicks(3u);
+    EXPECT_EQ(FALSE, Timer_IsActive(&self));
+
+    /* Period longer than one level */
+    Timer_Start(&timer, 1u, TIMER_TEST_LEVEL_TICKS(2u) + 1u);
+    record.fired = 0u;
+    Timer_TestTicks(1u + (3u * (TIMER_TEST_LEVEL_TICKS(2u) + 1u)));
+    EXPECT_EQ(4u, record.fired);
+    EXPECT_EQ(Timer_GetTickCount(), record.lastTick);
+    Timer_Stop(&timer);
+}
+
+TEST(Timer, TimeoutsBeyondTheWheelRangeExpireExactly)
+{
+    Timer_Type timers[2];
+    Timer_TestRecordType records[2] = { { 0u, 0u, 0u }, { 1u, 0u, 0u } };
+    const u32bit ticks[2] = { TIMER_TEST_RANGE + 1000u, (2u * TIMER_TEST_RANGE) + 3u };
+    u32bit i;
+
+    Timer_TestStart();
+    for (i = 0u; i < 2u; i++)
+    {
+        Timer_Setup(&timers[i], Timer_TestCallback, &records[i], TIMER_MODE_TICK);
+        Timer_Start(&timers[i], ticks[i], 0u);
+    }
+    Timer_TestTicks(ticks[0] - 1u);
+    EXPECT_EQ(0u, records[0].fired);
+    Timer_TestTicks(1u);
+    EXPECT_EQ(1u, records[0].fired);
+    Timer_TestTicks(ticks[1] - ticks[0] - 1u);
+    EXPECT_EQ(0u, records[1].fired);
+    Timer_TestTicks(1u);
+    EXPECT_EQ(1u, records[1].fired);
+    EXPECT_EQ(ticks[1], records[1].lastTick);
+}
+
+TEST(Timer, DeferredCallbacksRunFromPendSVAfterTheTick)
+{
+    Timer_Type tick;
+    Timer_Type deferred;
+    Timer_Type dropped;
+    Timer_TestRecordType records[3] = { { 0u, 0u, 0u }, { 1u, 0u, 0u }, { 2u, 0u, 0u } };
+
+    ASSERT_EQ(TRUE, Irq_Init());
+    Irq_RunBottomHalves();
+    Timer_TestStart();
+    Timer_Setup(&deferred, Timer_TestCallback, &records[1], TIMER_MODE_DEFERRED);
+    Timer_Setup(&tick, Timer_TestCallback, &records[0], TIMER_MODE_TICK);
+    Timer_Setup(&dropped, Timer_TestCallback, &records[2], TIMER_MODE_DEFERRED);
+    Timer_Start(&deferred, 2u, 0u);
+    Timer_Start(&tick, 2u, 0u);
+    Timer_Start(&dropped, 2u, 0u);
+
+    /* Tick from an interrupt: the deferred callbacks wait for PendSV, the tick ones do not */
+    DISABLE_INTERRUPTS();
+    Timer_Tick();
+    Timer_Tick();
+    EXPECT_EQ(1u, records[0].fired);
+    EXPECT_EQ(0u, records[1].fired);
+    EXPECT_EQ(TRUE, Timer_IsActive(&deferred));
+    EXPECT_NE(0u, S32_SCB->ICSR & S32_SCB_ICSR_PENDSVSET_MASK);
+    Timer_Stop(&dropped);
+    ENABLE_INTERRUPTS();
+
+    ASSERT_EQ(2u, Timer_TestOrderCount);
+    EXPECT_EQ(0u, Timer_TestOrder[0]);
+    EXPECT_EQ(1u, Timer_TestOrder[1]);
+    EXPECT_EQ(1u, records[1].fired);
+    EXPECT_EQ(0u, records[2].fired);
+    EXPECT_EQ(FALSE, Timer_IsActive(&deferred));
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-016   | 17-Oct-2026 | First version of Timer_Test.cpp                                              |
+***********************************************************************************************************************/
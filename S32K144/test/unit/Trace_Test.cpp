@@ -0,0 +1,293 @@
+/*********************************************************************************************************************/
+/*                                                     BSW GROUP                                                     */
+/*********************************************************************************************************************/
+/*                                               OBJECT SPECIFICATION                                                */
+/*********************************************************************************************************************/
+/*!
+ * $Source: Trace_Test.cpp $
+ * $Revision: Version 1.0 $
+ * $Author: Carlos Martinez $
+ * $Date: 2026-10-17 $
+ */
+/*********************************************************************************************************************/
+/* DESCRIPTION :                                                                                                     */
+/** \Trace_Test.cpp
+    Event trace recorder (make HOST=1 TRACE=1 test, skipped otherwise): ring wraparound, lap tags of claimed
+    but unwritten slots and timestamp unwrapping as tools/TraceView decodes them, and concurrent writers
+    claiming slots with the compare and swap (real atomics on the host) without losing an event or
+    breaking time order.
+ */
+/*********************************************************************************************************************/
+/* ALL RIGHTS RESERVED                                                                                               */
+/*                                                                                                                   */
+/* The reproduction, transmission, or use of this document or its content is                                         */
+/* not permitted without express written authority. Offenders will be liable                                         */
+/* for damages.                                                                                                      */
+/*********************************************************************************************************************/
+/*                                                       Includes                                                    */
+/*********************************************************************************************************************/
+#include <cstring>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <gtest/gtest.h>
+#include "HostTool.h"
+extern "C" {
+#include "Trace.h"
+}
+
+/*                                                Constants and types                                                */
+/*********************************************************************************************************************/
+#define TRACE_TEST_THREADS                  (4u)
+
+#if (TRACE_CFG_ENABLED == 1u)
+/*Events of every writer, the counter fits the 16 bit data*/
+#define TRACE_TEST_PER_THREAD               (32768u)
+
+/*Event decoded by tools/TraceView: unwrapped time, type, id, data*/
+typedef struct
+{
+    s64bit time;
+    u32bit type;
+    u32bit id;
+    u32bit data;
+} Trace_TestEventType;
+
+/*                                                  Private functions                                                  */
+/*********************************************************************************************************************/
+
+/*
+ * Trace_Buffer decoded by trace_view.decode, skipped slots in *skipped. Empty with *skipped ~0 when the tool failed.
+ */
+static std::vector<Trace_TestEventType> Trace_TestDecode(u32bit * skipped)
+{
+    std::vector<u8bit> raw(sizeof(Trace_Buffer));
+    std::vector<u8bit> out;
+    std::vector<Trace_TestEventType> events;
+    u32bit count;
+    u32bit i;
+
+    memcpy(raw.data(), (const void *)&Trace_Buffer, sizeof(Trace_Buffer));
+    out = HostTool_Python("TraceView",
+                          "import struct\n"
+                          "from trace_view import decode\n"
+                          "(clock, events, skipped) = decode(open(sys.argv[1], 'rb').read())\n"
+                          "out = struct.pack('<II', len(events), skipped)\n"
+                          "for (time, etype, eid, data) in events:\n"
+                          "    out += struct.pack('<qIII', time, etype, eid, data)\n"
+                          "open(sys.argv[2], 'wb').write(out)\n", raw);
+    *skipped = ~0u;
+    if (out.size() >= 8u)
+    {
+        memcpy(&count, &out[0], 4u);
+        memcpy(skipped, &out[4], 4u);
+        events.resize(count);
+        for (i = 0u; (i < count) && (out.size() >= (8u + ((i + 1u) * 20u))); i++)
+        {
+            memcpy(&events[i].time, &out[8u + (i * 20u)], 8u);
+            memcpy(&events[i].type, &out[16u + (i * 20u)], 4u);
+            memcpy(&events[i].id, &out[20u + (i * 20u)], 4u);
+            memcpy(&events[i].data, &out[24u + (i * 20u)], 4u);
+        }
+    }
+    return events;
+}
+
+/*
+ * Marker writer: id is the thread, data its own event counter, a yield now and then to shuffle the writers.
+ */
+static void * Trace_TestWriter(void * arg)
+{
+    const u32bit id = (u32bit)(uaddr)arg;
+    u32bit n;
+
+    for (n = 0u; n < TRACE_TEST_PER_THREAD; n++)
+    {
+        Trace_Record(TRACE_EVENT_MARK, id, n);
+        if ((n % 64u) == id)
+        {
+            (void)sched_yield();
+        }
+    }
+    return NULL;
+}
+#endif
+
+/*                                                        Tests                                                      */
+/*********************************************************************************************************************/
+
+TEST(Trace, RingKeepsTheLastEventsAcrossWraparound)
+{
+#if (TRACE_CFG_ENABLED == 1u)
+    const u32bit total = (3u * TRACE_EVENTS) + 5u;
+    std::vector<Trace_TestEventType> events;
+    u32bit skipped;
+    u32bit n;
+
+    Trace_Init();
+    EXPECT_EQ(TRACE_MAGIC, Trace_Buffer.magic);
+    EXPECT_EQ(TRACE_EVENTS, Trace_Buffer.events);
+    for (n = 0u; n < total; n++)
+    {
+        Trace_Record(TRACE_EVENT_MARK, 1u, n);
+    }
+    ASSERT_EQ(total, Trace_Buffer.index);
+
+    /* Slot n % TRACE_EVENTS holds the latest event n, tagged with its lap */
+    for (n = total - TRACE_EVENTS; n < total; n++)
+    {
+        ASSERT_EQ(TRACE_INFO(TRACE_EVENT_MARK, n, 1u, n), Trace_Buffer.event[n & (TRACE_EVENTS - 1u)].info) << n;
+    }
+
+    events = Trace_TestDecode(&skipped);
+    EXPECT_EQ(0u, skipped);
+    ASSERT_EQ(TRACE_EVENTS, events.size());
+    for (n = 0u; n < TRACE_EVENTS; n++)
+    {
+        EXPECT_EQ(total - TRACE_EVENTS + n, events[n].data) << n;
+        EXPECT_EQ((u32bit)TRACE_EVENT_MARK, events[n].type);
+        EXPECT_EQ(1u, events[n].id);
+    }
+
+    /* Stopped, the trace points leave the buffer alone */
+    Trace_Stop();
+    Trace_Record(TRACE_EVENT_MARK, 1u, 0u);
+    EXPECT_EQ(total, Trace_Buffer.index);
+    Trace_Start();
+    Trace_Record(TRACE_EVENT_MARK, 1u, 0u);
+    EXPECT_EQ(total + 1u, Trace_Buffer.index);
+#else
+    GTEST_SKIP() << "make HOST=1 TRACE=1 test";
+#endif
+}
+
+TEST(Trace, LapTagsSkipSlotsClaimedButNotWritten)
+{
+#if (TRACE_CFG_ENABLED == 1u)
+    std::vector<Trace_TestEventType> events;
+    u32bit skipped;
+    u32bit n;
+
+    Trace_Init();
+    for (n = 0u; n < (2u * TRACE_EVENTS); n++)
+    {
+        Trace_Record(TRACE_EVENT_MARK, 0u, n);
+    }
+
+    /* Three writers interrupted between their claim and their stores: the slots still hold lap 1 events */
+    Trace_Buffer.index += 3u;
+    Trace_Record(TRACE_EVENT_MARK, 0u, 0xAAAAu);
+
+    events = Trace_TestDecode(&skipped);
+    EXPECT_EQ(3u, skipped);
+    ASSERT_EQ(TRACE_EVENTS - 3u, events.size());
+    for (n = 0u; n < (TRACE_EVENTS - 4u); n++)
+    {
+        EXPECT_EQ(TRACE_EVENTS + 4u + n, events[n].data) << n;
+    }
+    EXPECT_EQ(0xAAAAu, events.back().data);
+
+    /* A buffer never filled: empty slots are skipped as well */
+    Trace_Init();
+    Trace_Record(TRACE_EVENT_MARK, 0u, 1u);
+    Trace_Buffer.index += 1u;
+    events = Trace_TestDecode(&skipped);
+    EXPECT_EQ(1u, skipped);
+    EXPECT_EQ(1u, events.size());
+#else
+    GTEST_SKIP() << "make HOST=1 TRACE=1 test";
+#endif
+}
+
+TEST(Trace, TimestampsUnwrapAcrossTheCounterOverflow)
+{
+#if (TRACE_CFG_ENABLED == 1u)
+    static const u32bit times[4] = { 0xFFFFFF00u, 0xFFFFFFF0u, 0x00000010u, 0x00000100u };
+    std::vector<Trace_TestEventType> events;
+    u32bit skipped;
+    u32bit n;
+
+    Trace_Init();
+    Trace_Stop();
+    for (n = 0u; n < 4u; n++)
+    {
+        Trace_Buffer.event[n].time = times[n];
+        Trace_Buffer.event[n].info = TRACE_INFO(TRACE_EVENT_MARK, n, 0u, n);
+    }
+    Trace_Buffer.index = 4u;
+    events = Trace_TestDecode(&skipped);
+    EXPECT_EQ(0u, skipped);
+    ASSERT_EQ(4u, events.size());
+    EXPECT_EQ(0, events[0].time);
+    EXPECT_EQ(0xF0, events[1].time);
+    EXPECT_EQ(0x110, events[2].time);
+    EXPECT_EQ(0x200, events[3].time);
+#else
+    GTEST_SKIP() << "make HOST=1 TRACE=1 test";
+#endif
+}
+
+TEST(Trace, ConcurrentWritersLoseNoEventAndKeepTimeOrder)
+{
+#if (TRACE_CFG_ENABLED == 1u)
+    pthread_t threads[TRACE_TEST_THREADS];
+    u32bit next[TRACE_TEST_THREADS] = {};
+    u32bit seen[TRACE_TEST_THREADS] = {};
+    const u32bit total = TRACE_TEST_THREADS * TRACE_TEST_PER_THREAD;
+    u32bit lastTime = 0u;
+    u32bit index;
+    u32bit info;
+    u32bit id;
+    u32bit i;
+
+    Trace_Init();
+    for (i = 0u; i < TRACE_TEST_THREADS; i++)
+    {
+        ASSERT_EQ(0, pthread_create(&threads[i], NULL, Trace_TestWriter, (void *)(uaddr)i));
+    }
+    for (i = 0u; i < TRACE_TEST_THREADS; i++)
+    {
+        (void)pthread_join(threads[i], NULL);
+    }
+
+    /* Every claim counted once */
+    ASSERT_EQ(total, Trace_Buffer.index);
+
+    /* The ring holds the last TRACE_EVENTS claims, all written, in time order. The events of one writer are
+       consecutive ones of its counter, up to its last */
+    for (index = total - TRACE_EVENTS; index < total; index++)
+    {
+        const Trace_EventType * event = &Trace_Buffer.event[index & (TRACE_EVENTS - 1u)];
+
+        info = event->info;
+        id = (info >> 16) & 0xFFu;
+        ASSERT_EQ(TRACE_INFO(TRACE_EVENT_MARK, index, id, info), info) << index;
+        ASSERT_LT(id, TRACE_TEST_THREADS);
+        if (seen[id] != 0u)
+        {
+            EXPECT_EQ(next[id], info & 0xFFFFu) << "writer " << id << " index " << index;
+        }
+        next[id] = (info & 0xFFFFu) + 1u;
+        seen[id]++;
+        if (index != (total - TRACE_EVENTS))
+        {
+            EXPECT_GE((s32bit)(event->time - lastTime), 0) << index;
+        }
+        lastTime = event->time;
+    }
+    for (i = 0u; i < TRACE_TEST_THREADS; i++)
+    {
+        if (seen[i] != 0u)
+        {
+            EXPECT_EQ(TRACE_TEST_PER_THREAD, next[i]) << "writer " << i;
+        }
+    }
+#else
+    GTEST_SKIP() << "make HOST=1 TRACE=1 test";
+#endif
+}
+
+/***************************************************Log Projects********************************************************
+ *|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ *| CMARTI  |  user-025   | 17-Oct-2026 | First version of Trace_Test.cpp                                              |
+***********************************************************************************************************************/
@@ -0,0 +1,387 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: com_gen.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# com_gen.py
+#    CAN signal codec generator. Reads the signal database (src/BSW/Services/Com/Com_Cfg.json) and writes
+#    Com.h / Com.c with one signal structure and one Com_Pack_<frame> / Com_Unpack_<frame> pair per frame.
+#    The codecs work on the two payload words: Intel signals on the words as loaded (little endian),
+#    Motorola signals on the words byte reversed with REV_BYTES_32 (big endian). Every signal is then a
+#    shift and a constant mask of one word, or of both words when it crosses bit 32, fixed at generation
+#    time: no bit loops, no signal tables.
+#    Before writing, the word plan of every signal is checked against a bit by bit DBC reference codec on
+#    random values, and the signals of a frame must not overlap nor exceed its DLC.
+#
+#    Frame description:
+#      "name"      C name, the frame is exported as Com_<name>Type, Com_Pack_<name>, Com_Unpack_<name>
+#      "id"        CAN identifier (number or "0x..." string), exported as COM_ID_<name>
+#      "dlc"       payload length 1..8, exported as COM_DLC_<name>
+#      "signals"   [{"name", "start", "length" 1..32, "order" "intel" | "motorola", "signed" (default false)}]
+#                  start is the DBC start bit: LSB for Intel, MSB for Motorola, bit b of byte n is 8 * n + b
+#    Values are raw, scaling and offset stay with the application.
+#
+#    usage: com_gen.py Com_Cfg.json <output directory>
+########################################################################################################################
+import json
+import os
+import random
+import re
+import sys
+
+C_NAME = re.compile(r'^[A-Za-z_][A-Za-z0-9_]*$')
+PAYLOAD_BYTES = 8             # Com_PayloadType
+JIRA = 'user-021'
+DATE = '17-Oct-2026'
+CHECK_VALUES = 256            # random values checked per signal
+
+# Payload word variables of the generated code, by byte order: (bits 0..31, bits 32..63) of the 64 bit container
+WORDS = {'intel': ('le0', 'le1'), 'motorola': ('be1', 'be0')}
+
+
+class Signal:
+    def __init__(self, frame, cfg):
+        for key in ('name', 'start', 'length', 'order'):
+            if key not in cfg:
+                raise ValueError('%s: signal %s missing "%s"' % (frame, cfg.get('name', '?'), key))
+        self.name = cfg['name']
+        self.start = int(cfg['start'])
+        self.length = int(cfg['length'])
+        self.order = cfg['order']
+        self.signed = bool(cfg.get('signed', False))
+        if not C_NAME.match(self.name):
+            raise ValueError('%s: signal %s is not a C identifier' % (frame, self.name))
+        if self.order not in WORDS or not (1 <= self.length <= 32) or not (0 <= self.start < 8 * PAYLOAD_BYTES):
+            raise ValueError('%s.%s: bad order, start or length' % (frame, self.name))
+        self.bits = self.walk()
+        self.mask = (1 << self.length) - 1
+        # Position of the signal LSB in the 64 bit container of its byte order
+        if self.order == 'intel':
+            self.pos = self.start
+        else:
+            self.pos = 8 * (7 - self.start // 8) + self.start % 8 - self.length + 1
+        if self.pos < 0 or self.pos + self.length > 64:
+            raise ValueError('%s.%s: signal leaves the payload' % (frame, self.name))
+        width = 8 if self.length <= 8 else (16 if self.length <= 16 else 32)
+        self.ctype = '%s%dbit' % ('s' if self.signed else 'u', width)
+
+    def walk(self):
+        # DBC bit numbering, payload bit positions from the signal LSB to its MSB
+        if self.order == 'intel':
+            return [self.start + i for i in range(self.length)]
+        bits = []
+        bit = self.start
+        for _ in range(self.length):
+            bits.append(bit)
+            bit = bit + 15 if (bit % 8) == 0 else bit - 1
+        return bits[::-1]
+
+
+class Frame:
+    def __init__(self, cfg):
+        for key in ('name', 'id', 'dlc', 'signals'):
+            if key not in cfg:
+                raise ValueError('frame %s: missing "%s"' % (cfg.get('name', '?'), key))
+        self.name = cfg['name']
+        self.id = int(cfg['id'], 0) if isinstance(cfg['id'], str) else int(cfg['id'])
+        self.dlc = int(cfg['dlc'])
+        if not C_NAME.match(self.name) or not (1 <= self.dlc <= PAYLOAD_BYTES):
+            raise ValueError('frame %s: bad name or dlc' % self.name)
+        self.signals = [Signal(self.name, s) for s in cfg['signals']]
+        used = {}
+        for sig in self.signals:
+            for bit in sig.bits:
+                if bit >= 8 * self.dlc:
+                    raise ValueError('%s.%s: bit %d beyond dlc %d' % (self.name, sig.name, bit, self.dlc))
+                if bit in used:
+                    raise ValueError('%s.%s overlaps %s at bit %d' % (self.name, sig.name, used[bit], bit))
+                used[bit] = sig.name
+        if len(set(s.name for s in self.signals)) != len(self.signals):
+            raise ValueError('frame %s: duplicated signal name' % self.name)
+        self.orders = sorted(set(s.order for s in self.signals))
+
+
+# Reference codec, bit by bit on the payload bytes like a generic DBC codec
+def ref_pack(sig, payload, value):
+    for (i, bit) in enumerate(sig.bits):
+        if (value >> i) & 1:
+            payload[bit // 8] |= 1 << (bit % 8)
+
+
+def ref_unpack(sig, payload):
+    return sum(((payload[bit // 8] >> (bit % 8)) & 1) << i for (i, bit) in enumerate(sig.bits))
+
+
+# Word plan emulation, the operations of the generated code
+def container(payload, order):
+    le0 = int.from_bytes(bytes(payload[0:4]), 'little')
+    le1 = int.from_bytes(bytes(payload[4:8]), 'little')
+    if order == 'intel':
+        return (le0, le1)
+    return (int.from_bytes(bytes(payload[4:8]), 'big'), int.from_bytes(bytes(payload[0:4]), 'big'))
+
+
+def word_unpack(sig, payload):
+    (lo, hi) = container(payload, sig.order)
+    if sig.pos >= 32:
+        raw = hi >> (sig.pos - 32)
+    elif sig.pos + sig.length <= 32:
+        raw = lo >> sig.pos
+    else:
+        raw = (lo >> sig.pos) | ((hi << (32 - sig.pos)) & 0xFFFFFFFF)
+    return raw & sig.mask
+
+
+def word_pack(sig, value):
+    (lo, hi) = (0, 0)
+    if sig.pos >= 32:
+        hi = value << (sig.pos - 32)
+    elif sig.pos + sig.length <= 32:
+        lo = value << sig.pos
+    else:
+        lo = (value << sig.pos) & 0xFFFFFFFF
+        hi = value >> (32 - sig.pos)
+    if sig.order == 'intel':
+        return list(lo.to_bytes(4, 'little') + hi.to_bytes(4, 'little'))
+    return list(hi.to_bytes(4, 'big') + lo.to_bytes(4, 'big'))
+
+
+def check(frames):
+    rng = random.Random(21)
+    names = set()
+    for frame in frames:
+        if frame.name in names:
+            raise ValueError('frame %s defined twice' % frame.name)
+        names.add(frame.name)
+        for sig in frame.signals:
+            for value in [0, sig.mask] + [rng.getrandbits(sig.length) for _ in range(CHECK_VALUES)]:
+                ref = [0] * PAYLOAD_BYTES
+                ref_pack(sig, ref, value)
+                noise = [rng.getrandbits(8) for _ in range(PAYLOAD_BYTES)]
+                for bit in sig.bits:
+                    noise[bit // 8] &= ~(1 << (bit % 8))
+                    noise[bit // 8] |= ref[bit // 8] & (1 << (bit % 8))
+                if word_pack(sig, value) != ref or word_unpack(sig, noise) != value or ref_unpack(sig, noise) != value:
+                    raise ValueError('%s.%s: word codec differs from the reference' % (frame.name, sig.name))
+
+
+def banner(name, description):
+    lines = ['/' + '*' * 117 + '/',
+             '/*' + 'BSW GROUP'.center(115) + '*/',
+             '/' + '*' * 117 + '/',
+             '/*' + 'OBJECT SPECIFICATION'.center(115) + '*/',
+             '/' + '*' * 117 + '/',
+             '/*!',
+             ' * $Source: %s $' % name,
+             ' * $Revision: Version 1.0 $',
+             ' * $Author: Carlos Martinez $',
+             ' * $Date: 2026-10-17 $',
+             ' */',
+             '/' + '*' * 117 + '/',
+             '/* DESCRIPTION :'.ljust(117) + '*/',
+             '/** \\%s' % name]
+    lines += ['    ' + d for d in description]
+    lines += [' */',
+              '/' + '*' * 117 + '/',
+              '/* ALL RIGHTS RESERVED'.ljust(117) + '*/',
+              '/*'.ljust(117) + '*/',
+              '/* The reproduction, transmission, or use of this document or its content is'.ljust(117) + '*/',
+              '/* not permitted without express written authority. Offenders will be liable'.ljust(117) + '*/',
+              '/* for damages.'.ljust(117) + '*/',
+              '/' + '*' * 117 + '/']
+    return lines
+
+
+# Section banners as written by hand in the BSW sources
+SECTIONS = {
+    'Includes':
+        ('/*                                                       Includes                                                    */',
+         '/*********************************************************************************************************************/'),
+    'Constants and types':
+        ('/*                                                Constants and types                                                */',
+         '/*********************************************************************************************************************/'),
+    'Exported Variables':
+        ('/*                                                    Exported Variables                                              */',
+         '/**********************************************************************************************************************/'),
+    'Exported functions prototypes':
+        ('/*                                              Exported functions prototypes                                         */',
+         '/**********************************************************************************************************************/'),
+    'Variables':
+        ('/*                                                      Variables                                                    */',
+         '/*********************************************************************************************************************/'),
+    'External functions implementation':
+        ('/*                                           External functions implementation                                       */',
+         '/*********************************************************************************************************************/'),
+}
+
+
+def section(title):
+    return [''] + list(SECTIONS[title])
+
+
+def log_table(name):
+    return ['',
+            '/***************************************************Log Projects' + '*' * 56,
+            ' *|    ID   | JIRA Ticket |     Date    |                                Description                                   |',
+            ' *| CMARTI  |  %s   | %s | %s|' % (JIRA, DATE, ('Generated %s' % name).ljust(77)),
+            '*' * 119 + '/']
+
+
+def hexmask(length):
+    return '0x%Xu' % ((1 << length) - 1)
+
+
+def used_words(sig):
+    (lo, hi) = WORDS[sig.order]
+    if sig.pos >= 32:
+        return [hi]
+    if sig.pos + sig.length <= 32:
+        return [lo]
+    return [lo, hi]
+
+
+def shifted(expr, op, amount, bare=False):
+    text = expr if amount == 0 else '%s %s %d' % (expr, op, amount)
+    return text if (bare or amount == 0) else '(%s)' % text
+
+
+def gen_header(frames):
+    out = banner('Com.h', ['CAN signal codecs, generated by tools/ComGen/com_gen.py from Com_Cfg.json. Do not edit.',
+                           'Com_Pack_<frame> writes the whole payload (unused bits 0), Com_Unpack_<frame> reads every',
+                           'signal of it. Signal values are raw.'])
+    out += ['#ifndef COM_H_', '#define COM_H_']
+    out += section('Includes')[1:] + ['#include "Std_Types.h"', '#include "Core_CM4.h"']
+    out += section('Constants and types')
+    out += ['/*CAN payload, word aligned for the codecs*/',
+            'typedef union',
+            '{',
+            '    u8bit  bytes[%du];' % PAYLOAD_BYTES,
+            '    u32bit words[%du];' % (PAYLOAD_BYTES // 4),
+            '} Com_PayloadType;']
+    for frame in frames:
+        out += ['', '/*%s*/' % frame.name,
+                '#define COM_ID_%s%s(0x%03Xu)' % (frame.name, ' ' * max(1, 26 - len(frame.name)), frame.id),
+                '#define COM_DLC_%s%s(%du)' % (frame.name, ' ' * max(1, 25 - len(frame.name)), frame.dlc),
+                '',
+                'typedef struct',
+                '{']
+        for sig in frame.signals:
+            out.append('    %-7s%s;%s/*%s %d|%d%s*/' % (sig.ctype, sig.name, ' ' * max(1, 28 - len(sig.name)),
+                                                     'Motorola' if sig.order == 'motorola' else 'Intel',
+                                                     sig.start, sig.length, ', signed' if sig.signed else ''))
+        out.append('} Com_%sType;' % frame.name)
+    out += section('Exported Variables')
+    out += section('Exported functions prototypes')
+    for frame in frames:
+        out += ['extern void Com_Pack_%s(const Com_%sType * signals, Com_PayloadType * payload);' % (frame.name, frame.name),
+                'extern void Com_Unpack_%s(const Com_PayloadType * payload, Com_%sType * signals);' % (frame.name, frame.name),
+                '']
+    out += ['#endif /* COM_H_ */']
+    out += log_table('Com.h')
+    return out
+
+
+def gen_pack(frame):
+    words = sorted(set(w for s in frame.signals for w in used_words(s)))
+    out = ['', 'void Com_Pack_%s(const Com_%sType * signals, Com_PayloadType * payload)' % (frame.name, frame.name), '{']
+    out += ['    u32bit %s = 0u;' % w for w in words]
+    both = any(w.startswith('le') for w in words) and any(w.startswith('be') for w in words)
+    out += ['    u32bit raw;'] + (['    u32bit swapped;'] if both else []) + ['']
+    for sig in frame.signals:
+        (lo, hi) = WORDS[sig.order]
+        value = '(u32bit)(s32bit)signals->%s' % sig.name if sig.signed else '(u32bit)signals->%s' % sig.name
+        out.append('    raw = %s & %s;' % (value, hexmask(sig.length)) if sig.length < 32 else '    raw = %s;' % value)
+        if sig.pos >= 32:
+            out.append('    %s |= %s;' % (hi, shifted('raw', '<<', sig.pos - 32, True)))
+        elif sig.pos + sig.length <= 32:
+            out.append('    %s |= %s;' % (lo, shifted('raw', '<<', sig.pos, True)))
+        else:
+            out.append('    %s |= %s;' % (lo, shifted('raw', '<<', sig.pos, True)))
+            out.append('    %s |= %s;' % (hi, shifted('raw', '>>', 32 - sig.pos, True)))
+    out.append('')
+    for n in range(2):
+        (le, be) = ('le%d' % n, 'be%d' % n)
+        if le in words and be in words:
+            out += ['    REV_BYTES_32(%s, swapped);' % be, '    payload->words[%du] = %s | swapped;' % (n, le)]
+        elif be in words:
+            out.append('    REV_BYTES_32(%s, payload->words[%du]);' % (be, n))
+        elif le in words:
+            out.append('    payload->words[%du] = %s;' % (n, le))
+        else:
+            out.append('    payload->words[%du] = 0u;' % n)
+    out.append('}')
+    return out
+
+
+def gen_unpack(frame):
+    words = sorted(set(w for s in frame.signals for w in used_words(s)))
+    out = ['', 'void Com_Unpack_%s(const Com_PayloadType * payload, Com_%sType * signals)' % (frame.name, frame.name), '{']
+    out += ['    u32bit %s;' % w for w in words] + ['']
+    for w in words:
+        if w.startswith('be'):
+            out.append('    REV_BYTES_32(payload->words[%su], %s);' % (w[2], w))
+        else:
+            out.append('    %s = payload->words[%su];' % (w, w[2]))
+    out.append('')
+    for sig in frame.signals:
+        (lo, hi) = WORDS[sig.order]
+        if sig.pos >= 32:
+            raw = shifted(hi, '>>', sig.pos - 32)
+            exact = sig.pos + sig.length == 64
+        elif sig.pos + sig.length <= 32:
+            raw = shifted(lo, '>>', sig.pos)
+            exact = sig.pos + sig.length == 32
+        else:
+            raw = '(%s | (%s << %d))' % (shifted(lo, '>>', sig.pos), hi, 32 - sig.pos)
+            exact = sig.pos + sig.length == 64
+        if not exact:
+            raw = '(%s & %s)' % (raw, hexmask(sig.length))
+        if sig.signed and sig.length < 32:
+            sign = '0x%Xu' % (1 << (sig.length - 1))
+            out.append('    signals->%s = (%s)((s32bit)(%s ^ %s) - (s32bit)%s);' % (sig.name, sig.ctype, raw, sign, sign))
+        else:
+            out.append('    signals->%s = (%s)%s;' % (sig.name, sig.ctype, raw))
+    out.append('}')
+    return out
+
+
+def gen_source(frames):
+    out = banner('Com.c', ['CAN signal codecs, generated by tools/ComGen/com_gen.py from Com_Cfg.json. Do not edit.'])
+    out += section('Includes') + ['#include "Com.h"']
+    out += section('Constants and types')
+    out += section('Variables')
+    out += section('External functions implementation')
+    for frame in frames:
+        out += gen_pack(frame)
+        out += gen_unpack(frame)
+    out += log_table('Com.c')
+    return out
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write('usage: com_gen.py <Com_Cfg.json> <output directory>\n')
+        return 1
+
+    with open(argv[1]) as f:
+        frames = [Frame(cfg) for cfg in json.load(f)['frames']]
+    check(frames)
+
+    for (name, lines) in (('Com.h', gen_header(frames)), ('Com.c', gen_source(frames))):
+        with open(os.path.join(argv[2], name), 'w', newline='\n') as f:
+            f.write('\n'.join(lines) + '\n')
+
+    print('%d frames, %d signals generated' % (len(frames), sum(len(f.signals) for f in frames)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-021   | 17-Oct-2026 | First version of com_gen.py                                                  |
+########################################################################################################################
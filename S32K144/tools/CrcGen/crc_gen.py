@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: crc_gen.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# crc_gen.py
+#    CRC table generator. Writes Crc_Tables.c, the slicing tables of the Crc service (src/BSW/Services/Crc):
+#      Crc_Table32[k][n]   CRC-32 (IEEE 802.3, reflected 0xEDB88320) of byte n followed by k zero bytes
+#      Crc_Table16[k][n]   CRC-16/CCITT-FALSE (0x1021, not reflected) of byte n followed by k zero bytes
+#    Table 0 is the classic byte table, slice-by-4 uses tables 0..3 and slice-by-8 all of them.
+#    Before writing, the slice-by-4/8 steps of Crc.c are emulated here with the new tables and compared with a
+#    bit by bit reference on the check string "123456789" and random buffers (CRC-32 also with zlib).
+#
+#    usage: crc_gen.py <output directory>
+########################################################################################################################
+import os
+import random
+import sys
+import zlib
+
+SLICES = 8                    # CRC_SLICES
+POLY32 = 0xEDB88320           # CRC_POLY32_REFLECTED
+POLY16 = 0x1021               # CRC_POLY16
+CHECK32 = 0xCBF43926          # CRC-32 of "123456789"
+CHECK16 = 0x29B1              # CRC-16/CCITT-FALSE of "123456789"
+JIRA = 'user-020'
+DATE = '17-Oct-2026'
+RANDOM_BUFFERS = 200          # random buffers compared per CRC
+
+
+def bitwise32(crc, data):
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ (POLY32 if (crc & 1) else 0)
+    return crc
+
+
+def bitwise16(crc, data):
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ (POLY16 if (crc & 0x8000) else 0)) & 0xFFFF
+    return crc
+
+
+def tables32():
+    table = [[bitwise32(n, [0]) for n in range(256)]]
+    for k in range(1, SLICES):
+        table.append([(table[k - 1][n] >> 8) ^ table[0][table[k - 1][n] & 0xFF] for n in range(256)])
+    return table
+
+
+def tables16():
+    table = [[bitwise16(n << 8, [0]) for n in range(256)]]
+    for k in range(1, SLICES):
+        table.append([((table[k - 1][n] << 8) & 0xFFFF) ^ table[0][table[k - 1][n] >> 8] for n in range(256)])
+    return table
+
+
+def slice32(table, slices, crc, data):
+    # Crc_Update32Slice4/8: whole blocks of slices bytes, the tail byte by byte
+    end = len(data) - len(data) % slices
+    for i in range(0, end, slices):
+        block = list(data[i:i + slices])
+        for j in range(4):
+            block[j] ^= (crc >> (8 * j)) & 0xFF
+        crc = 0
+        for j in range(slices):
+            crc ^= table[slices - 1 - j][block[j]]
+    for byte in data[end:]:
+        crc = (crc >> 8) ^ table[0][(crc ^ byte) & 0xFF]
+    return crc
+
+
+def slice16(table, slices, crc, data):
+    # Crc_Update16Slice4/8
+    end = len(data) - len(data) % slices
+    for i in range(0, end, slices):
+        block = list(data[i:i + slices])
+        block[0] ^= crc >> 8
+        block[1] ^= crc & 0xFF
+        crc = 0
+        for j in range(slices):
+            crc ^= table[slices - 1 - j][block[j]]
+    for byte in data[end:]:
+        crc = ((crc << 8) & 0xFFFF) ^ table[0][(crc >> 8) ^ byte]
+    return crc
+
+
+def check(t32, t16):
+    rng = random.Random(20)
+    buffers = [b'123456789'] + [bytes(rng.randrange(256) for _ in range(rng.randrange(300)))
+                                for _ in range(RANDOM_BUFFERS)]
+    for data in buffers:
+        ref32 = bitwise32(0xFFFFFFFF, data)
+        ref16 = bitwise16(0xFFFF, data)
+        if (ref32 ^ 0xFFFFFFFF) != zlib.crc32(data):
+            raise ValueError('CRC-32 bitwise reference differs from zlib')
+        for slices in (4, 8):
+            if slice32(t32, slices, 0xFFFFFFFF, data) != ref32:
+                raise ValueError('CRC-32 slice-by-%d differs on %d bytes' % (slices, len(data)))
+            if slice16(t16, slices, 0xFFFF, data) != ref16:
+                raise ValueError('CRC-16 slice-by-%d differs on %d bytes' % (slices, len(data)))
+    if (bitwise32(0xFFFFFFFF, b'123456789') ^ 0xFFFFFFFF) != CHECK32 or bitwise16(0xFFFF, b'123456789') != CHECK16:
+        raise ValueError('check values differ')
+
+
+def banner(name, description):
+    lines = ['/' + '*' * 117 + '/',
+             '/*' + 'BSW GROUP'.center(115) + '*/',
+             '/' + '*' * 117 + '/',
+             '/*' + 'OBJECT SPECIFICATION'.center(115) + '*/',
+             '/' + '*' * 117 + '/',
+             '/*!',
+             ' * $Source: %s $' % name,
+             ' * $Revision: Version 1.0 $',
+             ' * $Author: Carlos Martinez $',
+             ' * $Date: 2026-10-17 $',
+             ' */',
+             '/' + '*' * 117 + '/',
+             '/* DESCRIPTION :'.ljust(117) + '*/',
+             '/** \\%s' % name]
+    lines += ['    ' + d for d in description]
+    lines += [' */',
+              '/' + '*' * 117 + '/',
+              '/* ALL RIGHTS RESERVED'.ljust(117) + '*/',
+              '/*'.ljust(117) + '*/',
+              '/* The reproduction, transmission, or use of this document or its content is'.ljust(117) + '*/',
+              '/* not permitted without express written authority. Offenders will be liable'.ljust(117) + '*/',
+              '/* for damages.'.ljust(117) + '*/',
+              '/' + '*' * 117 + '/']
+    return lines
+
+
+# Section banners as written by hand in the BSW sources
+SECTIONS = {
+    'Includes':
+        ('/*                                                       Includes                                                    */',
+         '/*********************************************************************************************************************/'),
+    'Constants and types':
+        ('/*                                                Constants and types                                                */',
+         '/*********************************************************************************************************************/'),
+    'Variables':
+        ('/*                                                      Variables                                                    */',
+         '/*********************************************************************************************************************/'),
+}
+
+
+def section(title):
+    return [''] + list(SECTIONS[title])
+
+
+def log_table(name):
+    return ['',
+            '/***************************************************Log Projects' + '*' * 56,
+            ' *|    ID   | JIRA Ticket |     Date    |                                Description                                   |',
+            ' *| CMARTI  |  %s   | %s | %s|' % (JIRA, DATE, ('Generated %s' % name).ljust(77)),
+            '*' * 119 + '/']
+
+
+def gen_table(ctype, name, table, fmt, per_line):
+    out = ['', 'const %s %s[CRC_SLICES][256u] =' % (ctype, name), '{']
+    for (k, row) in enumerate(table):
+        out.append('    {')
+        for i in range(0, 256, per_line):
+            out.append('        ' + ' '.join(fmt % v + ',' for v in row[i:i + per_line]))
+        out[-1] = out[-1][:-1]
+        out.append('    }' + (',' if k != len(table) - 1 else ''))
+    out.append('};')
+    return out
+
+
+def gen_source(t32, t16):
+    out = banner('Crc_Tables.c', ['Slicing tables of the Crc service, generated by tools/CrcGen/crc_gen.py. Do not edit.',
+                                  'Table k holds the CRC of every byte value followed by k zero bytes.'])
+    out += section('Includes') + ['#include "Crc.h"']
+    out += section('Constants and types')
+    out += section('Variables')
+    out += gen_table('u32bit', 'Crc_Table32', t32, '0x%08XuL', 6)
+    out += gen_table('u16bit', 'Crc_Table16', t16, '0x%04Xu', 12)
+    out += log_table('Crc_Tables.c')
+    return out
+
+
+def main(argv):
+    if len(argv) != 2:
+        sys.stderr.write('usage: crc_gen.py <output directory>\n')
+        return 1
+
+    t32 = tables32()
+    t16 = tables16()
+    check(t32, t16)
+
+    with open(os.path.join(argv[1], 'Crc_Tables.c'), 'w', newline='\n') as f:
+        f.write('\n'.join(gen_source(t32, t16)) + '\n')
+    print('Crc_Tables.c: %d bytes of .rodata, check values 0x%08X 0x%04X' % (SLICES * 256 * 6, CHECK32, CHECK16))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-020   | 17-Oct-2026 | First version of crc_gen.py                                                  |
+########################################################################################################################
@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: delta_gen.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# delta_gen.py
+#    Delta update images for the bootloader. Encodes the new application image as copies from the old one
+#    (the image in flash, described by its trailer), fills, LZ matches inside the new image and literals,
+#    in the token format of settings/bootloader/Boot_Delta.h. The bootloader patches in place: sectors are
+#    erased in ascending order, only the last BOOT_CFG_DELTA_WINDOW erased sectors stay in RAM, so copies
+#    only reference old bytes still available when their output is produced. Every delta is decoded by a
+#    mirror of Boot_DeltaDecode and compared with the new image before it is written.
+#
+#    Images are either linked ELF files (flash load bytes from the vector table on, as downloaded) or raw
+#    binaries starting at the application start address (default 0x8000, BOOT_CFG_APP_START).
+#
+#    usage: delta_gen.py <old.elf|old.bin> <new.elf|new.bin> out.delta [application start address]
+########################################################################################################################
+import bisect
+import struct
+import sys
+import zlib
+
+DELTA_MAGIC = 0x41544C44      # "DLTA", BOOT_DELTA_MAGIC
+TOKEN_LIT = 0x00              # BOOT_DELTA_TOKEN_LIT
+TOKEN_FILL = 0x40             # BOOT_DELTA_TOKEN_FILL
+TOKEN_COPY = 0x80             # BOOT_DELTA_TOKEN_COPY
+TOKEN_MATCH = 0xC0            # BOOT_DELTA_TOKEN_MATCH
+LEN_MASK = 0x3F               # BOOT_DELTA_LEN_MASK
+COPY_MIN = 3                  # BOOT_DELTA_COPY_MIN
+MATCH_MIN = 3                 # BOOT_DELTA_MATCH_MIN
+WINDOW = 3                    # BOOT_CFG_DELTA_WINDOW
+SECTOR = 0x1000               # FEATURE_FLS_PF_SECTOR_SIZE
+PHRASE = 8                    # FEATURE_FLS_PF_WRITE_UNIT_SIZE
+FLASH_END = 0x00080000        # BOOT_CFG_APP_END, last sector holds the trailer
+APP_START = 0x00008000        # BOOT_CFG_APP_START
+
+KEY = 4                       # bytes hashed to find match candidates
+CANDIDATES = 8                # old positions tried on each side of the expected source
+MATCH_CHAIN = 16              # latest new image positions tried
+CHUNK = 64                    # bytes compared at once while extending a match
+
+CAN_BITS_PER_FRAME = 125      # 8 byte standard frame with stuffing, for the transfer estimate
+CAN_BITRATE = 500000
+BLOCK_SIZE = 4088             # BOOT_CFG_BLOCK_SIZE
+
+PT_LOAD = 1
+
+
+class Elf32(object):
+    """Minimal little endian ELF32 reader, only the flash load image."""
+
+    def __init__(self, raw):
+        self.raw = raw
+        if self.raw[4] != 1 or self.raw[5] != 1:
+            raise ValueError('not a little endian ELF32 file')
+        self.phoff = struct.unpack_from('<I', self.raw, 0x1C)[0]
+        (self.phentsize, self.phnum) = struct.unpack_from('<HH', self.raw, 0x2A)
+
+    def segments(self):
+        for i in range(self.phnum):
+            (ptype, offset, vaddr, paddr, filesz, memsz, flags, align) = \
+                struct.unpack_from('<8I', self.raw, self.phoff + i * self.phentsize)
+            if ptype == PT_LOAD and filesz != 0 and paddr < FLASH_END:
+                yield offset, paddr, filesz
+
+    def flash_image(self):
+        """(start address, bytes) from the lowest to the highest flash load address, erased value in gaps."""
+        segments = list(self.segments())
+        start = min(paddr for (offset, paddr, filesz) in segments)
+        end = max(paddr + filesz for (offset, paddr, filesz) in segments)
+        image = bytearray(b'\xFF' * (end - start))
+        for (offset, paddr, filesz) in segments:
+            image[paddr - start:paddr - start + filesz] = self.raw[offset:offset + filesz]
+        return start, bytes(image)
+
+
+def read_image(path, start):
+    with open(path, 'rb') as f:
+        raw = f.read()
+    if raw[:4] == b'\x7fELF':
+        return Elf32(raw).flash_image()
+    return start, raw
+
+
+def leb128(value):
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        out.append(byte | (0x80 if value else 0))
+        if not value:
+            return bytes(out)
+
+
+def zigzag(value):
+    return (value << 1) if value >= 0 else ((-value << 1) - 1)
+
+
+def encode_length(token, length):
+    """Control byte plus LEB128 extension when length does not fit the 6 bit field."""
+    if length < LEN_MASK:
+        return bytes([token | length])
+    return bytes([token | LEN_MASK]) + leb128(length - LEN_MASK)
+
+
+def extend(a, ai, b, bi, limit):
+    """Equal bytes of a[ai:] and b[bi:], at most limit."""
+    length = 0
+    while length + CHUNK <= limit and a[ai + length:ai + length + CHUNK] == b[bi + length:bi + length + CHUNK]:
+        length += CHUNK
+    while length < limit and a[ai + length] == b[bi + length]:
+        length += 1
+    return length
+
+
+def copy_limit(pos, source, old_limit):
+    """Bytes from pos a copy of source may produce: old bytes below old_limit, sectors still in flash or in
+    the window. The window only moves at sector starts, so a source more than WINDOW - 1 sectors back ends
+    with the sector."""
+    if source < 0 or source >= old_limit:
+        return 0
+    limit = old_limit - source
+    back = pos - source - (WINDOW - 1) * SECTOR
+    if back > 0:
+        if pos % SECTOR < back:
+            return 0
+        limit = min(limit, SECTOR - pos % SECTOR)
+    return limit
+
+
+class Encoder(object):
+
+    def __init__(self, old, new, old_limit):
+        self.old = old
+        self.new = new
+        self.old_limit = old_limit
+        self.old_index = {}
+        for i in range(old_limit - KEY + 1):
+            self.old_index.setdefault(old[i:i + KEY], []).append(i)
+        self.new_index = {}
+        self.out = bytearray()
+        self.literals = bytearray()
+        self.shift = 0
+        self.stats = {'copy': 0, 'match': 0, 'fill': 0, 'literal': 0}
+
+    def flush_literals(self):
+        while self.literals:
+            chunk = self.literals[:0x10000]
+            self.out += encode_length(TOKEN_LIT, len(chunk) - 1) + chunk
+            del self.literals[:len(chunk)]
+
+    def best(self, pos):
+        """(gain, length, token, argument) of the cheapest encoding of the bytes at pos, None for a literal."""
+        new = self.new
+        remain = len(new) - pos
+        options = []
+
+        run = extend(new, pos, new, pos + 1, remain - 1) + 1 if remain > 1 else 1
+        if run >= 2:
+            options.append((run - len(encode_length(TOKEN_FILL, run - 1)) - 1, run, TOKEN_FILL, new[pos]))
+
+        key = new[pos:pos + KEY]
+        sources = {pos + self.shift}
+        chain = self.old_index.get(key, [])
+        near = bisect.bisect_left(chain, pos + self.shift)
+        sources.update(chain[max(0, near - CANDIDATES):near + CANDIDATES])
+        for source in sources:
+            limit = min(remain, copy_limit(pos, source, self.old_limit))
+            length = extend(self.old, source, new, pos, limit) if limit else 0
+            if length >= COPY_MIN:
+                cost = len(encode_length(TOKEN_COPY, length - COPY_MIN)) + len(leb128(zigzag(source - pos - self.shift)))
+                options.append((length - cost, length, TOKEN_COPY, source - pos))
+
+        for cand in self.new_index.get(key, [])[-MATCH_CHAIN:]:
+            length = extend(new, cand, new, pos, remain)
+            if length >= MATCH_MIN:
+                cost = len(encode_length(TOKEN_MATCH, length - MATCH_MIN)) + len(leb128(pos - cand))
+                options.append((length - cost, length, TOKEN_MATCH, pos - cand))
+
+        choice = max(options) if options else None
+        return choice if choice is not None and choice[0] > 0 else None
+
+    def encode(self):
+        new = self.new
+        pos = 0
+        while pos < len(new):
+            choice = self.best(pos)
+            if choice is None:
+                self.literals.append(new[pos])
+                self.stats['literal'] += 1
+                step = 1
+            else:
+                (gain, step, token, argument) = choice
+                self.flush_literals()
+                if token == TOKEN_FILL:
+                    self.out += encode_length(TOKEN_FILL, step - 1) + bytes([argument])
+                    self.stats['fill'] += step
+                elif token == TOKEN_COPY:
+                    self.out += encode_length(TOKEN_COPY, step - COPY_MIN) + leb128(zigzag(argument - self.shift))
+                    self.shift = argument
+                    self.stats['copy'] += step
+                else:
+                    self.out += encode_length(TOKEN_MATCH, step - MATCH_MIN) + leb128(argument)
+                    self.stats['match'] += step
+            for index in range(pos, min(pos + step, len(new) - KEY + 1)):
+                self.new_index.setdefault(new[index:index + KEY], []).append(index)
+            pos += step
+        self.flush_literals()
+        return bytes(self.out)
+
+
+def decode(delta, old, old_limit, size):
+    """Python mirror of Boot_DeltaDecode, with the same window rule for copies."""
+    out = bytearray()
+    pos = 0
+    shift = 0
+
+    def varint():
+        nonlocal pos
+        value = 0
+        bits = 0
+        while True:
+            byte = delta[pos]
+            pos += 1
+            value += (byte & 0x7F) << bits
+            bits += 7
+            if not byte & 0x80:
+                return value
+
+    while pos < len(delta):
+        control = delta[pos]
+        pos += 1
+        length = control & LEN_MASK
+        if length == LEN_MASK:
+            length += varint()
+        token = control & 0xC0
+        if token == TOKEN_LIT:
+            out += delta[pos:pos + length + 1]
+            pos += length + 1
+        elif token == TOKEN_FILL:
+            out += bytes([delta[pos]]) * (length + 1)
+            pos += 1
+        elif token == TOKEN_COPY:
+            value = varint()
+            shift += (value >> 1) ^ -(value & 1)
+            for _ in range(length + COPY_MIN):
+                source = len(out) + shift
+                if copy_limit(len(out), source, old_limit) == 0:
+                    raise RuntimeError('copy from 0x%X at 0x%X outside the window' % (source, len(out)))
+                out.append(old[source])
+        else:
+            distance = varint()
+            if distance == 0 or distance > len(out):
+                raise RuntimeError('match distance %d at 0x%X' % (distance, len(out)))
+            for _ in range(length + MATCH_MIN):
+                out.append(out[-distance])
+        if len(out) > size:
+            raise RuntimeError('delta output longer than the new image')
+    return bytes(out)
+
+
+def frames(length):
+    """ISO-TP frames of a request of length bytes, single frame up to 7."""
+    return 1 if length <= 7 else 1 + (length - 6 + 6) // 7
+
+
+def report(old, new, delta, stats):
+    full = sum(frames(2 + min(BLOCK_SIZE, len(new) - i)) for i in range(0, len(new), BLOCK_SIZE))
+    part = sum(frames(2 + min(BLOCK_SIZE, len(delta) - i)) for i in range(0, len(delta), BLOCK_SIZE))
+    seconds = CAN_BITS_PER_FRAME / float(CAN_BITRATE)
+    print('DeltaGen: old %d B, new %d B, delta %d B (%.1f %% of the new image, %.1f %% smaller)'
+          % (len(old), len(new), len(delta), 100.0 * len(delta) / len(new), 100.0 - 100.0 * len(delta) / len(new)))
+    print('  new image bytes from  copies %d, matches %d, fills %d, literals %d'
+          % (stats['copy'], stats['match'], stats['fill'], stats['literal']))
+    print('  CAN transfer (%d kbit/s)  full image %d frames %.1f s, delta %d frames %.1f s'
+          % (CAN_BITRATE // 1000, full, full * seconds, part, part * seconds))
+
+
+def main(argv):
+    if len(argv) not in (4, 5):
+        sys.stderr.write('usage: delta_gen.py <old.elf|old.bin> <new.elf|new.bin> out.delta '
+                         '[application start address]\n')
+        return 1
+
+    start = int(argv[4], 0) if len(argv) == 5 else APP_START
+    (old_start, old) = read_image(argv[1], start)
+    (new_start, new) = read_image(argv[2], start)
+    if old_start != new_start or old_start % SECTOR != 0:
+        raise RuntimeError('images start at 0x%X and 0x%X, not the same sector' % (old_start, new_start))
+    trailer_sector = FLASH_END - SECTOR - old_start
+    if len(new) > FLASH_END - PHRASE - old_start:
+        raise RuntimeError('new image overlaps the trailer')
+
+    # The trailer sector is erased before the download starts
+    old_limit = min(len(old), trailer_sector)
+    encoder = Encoder(old, new, old_limit)
+    delta = encoder.encode()
+    if decode(delta, old, old_limit, len(new)) != new:
+        raise RuntimeError('delta does not rebuild the new image')
+
+    header = struct.pack('<IIII', DELTA_MAGIC, len(old), zlib.crc32(old) & 0xFFFFFFFF, len(new))
+    with open(argv[3], 'wb') as f:
+        f.write(header + delta)
+
+    report(old, new, header + delta, encoder.stats)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-019   | 17-Oct-2026 | First version of delta_gen.py                                                |
+########################################################################################################################
@@ -0,0 +1,339 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: fuzzy_gen.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# fuzzy_gen.py
+#    Fuzzy table generator. Compiles the fuzzy systems described in Fuzzy_Cfg.json into the lookup tables
+#    of Fuzzy_Cfg.c / Fuzzy_Cfg.h used by Fuzzy_Infer() (src/BSW/ComplexDrivers/Fuzzy).
+#    Every system is then checked: the fixed point inference (emulated here exactly like Fuzzy.c) is
+#    compared with a floating point Mamdani reference (min, product implication, sum aggregation,
+#    numeric centroid) on random inputs. The tool fails when the error exceeds the tolerance.
+#
+#    System description:
+#      "name"      C name suffix, the system is exported as Fuzzy_<name>
+#      "lutSize"   entries per input table (default 256)
+#      "default"   output when no rule fires (default 0)
+#      "inputs"    [{"name", "min", "max", "terms": {"T": ["tri", a, b, c] or ["trap", a, b, c, d]}}]
+#      "output"    {"name", "terms": {...}}, terms in output units
+#      "rules"     [{"if": [term of every input, "*" = any], "then": output term}]
+#
+#    usage: fuzzy_gen.py Fuzzy_Cfg.json <output directory> [tolerance in % of output range, default 2]
+########################################################################################################################
+import itertools
+import json
+import os
+import random
+import sys
+
+MAX_INPUTS = 4                # FUZZY_MAX_INPUTS
+NO_RULE = 0xFF                # FUZZY_NO_RULE
+Q15 = 32767
+JIRA = 'user-009'
+DATE = '17-Oct-2026'
+CHECK_POINTS = 1024           # inputs compared per system
+CENTROID_STEPS = 2000         # output samples of the reference centroid
+
+
+def membership(mf, x):
+    """Degree of x in a triangle [a, b, c] or trapezoid [a, b, c, d]."""
+    if mf[0] == 'tri':
+        (a, b, c, d) = (mf[1], mf[2], mf[2], mf[3])
+    elif mf[0] == 'trap':
+        (a, b, c, d) = (mf[1], mf[2], mf[3], mf[4])
+    else:
+        raise ValueError('unknown membership function %s' % mf[0])
+    if x < a or x > d:
+        return 0.0
+    if b <= x <= c:
+        return 1.0
+    if x < b:
+        return (x - a) / float(b - a)
+    return (d - x) / float(d - c)
+
+
+def support(mf):
+    return (mf[1], mf[-1])
+
+
+class System(object):
+
+    def __init__(self, cfg):
+        self.name = cfg['name']
+        self.lut_size = cfg.get('lutSize', 256)
+        self.default = int(cfg.get('default', 0))
+        self.inputs = cfg['inputs']
+        self.output = cfg['output']
+        if not 1 <= len(self.inputs) <= MAX_INPUTS:
+            raise ValueError('%s: 1..%d inputs supported' % (self.name, MAX_INPUTS))
+        self.out_terms = list(self.output['terms'].keys())
+        if len(self.out_terms) >= NO_RULE:
+            raise ValueError('%s: too many output terms' % self.name)
+        self.build_luts()
+        self.build_rules(cfg['rules'])
+        self.build_output()
+
+    def build_luts(self):
+        self.luts = []
+        self.strides = []
+        stride = 1
+        for inp in self.inputs:
+            terms = list(inp['terms'].values())
+            step = (inp['max'] - inp['min']) / float(self.lut_size)
+            lut = []
+            for i in range(self.lut_size):
+                x = inp['min'] + (i + 0.5) * step
+                active = [(t, int(round(membership(mf, x) * Q15))) for (t, mf) in enumerate(terms)]
+                active = [(t, mu) for (t, mu) in active if mu > 0]
+                if len(active) > 2:
+                    raise ValueError('%s.%s: more than two terms overlap at %g' % (self.name, inp['name'], x))
+                if not active:
+                    active = [(0, 0)]
+                if len(active) == 1:
+                    active.append((0, 0))
+                lut.append(active)
+            self.luts.append(lut)
+            self.strides.append(stride)
+            stride *= len(terms)
+            inp['scale'] = int(round(self.lut_size * 65536.0 / (inp['max'] - inp['min'])))
+        self.combinations = stride
+
+    def build_rules(self, rules):
+        self.rules = [NO_RULE] * self.combinations
+        names = [list(inp['terms'].keys()) for inp in self.inputs]
+        for rule in rules:
+            if len(rule['if']) != len(self.inputs):
+                raise ValueError('%s: rule %s does not name every input' % (self.name, rule))
+            choices = [range(len(names[i])) if term == '*' else [names[i].index(term)]
+                       for (i, term) in enumerate(rule['if'])]
+            for combo in itertools.product(*choices):
+                index = sum(t * s for (t, s) in zip(combo, self.strides))
+                if self.rules[index] != NO_RULE:
+                    raise ValueError('%s: rule %s overlaps another rule' % (self.name, rule))
+                self.rules[index] = self.out_terms.index(rule['then'])
+
+    def build_output(self):
+        self.areas = []
+        self.centroids = []
+        for name in self.out_terms:
+            mf = self.output['terms'][name]
+            (lo, hi) = support(mf)
+            step = (hi - lo) / float(CENTROID_STEPS)
+            ys = [lo + (k + 0.5) * step for k in range(CENTROID_STEPS)]
+            mus = [membership(mf, y) for y in ys]
+            area = sum(mus) * step
+            self.areas.append(area)
+            self.centroids.append(sum(m * y for (m, y) in zip(mus, ys)) * step / area)
+        top = max(self.areas)
+        self.area_q15 = [int(round(a / top * Q15)) for a in self.areas]
+        self.centroid_int = [int(round(c)) for c in self.centroids]
+
+    def infer_fixed(self, values):
+        """Bit exact emulation of Fuzzy_Infer()."""
+        combos = [(0, 0x7FFF)]
+        for (i, inp) in enumerate(self.inputs):
+            index = ((int(values[i]) - int(round(inp['min']))) * inp['scale']) >> 16
+            index = min(max(index, 0), self.lut_size - 1)
+            entry = self.luts[i][index]
+            new = entry if entry[1][1] != 0 else entry[:1]
+            combos = [(idx + t * self.strides[i], min(w, mu)) for (t, mu) in new for (idx, w) in combos]
+        num = 0
+        den = 0
+        for (idx, w) in combos:
+            rule = self.rules[idx]
+            if rule != NO_RULE and w != 0:
+                area = (w * self.area_q15[rule]) >> 15
+                num += area * self.centroid_int[rule]
+                den += area
+        if den == 0:
+            return self.default
+        quotient = abs(num) // den
+        return quotient if num >= 0 else -quotient
+
+    def infer_float(self, values):
+        """Mamdani reference on exact membership degrees."""
+        terms = [list(inp['terms'].values()) for inp in self.inputs]
+        weights = [0.0] * len(self.out_terms)
+        fired = False
+        for combo in itertools.product(*[range(len(t)) for t in terms]):
+            index = sum(t * s for (t, s) in zip(combo, self.strides))
+            if self.rules[index] == NO_RULE:
+                continue
+            w = min(membership(terms[i][t], values[i]) for (i, t) in enumerate(combo))
+            if w > 0.0:
+                weights[self.rules[index]] += w
+                fired = True
+        if not fired:
+            return float(self.default)
+        mfs = [self.output['terms'][n] for n in self.out_terms]
+        lo = min(support(mf)[0] for mf in mfs)
+        hi = max(support(mf)[1] for mf in mfs)
+        step = (hi - lo) / float(CENTROID_STEPS)
+        num = 0.0
+        den = 0.0
+        for k in range(CENTROID_STEPS):
+            y = lo + (k + 0.5) * step
+            m = sum(w * membership(mf, y) for (w, mf) in zip(weights, mfs) if w > 0.0)
+            num += m * y
+            den += m
+        return num / den if den > 0.0 else float(self.default)
+
+    def check(self, tolerance):
+        mfs = list(self.output['terms'].values())
+        span = max(support(mf)[1] for mf in mfs) - min(support(mf)[0] for mf in mfs)
+        rnd = random.Random(1)
+        worst = (0.0, None)
+        for _ in range(CHECK_POINTS):
+            values = [rnd.randint(int(inp['min']), int(inp['max'])) for inp in self.inputs]
+            err = abs(self.infer_fixed(values) - self.infer_float(values))
+            if err > worst[0]:
+                worst = (err, values)
+        percent = 100.0 * worst[0] / span
+        print('Fuzzy_%s: %d rule slots, %d B of tables, max error %.2f (%.2f %% of output range) at %s'
+              % (self.name, self.combinations, self.size(), worst[0], percent, worst[1]))
+        if percent > tolerance:
+            raise ValueError('Fuzzy_%s: error above %.2f %%, increase lutSize' % (self.name, tolerance))
+
+    def size(self):
+        return 6 * self.lut_size * len(self.inputs) + self.combinations + 6 * len(self.out_terms)
+
+
+def banner(name, description):
+    lines = ['/' + '*' * 117 + '/',
+             '/*' + 'BSW GROUP'.center(115) + '*/',
+             '/' + '*' * 117 + '/',
+             '/*' + 'OBJECT SPECIFICATION'.center(115) + '*/',
+             '/' + '*' * 117 + '/',
+             '/*!',
+             ' * $Source: %s $' % name,
+             ' * $Revision: Version 1.0 $',
+             ' * $Author: Carlos Martinez $',
+             ' * $Date: 2026-10-17 $',
+             ' */',
+             '/' + '*' * 117 + '/',
+             '/* DESCRIPTION :'.ljust(117) + '*/',
+             '/** \\%s' % name]
+    lines += ['    ' + d for d in description]
+    lines += [' */',
+              '/' + '*' * 117 + '/',
+              '/* ALL RIGHTS RESERVED'.ljust(117) + '*/',
+              '/*'.ljust(117) + '*/',
+              '/* The reproduction, transmission, or use of this document or its content is'.ljust(117) + '*/',
+              '/* not permitted without express written authority. Offenders will be liable'.ljust(117) + '*/',
+              '/* for damages.'.ljust(117) + '*/',
+              '/' + '*' * 117 + '/']
+    return lines
+
+
+# Section banners as written by hand in the BSW sources
+SECTIONS = {
+    'Includes':
+        ('/*                                                       Includes                                                    */',
+         '/*********************************************************************************************************************/'),
+    'Constants and types':
+        ('/*                                                Constants and types                                                */',
+         '/*********************************************************************************************************************/'),
+    'Exported Variables':
+        ('/*                                                    Exported Variables                                              */',
+         '/**********************************************************************************************************************/'),
+    'Exported functions prototypes':
+        ('/*                                              Exported functions prototypes                                         */',
+         '/**********************************************************************************************************************/'),
+    'Variables':
+        ('/*                                                      Variables                                                    */',
+         '/*********************************************************************************************************************/'),
+}
+
+
+def section(title):
+    return [''] + list(SECTIONS[title])
+
+
+def log_table(name):
+    return ['',
+            '/***************************************************Log Projects' + '*' * 56,
+            ' *|    ID   | JIRA Ticket |     Date    |                                Description                                   |',
+            ' *| CMARTI  |  %s   | %s | %s|' % (JIRA, DATE, ('Generated %s' % name).ljust(77)),
+            '*' * 119 + '/']
+
+
+def gen_header(systems):
+    out = banner('Fuzzy_Cfg.h', ['Fuzzy systems, generated by tools/FuzzyGen/fuzzy_gen.py from Fuzzy_Cfg.json. Do not edit.'])
+    out += ['#ifndef FUZZY_CFG_H_', '#define FUZZY_CFG_H_']
+    out += section('Includes')[1:] + ['#include "Fuzzy.h"']
+    out += section('Constants and types')
+    out += section('Exported Variables')
+    for system in systems:
+        out.append('extern const Fuzzy_SystemType Fuzzy_%s;' % system.name)
+    out += section('Exported functions prototypes')
+    out += ['', '#endif /* FUZZY_CFG_H_ */']
+    out += log_table('Fuzzy_Cfg.h')
+    return out
+
+
+def gen_array(ctype, name, values, per_line):
+    out = ['static const %s %s[%du] =' % (ctype, name, len(values)), '{']
+    for i in range(0, len(values), per_line):
+        out.append('    ' + ' '.join('%s,' % v for v in values[i:i + per_line]))
+    out[-1] = out[-1][:-1]
+    out.append('};')
+    return out
+
+
+def gen_source(systems):
+    out = banner('Fuzzy_Cfg.c', ['Fuzzy systems, generated by tools/FuzzyGen/fuzzy_gen.py from Fuzzy_Cfg.json. Do not edit.'])
+    out += section('Includes') + ['#include "Fuzzy_Cfg.h"']
+    out += section('Constants and types')
+    out += section('Variables')
+    for system in systems:
+        name = system.name
+        for (i, inp) in enumerate(system.inputs):
+            entries = ['{ { %du, %du }, { %du, %du } }' % (e[0][0], e[1][0], e[0][1], e[1][1]) for e in system.luts[i]]
+            out += ['', '/*%s.%s, %s*/' % (name, inp['name'], ' '.join(inp['terms'].keys()))]
+            out += gen_array('Fuzzy_LutEntryType', 'Fuzzy_%s_Lut%d' % (name, i), entries, 3)
+        out += ['', 'static const Fuzzy_InputType Fuzzy_%s_Inputs[%du] =' % (name, len(system.inputs)), '{']
+        rows = ['    { Fuzzy_%s_Lut%d, %d, %du, %du, %du }' % (name, i, int(round(inp['min'])), inp['scale'],
+                                                             system.lut_size, system.strides[i])
+                for (i, inp) in enumerate(system.inputs)]
+        out += [r + ',' for r in rows[:-1]] + [rows[-1], '};', '']
+        out += gen_array('u8bit', 'Fuzzy_%s_Rules' % name, ['%du' % r for r in system.rules], 16)
+        out += ['', '/*%s.%s, %s*/' % (name, system.output['name'], ' '.join(system.out_terms))]
+        out += gen_array('u16bit', 'Fuzzy_%s_Area' % name, ['%du' % a for a in system.area_q15], 8)
+        out += [''] + gen_array('s32bit', 'Fuzzy_%s_Centroid' % name, ['%d' % c for c in system.centroid_int], 8)
+        out += ['',
+                'const Fuzzy_SystemType Fuzzy_%s =' % name,
+                '{',
+                '    Fuzzy_%s_Inputs, Fuzzy_%s_Rules, Fuzzy_%s_Area, Fuzzy_%s_Centroid, %d, %du'
+                % (name, name, name, name, system.default, len(system.inputs)),
+                '};']
+    out += log_table('Fuzzy_Cfg.c')
+    return out
+
+
+def main(argv):
+    if len(argv) not in (3, 4):
+        sys.stderr.write('usage: fuzzy_gen.py <Fuzzy_Cfg.json> <output directory> [tolerance %]\n')
+        return 1
+    tolerance = float(argv[3]) if len(argv) == 4 else 2.0
+
+    with open(argv[1]) as f:
+        systems = [System(cfg) for cfg in json.load(f)['systems']]
+    for system in systems:
+        system.check(tolerance)
+
+    for (name, lines) in (('Fuzzy_Cfg.h', gen_header(systems)), ('Fuzzy_Cfg.c', gen_source(systems))):
+        with open(os.path.join(argv[2], name), 'w', newline='\n') as f:
+            f.write('\n'.join(lines) + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-009   | 17-Oct-2026 | First version of fuzzy_gen.py                                                |
+########################################################################################################################
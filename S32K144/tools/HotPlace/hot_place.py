@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: hot_place.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# hot_place.py
+#    Profile guided placement of functions in .code_ram. Reads the function symbols of a linked ELF and the
+#    call counts of a profiling run, picks the set of functions that saves the most flash wait states within
+#    a RAM budget and writes HotPlace.mk. The Makefile moves the .text.<function> input section of every
+#    listed function into .code_ram, which init_data_bss() copies to SRAM before main.
+#
+#    Call counts, either:
+#      - a binary dump of CallCount_Table (src/BSW/Services/CallCount, make PROFILE_CALLS=1): pairs of
+#        little endian u32 entry address and count, empty slots have address 0
+#      - a text file, one "<function name or 0x address> <count>" per line ('#' starts a comment), e.g.
+#        counts derived from a trace
+#
+#    Estimated gain of a function = calls * (flash fetches * wait states - long branch veneer cycles).
+#    Every call is assumed to run the function body once without flash cache hits, loops make the real
+#    gain larger, early returns and the flash prefetch buffer smaller. Use the report to compare placements,
+#    and measure the result.
+#
+#    usage: hot_place.py Project.elf calls.bin HotPlace.mk <RAM budget bytes> <flash wait states>
+########################################################################################################################
+import os
+import struct
+import sys
+
+JIRA = 'user-011'
+DATE = '17-Oct-2026'
+
+SHT_SYMTAB = 2
+STT_FUNC = 2
+RAM_START = 0x1FFF8000        # m_data origin, functions above are already in RAM
+FETCH_BYTES = 8               # flash read width, one wait state penalty per line
+VENEER_CYCLES = 4             # long branch veneer between flash and RAM (LDR PC) per call
+ALIGN = 4
+
+# Run before init_data_bss() has copied .code_ram, must stay in flash
+NEVER_MOVE = ('Reset_Handler', 'SystemInit', 'init_data_bss', 'StartupMem_')
+
+
+class Elf32(object):
+    """Minimal little endian ELF32 reader, only the function symbols."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.raw = f.read()
+        if self.raw[:4] != b'\x7fELF' or self.raw[4] != 1 or self.raw[5] != 1:
+            raise ValueError('%s is not a little endian ELF32 file' % path)
+        self.shoff = struct.unpack_from('<I', self.raw, 0x20)[0]
+        (self.shentsize, self.shnum) = struct.unpack_from('<HH', self.raw, 0x2E)
+
+    def sections(self):
+        for i in range(self.shnum):
+            yield struct.unpack_from('<10I', self.raw, self.shoff + i * self.shentsize)
+
+    def functions(self):
+        """(name, address, size) of every sized function, Thumb bit cleared."""
+        sections = list(self.sections())
+        for sh in sections:
+            if sh[1] != SHT_SYMTAB:
+                continue
+            strtab = sections[sh[6]]
+            for off in range(sh[4], sh[4] + sh[5], sh[9]):
+                (name, value, size, info) = struct.unpack_from('<IIIB', self.raw, off)
+                if (info & 0x0F) != STT_FUNC or size == 0:
+                    continue
+                end = self.raw.index(b'\0', strtab[4] + name)
+                yield self.raw[strtab[4] + name:end].decode(), value & ~1, size
+
+
+def read_counts(path):
+    """Calls per function name or per address."""
+    counts = {}
+    if path.endswith('.bin'):
+        with open(path, 'rb') as f:
+            raw = f.read()
+        for (address, count) in struct.iter_unpack('<II', raw[:len(raw) // 8 * 8]):
+            if address != 0:
+                counts[address & ~1] = counts.get(address & ~1, 0) + count
+        return counts
+    with open(path) as f:
+        for line in f:
+            fields = line.split('#')[0].split()
+            if not fields:
+                continue
+            key = int(fields[0], 16) & ~1 if fields[0].startswith('0x') else fields[0]
+            counts[key] = counts.get(key, 0) + int(fields[1])
+    return counts
+
+
+class Candidate(object):
+
+    def __init__(self, name):
+        self.name = name
+        self.size = 0
+        self.calls = 0
+        self.gain = 0
+
+
+def candidates(elf, counts, wait_states):
+    """Profiled functions still in flash. Static functions sharing a name share the .text.<name> rename."""
+    by_name = {}
+    in_ram = []
+    for (name, address, size) in elf.functions():
+        calls = counts.get(address, 0) + counts.get(name, 0)
+        if calls == 0:
+            continue
+        if address >= RAM_START:
+            in_ram.append(name)
+            continue
+        if name.startswith(NEVER_MOVE):
+            continue
+        c = by_name.setdefault(name, Candidate(name))
+        c.size += (size + ALIGN - 1) // ALIGN * ALIGN
+        c.calls += calls
+        c.gain += calls * (((size + FETCH_BYTES - 1) // FETCH_BYTES) * wait_states - VENEER_CYCLES)
+    return [c for c in by_name.values() if c.gain > 0], in_ram
+
+
+def select(cands, budget):
+    """0/1 knapsack on ALIGN byte units: largest total gain within budget."""
+    units = budget // ALIGN
+    best = [0] * (units + 1)
+    keep = []
+    for c in cands:
+        w = c.size // ALIGN
+        row = [False] * (units + 1)
+        for u in range(units, w - 1, -1):
+            if best[u - w] + c.gain > best[u]:
+                best[u] = best[u - w] + c.gain
+                row[u] = True
+        keep.append(row)
+    chosen = []
+    u = units
+    for i in range(len(cands) - 1, -1, -1):
+        if keep[i][u]:
+            chosen.append(cands[i])
+            u -= cands[i].size // ALIGN
+    return sorted(chosen, key=lambda c: -c.gain)
+
+
+def report(chosen, cands, in_ram, budget, wait_states):
+    used = sum(c.size for c in chosen)
+    print('HotPlace: %d of %d functions placed, %d of %d B RAM, %d flash wait states'
+          % (len(chosen), len(cands), used, budget, wait_states))
+    print('  %-32s %8s %12s %14s' % ('function', 'bytes', 'calls', 'cycles saved'))
+    for c in chosen:
+        print('  %-32s %8d %12d %14d' % (c.name, c.size, c.calls, c.gain))
+    print('  %-32s %8d %12s %14d' % ('total', used, '', sum(c.gain for c in chosen)))
+    left = sorted((c for c in cands if c not in chosen), key=lambda c: -c.gain)[:5]
+    for c in left:
+        print('  left in flash: %s (%d B, %d cycles)' % (c.name, c.size, c.gain))
+    for name in in_ram:
+        print('  already in .code_ram: %s' % name)
+
+
+def write_mk(path, chosen):
+    lines = ['#' * 120,
+             '# $Source: %s$' % os.path.basename(path),
+             '# $Revision: Version 1.0 $',
+             '# $Author: Carlos Martinez $',
+             '# $Date: 2026-10-17 $',
+             '#' * 120,
+             '# DESCRIPTION :',
+             '# %s' % os.path.basename(path),
+             '#    Functions moved to .code_ram, generated by tools/HotPlace/hot_place.py from a profiling run.',
+             '#    Do not edit, run make hotplace again after the code changed.',
+             '#' * 120,
+             '']
+    lines.append('HOT_FUNCTIONS  = ' + ' \\\n                 '.join(c.name for c in chosen))
+    lines += ['',
+              '#' * 120,
+              ' #|    ID   | JIRA Ticket |     Date    |                                       Description                            |',
+              ' #| CMARTI  |  %s   | %s | %s|' % (JIRA, DATE, ('Generated %s' % os.path.basename(path)).ljust(77)),
+              '#' * 120]
+    with open(path, 'w', newline='\n') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def main(argv):
+    if len(argv) != 6:
+        sys.stderr.write('usage: hot_place.py Project.elf <calls.bin|calls.txt> HotPlace.mk '
+                         '<RAM budget bytes> <flash wait states>\n')
+        return 1
+
+    budget = int(argv[4], 0)
+    wait_states = int(argv[5])
+    (cands, in_ram) = candidates(Elf32(argv[1]), read_counts(argv[2]), wait_states)
+    chosen = select(cands, budget)
+    report(chosen, cands, in_ram, budget, wait_states)
+    write_mk(argv[3], chosen)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-011   | 17-Oct-2026 | First version of hot_place.py                                                |
+########################################################################################################################
@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: init_pack.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# init_pack.py
+#    Post-link tool. Reads the linked ELF, packs the .data and .code_ram load images with zero-run and LZ
+#    compression and writes a flash binary where everything from __DATA_ROM on is replaced by the packed
+#    init image understood by StartupMem_UnpackImage() (settings/startup/Startup_Mem.c).
+#    Build the startup with -DSTARTUP_COMPRESSED_INIT to use it.
+#
+#    usage: init_pack.py Project.elf Project.bin
+########################################################################################################################
+import struct
+import sys
+
+IMAGE_MAGIC = 0x474D4943      # "CIMG", STARTUP_MEM_IMAGE_MAGIC
+TOKEN_LIT = 0x00              # STARTUP_MEM_TOKEN_LIT
+TOKEN_ZERO = 0x40             # STARTUP_MEM_TOKEN_ZERO
+TOKEN_MATCH = 0x80            # STARTUP_MEM_TOKEN_MATCH
+LEN_MASK = 0x3F               # STARTUP_MEM_LEN_MASK
+MATCH_MIN = 3                 # STARTUP_MEM_MATCH_MIN
+MATCH_WINDOW = 0xFFFF         # 16 bit offset
+MATCH_CHAIN = 64              # candidates checked per position
+ZERO_RUN_MIN = 2              # shorter zero runs are cheaper as literals
+
+FLASH_END = 0x00080000        # m_text end, everything below is flash
+SHT_SYMTAB = 2
+PT_LOAD = 1
+
+
+class Elf32(object):
+    """Minimal little endian ELF32 reader, only what the packer needs."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.raw = f.read()
+        if self.raw[:4] != b'\x7fELF' or self.raw[4] != 1 or self.raw[5] != 1:
+            raise ValueError('%s is not a little endian ELF32 file' % path)
+        (self.phoff, self.shoff) = struct.unpack_from('<II', self.raw, 0x1C)
+        (self.phentsize, self.phnum, self.shentsize, self.shnum, self.shstrndx) = \
+            struct.unpack_from('<HHHHH', self.raw, 0x2A)
+
+    def segments(self):
+        for i in range(self.phnum):
+            (ptype, offset, vaddr, paddr, filesz, memsz, flags, align) = \
+                struct.unpack_from('<8I', self.raw, self.phoff + i * self.phentsize)
+            yield ptype, offset, vaddr, paddr, filesz
+
+    def sections(self):
+        for i in range(self.shnum):
+            yield struct.unpack_from('<10I', self.raw, self.shoff + i * self.shentsize)
+
+    def symbols(self):
+        sections = list(self.sections())
+        table = {}
+        for sh in sections:
+            if sh[1] != SHT_SYMTAB:
+                continue
+            strtab = sections[sh[6]]
+            for off in range(sh[4], sh[4] + sh[5], sh[9]):
+                (name, value) = struct.unpack_from('<II', self.raw, off)
+                end = self.raw.index(b'\0', strtab[4] + name)
+                table[self.raw[strtab[4] + name:end].decode()] = value
+        return table
+
+    def load_image(self, start, end):
+        """Bytes stored in flash (load addresses) between start and end, erased value 0xFF elsewhere."""
+        image = bytearray(b'\xFF' * (end - start))
+        for (ptype, offset, vaddr, paddr, filesz) in self.segments():
+            if ptype != PT_LOAD or filesz == 0:
+                continue
+            lo = max(paddr, start)
+            hi = min(paddr + filesz, end)
+            if lo < hi:
+                image[lo - start:hi - start] = self.raw[offset + lo - paddr:offset + hi - paddr]
+        return bytes(image)
+
+
+def encode_length(token, length):
+    """Control byte plus LEB128 extension when length does not fit the 6 bit field."""
+    if length < LEN_MASK:
+        return bytes([token | length])
+    out = bytearray([token | LEN_MASK])
+    rest = length - LEN_MASK
+    while True:
+        byte = rest & 0x7F
+        rest >>= 7
+        out.append(byte | (0x80 if rest else 0))
+        if not rest:
+            return bytes(out)
+
+
+def pack(data):
+    """Greedy zero-run + LZ77 packer with hash chains on 3 byte prefixes."""
+    out = bytearray()
+    literals = bytearray()
+    chains = {}
+    pos = 0
+
+    def flush_literals():
+        if literals:
+            out.extend(encode_length(TOKEN_LIT, len(literals) - 1))
+            out.extend(literals)
+            del literals[:]
+
+    def remember(index):
+        if index + MATCH_MIN <= len(data):
+            chains.setdefault(data[index:index + MATCH_MIN], []).append(index)
+
+    while pos < len(data):
+        zeros = 0
+        while pos + zeros < len(data) and data[pos + zeros] == 0:
+            zeros += 1
+
+        best_len = 0
+        best_off = 0
+        for cand in reversed(chains.get(data[pos:pos + MATCH_MIN], [])[-MATCH_CHAIN:]):
+            if pos - cand > MATCH_WINDOW:
+                break
+            length = 0
+            while pos + length < len(data) and data[cand + length] == data[pos + length]:
+                length += 1
+            if length > best_len:
+                best_len = length
+                best_off = pos - cand
+
+        if zeros >= ZERO_RUN_MIN and zeros >= best_len:
+            flush_literals()
+            out.extend(encode_length(TOKEN_ZERO, zeros - 1))
+            step = zeros
+        elif best_len >= MATCH_MIN:
+            flush_literals()
+            out.extend(encode_length(TOKEN_MATCH, best_len - MATCH_MIN))
+            out.extend(struct.pack('<H', best_off))
+            step = best_len
+        else:
+            literals.append(data[pos])
+            step = 1
+
+        for index in range(pos, pos + step):
+            remember(index)
+        pos += step
+
+    flush_literals()
+    return bytes(out)
+
+
+def unpack(stream, size):
+    """Python mirror of StartupMem_Unpack, used to check every packed section before it is written."""
+    out = bytearray()
+    pos = 0
+    while len(out) < size:
+        control = stream[pos]
+        pos += 1
+        length = control & LEN_MASK
+        if length == LEN_MASK:
+            shift = 0
+            while True:
+                byte = stream[pos]
+                pos += 1
+                length += (byte & 0x7F) << shift
+                shift += 7
+                if not byte & 0x80:
+                    break
+        token = control & 0xC0
+        if token == TOKEN_LIT:
+            out.extend(stream[pos:pos + length + 1])
+            pos += length + 1
+        elif token == TOKEN_ZERO:
+            out.extend(bytes(length + 1))
+        elif token == TOKEN_MATCH:
+            offset = struct.unpack_from('<H', stream, pos)[0]
+            pos += 2
+            for _ in range(length + MATCH_MIN):
+                out.append(out[-offset])
+        else:
+            raise ValueError('reserved token')
+    return bytes(out)
+
+
+def record(name, raw):
+    packed = pack(raw)
+    if unpack(packed, len(raw)) != raw:
+        raise RuntimeError('%s: packed stream does not round trip' % name)
+    ratio = (100.0 * len(packed) / len(raw)) if raw else 100.0
+    # Flash reads at boot: one word per 4 bytes of load image, packed matches and zero runs read RAM only
+    print('%-10s raw %7d B  packed %7d B  (%5.1f %%)  flash words %6d -> %6d'
+          % (name, len(raw), len(packed), ratio, (len(raw) + 3) // 4, (len(packed) + 11) // 4))
+    body = struct.pack('<II', len(raw), len(packed)) + packed
+    return body + bytes(-len(body) % 4)
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write('usage: init_pack.py <input.elf> <output.bin>\n')
+        return 1
+
+    elf = Elf32(argv[1])
+    sym = elf.symbols()
+    data_rom = sym['__DATA_ROM']
+    code_rom = sym['__CODE_ROM']
+    data_raw = elf.load_image(data_rom, data_rom + sym['__data_end__'] - sym['__data_start__'])
+    code_raw = elf.load_image(code_rom, code_rom + sym['__code_end__'] - sym['__code_start__'])
+
+    image = struct.pack('<I', IMAGE_MAGIC) + record('.data', data_raw) + record('.code_ram', code_raw)
+    if data_rom + len(image) > FLASH_END:
+        raise RuntimeError('packed init image does not fit in flash')
+
+    with open(argv[2], 'wb') as f:
+        f.write(elf.load_image(0, data_rom))
+        f.write(image)
+
+    print('init image %d B instead of %d B, flash image ends at 0x%08X'
+          % (len(image), len(data_raw) + len(code_raw), data_rom + len(image)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-002   | 17-Oct-2026 | First version of init_pack.py                                                |
+########################################################################################################################
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: mem_map.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# mem_map.py
+#    Memory map report of a linked image. Reads the section headers and symbols of the ELF and writes the
+#    usage of the flash, SRAM_L and SRAM_U regions of S32K144_flash.ld/S32K144_boot.ld, every output section
+#    placed in them and the variables of the placement sections (FAST_DATA, FAST_BSS, DMA_BUFFER, NO_INIT in
+#    Core_CM4.h), so the bus each piece of hot state sits on can be reviewed after every link.
+#
+#    SRAM_L is reached by the core through the code bus (data and .code_ram instruction fetch), SRAM_U through
+#    the system bus shared with DMA. Flash usage counts the load images of .data and .code as well.
+#
+#    usage: mem_map.py Project.elf Project.map.txt
+########################################################################################################################
+import os
+import struct
+import sys
+
+JIRA = 'user-023'
+DATE = '17-Oct-2026'
+
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+STT_OBJECT = 1
+PT_LOAD = 1
+
+# S32K144_flash.ld MEMORY, flash regions start at __app_offset__ in the application
+FLASH_END = 0x00080000
+REGIONS = (('FLASH', '-', 0x00000000, FLASH_END),
+           ('SRAM_L', 'code', 0x1FFF8000, 0x00008000),   # m_data
+           ('SRAM_U', 'system', 0x20000000, 0x00007000))  # m_data_2
+
+CONTENT = {'.interrupts': 'vector table',
+           '.flash_config': 'flash configuration field',
+           '.text': 'code and constants',
+           '.interrupts_ram': 'RAM vector table',
+           '.data': 'initialized data, FAST_DATA first',
+           '.code': '.code_ram functions',
+           '.fast_bss': 'FAST_BSS',
+           '.stack': 'main stack (MSP)',
+           '.customSectionBlock': '.customSection',
+           '.dma_bss': 'DMA_BUFFER',
+           '.bss': 'zeroed data',
+           '.heap': 'MemPool heap',
+           '.noinit': 'NO_INIT, kept over a reset'}
+
+# Output sections whose variables are listed one by one
+PLACEMENT = ('.fast_bss', '.dma_bss', '.noinit')
+
+
+class Elf32(object):
+    """Minimal little endian ELF32 reader, allocated sections, their load address and object symbols."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.raw = f.read()
+        if self.raw[:4] != b'\x7fELF' or self.raw[4] != 1 or self.raw[5] != 1:
+            raise ValueError('%s is not a little endian ELF32 file' % path)
+        (self.phoff, self.shoff) = struct.unpack_from('<II', self.raw, 0x1C)
+        (self.phentsize, self.phnum, self.shentsize, self.shnum, self.shstrndx) = \
+            struct.unpack_from('<HHHHH', self.raw, 0x2A)
+        self.headers = [struct.unpack_from('<10I', self.raw, self.shoff + i * self.shentsize)
+                        for i in range(self.shnum)]
+
+    def string(self, table, offset):
+        start = self.headers[table][4] + offset
+        return self.raw[start:self.raw.index(b'\0', start)].decode()
+
+    def load_address(self, sh):
+        """LMA of a section with contents, from the PT_LOAD segment holding its file bytes."""
+        lma = sh[3]
+        for i in range(self.phnum):
+            (ptype, offset, vaddr, paddr, filesz) = \
+                struct.unpack_from('<5I', self.raw, self.phoff + i * self.phentsize)
+            if ptype == PT_LOAD and offset <= sh[4] < offset + filesz:
+                lma = paddr + (sh[4] - offset)
+            else:
+                pass
+        return lma
+
+    def sections(self):
+        """(name, address, load address, size, has contents) of every allocated section."""
+        for sh in self.headers:
+            if (sh[2] & SHF_ALLOC) and sh[5] != 0:
+                loaded = sh[1] != SHT_NOBITS
+                lma = self.load_address(sh) if loaded else sh[3]
+                yield self.string(self.shstrndx, sh[0]), sh[3], lma, sh[5], loaded
+
+    def objects(self):
+        """(name, address, size) of every sized variable."""
+        for sh in self.headers:
+            if sh[1] != SHT_SYMTAB:
+                continue
+            for off in range(sh[4], sh[4] + sh[5], sh[9]):
+                (name, value, size, info) = struct.unpack_from('<IIIB', self.raw, off)
+                if (info & 0x0F) == STT_OBJECT and size != 0:
+                    yield self.string(sh[6], name), value, size
+
+
+def region_of(address):
+    found = None
+    for region in REGIONS:
+        if region[2] <= address < region[2] + region[3]:
+            found = region
+        else:
+            pass
+    return found
+
+
+def build(elf, name):
+    sections = list(elf.sections())
+    lines = ['Memory map of %s' % name, '']
+
+    #Flash holds the sections linked there and the load images of the RAM sections with contents
+    flash = [s for s in sections if region_of(s[1]) is REGIONS[0]]
+    images = [s for s in sections if s[4] and region_of(s[1]) is not REGIONS[0] and region_of(s[2]) is REGIONS[0]]
+    flash_start = min(s[1] for s in flash) if flash else 0
+    usage = {'FLASH': (flash_start, FLASH_END - flash_start, sum(s[3] for s in flash + images))}
+    for region in REGIONS[1:]:
+        used = sum(s[3] for s in sections if region_of(s[1]) is region)
+        usage[region[0]] = (region[2], region[3], used)
+
+    lines.append('%-8s %-7s %-10s %8s %8s %8s %6s' % ('Region', 'Bus', 'Start', 'Size', 'Used', 'Free', 'Use'))
+    for region in REGIONS:
+        (start, size, used) = usage[region[0]]
+        lines.append('%-8s %-7s 0x%08X %8u %8u %8d %5.1f%%'
+                     % (region[0], region[1], start, size, used, size - used, 100.0 * used / size))
+
+    for region in REGIONS:
+        lines.append('')
+        lines.append('%s%s' % (region[0], ' (%s bus)' % region[1] if region[1] != '-' else ''))
+        lines.append('  %-20s %-10s %-10s %8s  %s' % ('Section', 'Address', 'Load', 'Size', 'Content'))
+        for (sname, address, lma, size, loaded) in sorted(sections, key=lambda s: s[1]):
+            if region_of(address) is region:
+                load = ('0x%08X' % lma) if (loaded and lma != address) else '-'
+                lines.append('  %-20s 0x%08X %-10s %8u  %s' % (sname, address, load, size, CONTENT.get(sname, '')))
+            else:
+                pass
+
+    objects = sorted(elf.objects(), key=lambda o: o[1])
+    for (sname, address, lma, size, loaded) in sections:
+        if sname in PLACEMENT:
+            lines.append('')
+            lines.append('%s (%s)' % (sname, CONTENT[sname]))
+            members = [o for o in objects if address <= o[1] < address + size]
+            for (oname, oaddress, osize) in members:
+                lines.append('  0x%08X %8u  %s' % (oaddress, osize, oname))
+            if not members:
+                lines.append('  empty')
+        else:
+            pass
+    return lines
+
+
+def log_table(path):
+    return ['', '#' * 120,
+            ' #|    ID   | JIRA Ticket |     Date    |                                       Description                            |',
+            ' #| CMARTI  |  %s   | %s | %s|' % (JIRA, DATE, ('Generated %s' % os.path.basename(path)).ljust(77)),
+            '#' * 120]
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write('usage: mem_map.py Project.elf Project.map.txt\n')
+        return 1
+
+    lines = build(Elf32(argv[1]), os.path.basename(argv[1]))
+    print('\n'.join(lines[:3 + len(REGIONS)]))
+    with open(argv[2], 'w', newline='\n') as f:
+        f.write('\n'.join(lines + log_table(argv[2])) + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-023   | 17-Oct-2026 | First version of mem_map.py                                                  |
+########################################################################################################################
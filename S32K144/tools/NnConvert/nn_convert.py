@@ -0,0 +1,377 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: nn_convert.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# nn_convert.py
+#    Neural network converter. Quantizes the float models described in NeuralNet_Models.json and writes the
+#    const tables of NeuralNet_Models.c / NeuralNet_Models.h run by NeuralNet_Invoke()
+#    (src/BSW/ComplexDrivers/NeuralNet).
+#    - weights: int8, symmetric per layer
+#    - activations: int8 asymmetric ("activation": "s8") or int16 symmetric ("s16"), ranges taken from the
+#      calibration inputs run through the float model
+#    - biases: int32 with the input zero point folded in, requantization as a Q31 multiplier and a shift
+#    - tensor arena: every tensor gets a fixed offset, tensors whose lifetimes do not overlap share space
+#    The integer inference is emulated exactly like NeuralNet.c, the report gives per layer MACs, peak
+#    arena bytes and the quantization error against the float model on the calibration inputs.
+#
+#    Model description:
+#      "name"         the model is exported as NeuralNet_<name>
+#      "activation"   "s8" (default) or "s16"
+#      "input"        {"length": positions, "channels": channels}
+#      "layers"       [{"type": "conv1d", "filters", "kernel", "stride", "weights": [f][k][c], "bias": [f]},
+#                      {"type": "dense", "units", "weights": [u][inputs], "bias": [u]}], "activation": "relu"
+#                     or "none" on every layer. Dense layers see the previous tensor flattened channels last.
+#      "calibration"  [[input values, positions x channels, channels last], ...]
+#
+#    usage: nn_convert.py NeuralNet_Models.json <output directory>
+########################################################################################################################
+import json
+import math
+import os
+import re
+import sys
+
+JIRA = 'user-010'
+DATE = '17-Oct-2026'
+ALIGN = 4
+
+
+def flatten(values):
+    if isinstance(values, list):
+        out = []
+        for v in values:
+            out += flatten(v)
+        return out
+    return [values]
+
+
+def round_half_up(x):
+    return int(math.floor(x + 0.5))
+
+
+class Layer(object):
+
+    def __init__(self, cfg, in_length, in_channels):
+        self.type = cfg['type']
+        self.relu = cfg.get('activation', 'none') == 'relu'
+        self.weights = flatten(cfg['weights'])
+        self.bias = [float(b) for b in cfg['bias']]
+        if self.type == 'conv1d':
+            self.filters = cfg['filters']
+            self.window = cfg['kernel'] * in_channels
+            self.step = cfg.get('stride', 1) * in_channels
+            self.out_length = (in_length - cfg['kernel']) // cfg.get('stride', 1) + 1
+        elif self.type == 'dense':
+            self.filters = cfg['units']
+            self.window = in_length * in_channels
+            self.step = 0
+            self.out_length = 1
+        else:
+            raise ValueError('unknown layer type %s' % self.type)
+        if len(self.weights) != self.filters * self.window or len(self.bias) != self.filters:
+            raise ValueError('%s layer: weights or bias do not match the shape' % self.type)
+        self.in_size = in_length * in_channels
+        self.out_size = self.out_length * self.filters
+        self.macs = self.out_length * self.filters * self.window
+
+    def run_float(self, x):
+        out = []
+        for pos in range(self.out_length):
+            for f in range(self.filters):
+                acc = self.bias[f]
+                base = pos * self.step
+                for i in range(self.window):
+                    acc += x[base + i] * self.weights[f * self.window + i]
+                out.append(max(acc, 0.0) if self.relu else acc)
+        return out
+
+    def quantize(self, in_q, out_q, qmin, qmax):
+        (in_scale, in_zero) = in_q
+        (out_scale, out_zero) = out_q
+        top = max(abs(w) for w in self.weights) or 1.0
+        w_scale = top / 127.0
+        self.wq = [max(-127, min(127, round_half_up(w / w_scale))) for w in self.weights]
+        self.bq = []
+        for f in range(self.filters):
+            row = self.wq[f * self.window:(f + 1) * self.window]
+            self.bq.append(round_half_up(self.bias[f] / (in_scale * w_scale)) - in_zero * sum(row))
+            bound = sum(abs(w) for w in row) * max(abs(qmin), abs(qmax)) + abs(self.bq[-1])
+            if bound >= 2 ** 31:
+                raise ValueError('%s layer: accumulator may overflow, reduce the window' % self.type)
+        (mantissa, exponent) = math.frexp(in_scale * w_scale / out_scale)
+        self.mult = round_half_up(mantissa * 2 ** 31)
+        if self.mult == 2 ** 31:
+            self.mult //= 2
+            exponent += 1
+        self.shift = 31 - exponent
+        if not 1 <= self.shift <= 62:
+            raise ValueError('%s layer: requantization scale out of range' % self.type)
+        self.out_zero = out_zero
+        self.act_min = max(out_zero, qmin) if self.relu else qmin
+        self.act_max = qmax
+
+    def run_fixed(self, x):
+        """Bit exact emulation of NeuralNet_Layer()."""
+        out = []
+        for pos in range(self.out_length):
+            for f in range(self.filters):
+                acc = self.bq[f]
+                base = pos * self.step
+                for i in range(self.window):
+                    acc += x[base + i] * self.wq[f * self.window + i]
+                acc = ((acc * self.mult) + (1 << (self.shift - 1))) >> self.shift
+                acc += self.out_zero
+                out.append(min(max(acc, self.act_min), self.act_max))
+        return out
+
+
+class Model(object):
+
+    def __init__(self, cfg):
+        self.name = cfg['name']
+        self.elem_bytes = {'s8': 1, 's16': 2}[cfg.get('activation', 's8')]
+        (self.qmin, self.qmax) = (-128, 127) if self.elem_bytes == 1 else (-32768, 32767)
+        length = cfg['input']['length']
+        channels = cfg['input']['channels']
+        self.in_size = length * channels
+        self.layers = []
+        for lcfg in cfg['layers']:
+            layer = Layer(lcfg, length, channels)
+            self.layers.append(layer)
+            (length, channels) = (layer.out_length, layer.filters)
+        self.out_size = self.layers[-1].out_size
+        self.calibration = [[float(v) for v in flatten(c)] for c in cfg['calibration']]
+        for c in self.calibration:
+            if len(c) != self.in_size:
+                raise ValueError('%s: calibration input of %d values instead of %d' % (self.name, len(c), self.in_size))
+        self.quantize()
+        self.plan_arena()
+
+    def qparams(self, values):
+        lo = min(min(values), 0.0)
+        hi = max(max(values), 0.0)
+        if hi == lo:
+            hi = lo + 1.0
+        if self.elem_bytes == 2:
+            return (max(abs(lo), abs(hi)) / 32767.0, 0)
+        scale = (hi - lo) / 255.0
+        return (scale, max(-128, min(127, round_half_up(-128 - lo / scale))))
+
+    def quantize(self):
+        tensors = [[] for _ in range(len(self.layers) + 1)]
+        for x in self.calibration:
+            tensors[0] += x
+            for (i, layer) in enumerate(self.layers):
+                x = layer.run_float(x)
+                tensors[i + 1] += x
+        self.qp = [self.qparams(t) for t in tensors]
+        for (i, layer) in enumerate(self.layers):
+            layer.quantize(self.qp[i], self.qp[i + 1], self.qmin, self.qmax)
+
+    def plan_arena(self):
+        """Tensor i is written by layer i - 1 and read by layer i, the model output stays alive."""
+        count = len(self.layers) + 1
+        sizes = [self.in_size * self.elem_bytes] + [l.out_size * self.elem_bytes for l in self.layers]
+        life = [(max(i - 1, 0), i if i < count - 1 else count) for i in range(count)]
+        self.offsets = [None] * count
+        for i in sorted(range(count), key=lambda t: -sizes[t]):
+            busy = sorted((self.offsets[j], self.offsets[j] + sizes[j]) for j in range(count)
+                          if self.offsets[j] is not None and life[j][0] <= life[i][1] and life[i][0] <= life[j][1])
+            offset = 0
+            for (lo, hi) in busy:
+                if offset + sizes[i] <= lo:
+                    break
+                offset = max(offset, (hi + ALIGN - 1) // ALIGN * ALIGN)
+            self.offsets[i] = offset
+        self.arena = max(o + s for (o, s) in zip(self.offsets, sizes))
+        self.naive = sum(sizes)
+
+    def quantize_input(self, x):
+        (scale, zero) = self.qp[0]
+        return [min(max(round_half_up(v / scale) + zero, self.qmin), self.qmax) for v in x]
+
+    def run_fixed(self, x):
+        q = self.quantize_input(x)
+        for layer in self.layers:
+            q = layer.run_fixed(q)
+        return q
+
+    def report(self):
+        (scale, zero) = self.qp[-1]
+        worst = 0.0
+        for x in self.calibration:
+            ref = x
+            for layer in self.layers:
+                ref = layer.run_float(ref)
+            out = [(q - zero) * scale for q in self.run_fixed(x)]
+            worst = max([worst] + [abs(a - b) for (a, b) in zip(out, ref)])
+        print('NeuralNet_%s: arena %d B (%d B without reuse), max error %.4f on %d calibration inputs'
+              % (self.name, self.arena, self.naive, worst, len(self.calibration)))
+        for (i, layer) in enumerate(self.layers):
+            print('  layer %d %-6s out %3dx%-3d %6d MACs %6d B weights' % (i, layer.type, layer.out_length,
+                                                                         layer.filters, layer.macs, len(layer.wq)))
+
+
+def banner(name, description):
+    lines = ['/' + '*' * 117 + '/',
+             '/*' + 'BSW GROUP'.center(115) + '*/',
+             '/' + '*' * 117 + '/',
+             '/*' + 'OBJECT SPECIFICATION'.center(115) + '*/',
+             '/' + '*' * 117 + '/',
+             '/*!',
+             ' * $Source: %s $' % name,
+             ' * $Revision: Version 1.0 $',
+             ' * $Author: Carlos Martinez $',
+             ' * $Date: 2026-10-17 $',
+             ' */',
+             '/' + '*' * 117 + '/',
+             '/* DESCRIPTION :'.ljust(117) + '*/',
+             '/** \\%s' % name]
+    lines += ['    ' + d for d in description]
+    lines += [' */',
+              '/' + '*' * 117 + '/',
+              '/* ALL RIGHTS RESERVED'.ljust(117) + '*/',
+              '/*'.ljust(117) + '*/',
+              '/* The reproduction, transmission, or use of this document or its content is'.ljust(117) + '*/',
+              '/* not permitted without express written authority. Offenders will be liable'.ljust(117) + '*/',
+              '/* for damages.'.ljust(117) + '*/',
+              '/' + '*' * 117 + '/']
+    return lines
+
+
+# Section banners as written by hand in the BSW sources
+SECTIONS = {
+    'Includes':
+        ('/*                                                       Includes                                                    */',
+         '/*********************************************************************************************************************/'),
+    'Constants and types':
+        ('/*                                                Constants and types                                                */',
+         '/*********************************************************************************************************************/'),
+    'Exported Variables':
+        ('/*                                                    Exported Variables                                              */',
+         '/**********************************************************************************************************************/'),
+    'Exported functions prototypes':
+        ('/*                                              Exported functions prototypes                                         */',
+         '/**********************************************************************************************************************/'),
+    'Variables':
+        ('/*                                                      Variables                                                    */',
+         '/*********************************************************************************************************************/'),
+}
+
+
+def section(title):
+    return [''] + list(SECTIONS[title])
+
+
+def log_table(name):
+    return ['',
+            '/***************************************************Log Projects' + '*' * 56,
+            ' *|    ID   | JIRA Ticket |     Date    |                                Description                                   |',
+            ' *| CMARTI  |  %s   | %s | %s|' % (JIRA, DATE, ('Generated %s' % name).ljust(77)),
+            '*' * 119 + '/']
+
+
+def gen_array(ctype, name, values, per_line):
+    out = ['static const %s %s[%du] =' % (ctype, name, len(values)), '{']
+    for i in range(0, len(values), per_line):
+        out.append('    ' + ' '.join('%s,' % v for v in values[i:i + per_line]))
+    out[-1] = out[-1][:-1]
+    out.append('};')
+    return out
+
+
+def gen_header(models):
+    out = banner('NeuralNet_Models.h', ['Models, generated by tools/NnConvert/nn_convert.py from NeuralNet_Models.json. Do not edit.'])
+    out += ['#ifndef NEURALNET_MODELS_H_', '#define NEURALNET_MODELS_H_']
+    out += section('Includes')[1:] + ['#include "NeuralNet.h"']
+    out += section('Constants and types')
+    for model in models:
+        (scale, zero) = model.qp[0]
+        out.append('/*NeuralNet_%s input: value = %.9g * (q - zero), zero = %d*/' % (model.name, scale, zero))
+        (scale, zero) = model.qp[-1]
+        out.append('/*NeuralNet_%s output: value = %.9g * (q - zero), zero = %d*/' % (model.name, scale, zero))
+        out.append('#define NEURALNET_%s_ARENA_BYTES    (%du)' % (model.name.upper(), model.arena))
+    out += section('Exported Variables')
+    for model in models:
+        out.append('extern const NeuralNet_ModelType NeuralNet_%s;' % model.name)
+    out += section('Exported functions prototypes')
+    out += ['', '#endif /* NEURALNET_MODELS_H_ */']
+    out += log_table('NeuralNet_Models.h')
+    return out
+
+
+def gen_source(models):
+    out = banner('NeuralNet_Models.c', ['Models, generated by tools/NnConvert/nn_convert.py from NeuralNet_Models.json. Do not edit.'])
+    out += section('Includes') + ['#include "NeuralNet_Models.h"']
+    out += section('Constants and types')
+    out += section('Variables')
+    for model in models:
+        name = model.name
+        for (i, layer) in enumerate(model.layers):
+            out += ['']
+            out += gen_array('s8bit', 'NeuralNet_%s_Weights%d' % (name, i), ['%d' % w for w in layer.wq], 16)
+            out += ['']
+            out += gen_array('s32bit', 'NeuralNet_%s_Bias%d' % (name, i), ['%d' % b for b in layer.bq], 8)
+        out += ['', 'static const NeuralNet_LayerType NeuralNet_%s_Layers[%du] =' % (name, len(model.layers)), '{']
+        rows = []
+        for (i, layer) in enumerate(model.layers):
+            rows.append('    { NeuralNet_%s_Weights%d, NeuralNet_%s_Bias%d, %du, %du, %du, %du, %du, %du,\n'
+                        '      %d, %du, %d, %d, %d, %du }'
+                        % (name, i, name, i, model.offsets[i], model.offsets[i + 1], layer.out_length, layer.filters,
+                           layer.window, layer.step, layer.mult, layer.shift, layer.out_zero, layer.act_min,
+                           layer.act_max, layer.macs))
+        out += [r + ',' for r in rows[:-1]] + [rows[-1], '};']
+        out += ['',
+                'const NeuralNet_ModelType NeuralNet_%s =' % name,
+                '{',
+                '    NeuralNet_%s_Layers, %du, %du, %du, %du, %du, %du, %du'
+                % (name, model.offsets[0], model.offsets[-1], model.arena, model.in_size, model.out_size,
+                   len(model.layers), model.elem_bytes),
+                '};']
+    out += log_table('NeuralNet_Models.c')
+    return out
+
+
+def check_config(models, directory):
+    """Models must fit the runtime configuration of NeuralNet_Cfg.h."""
+    path = os.path.join(directory, 'NeuralNet_Cfg.h')
+    if not os.path.exists(path):
+        return
+    with open(path) as f:
+        text = f.read()
+    arena = int(re.search(r'NEURALNET_CFG_ARENA_SIZE\s+\((\d+)u\)', text).group(1))
+    layers = int(re.search(r'NEURALNET_CFG_MAX_LAYERS\s+\((\d+)u\)', text).group(1))
+    for model in models:
+        if model.arena > arena or len(model.layers) > layers:
+            raise ValueError('NeuralNet_%s needs %d arena bytes and %d layers, NeuralNet_Cfg.h allows %d and %d'
+                             % (model.name, model.arena, len(model.layers), arena, layers))
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write('usage: nn_convert.py <NeuralNet_Models.json> <output directory>\n')
+        return 1
+
+    with open(argv[1]) as f:
+        models = [Model(cfg) for cfg in json.load(f)['models']]
+    for model in models:
+        model.report()
+    check_config(models, argv[2])
+
+    for (name, lines) in (('NeuralNet_Models.h', gen_header(models)), ('NeuralNet_Models.c', gen_source(models))):
+        with open(os.path.join(argv[2], name), 'w', newline='\n') as f:
+            f.write('\n'.join(lines) + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-010   | 17-Oct-2026 | First version of nn_convert.py                                               |
+########################################################################################################################
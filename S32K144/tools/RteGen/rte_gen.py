@@ -0,0 +1,249 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: rte_gen.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# rte_gen.py
+#    RTE generator. Reads the sender/receiver connection description (src/BSW/RTE/Rte_Cfg.json) and writes
+#    Rte.h / Rte.c. Every connection owns one statically placed buffer, Rte_Write_<Swc>_<Port> and
+#    Rte_Read_<Swc>_<Port> are static inline functions that access it directly, so the compiler resolves
+#    each port at compile time: no lookup tables and no intermediate copies.
+#
+#    "types" maps type names to C type definitions emitted in Rte.h, "includes" lists extra headers.
+#    Connection description:
+#      "name"        buffer name, unique
+#      "type"        C data type
+#      "init"        C initializer, default 0u (or {0} for byRef)
+#      "byRef"       true for structures: API passes pointers and gets Rte_WriteRef/Rte_Ref zero-copy access
+#      "consistency" "direct" (default): single buffer, for data that is read and written atomically or by
+#                    tasks that never preempt each other.
+#                    "double": two buffers and a write counter. The writer fills the idle buffer and
+#                    publishes it, readers retry when two writes happened during their copy. Consistent
+#                    across rates whatever the priorities are.
+#      "sender"      {"swc": ..., "port": ...}
+#      "receivers"   [{"swc": ..., "port": ...}, ...]
+#
+#    usage: rte_gen.py Rte_Cfg.json <output directory>
+########################################################################################################################
+import json
+import os
+import re
+import sys
+
+C_NAME = re.compile(r'^[A-Za-z_][A-Za-z0-9_]*$')
+JIRA = 'user-007'
+DATE = '17-Oct-2026'
+
+
+def banner(name, description):
+    lines = ['/' + '*' * 117 + '/',
+             '/*' + 'BSW GROUP'.center(115) + '*/',
+             '/' + '*' * 117 + '/',
+             '/*' + 'OBJECT SPECIFICATION'.center(115) + '*/',
+             '/' + '*' * 117 + '/',
+             '/*!',
+             ' * $Source: %s $' % name,
+             ' * $Revision: Version 1.0 $',
+             ' * $Author: Carlos Martinez $',
+             ' * $Date: 2026-10-17 $',
+             ' */',
+             '/' + '*' * 117 + '/',
+             '/* DESCRIPTION :'.ljust(117) + '*/',
+             '/** \\%s' % name]
+    lines += ['    ' + d for d in description]
+    lines += [' */',
+              '/' + '*' * 117 + '/',
+              '/* ALL RIGHTS RESERVED'.ljust(117) + '*/',
+              '/*'.ljust(117) + '*/',
+              '/* The reproduction, transmission, or use of this document or its content is'.ljust(117) + '*/',
+              '/* not permitted without express written authority. Offenders will be liable'.ljust(117) + '*/',
+              '/* for damages.'.ljust(117) + '*/',
+              '/' + '*' * 117 + '/']
+    return lines
+
+
+# Section banners as written by hand in the BSW sources
+SECTIONS = {
+    'Includes':
+        ('/*                                                       Includes                                                    */',
+         '/*********************************************************************************************************************/'),
+    'Constants and types':
+        ('/*                                                Constants and types                                                */',
+         '/*********************************************************************************************************************/'),
+    'Exported Variables':
+        ('/*                                                    Exported Variables                                              */',
+         '/**********************************************************************************************************************/'),
+    'Exported functions prototypes':
+        ('/*                                              Exported functions prototypes                                         */',
+         '/**********************************************************************************************************************/'),
+    'Variables':
+        ('/*                                                      Variables                                                    */',
+         '/*********************************************************************************************************************/'),
+    'Inline functions':
+        ('/*                                                 Inline functions                                                  */',
+         '/*********************************************************************************************************************/'),
+}
+
+
+def section(title):
+    return [''] + list(SECTIONS[title])
+
+
+def log_table(name):
+    return ['',
+            '/***************************************************Log Projects' + '*' * 56,
+            ' *|    ID   | JIRA Ticket |     Date    |                                Description                                   |',
+            ' *| CMARTI  |  %s   | %s | %s|' % (JIRA, DATE, ('Generated %s' % name).ljust(77)),
+            '*' * 119 + '/']
+
+
+def check(cfg):
+    names = set()
+    ports = set()
+    for con in cfg['connections']:
+        for key in ('name', 'type', 'sender', 'receivers'):
+            if key not in con:
+                raise ValueError('connection %s: missing "%s"' % (con.get('name', '?'), key))
+        if not C_NAME.match(con['name']) or con['name'] in names:
+            raise ValueError('connection name %s is not a unique C identifier' % con['name'])
+        names.add(con['name'])
+        if con.get('consistency', 'direct') not in ('direct', 'double'):
+            raise ValueError('connection %s: consistency must be direct or double' % con['name'])
+        for ep in [con['sender']] + con['receivers']:
+            port = '%s_%s' % (ep['swc'], ep['port'])
+            if not C_NAME.match(port) or port in ports:
+                raise ValueError('port %s is not a unique C identifier' % port)
+            ports.add(port)
+
+
+def gen_header(cfg):
+    out = banner('Rte.h', ['Runtime environment, generated by tools/RteGen/rte_gen.py from Rte_Cfg.json. Do not edit.',
+                           'Ports resolve at compile time to the connection buffers defined in Rte.c.'])
+    out += ['#ifndef RTE_H_', '#define RTE_H_']
+    out += section('Includes')[1:]
+    for inc in ['Std_Types.h', 'Core_CM4.h'] + cfg.get('includes', []):
+        out.append('#include "%s"' % inc)
+
+    out += section('Constants and types')
+    for (name, definition) in cfg.get('types', {}).items():
+        out.append('typedef %s %s;' % (definition, name))
+    out += section('Exported Variables')
+    for con in cfg['connections']:
+        if con.get('consistency', 'direct') == 'double':
+            out.append('extern %s Rte_Buf_%s[2u];' % (con['type'], con['name']))
+            out.append('extern volatile u32bit Rte_Seq_%s;' % con['name'])
+        else:
+            out.append('extern %s Rte_Buf_%s;' % (con['type'], con['name']))
+
+    out += section('Exported functions prototypes')
+    out += section('Inline functions')
+    for con in cfg['connections']:
+        out += gen_connection(con)
+    out += ['', '#endif /* RTE_H_ */']
+    out += log_table('Rte.h')
+    return out
+
+
+def gen_connection(con):
+    name = con['name']
+    ctype = con['type']
+    by_ref = con.get('byRef', False)
+    double = con.get('consistency', 'direct') == 'double'
+    snd = '%s_%s' % (con['sender']['swc'], con['sender']['port'])
+    arg = ('const %s * data' % ctype) if by_ref else ('%s data' % ctype)
+    val = '*data' if by_ref else 'data'
+    out = ['', '/*%s: %s -> %s%s*/' % (name, snd, ', '.join('%s_%s' % (r['swc'], r['port']) for r in con['receivers']),
+                                         ', double buffered' if double else '')]
+
+    if double:
+        out += ['static inline void Rte_Write_%s(%s)' % (snd, arg),
+                '{',
+                '    u32bit seq = Rte_Seq_%s;' % name,
+                '',
+                '    Rte_Buf_%s[(seq + 1u) & 1u] = %s;' % (name, val),
+                '    Core_StoreRelease(&Rte_Seq_%s, seq + 1u);' % name,
+                '}']
+    else:
+        out += ['static inline void Rte_Write_%s(%s)' % (snd, arg),
+                '{',
+                '    Rte_Buf_%s = %s;' % (name, val),
+                '}']
+        if by_ref:
+            out += ['', '/*In place write, no copy*/',
+                    'static inline %s * Rte_WriteRef_%s(void)' % (ctype, snd),
+                    '{',
+                    '    return &Rte_Buf_%s;' % name,
+                    '}']
+
+    for rcv in con['receivers']:
+        port = '%s_%s' % (rcv['swc'], rcv['port'])
+        out.append('')
+        if double:
+            out += ['static inline void Rte_Read_%s(%s * data)' % (port, ctype),
+                    '{',
+                    '    u32bit seq;',
+                    '',
+                    '    do',
+                    '    {',
+                    '        seq = Core_LoadAcquire(&Rte_Seq_%s);' % name,
+                    '        *data = Rte_Buf_%s[seq & 1u];' % name,
+                    '        Core_ReadFence();',
+                    '    } while ((Rte_Seq_%s - seq) > 1u);' % name,
+                    '}']
+        else:
+            out += ['static inline void Rte_Read_%s(%s * data)' % (port, ctype),
+                    '{',
+                    '    *data = Rte_Buf_%s;' % name,
+                    '}']
+            if by_ref:
+                out += ['', '/*In place read, no copy*/',
+                        'static inline const %s * Rte_Ref_%s(void)' % (ctype, port),
+                        '{',
+                        '    return &Rte_Buf_%s;' % name,
+                        '}']
+    return out
+
+
+def gen_source(cfg):
+    out = banner('Rte.c', ['Connection buffers, generated by tools/RteGen/rte_gen.py from Rte_Cfg.json. Do not edit.'])
+    out += section('Includes') + ['#include "Rte.h"']
+    out += section('Constants and types')
+    out += section('Variables')
+    for con in cfg['connections']:
+        init = con.get('init', '{0}' if con.get('byRef', False) else '0u')
+        if con.get('consistency', 'direct') == 'double':
+            out.append('%s Rte_Buf_%s[2u] = { %s, %s };' % (con['type'], con['name'], init, init))
+            out.append('volatile u32bit Rte_Seq_%s = 0u;' % con['name'])
+        else:
+            out.append('%s Rte_Buf_%s = %s;' % (con['type'], con['name'], init))
+    out += log_table('Rte.c')
+    return out
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write('usage: rte_gen.py <Rte_Cfg.json> <output directory>\n')
+        return 1
+
+    with open(argv[1]) as f:
+        cfg = json.load(f)
+    check(cfg)
+
+    for (name, lines) in (('Rte.h', gen_header(cfg)), ('Rte.c', gen_source(cfg))):
+        with open(os.path.join(argv[2], name), 'w', newline='\n') as f:
+            f.write('\n'.join(lines) + '\n')
+
+    print('%d connections generated' % len(cfg['connections']))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-007   | 17-Oct-2026 | First version of rte_gen.py                                                  |
+########################################################################################################################
@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: stack_usage.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# stack_usage.py
+#    Static worst case stack depth per entry point. Reads the .su (frame size of every function, -fstack-usage)
+#    and .ci (call graph, -fcallgraph-info=su) files next to the objects of a make STACK_USAGE=1 build and
+#    walks the deepest call path of every function nobody calls directly: Reset_Handler/main, the exception
+#    and interrupt handlers and the Os task bodies.
+#
+#    Handlers (*_Handler, *_IRQHandler) are charged the hardware exception frame on top of their call path.
+#    The main stack estimate is the Reset_Handler/main path plus every handler, i.e. all priorities nested,
+#    task bodies run on their own Os stacks (Os_TaskCreate stackWords, compare with Os_TaskStackUnused()).
+#
+#    Flags, the depth of a flagged entry point is NOT an upper bound:
+#      R  recursion, every cycle counted once
+#      I  indirect call without --indirect targets, function pointers are not followed
+#      D  dynamic frame (alloca, variable length array)
+#      U  callee without frame information (assembly, library, other build)
+#
+#    usage: stack_usage.py <object directory> [--isr-frame bytes] [--indirect caller=callee[,callee]]...
+#           --isr-frame   exception frame, 32 = basic (default), 104 = with FPU context (ENABLE_FPU)
+#           --indirect    targets of the function pointer calls made by caller, e.g. Os_PortStart=Task_10ms
+########################################################################################################################
+import os
+import re
+import sys
+
+INDIRECT = '__indirect_call'
+ISR_FRAME = 32                # Cortex-M4 basic exception frame: r0-r3, r12, lr, pc, xpsr
+HANDLER_SUFFIX = ('_Handler', '_IRQHandler')
+MAIN_ROOTS = ('Reset_Handler', 'main')
+
+NODE_RE = re.compile(r'node:\s*\{\s*title:\s*"([^"]*)"\s*label:\s*"([^"]*)"')
+EDGE_RE = re.compile(r'edge:\s*\{\s*sourcename:\s*"([^"]*)"\s*targetname:\s*"([^"]*)"')
+
+
+class Function(object):
+
+    def __init__(self, title):
+        self.title = title
+        self.name = title.split(':')[-1]
+        self.frame = None             # bytes, None = no .su information
+        self.dynamic = False
+        self.callees = set()
+        self.called = False
+
+
+def read_su(path, frames):
+    """<file>:<line>:<column>:<function>\t<bytes>\t<static|dynamic|dynamic,bounded>"""
+    with open(path) as f:
+        for line in f:
+            fields = line.rstrip('\n').split('\t')
+            if len(fields) == 3:
+                frames[fields[0]] = (int(fields[1]), fields[2] != 'static')
+
+
+def read_ci(path, frames, funcs):
+    with open(path) as f:
+        text = f.read()
+    for (title, label) in NODE_RE.findall(text):
+        func = funcs.setdefault(title, Function(title))
+        lines = label.split('\\n')
+        if len(lines) > 1:
+            #Definition: label is "<function>\n<file>:<line>:<column>\n...", same key as the .su line
+            key = '%s:%s' % (lines[1], lines[0])
+            if key in frames:
+                (func.frame, func.dynamic) = frames[key]
+        else:
+            #Declaration only, the definition (if any) comes from another .ci file
+            pass
+    for (source, target) in EDGE_RE.findall(text):
+        funcs.setdefault(source, Function(source)).callees.add(target)
+        funcs.setdefault(target, Function(target)).called = True
+
+
+def load(objdir):
+    frames = {}
+    funcs = {}
+    cis = []
+    for (root, dirs, files) in sorted(os.walk(objdir)):
+        for name in sorted(files):
+            if name.endswith('.su'):
+                read_su(os.path.join(root, name), frames)
+            elif name.endswith('.ci'):
+                cis.append(os.path.join(root, name))
+            else:
+                pass
+    for path in cis:
+        read_ci(path, frames, funcs)
+    return funcs
+
+
+def parse_indirect(args):
+    targets = {}
+    for arg in args:
+        (caller, callees) = arg.split('=', 1)
+        targets.setdefault(caller, set()).update(c for c in callees.split(',') if c)
+    return targets
+
+
+class Walker(object):
+    """Deepest path per function, memoized, a back edge to a function on the path is a cycle."""
+
+    def __init__(self, funcs, indirect):
+        self.funcs = funcs
+        self.indirect = indirect
+        self.memo = {}
+
+    def callees(self, func):
+        for title in sorted(func.callees):
+            if title == INDIRECT:
+                for target in sorted(self.indirect.get(func.name, ())):
+                    yield target
+            else:
+                yield title
+
+    def depth(self, title, path):
+        """Returns (bytes, flags, call path)."""
+        if title in self.memo:
+            result = self.memo[title]
+        elif title in path:
+            result = (0, set('R'), [])
+        elif title == INDIRECT:
+            result = (0, set('I'), [])
+        else:
+            func = self.funcs.get(title)
+            flags = set()
+            if func is None or func.frame is None:
+                flags.add('U')
+                frame = 0
+            else:
+                frame = func.frame
+                if func.dynamic:
+                    flags.add('D')
+                else:
+                    pass
+            if (func is not None) and (INDIRECT in func.callees) and (func.name not in self.indirect):
+                flags.add('I')
+            else:
+                pass
+            best = (0, [])
+            for callee in (self.callees(func) if func is not None else ()):
+                (size, sub_flags, sub_path) = self.depth(callee, path + [title])
+                flags |= sub_flags
+                if size > best[0] or not best[1]:
+                    best = (size, sub_path)
+                else:
+                    pass
+            result = (frame + best[0], flags, [(title, frame)] + best[1])
+            #A result inside a cycle depends on the path it was reached from, do not reuse it
+            if 'R' not in flags:
+                self.memo[title] = result
+            else:
+                pass
+        return result
+
+
+def entry_points(funcs):
+    """Defined functions nobody calls directly. Calls to an external function land on the bare name node,
+    which is also the title of its definition in the other .ci file."""
+    return sorted(t for (t, f) in funcs.items() if (not f.called) and f.frame is not None)
+
+
+def short(title):
+    """Static functions are titled <source path>:<function>, keep the file name only."""
+    (path, sep, name) = title.rpartition(':')
+    return os.path.basename(path) + sep + name
+
+
+def is_handler(name):
+    return name.endswith(HANDLER_SUFFIX) and name != 'Reset_Handler'
+
+
+def report(funcs, roots, walker, isr_frame):
+    results = []
+    for title in roots:
+        (size, flags, path) = walker.depth(title, [])
+        name = funcs[title].name
+        if is_handler(name):
+            size += isr_frame
+        else:
+            pass
+        results.append((title, name, size, flags, path))
+
+    print('%-40s %10s  %s' % ('Entry point', 'Worst case', 'Flags'))
+    for (title, name, size, flags, path) in sorted(results, key=lambda r: -r[2]):
+        print('%-40s %8u B  %s' % (short(title), size, ''.join(sorted(flags))))
+        print('    ' + ' > '.join('%s (%u)' % (funcs[t].name if t in funcs else t, s) for (t, s) in path))
+
+    main = [r for r in results if r[1] in MAIN_ROOTS]
+    main = [r for r in main if r[1] == MAIN_ROOTS[0]] or main
+    handlers = [r for r in results if is_handler(r[1])]
+    flags = set()
+    total = 0
+    for r in main[:1] + handlers:
+        total += r[2]
+        flags |= r[3]
+    print('')
+    print('Main stack worst case: %u B (%s + %u handlers, exception frame %u B)%s'
+          % (total, short(main[0][0]) if main else 'no main', len(handlers), isr_frame,
+             ', flags ' + ''.join(sorted(flags)) if flags else ''))
+    return 0
+
+
+def main(argv):
+    args = argv[1:]
+    if not args or args[0].startswith('--'):
+        sys.stderr.write('usage: stack_usage.py <object directory> [--isr-frame bytes] '
+                         '[--indirect caller=callee[,callee]]...\n')
+        return 1
+
+    objdir = args.pop(0)
+    isr_frame = ISR_FRAME
+    indirect = []
+    while args:
+        opt = args.pop(0)
+        if opt == '--isr-frame' and args:
+            isr_frame = int(args.pop(0), 0)
+        elif opt == '--indirect' and args:
+            indirect.append(args.pop(0))
+        else:
+            sys.stderr.write('stack_usage.py: unknown option %s\n' % opt)
+            return 1
+
+    funcs = load(objdir)
+    if not funcs:
+        sys.stderr.write('stack_usage.py: no .ci files in %s, build with make STACK_USAGE=1\n' % objdir)
+        return 1
+    walker = Walker(funcs, parse_indirect(indirect))
+    return report(funcs, entry_points(funcs), walker, isr_frame)
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-022   | 17-Oct-2026 | First version of stack_usage.py                                              |
+########################################################################################################################
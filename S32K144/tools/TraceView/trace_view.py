@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+########################################################################################################################
+# $Source: trace_view.py$
+# $Revision: Version 1.0 $
+# $Author: Carlos Martinez $
+# $Date: 2026-10-17 $
+########################################################################################################################
+# DESCRIPTION :
+# trace_view.py
+#    Decoder of the event trace recorder (src/BSW/Services/Trace). Reads a binary dump of Trace_Buffer and
+#    writes the timeline in the Chrome trace event format, opened by chrome://tracing and ui.perfetto.dev:
+#    one track per task (running slices between task switches), one per exception (ISR enter to exit,
+#    PendSV = bottom halves) and one for the user markers.
+#
+#    Events are read oldest first from the free running index. A slot whose lap does not match its index
+#    was claimed but not written when the dump was taken and is skipped. 32 bit timestamps are unwrapped
+#    from one event to the next, gaps of more than 2^31 clocks can not be told from a wrap.
+#
+#    --cfg   Trace_Cfg.h, marker names of TRACE_CFG_MARKS (default: mark <id>)
+#    --elf   target image, task names from the control block symbols (default: task P<priority>)
+#
+#    usage: trace_view.py trace.bin trace.json [--cfg Trace_Cfg.h] [--elf Project.elf]
+########################################################################################################################
+import json
+import re
+import struct
+import sys
+
+TRACE_MAGIC = 0x45435254
+HEADER = struct.Struct('<5I')
+EVENT = struct.Struct('<2I')
+
+EVENT_NONE = 0
+EVENT_ISR_ENTER = 1
+EVENT_ISR_EXIT = 2
+EVENT_TASK = 3
+EVENT_MARK = 4
+
+EXCEPTIONS = {2: 'NMI', 3: 'HardFault', 4: 'MemManage', 5: 'BusFault', 6: 'UsageFault', 11: 'SVCall',
+              12: 'DebugMonitor', 14: 'PendSV', 15: 'SysTick'}
+
+# Track ids, sorted by the viewer: markers on top, then the exceptions, then the tasks
+TID_MARKS = 1
+TID_ISR = 100
+TID_TASK = 1000
+
+# RAM of S32K144_flash.ld, control blocks are looked up there by the low half of their address
+RAM = (0x1FFF8000, 0x20007000)
+
+SHT_SYMTAB = 2
+STT_OBJECT = 1
+
+
+def read_marks(path):
+    """Marker names in TRACE_CFG_MARKS order, the Trace_MarkType values."""
+    names = []
+    inside = False
+    with open(path) as f:
+        for line in f:
+            if line.startswith('#define TRACE_CFG_MARKS('):
+                inside = True
+            elif inside:
+                names += re.findall(r'MARK\((\w+)\)', line)
+            else:
+                pass
+            if inside and not line.rstrip().endswith('\\'):
+                inside = False
+    return names
+
+
+def read_tasks(path):
+    """{address low half: name} of the RAM objects of an ELF32 image, {} for other files (host builds)."""
+    with open(path, 'rb') as f:
+        raw = f.read()
+    tasks = {}
+    if raw[:4] == b'\x7fELF' and raw[4] == 1 and raw[5] == 1:
+        shoff = struct.unpack_from('<I', raw, 0x20)[0]
+        (shentsize, shnum) = struct.unpack_from('<HH', raw, 0x2E)
+        headers = [struct.unpack_from('<10I', raw, shoff + i * shentsize) for i in range(shnum)]
+        for sh in headers:
+            if sh[1] != SHT_SYMTAB:
+                continue
+            strings = headers[sh[6]][4]
+            for off in range(sh[4], sh[4] + sh[5], sh[9]):
+                (name, value, size, info) = struct.unpack_from('<IIIB', raw, off)
+                if (info & 0x0F) == STT_OBJECT and RAM[0] <= value < RAM[1]:
+                    start = strings + name
+                    tasks[value & 0xFFFF] = raw[start:raw.index(b'\0', start)].decode()
+                else:
+                    pass
+    else:
+        sys.stderr.write('trace_view.py: %s is not an ELF32 image, tasks are named by priority\n' % path)
+    return tasks
+
+
+def decode(raw):
+    """(clock Hz, [(time, type, id, data)] oldest first with unwrapped time, skipped slots)."""
+    (magic, count, clock, index, stopped) = HEADER.unpack_from(raw, 0)
+    if magic != TRACE_MAGIC:
+        raise ValueError('no Trace_Buffer (magic 0x%08X), Trace_Init not called?' % magic)
+    if count == 0 or (count & (count - 1)) != 0 or len(raw) < HEADER.size + count * EVENT.size:
+        raise ValueError('dump of %u bytes does not hold %u events' % (len(raw), count))
+
+    shift = count.bit_length() - 1
+    events = []
+    skipped = 0
+    last = None
+    now = 0
+    for position in range(max(0, index - count), index):
+        (time, info) = EVENT.unpack_from(raw, HEADER.size + (position & (count - 1)) * EVENT.size)
+        etype = info >> 28
+        if etype == EVENT_NONE or ((info >> 24) & 0xF) != ((position >> shift) & 0xF):
+            skipped += 1
+            continue
+        if last is not None:
+            delta = (time - last) & 0xFFFFFFFF
+            now += delta - 0x100000000 if delta >= 0x80000000 else delta
+        last = time
+        events.append((now, etype, (info >> 16) & 0xFF, info & 0xFFFF))
+    #Index order is time order on target, keep it for equal times (stable)
+    events.sort(key=lambda e: e[0])
+    return clock, events, skipped
+
+
+def exception_name(number):
+    return EXCEPTIONS.get(number, 'IRQ %u' % (number - 16) if number >= 16 else 'exception %u' % number)
+
+
+def timeline(clock, events, marks, tasks):
+    """Chrome trace events, complete slices ('X') in microseconds from the first event."""
+    out = []
+    names = {TID_MARKS: 'Markers'}
+    start = events[0][0] if events else 0
+    end = events[-1][0] if events else 0
+
+    def us(t):
+        return (t - start) * 1e6 / clock
+
+    def add_slice(tid, name, begin, finish, args):
+        out.append({'name': name, 'ph': 'X', 'pid': 1, 'tid': tid, 'ts': us(begin),
+                    'dur': us(finish) - us(begin), 'args': args})
+
+    running = None
+    open_isr = {}
+    unmatched = 0
+    for (t, etype, eid, data) in events:
+        if etype == EVENT_TASK:
+            if running is not None:
+                add_slice(*running[:2], begin=running[2], finish=t, args=running[3])
+            name = tasks.get(data, 'task P%u' % eid)
+            tid = TID_TASK + ((31 - eid) << 16) + data
+            names[tid] = name
+            running = (tid, name, t, {'priority': eid, 'tcb': '0x%04X' % data})
+        elif etype == EVENT_ISR_ENTER:
+            open_isr.setdefault(eid, []).append(t)
+            names[TID_ISR + eid] = exception_name(eid)
+        elif etype == EVENT_ISR_EXIT:
+            if open_isr.get(eid):
+                add_slice(TID_ISR + eid, exception_name(eid), open_isr[eid].pop(), t, {'exception': eid})
+            else:
+                #Its enter was overwritten
+                unmatched += 1
+        elif etype == EVENT_MARK:
+            name = marks[eid] if eid < len(marks) else 'mark %u' % eid
+            out.append({'name': name, 'ph': 'i', 's': 't', 'pid': 1, 'tid': TID_MARKS, 'ts': us(t),
+                        'args': {'value': data}})
+        else:
+            unmatched += 1
+    #Still running or inside an ISR when the dump was taken
+    if running is not None:
+        add_slice(*running[:2], begin=running[2], finish=end, args=running[3])
+    for (eid, begins) in sorted(open_isr.items()):
+        for begin in begins:
+            add_slice(TID_ISR + eid, exception_name(eid), begin, end, {'exception': eid, 'open': True})
+
+    meta = [{'name': 'process_name', 'ph': 'M', 'pid': 1, 'args': {'name': 'S32K144'}}]
+    for (tid, name) in sorted(names.items()):
+        meta.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': tid, 'args': {'name': name}})
+        meta.append({'name': 'thread_sort_index', 'ph': 'M', 'pid': 1, 'tid': tid, 'args': {'sort_index': tid}})
+    return meta + out, unmatched, us(end)
+
+
+def main(argv):
+    args = argv[1:]
+    if len(args) < 2 or args[0].startswith('--') or args[1].startswith('--'):
+        sys.stderr.write('usage: trace_view.py trace.bin trace.json [--cfg Trace_Cfg.h] [--elf Project.elf]\n')
+        return 1
+
+    (dump, output) = args[:2]
+    args = args[2:]
+    marks = []
+    tasks = {}
+    while args:
+        opt = args.pop(0)
+        if opt == '--cfg' and args:
+            marks = read_marks(args.pop(0))
+        elif opt == '--elf' and args:
+            tasks = read_tasks(args.pop(0))
+        else:
+            sys.stderr.write('trace_view.py: unknown option %s\n' % opt)
+            return 1
+
+    with open(dump, 'rb') as f:
+        (clock, events, skipped) = decode(f.read())
+    (trace, unmatched, span) = timeline(clock, events, marks, tasks)
+    with open(output, 'w', newline='\n') as f:
+        json.dump({'traceEvents': trace, 'displayTimeUnit': 'ns',
+                   'otherData': {'clockHz': clock}}, f, indent=0)
+        f.write('\n')
+
+    print('%u events over %.1f us (%u Hz clock), %u unwritten slots skipped, %u ISR exits without enter'
+          % (len(events), span, clock, skipped, unmatched))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
+
+########################################################################################################################
+ #|    ID   | JIRA Ticket |     Date    |                                       Description                            |
+ #| CMARTI  |  user-025   | 17-Oct-2026 | First version of trace_view.py                                               |
+########################################################################################################################